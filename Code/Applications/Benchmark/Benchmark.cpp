@@ -0,0 +1,252 @@
+#include "Benchmark.h"
+#include "System/Serialization/JsonSerialization.h"
+#include "System/Time/Timers.h"
+#include "System/Math/Math.h"
+#include "System/Log.h"
+#include <eastl/sort.h>
+#include <iostream>
+#include <cmath>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmark
+{
+    constexpr static char const* const g_resultsKey = "Results";
+    constexpr static char const* const g_nameKey = "Name";
+    constexpr static char const* const g_numSamplesKey = "NumSamples";
+    constexpr static char const* const g_numOperationsPerSampleKey = "NumOperationsPerSample";
+    constexpr static char const* const g_minKey = "MinNs";
+    constexpr static char const* const g_medianKey = "MedianNs";
+    constexpr static char const* const g_meanKey = "MeanNs";
+    constexpr static char const* const g_p99Key = "P99Ns";
+    constexpr static char const* const g_standardDeviationKey = "StdDevNs";
+
+    //-------------------------------------------------------------------------
+
+    // Get the value at the specified percentile from a sorted set of samples (nearest rank)
+    static double GetPercentile( TVector<double> const& sortedSamples, float percentile )
+    {
+        EE_ASSERT( !sortedSamples.empty() );
+        EE_ASSERT( percentile >= 0.0f && percentile <= 1.0f );
+
+        int32_t const numSamples = (int32_t) sortedSamples.size();
+        int32_t const rank = (int32_t) std::ceil( percentile * numSamples ) - 1;
+        return sortedSamples[Math::Clamp( rank, 0, numSamples - 1 )];
+    }
+
+    //-------------------------------------------------------------------------
+
+    void Runner::AddBenchmark( Benchmark const& benchmark )
+    {
+        EE_ASSERT( !benchmark.m_name.empty() && benchmark.m_runFunction != nullptr );
+        EE_ASSERT( benchmark.m_numOperationsPerSample > 0 );
+
+        #if EE_DEVELOPMENT_TOOLS
+        for ( auto const& existingBenchmark : m_benchmarks )
+        {
+            EE_ASSERT( existingBenchmark.m_name != benchmark.m_name );
+        }
+        #endif
+
+        m_benchmarks.emplace_back( benchmark );
+    }
+
+    void Runner::Run()
+    {
+        m_results.clear();
+        m_failedBenchmarks.clear();
+
+        for ( auto const& benchmark : m_benchmarks )
+        {
+            if ( !m_settings.m_filter.empty() && benchmark.m_name.find( m_settings.m_filter ) == String::npos )
+            {
+                continue;
+            }
+
+            std::cout << " * " << benchmark.m_name.c_str() << "... ";
+
+            Result result;
+            if ( !RunBenchmark( benchmark, result ) )
+            {
+                std::cout << "FAILED VALIDATION" << std::endl;
+                m_failedBenchmarks.emplace_back( benchmark.m_name );
+                continue;
+            }
+
+            m_results.emplace_back( result );
+            std::cout << "median: " << result.m_median << "ns, min: " << result.m_min << "ns, p99: " << result.m_p99 << "ns" << std::endl;
+        }
+    }
+
+    bool Runner::RunBenchmark( Benchmark const& benchmark, Result& outResult ) const
+    {
+        EE_ASSERT( m_settings.m_numSamples > 0 );
+
+        if ( benchmark.m_setupFunction != nullptr )
+        {
+            benchmark.m_setupFunction();
+        }
+
+        // Validation - there is no point in timing an operation that produces the wrong results
+        //-------------------------------------------------------------------------
+
+        if ( benchmark.m_validateFunction != nullptr && !benchmark.m_validateFunction() )
+        {
+            if ( benchmark.m_teardownFunction != nullptr )
+            {
+                benchmark.m_teardownFunction();
+            }
+
+            return false;
+        }
+
+        // Warm-up - ensure caches, allocators and branch predictors are in a steady state
+        //-------------------------------------------------------------------------
+
+        for ( auto i = 0; i < m_settings.m_numWarmupIterations; i++ )
+        {
+            benchmark.m_runFunction();
+        }
+
+        // Record samples
+        //-------------------------------------------------------------------------
+
+        TVector<double> samples;
+        samples.reserve( m_settings.m_numSamples );
+
+        for ( auto sampleIdx = 0; sampleIdx < m_settings.m_numSamples; sampleIdx++ )
+        {
+            Timer<PlatformClock> timer;
+            for ( auto opIdx = 0; opIdx < benchmark.m_numOperationsPerSample; opIdx++ )
+            {
+                benchmark.m_runFunction();
+            }
+            Nanoseconds const elapsedTime = timer.GetElapsedTimeNanoseconds();
+            samples.emplace_back( double( elapsedTime.ToU64() ) / benchmark.m_numOperationsPerSample );
+        }
+
+        if ( benchmark.m_teardownFunction != nullptr )
+        {
+            benchmark.m_teardownFunction();
+        }
+
+        // Calculate statistics
+        //-------------------------------------------------------------------------
+
+        eastl::sort( samples.begin(), samples.end() );
+
+        outResult.m_name = benchmark.m_name;
+        outResult.m_numSamples = m_settings.m_numSamples;
+        outResult.m_numOperationsPerSample = benchmark.m_numOperationsPerSample;
+        outResult.m_min = samples.front();
+        outResult.m_median = GetPercentile( samples, 0.5f );
+        outResult.m_p99 = GetPercentile( samples, 0.99f );
+
+        double total = 0.0;
+        for ( auto sample : samples )
+        {
+            total += sample;
+        }
+        outResult.m_mean = total / samples.size();
+
+        double variance = 0.0;
+        for ( auto sample : samples )
+        {
+            double const delta = sample - outResult.m_mean;
+            variance += delta * delta;
+        }
+        outResult.m_standardDeviation = std::sqrt( variance / samples.size() );
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool Runner::WriteResultsToFile( FileSystem::Path const& outputPath ) const
+    {
+        Serialization::JsonArchiveWriter archive;
+        auto pWriter = archive.GetWriter();
+
+        pWriter->StartObject();
+        pWriter->Key( g_resultsKey );
+        pWriter->StartArray();
+
+        for ( auto const& result : m_results )
+        {
+            pWriter->StartObject();
+            pWriter->Key( g_nameKey );
+            pWriter->String( result.m_name.c_str() );
+            pWriter->Key( g_numSamplesKey );
+            pWriter->Int( result.m_numSamples );
+            pWriter->Key( g_numOperationsPerSampleKey );
+            pWriter->Int( result.m_numOperationsPerSample );
+            pWriter->Key( g_minKey );
+            pWriter->Double( result.m_min );
+            pWriter->Key( g_medianKey );
+            pWriter->Double( result.m_median );
+            pWriter->Key( g_meanKey );
+            pWriter->Double( result.m_mean );
+            pWriter->Key( g_p99Key );
+            pWriter->Double( result.m_p99 );
+            pWriter->Key( g_standardDeviationKey );
+            pWriter->Double( result.m_standardDeviation );
+            pWriter->EndObject();
+        }
+
+        pWriter->EndArray();
+        pWriter->EndObject();
+
+        return archive.WriteToFile( outputPath );
+    }
+
+    bool Runner::CompareAgainstBaseline( FileSystem::Path const& baselinePath, TVector<Comparison>& outComparisons ) const
+    {
+        outComparisons.clear();
+
+        Serialization::JsonArchiveReader archive;
+        if ( !archive.ReadFromFile( baselinePath ) )
+        {
+            EE_LOG_ERROR( "Benchmark", "Baseline", "Failed to read baseline file: %s", baselinePath.c_str() );
+            return false;
+        }
+
+        auto const& document = archive.GetDocument();
+        auto const resultsIter = document.FindMember( g_resultsKey );
+        if ( resultsIter == document.MemberEnd() || !resultsIter->value.IsArray() )
+        {
+            EE_LOG_ERROR( "Benchmark", "Baseline", "Invalid baseline file: %s", baselinePath.c_str() );
+            return false;
+        }
+
+        //-------------------------------------------------------------------------
+
+        bool hasRegressions = false;
+
+        for ( auto const& baselineResult : resultsIter->value.GetArray() )
+        {
+            auto const nameIter = baselineResult.FindMember( g_nameKey );
+            auto const medianIter = baselineResult.FindMember( g_medianKey );
+            if ( nameIter == baselineResult.MemberEnd() || medianIter == baselineResult.MemberEnd() )
+            {
+                continue;
+            }
+
+            // Benchmarks that were not run (filtered or removed) are not compared
+            auto const currentResultIter = eastl::find_if( m_results.begin(), m_results.end(), [&nameIter] ( Result const& result ) { return result.m_name == nameIter->value.GetString(); } );
+            if ( currentResultIter == m_results.end() )
+            {
+                continue;
+            }
+
+            Comparison& comparison = outComparisons.emplace_back();
+            comparison.m_name = currentResultIter->m_name;
+            comparison.m_baselineMedian = medianIter->value.GetDouble();
+            comparison.m_currentMedian = currentResultIter->m_median;
+            comparison.m_relativeChange = ( comparison.m_baselineMedian > 0.0 ) ? float( ( comparison.m_currentMedian - comparison.m_baselineMedian ) / comparison.m_baselineMedian ) : 0.0f;
+            comparison.m_isRegression = comparison.m_relativeChange > m_settings.m_regressionThreshold;
+            hasRegressions |= comparison.m_isRegression;
+        }
+
+        return !hasRegressions;
+    }
+}
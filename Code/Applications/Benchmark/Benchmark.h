@@ -0,0 +1,127 @@
+#pragma once
+
+#include "System/FileSystem/FileSystemPath.h"
+#include "System/Types/Function.h"
+#include "System/Types/String.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Microbenchmark Harness
+//-------------------------------------------------------------------------
+// Each benchmark is a named operation that is timed in batches (samples)
+// after a warm-up phase. The per-operation timings of all samples are used
+// to calculate the min/median/mean/p99 statistics for that benchmark.
+//
+// Results can be written out as JSON and compared against a previously
+// stored baseline, any benchmark whose median regressed by more than the
+// allowed threshold is flagged as a regression.
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmark
+{
+    struct Settings
+    {
+        int32_t                             m_numWarmupIterations = 100;
+        int32_t                             m_numSamples = 50;
+        float                               m_regressionThreshold = 0.1f; // Allowed relative increase of the median before we flag a regression
+        String                              m_filter; // Only run benchmarks whose name contains this string
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct Benchmark
+    {
+        String                              m_name;
+        TFunction<void()>                   m_setupFunction; // Optional: called once before the warm-up
+        TFunction<void()>                   m_runFunction; // The operation to time
+        TFunction<bool()>                   m_validateFunction; // Optional: called after the setup to check that the operation produces the correct results, failed benchmarks are not timed
+        TFunction<void()>                   m_teardownFunction; // Optional: called once after all samples have been recorded
+        int32_t                             m_numOperationsPerSample = 1; // How many times to run the operation per timed sample
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct Result
+    {
+        String                              m_name;
+        int32_t                             m_numSamples = 0;
+        int32_t                             m_numOperationsPerSample = 0;
+
+        // All timings are per operation, in nanoseconds
+        double                              m_min = 0.0;
+        double                              m_median = 0.0;
+        double                              m_mean = 0.0;
+        double                              m_p99 = 0.0;
+        double                              m_standardDeviation = 0.0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct Comparison
+    {
+        String                              m_name;
+        double                              m_baselineMedian = 0.0;
+        double                              m_currentMedian = 0.0;
+        float                               m_relativeChange = 0.0f; // ( current - baseline ) / baseline
+        bool                                m_isRegression = false;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class Runner
+    {
+    public:
+
+        Runner( Settings const& settings ) : m_settings( settings ) {}
+
+        // Register a new benchmark
+        void AddBenchmark( Benchmark const& benchmark );
+
+        // Helper to register a simple benchmark with no setup/teardown
+        inline void AddBenchmark( char const* pName, int32_t numOperationsPerSample, TFunction<void()>&& runFunction )
+        {
+            Benchmark benchmark;
+            benchmark.m_name = pName;
+            benchmark.m_runFunction = eastl::move( runFunction );
+            benchmark.m_numOperationsPerSample = numOperationsPerSample;
+            AddBenchmark( benchmark );
+        }
+
+        // Run all registered benchmarks that match the filter
+        void Run();
+
+        // Get the results of the last run
+        inline TVector<Result> const& GetResults() const { return m_results; }
+
+        // Get the names of all the benchmarks that failed their validation in the last run
+        inline TVector<String> const& GetFailedBenchmarks() const { return m_failedBenchmarks; }
+
+        // Write the results of the last run as JSON
+        bool WriteResultsToFile( FileSystem::Path const& outputPath ) const;
+
+        // Compare the results of the last run against a stored baseline, returns false if the baseline is invalid or any regressions were detected
+        bool CompareAgainstBaseline( FileSystem::Path const& baselinePath, TVector<Comparison>& outComparisons ) const;
+
+    private:
+
+        // Returns false if the benchmark failed its validation
+        bool RunBenchmark( Benchmark const& benchmark, Result& outResult ) const;
+
+    private:
+
+        Settings                            m_settings;
+        TVector<Benchmark>                  m_benchmarks;
+        TVector<Result>                     m_results;
+        TVector<String>                     m_failedBenchmarks;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Prevent the compiler from optimizing away the result of a benchmarked operation
+    template<typename T>
+    EE_FORCE_INLINE void DoNotOptimize( T const& value )
+    {
+        static void const* volatile s_pSink = nullptr;
+        s_pSink = &value;
+    }
+}
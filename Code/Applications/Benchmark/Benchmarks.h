@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Benchmark.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class TaskSystem;
+    namespace TypeSystem { class TypeRegistry; }
+}
+
+//-------------------------------------------------------------------------
+// Benchmark Registration
+//-------------------------------------------------------------------------
+// All benchmarks are grouped by the module that they test
+
+namespace EE::Benchmark
+{
+    struct Context
+    {
+        TypeSystem::TypeRegistry const*     m_pTypeRegistry = nullptr;
+        TaskSystem*                         m_pTaskSystem = nullptr;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Serialization, StringID, AABBTree, HashMaps, TaskSystem
+    void RegisterSystemBenchmarks( Runner& runner, Context const& context );
+
+    // TypeDescriptor instantiation, pose sampling and blending
+    void RegisterEngineBenchmarks( Runner& runner, Context const& context );
+}
@@ -0,0 +1,637 @@
+#include "Benchmarks.h"
+#include "Engine/Animation/ResourceLoaders/AnimationSkeletonLoader.h"
+#include "Engine/Animation/AnimationSkeleton.h"
+#include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/AnimationBlender.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_ValueProgram.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Bools.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Floats.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Parameters.h"
+#include "Engine/Render/Components/Component_StaticMesh.h"
+#include "System/Resource/ResourceHeader.h"
+#include "System/Resource/ResourceRecord.h"
+#include "System/TypeSystem/TypeDescriptors.h"
+#include "System/TypeSystem/TypeRegistry.h"
+#include "System/Serialization/BinarySerialization.h"
+#include "System/Algorithm/Quantization.h"
+#include "System/Math/MathRandom.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmark
+{
+    using namespace EE::Animation;
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        constexpr static int32_t const g_numSkeletonBones = 128;
+        constexpr static int32_t const g_numTypeInstances = 64;
+
+        // A single bone track with two quantized key-frames, laid out the same way as the compressed clip data
+        struct KeyFrameTrack
+        {
+            Quantization::EncodedQuaternion     m_rotations[2];
+            uint16_t                            m_translations[2][3];
+            float                               m_translationRangeStart = -1.0f;
+            float                               m_translationRangeLength = 2.0f;
+        };
+
+        //-------------------------------------------------------------------------
+
+        // Creates a synthetic skeleton through the regular resource loader so that we dont need any compiled data on disk
+        class SyntheticSkeleton
+        {
+        public:
+
+            SyntheticSkeleton()
+                : m_resourceRecord( ResourceID( "data://Benchmark/Benchmark.skel" ) )
+            {
+                Math::RNG rng( 1234 );
+
+                TVector<StringID> boneIDs;
+                TVector<Transform> localReferencePose;
+                TVector<int32_t> parentIndices;
+                TVector<TBitFlags<BoneFlags>> boneFlags;
+
+                for ( auto i = 0; i < g_numSkeletonBones; i++ )
+                {
+                    boneIDs.emplace_back( StringID( String( String::CtorSprintf(), "Bone_%d", i ) ) );
+                    localReferencePose.emplace_back( Transform( Quaternion( EulerAngles( rng.GetFloat( -45.0f, 45.0f ), rng.GetFloat( -45.0f, 45.0f ), rng.GetFloat( -45.0f, 45.0f ) ) ), Vector( 0.0f, 0.0f, 0.1f ) ) );
+
+                    // Branchy hierarchy i.e. each bone has up to 3 children
+                    parentIndices.emplace_back( ( i == 0 ) ? InvalidIndex : ( i - 1 ) / 3 );
+                    boneFlags.emplace_back();
+                }
+
+                // Serialize in the same layout as the skeleton compiler
+                Serialization::BinaryOutputArchive archive;
+                archive << Resource::ResourceHeader( 0, Skeleton::GetStaticResourceTypeID() );
+                archive << boneIDs << localReferencePose << parentIndices << boneFlags;
+
+                Blob skeletonData;
+                archive.GetAsBinaryBlob( skeletonData );
+
+                bool const loadResult = m_loader.Load( m_resourceRecord.GetResourceID(), skeletonData, &m_resourceRecord );
+                EE_ASSERT( loadResult );
+                m_resourceRecord.SetLoadingStatus( LoadingStatus::Loaded );
+            }
+
+            ~SyntheticSkeleton()
+            {
+                m_resourceRecord.SetLoadingStatus( LoadingStatus::Unloading );
+                m_loader.Unload( m_resourceRecord.GetResourceID(), &m_resourceRecord );
+            }
+
+            inline Skeleton const* GetSkeleton() const { return static_cast<Skeleton const*>( m_resourceRecord.GetResourceData() ); }
+
+        private:
+
+            SkeletonLoader                      m_loader;
+            Resource::ResourceRecord            m_resourceRecord;
+        };
+
+        //-------------------------------------------------------------------------
+
+        struct PoseBenchmarkState
+        {
+            PoseBenchmarkState()
+                : m_sourcePose( m_skeleton.GetSkeleton() )
+                , m_targetPose( m_skeleton.GetSkeleton() )
+                , m_resultPose( m_skeleton.GetSkeleton() )
+            {
+                Math::RNG rng( 5678 );
+
+                int32_t const numBones = m_skeleton.GetSkeleton()->GetNumBones();
+                m_keyFrameTracks.resize( numBones );
+                for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    auto& track = m_keyFrameTracks[boneIdx];
+                    for ( auto keyIdx = 0; keyIdx < 2; keyIdx++ )
+                    {
+                        Quaternion const rotation( EulerAngles( rng.GetFloat( -90.0f, 90.0f ), rng.GetFloat( -90.0f, 90.0f ), rng.GetFloat( -90.0f, 90.0f ) ) );
+                        track.m_rotations[keyIdx] = Quantization::EncodedQuaternion( rotation );
+
+                        for ( auto axisIdx = 0; axisIdx < 3; axisIdx++ )
+                        {
+                            track.m_translations[keyIdx][axisIdx] = Quantization::EncodeFloat( rng.GetFloat( -1.0f, 1.0f ), track.m_translationRangeStart, track.m_translationRangeLength );
+                        }
+                    }
+
+                    m_targetPose.SetRotation( boneIdx, Quaternion( EulerAngles( rng.GetFloat( -90.0f, 90.0f ), 0.0f, 0.0f ) ) );
+                }
+            }
+
+            SyntheticSkeleton                   m_skeleton;
+            TVector<KeyFrameTrack>              m_keyFrameTracks;
+            Pose                                m_sourcePose;
+            Pose                                m_targetPose;
+            Pose                                m_resultPose;
+            float                               m_time = 0.0f;
+        };
+
+        static PoseBenchmarkState* g_pPoseState = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        struct TypeDescriptorBenchmarkState
+        {
+            TypeSystem::TypeDescriptor          m_descriptor;
+            TypeSystem::TypeInfo const*         m_pTypeInfo = nullptr;
+            TVector<IRegisteredType*>           m_createdInstances;
+        };
+
+        static TypeDescriptorBenchmarkState* g_pTypeDescriptorState = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        // A value node network and its value programs, the programs are hand-assembled the same way the graph compiler would emit them (the compiler lives in the tools module)
+        struct ValueNodeNetworkState
+        {
+            ValueNodeNetworkState()
+                : m_taskSystem( m_skeleton.GetSkeleton() )
+                , m_context( 1, m_skeleton.GetSkeleton() )
+            {}
+
+            ~ValueNodeNetworkState()
+            {
+                m_pRootNode->Shutdown( m_context );
+                m_context.m_pValueProgramInterpreter = nullptr;
+                m_context.Shutdown();
+                m_interpreter.Shutdown();
+
+                for ( auto pNode : m_nodes )
+                {
+                    pNode->~GraphNode();
+                    EE::Free( pNode );
+                }
+
+                for ( auto pSettings : m_nodeSettings )
+                {
+                    EE::Delete( pSettings );
+                }
+            }
+
+            template<typename T>
+            typename T::Settings* CreateNode()
+            {
+                auto pSettings = EE::New<typename T::Settings>();
+                pSettings->m_nodeIdx = (int16_t) m_nodeSettings.size();
+                m_nodeSettings.emplace_back( pSettings );
+                m_nodes.emplace_back( reinterpret_cast<GraphNode*>( EE::Alloc( sizeof( T ), alignof( T ) ) ) );
+                return pSettings;
+            }
+
+            // Instantiate all the nodes and initialize the root node, called once all the nodes and programs have been created
+            void Initialize( int16_t rootNodeIdx )
+            {
+                TInlineVector<GraphInstance*, 20> const childGraphInstances;
+                TFlatHashMap<StringID, int16_t> const parameterLookupMap;
+                InstantiationContext const instantiationContext = { m_nodes, childGraphInstances, parameterLookupMap, nullptr, 1 };
+                for ( auto pSettings : m_nodeSettings )
+                {
+                    pSettings->InstantiateNode( instantiationContext, InstantiationOptions::CreateNode );
+                }
+
+                m_interpreter.Initialize( &m_programs, m_nodes.data() );
+
+                m_context.Initialize( &m_taskSystem );
+                m_context.m_pValueProgramInterpreter = &m_interpreter;
+
+                m_pRootNode = static_cast<ValueNode*>( m_nodes[rootNodeIdx] );
+                m_pRootNode->Initialize( m_context );
+            }
+
+            template<typename T>
+            inline void SetParameterValue( int16_t nodeIdx, T value ) { static_cast<ValueNode*>( m_nodes[nodeIdx] )->SetValue<T>( value ); }
+
+            // Start a new graph update, all cached node and program results are invalidated
+            inline void StartUpdate() { m_context.Update( 1.0f / 60.0f, Transform::Identity, nullptr ); }
+
+            SyntheticSkeleton                   m_skeleton;
+            Animation::TaskSystem               m_taskSystem;
+            GraphContext                        m_context;
+            TVector<GraphNode::Settings*>       m_nodeSettings;
+            TVector<GraphNode*>                 m_nodes;
+            GraphValuePrograms                  m_programs;
+            ValueProgramInterpreter             m_interpreter;
+            ValueNode*                          m_pRootNode = nullptr;
+        };
+
+        //-------------------------------------------------------------------------
+
+        // A typical locomotion style value node network, evaluated either through the nodes or through a value program
+        struct ValueNodeBenchmarkState : public ValueNodeNetworkState
+        {
+            ValueNodeBenchmarkState()
+            {
+                using namespace GraphNodes;
+
+                // Nodes
+                //-------------------------------------------------------------------------
+
+                auto pSpeedParameter = CreateNode<ControlParameterFloatNode>();         // 0
+                auto pDirectionParameter = CreateNode<ControlParameterFloatNode>();     // 1
+                auto pCrouchParameter = CreateNode<ControlParameterBoolNode>();         // 2
+
+                auto pScaledSpeed = CreateNode<FloatMathNode>();                        // 3
+                pScaledSpeed->m_inputValueNodeIdxA = pSpeedParameter->m_nodeIdx;
+                pScaledSpeed->m_operator = FloatMathNode::Operator::Mul;
+                pScaledSpeed->m_valueB = 0.01f;
+
+                auto pClampedSpeed = CreateNode<FloatClampNode>();                      // 4
+                pClampedSpeed->m_inputValueNodeIdx = pScaledSpeed->m_nodeIdx;
+                pClampedSpeed->m_clampRange = FloatRange( 0.0f, 1.0f );
+
+                auto pRemappedDirection = CreateNode<FloatRemapNode>();                 // 5
+                pRemappedDirection->m_inputValueNodeIdx = pDirectionParameter->m_nodeIdx;
+                pRemappedDirection->m_inputRange.m_begin = -180.0f;
+                pRemappedDirection->m_inputRange.m_end = 180.0f;
+                pRemappedDirection->m_outputRange.m_begin = 0.0f;
+                pRemappedDirection->m_outputRange.m_end = 1.0f;
+
+                auto pSum = CreateNode<FloatMathNode>();                                // 6
+                pSum->m_inputValueNodeIdxA = pClampedSpeed->m_nodeIdx;
+                pSum->m_inputValueNodeIdxB = pRemappedDirection->m_nodeIdx;
+                pSum->m_operator = FloatMathNode::Operator::Add;
+
+                auto pSumComparison = CreateNode<FloatComparisonNode>();                // 7
+                pSumComparison->m_inputValueNodeIdx = pSum->m_nodeIdx;
+                pSumComparison->m_comparison = FloatComparisonNode::Comparison::GreaterThanEqual;
+                pSumComparison->m_comparisonValue = 0.5f;
+
+                auto pDirectionCheck = CreateNode<FloatRangeComparisonNode>();          // 8
+                pDirectionCheck->m_inputValueNodeIdx = pDirectionParameter->m_nodeIdx;
+                pDirectionCheck->m_range = FloatRange( -45.0f, 45.0f );
+                pDirectionCheck->m_isInclusiveCheck = true;
+
+                auto pNotCrouching = CreateNode<NotNode>();                             // 9
+                pNotCrouching->m_inputValueNodeIdx = pCrouchParameter->m_nodeIdx;
+
+                auto pCondition = CreateNode<AndNode>();                                // 10
+                pCondition->m_conditionNodeIndices = { pSumComparison->m_nodeIdx, pDirectionCheck->m_nodeIdx, pNotCrouching->m_nodeIdx };
+
+                auto pResult = CreateNode<FloatSwitchNode>();                           // 11
+                pResult->m_switchValueNodeIdx = pCondition->m_nodeIdx;
+                pResult->m_trueValueNodeIdx = pClampedSpeed->m_nodeIdx;
+                pResult->m_falseValueNodeIdx = pRemappedDirection->m_nodeIdx;
+
+                // Program
+                //-------------------------------------------------------------------------
+
+                using Op = ValueProgramOpCode;
+
+                m_programs.m_constants = { Float4( 0.01f ), Float4( 0.0f, 1.0f, 0.0f, 0.0f ), Float4( -180.0f, 180.0f, 0.0f, 1.0f ), Float4( 0.5f ), Float4( -45.0f, 45.0f, 0.0f, 0.0f ) };
+                m_programs.m_instructions =
+                {
+                    { Op::LoadFloatParameter, 1, 0 },
+                    { Op::LoadConstant, 2, 0 },
+                    { Op::FloatMul, 1, 1, 2 },
+                    { Op::FloatClamp, 1, 1, 1 },
+                    { Op::LoadFloatParameter, 2, 1 },
+                    { Op::FloatRemap, 2, 2, 2 },
+                    { Op::FloatAdd, 1, 1, 2 },
+                    { Op::LoadConstant, 2, 3 },
+                    { Op::FloatGreaterThanEqual, 1, 1, 2 },
+                    { Op::JumpIfFalse, InvalidIndex, 1, 15 },
+                    { Op::LoadFloatParameter, 1, 1 },
+                    { Op::FloatInRangeInclusive, 1, 1, 4 },
+                    { Op::JumpIfFalse, InvalidIndex, 1, 15 },
+                    { Op::LoadBoolParameter, 1, 2 },
+                    { Op::BoolNot, 1, 1 },
+                    { Op::JumpIfFalse, InvalidIndex, 1, 21 },
+                    { Op::LoadFloatParameter, 0, 0 },
+                    { Op::LoadConstant, 1, 0 },
+                    { Op::FloatMul, 0, 0, 1 },
+                    { Op::FloatClamp, 0, 0, 1 },
+                    { Op::Jump, InvalidIndex, 23 },
+                    { Op::LoadFloatParameter, 0, 1 },
+                    { Op::FloatRemap, 0, 0, 2 },
+                };
+
+                ValueProgram& program = m_programs.m_programs.emplace_back();
+                program.m_rootNodeIdx = pResult->m_nodeIdx;
+                program.m_firstInstructionIdx = 0;
+                program.m_numInstructions = (uint16_t) m_programs.m_instructions.size();
+                program.m_resultRegisterIdx = 0;
+                program.m_resultType = GraphValueType::Float;
+                m_programs.m_numRegisters = 3;
+
+                Initialize( pResult->m_nodeIdx );
+            }
+
+            // Update the parameters and evaluate the network once
+            float Evaluate()
+            {
+                m_time += 0.01f;
+                StartUpdate();
+
+                SetParameterValue<float>( 0, Math::FModF( m_time * 37.0f, 150.0f ) );
+                SetParameterValue<float>( 1, Math::FModF( m_time * 53.0f, 360.0f ) - 180.0f );
+                SetParameterValue<bool>( 2, Math::FModF( m_time, 1.0f ) > 0.75f );
+
+                return m_pRootNode->GetValue<float>( m_context );
+            }
+
+            float                               m_time = 0.0f;
+        };
+
+        static ValueNodeBenchmarkState* g_pValueNodeState = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        // Two programs where the outer program runs the inner one (through a stateful node) while it still has a live scratch register
+        // Each program has its own scratch registers, if they were shared the inner program would overwrite the outer program's partial result
+        struct NestedValueProgramState : public ValueNodeNetworkState
+        {
+            NestedValueProgramState()
+            {
+                using namespace GraphNodes;
+
+                // Nodes
+                //-------------------------------------------------------------------------
+
+                auto pSpeedParameter = CreateNode<ControlParameterFloatNode>();         // 0
+                auto pScaleParameter = CreateNode<ControlParameterFloatNode>();         // 1
+
+                auto pScaledSpeed = CreateNode<FloatMathNode>();                        // 2 - Inner program root
+                pScaledSpeed->m_inputValueNodeIdxA = pSpeedParameter->m_nodeIdx;
+                pScaledSpeed->m_inputValueNodeIdxB = pScaleParameter->m_nodeIdx;
+                pScaledSpeed->m_operator = FloatMathNode::Operator::Mul;
+
+                auto pCurve = CreateNode<FloatCurveNode>();                             // 3 - Not flattenable, runs the inner program
+                pCurve->m_inputValueNodeIdx = pScaledSpeed->m_nodeIdx;
+                pCurve->m_curve.AddPoint( 0.0f, 0.0f );
+                pCurve->m_curve.AddPoint( 100.0f, 50.0f );
+
+                auto pOffsetCurve = CreateNode<FloatMathNode>();                        // 4
+                pOffsetCurve->m_inputValueNodeIdxA = pSpeedParameter->m_nodeIdx;
+                pOffsetCurve->m_inputValueNodeIdxB = pCurve->m_nodeIdx;
+                pOffsetCurve->m_operator = FloatMathNode::Operator::Add;
+
+                auto pResult = CreateNode<FloatMathNode>();                             // 5 - Outer program root
+                pResult->m_inputValueNodeIdxA = pScaleParameter->m_nodeIdx;
+                pResult->m_inputValueNodeIdxB = pOffsetCurve->m_nodeIdx;
+                pResult->m_operator = FloatMathNode::Operator::Sub;
+
+                // Programs
+                //-------------------------------------------------------------------------
+                // Registers: 0-1 are the program results, 2 is the inner program's scratch register and 3-4 are the outer program's scratch registers
+
+                using Op = ValueProgramOpCode;
+
+                m_programs.m_instructions =
+                {
+                    // Inner
+                    { Op::LoadFloatParameter, 0, 0 },
+                    { Op::LoadFloatParameter, 2, 1 },
+                    { Op::FloatMul, 0, 0, 2 },
+
+                    // Outer - register 3 holds the speed while the curve node runs the inner program
+                    { Op::LoadFloatParameter, 1, 1 },
+                    { Op::LoadFloatParameter, 3, 0 },
+                    { Op::LoadFloatNode, 4, 3 },
+                    { Op::FloatAdd, 3, 3, 4 },
+                    { Op::FloatSub, 1, 1, 3 },
+                };
+
+                ValueProgram& innerProgram = m_programs.m_programs.emplace_back();
+                innerProgram.m_rootNodeIdx = pScaledSpeed->m_nodeIdx;
+                innerProgram.m_firstInstructionIdx = 0;
+                innerProgram.m_numInstructions = 3;
+                innerProgram.m_resultRegisterIdx = 0;
+                innerProgram.m_resultType = GraphValueType::Float;
+
+                ValueProgram& outerProgram = m_programs.m_programs.emplace_back();
+                outerProgram.m_rootNodeIdx = pResult->m_nodeIdx;
+                outerProgram.m_firstInstructionIdx = 3;
+                outerProgram.m_numInstructions = 5;
+                outerProgram.m_resultRegisterIdx = 1;
+                outerProgram.m_resultType = GraphValueType::Float;
+
+                m_programs.m_numRegisters = 5;
+
+                Initialize( pResult->m_nodeIdx );
+            }
+
+            float Evaluate( float speed, float scale )
+            {
+                StartUpdate();
+                SetParameterValue<float>( 0, speed );
+                SetParameterValue<float>( 1, scale );
+                return m_pRootNode->GetValue<float>( m_context );
+            }
+
+            // Check that the programs produce the same results as the regular node evaluation
+            bool Validate()
+            {
+                bool isValid = true;
+                for ( int32_t i = 0; i < 16; i++ )
+                {
+                    float const speed = 1.0f + i * 0.5f;
+                    float const scale = 2.0f + i * 0.25f;
+
+                    m_interpreter.SetProgramsEnabled( false );
+                    float const expectedResult = Evaluate( speed, scale );
+
+                    m_interpreter.SetProgramsEnabled( true );
+                    float const programResult = Evaluate( speed, scale );
+
+                    if ( !Math::IsNearEqual( expectedResult, programResult, Math::LargeEpsilon ) )
+                    {
+                        EE_LOG_ERROR( "Benchmark", "Value Programs", "Nested program result mismatch (speed: %.2f, scale: %.2f): expected %f, got %f", speed, scale, expectedResult, programResult );
+                        isValid = false;
+                    }
+                }
+
+                return isValid;
+            }
+        };
+
+        static NestedValueProgramState* g_pNestedValueProgramState = nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+
+    static void CreatePoseBenchmarkState() { g_pPoseState = EE::New<PoseBenchmarkState>(); }
+    static void DestroyPoseBenchmarkState() { EE::Delete( g_pPoseState ); }
+    static void DestroyValueNodeBenchmarkState() { EE::Delete( g_pValueNodeState ); }
+    static void DestroyNestedValueProgramState() { EE::Delete( g_pNestedValueProgramState ); }
+
+    // Decode and interpolate the key-frames for every bone, this is the same work that is performed when sampling a compressed animation clip
+    static void SampleKeyFrames( PoseBenchmarkState& state, Percentage percentageThrough )
+    {
+        int32_t const numBones = (int32_t) state.m_keyFrameTracks.size();
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            auto const& track = state.m_keyFrameTracks[boneIdx];
+
+            Transform keyFrames[2];
+            for ( auto keyIdx = 0; keyIdx < 2; keyIdx++ )
+            {
+                uint16_t const* pTranslation = track.m_translations[keyIdx];
+                float const x = Quantization::DecodeFloat( pTranslation[0], track.m_translationRangeStart, track.m_translationRangeLength );
+                float const y = Quantization::DecodeFloat( pTranslation[1], track.m_translationRangeStart, track.m_translationRangeLength );
+                float const z = Quantization::DecodeFloat( pTranslation[2], track.m_translationRangeStart, track.m_translationRangeLength );
+                keyFrames[keyIdx] = Transform( track.m_rotations[keyIdx].ToQuaternion(), Vector( x, y, z ) );
+            }
+
+            state.m_resultPose.SetTransform( boneIdx, Transform::Slerp( keyFrames[0], keyFrames[1], percentageThrough ) );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RegisterEngineBenchmarks( Runner& runner, Context const& context )
+    {
+        // Type Descriptors
+        //-------------------------------------------------------------------------
+
+        TypeSystem::TypeRegistry const* pTypeRegistry = context.m_pTypeRegistry;
+        EE_ASSERT( pTypeRegistry != nullptr );
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name = "TypeDescriptor/CreateTypeInstance";
+            benchmark.m_numOperationsPerSample = g_numTypeInstances;
+            benchmark.m_setupFunction = [pTypeRegistry] ()
+            {
+                g_pTypeDescriptorState = EE::New<TypeDescriptorBenchmarkState>();
+
+                // Describe a component with some non-default property values
+                Render::StaticMeshComponent component;
+                component.SetLocalTransform( Transform( Quaternion( EulerAngles( 0.0f, 0.0f, 90.0f ) ), Vector( 1.0f, 2.0f, 3.0f ) ) );
+                g_pTypeDescriptorState->m_descriptor.DescribeTypeInstance( *pTypeRegistry, &component, false );
+                g_pTypeDescriptorState->m_pTypeInfo = pTypeRegistry->GetTypeInfo( g_pTypeDescriptorState->m_descriptor.m_typeID );
+                g_pTypeDescriptorState->m_createdInstances.reserve( g_numTypeInstances );
+            };
+            benchmark.m_runFunction = [pTypeRegistry] ()
+            {
+                auto& createdInstances = g_pTypeDescriptorState->m_createdInstances;
+                createdInstances.emplace_back( g_pTypeDescriptorState->m_descriptor.CreateTypeInstance<IRegisteredType>( *pTypeRegistry, g_pTypeDescriptorState->m_pTypeInfo ) );
+
+                // Release the instances in batches so that memory usage stays bounded
+                if ( createdInstances.size() == g_numTypeInstances )
+                {
+                    for ( auto& pInstance : createdInstances )
+                    {
+                        EE::Delete( pInstance );
+                    }
+                    createdInstances.clear();
+                }
+            };
+            benchmark.m_teardownFunction = [] ()
+            {
+                for ( auto& pInstance : g_pTypeDescriptorState->m_createdInstances )
+                {
+                    EE::Delete( pInstance );
+                }
+                EE::Delete( g_pTypeDescriptorState );
+            };
+            runner.AddBenchmark( benchmark );
+        }
+
+        // Poses
+        //-------------------------------------------------------------------------
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name = "Pose/SampleKeyFrames";
+            benchmark.m_numOperationsPerSample = 16;
+            benchmark.m_setupFunction = CreatePoseBenchmarkState;
+            benchmark.m_runFunction = [] ()
+            {
+                g_pPoseState->m_time = Math::FModF( g_pPoseState->m_time + 0.01f, 1.0f );
+                SampleKeyFrames( *g_pPoseState, Percentage( g_pPoseState->m_time ) );
+                DoNotOptimize( g_pPoseState->m_resultPose );
+            };
+            benchmark.m_teardownFunction = DestroyPoseBenchmarkState;
+            runner.AddBenchmark( benchmark );
+        }
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name = "Pose/Blend";
+            benchmark.m_numOperationsPerSample = 16;
+            benchmark.m_setupFunction = CreatePoseBenchmarkState;
+            benchmark.m_runFunction = [] ()
+            {
+                Blender::Blend( &g_pPoseState->m_sourcePose, &g_pPoseState->m_targetPose, 0.35f, TBitFlags<PoseBlendOptions>(), nullptr, &g_pPoseState->m_resultPose );
+                DoNotOptimize( g_pPoseState->m_resultPose );
+            };
+            benchmark.m_teardownFunction = DestroyPoseBenchmarkState;
+            runner.AddBenchmark( benchmark );
+        }
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name = "Pose/CalculateGlobalTransforms";
+            benchmark.m_numOperationsPerSample = 16;
+            benchmark.m_setupFunction = CreatePoseBenchmarkState;
+            benchmark.m_runFunction = [] ()
+            {
+                g_pPoseState->m_targetPose.CalculateGlobalTransforms();
+                DoNotOptimize( g_pPoseState->m_targetPose );
+            };
+            benchmark.m_teardownFunction = DestroyPoseBenchmarkState;
+            runner.AddBenchmark( benchmark );
+        }
+
+        // Animation Graph Value Nodes
+        //-------------------------------------------------------------------------
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name = "AnimationGraph/ValueNodes";
+            benchmark.m_numOperationsPerSample = 64;
+            benchmark.m_setupFunction = [] ()
+            {
+                g_pValueNodeState = EE::New<ValueNodeBenchmarkState>();
+                g_pValueNodeState->m_interpreter.SetProgramsEnabled( false );
+            };
+            benchmark.m_runFunction = [] ()
+            {
+                float const result = g_pValueNodeState->Evaluate();
+                DoNotOptimize( result );
+            };
+            benchmark.m_teardownFunction = DestroyValueNodeBenchmarkState;
+            runner.AddBenchmark( benchmark );
+        }
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name = "AnimationGraph/ValueProgram";
+            benchmark.m_numOperationsPerSample = 64;
+            benchmark.m_setupFunction = [] ()
+            {
+                g_pValueNodeState = EE::New<ValueNodeBenchmarkState>();
+                EE_ASSERT( g_pValueNodeState->m_interpreter.AreProgramsEnabled() );
+            };
+            benchmark.m_runFunction = [] ()
+            {
+                float const result = g_pValueNodeState->Evaluate();
+                DoNotOptimize( result );
+            };
+            benchmark.m_teardownFunction = DestroyValueNodeBenchmarkState;
+            runner.AddBenchmark( benchmark );
+        }
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name = "AnimationGraph/ValueProgram/Nested";
+            benchmark.m_numOperationsPerSample = 64;
+            benchmark.m_setupFunction = [] () { g_pNestedValueProgramState = EE::New<NestedValueProgramState>(); };
+            benchmark.m_validateFunction = [] () { return g_pNestedValueProgramState->Validate(); };
+            benchmark.m_runFunction = [] ()
+            {
+                float const result = g_pNestedValueProgramState->Evaluate( 3.0f, 1.5f );
+                DoNotOptimize( result );
+            };
+            benchmark.m_teardownFunction = DestroyNestedValueProgramState;
+            runner.AddBenchmark( benchmark );
+        }
+    }
+}
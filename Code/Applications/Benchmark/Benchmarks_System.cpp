@@ -0,0 +1,314 @@
+#include "Benchmarks.h"
+#include "System/Serialization/BinarySerialization.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Math/AABBTree.h"
+#include "System/Math/MathRandom.h"
+#include "System/Types/StringID.h"
+#include "System/Types/HashMap.h"
+#include "System/Types/FlatHashMap.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmark
+{
+    namespace
+    {
+        struct SerializedBase
+        {
+            EE_SERIALIZE( m_bool, m_int32, m_int64, m_float, m_double );
+
+            bool                    m_bool = true;
+            int32_t                 m_int32 = 2;
+            int64_t                 m_int64 = 3;
+            float                   m_float = 124.5f;
+            double                  m_double = 154.5;
+        };
+
+        struct SerializedData : public SerializedBase
+        {
+            EE_SERIALIZE( EE_SERIALIZE_BASE( SerializedBase ), m_string, m_ids, m_strings, m_children, m_inlineChildren, m_blob, m_stringID );
+
+            String                          m_string = "Serialization Benchmark";
+            TVector<uint64_t>               m_ids = { 9, 10, 11, 12, 13, 14, 15, 16 };
+            TVector<String>                 m_strings = { "AAA", "BBB", "CCC", "DDD" };
+            TVector<SerializedBase>         m_children = TVector<SerializedBase>( 32 );
+            TInlineVector<SerializedBase, 4> m_inlineChildren = { SerializedBase(), SerializedBase() };
+            Blob                            m_blob = Blob( 1024, 0xFF );
+            StringID                        m_stringID = StringID( "Benchmark" );
+        };
+
+        //-------------------------------------------------------------------------
+
+        struct EmptyTask : public ITaskSet
+        {
+            EmptyTask( uint32_t setSize ) : ITaskSet( setSize ) { m_MinRange = 1; }
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final {}
+        };
+
+        //-------------------------------------------------------------------------
+
+        constexpr static int32_t const g_numStringIDs = 1024;
+        constexpr static int32_t const g_numAABBTreeBoxes = 1024;
+        constexpr static int32_t const g_numAABBTreeQueries = 64;
+        constexpr static int32_t const g_numHashMapEntries = 4096;
+
+        static TVector<String>      g_stringIDSourceStrings;
+        static TVector<StringID>    g_stringIDs;
+        static TVector<AABB>        g_aabbTreeBoxes;
+        static Math::AABBTree*      g_pAABBTree = nullptr;
+        static TVector<uint32_t>    g_hashMapKeys;
+        static TVector<uint32_t>    g_hashMapMissingKeys;
+    }
+
+    //-------------------------------------------------------------------------
+
+    static void CreateRandomBoxes( TVector<AABB>& outBoxes, int32_t numBoxes, float worldExtents )
+    {
+        // Fixed seed so that the tree layout is identical across runs
+        Math::RNG rng( 1234 );
+
+        outBoxes.clear();
+        outBoxes.reserve( numBoxes );
+        for ( auto i = 0; i < numBoxes; i++ )
+        {
+            Vector const center( rng.GetFloat( -worldExtents, worldExtents ), rng.GetFloat( -worldExtents, worldExtents ), rng.GetFloat( 0.0f, 10.0f ) );
+            Vector const extents( rng.GetFloat( 0.25f, 2.0f ), rng.GetFloat( 0.25f, 2.0f ), rng.GetFloat( 0.5f, 2.0f ) );
+            outBoxes.emplace_back( AABB( center, extents ) );
+        }
+    }
+
+    // Random 32bit keys, like the path/string IDs most of our tables are keyed on
+    static void CreateHashMapKeys()
+    {
+        Math::RNG rng( 5678 );
+
+        g_hashMapKeys.resize( g_numHashMapEntries );
+        g_hashMapMissingKeys.resize( g_numHashMapEntries );
+        for ( auto i = 0; i < g_numHashMapEntries; i++ )
+        {
+            // Keep the lowest bit free so that the missing keys never collide with the inserted ones
+            g_hashMapKeys[i] = rng.GetUInt() & ~1u;
+            g_hashMapMissingKeys[i] = g_hashMapKeys[i] | 1u;
+        }
+    }
+
+    // Register the same insert/lookup benchmarks for each map type so the results can be compared directly
+    template<typename MapType>
+    static void RegisterHashMapBenchmarks( Runner& runner, char const* pMapName )
+    {
+        static MapType* s_pMap = nullptr;
+
+        auto CreateMap = [] ()
+        {
+            CreateHashMapKeys();
+
+            s_pMap = EE::New<MapType>();
+            for ( auto key : g_hashMapKeys )
+            {
+                s_pMap->insert( TPair<uint32_t, uint64_t>( key, key ) );
+            }
+        };
+
+        auto DestroyMap = [] () { EE::Delete( s_pMap ); };
+
+        //-------------------------------------------------------------------------
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name.sprintf( "HashMap/%s/Insert", pMapName );
+            benchmark.m_numOperationsPerSample = 1;
+            benchmark.m_setupFunction = [] () { CreateHashMapKeys(); };
+            benchmark.m_runFunction = [] ()
+            {
+                MapType map;
+                for ( auto key : g_hashMapKeys )
+                {
+                    map.insert( TPair<uint32_t, uint64_t>( key, key ) );
+                }
+                DoNotOptimize( map );
+            };
+            runner.AddBenchmark( benchmark );
+        }
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name.sprintf( "HashMap/%s/Lookup", pMapName );
+            benchmark.m_numOperationsPerSample = g_numHashMapEntries;
+            benchmark.m_setupFunction = CreateMap;
+            benchmark.m_runFunction = [] ()
+            {
+                static int32_t s_keyIdx = 0;
+                auto const foundIter = s_pMap->find( g_hashMapKeys[s_keyIdx] );
+                s_keyIdx = ( s_keyIdx + 1 ) % g_numHashMapEntries;
+                DoNotOptimize( foundIter->second );
+            };
+            benchmark.m_teardownFunction = DestroyMap;
+            runner.AddBenchmark( benchmark );
+        }
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name.sprintf( "HashMap/%s/LookupMissing", pMapName );
+            benchmark.m_numOperationsPerSample = g_numHashMapEntries;
+            benchmark.m_setupFunction = CreateMap;
+            benchmark.m_runFunction = [] ()
+            {
+                static int32_t s_keyIdx = 0;
+                bool const wasFound = s_pMap->find( g_hashMapMissingKeys[s_keyIdx] ) != s_pMap->end();
+                s_keyIdx = ( s_keyIdx + 1 ) % g_numHashMapEntries;
+                DoNotOptimize( wasFound );
+            };
+            benchmark.m_teardownFunction = DestroyMap;
+            runner.AddBenchmark( benchmark );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RegisterSystemBenchmarks( Runner& runner, Context const& context )
+    {
+        // Binary Serialization
+        //-------------------------------------------------------------------------
+
+        runner.AddBenchmark( "Serialization/BinaryRoundTrip", 16, [] ()
+        {
+            SerializedData const source;
+
+            Serialization::BinaryOutputArchive outputArchive;
+            outputArchive << source;
+
+            SerializedData result;
+            Serialization::BinaryInputArchive inputArchive;
+            inputArchive.ReadFromData( outputArchive.GetBinaryData(), outputArchive.GetBinaryDataSize() );
+            inputArchive << result;
+
+            DoNotOptimize( result );
+        } );
+
+        // String IDs
+        //-------------------------------------------------------------------------
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name = "StringID/Create";
+            benchmark.m_numOperationsPerSample = g_numStringIDs;
+            benchmark.m_setupFunction = [] ()
+            {
+                g_stringIDSourceStrings.resize( g_numStringIDs );
+                for ( auto i = 0; i < g_numStringIDs; i++ )
+                {
+                    g_stringIDSourceStrings[i].sprintf( "Benchmark_StringID_%d", i );
+                }
+            };
+            benchmark.m_runFunction = [] ()
+            {
+                static int32_t s_stringIdx = 0;
+                StringID const ID( g_stringIDSourceStrings[s_stringIdx] );
+                s_stringIdx = ( s_stringIdx + 1 ) % g_numStringIDs;
+                DoNotOptimize( ID );
+            };
+            runner.AddBenchmark( benchmark );
+        }
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name = "StringID/Lookup";
+            benchmark.m_numOperationsPerSample = g_numStringIDs;
+            benchmark.m_setupFunction = [] ()
+            {
+                g_stringIDs.resize( g_numStringIDs );
+                for ( auto i = 0; i < g_numStringIDs; i++ )
+                {
+                    g_stringIDs[i] = StringID( String( String::CtorSprintf(), "Benchmark_StringID_%d", i ) );
+                }
+            };
+            benchmark.m_runFunction = [] ()
+            {
+                static int32_t s_IDIdx = 0;
+                char const* pString = g_stringIDs[s_IDIdx].c_str();
+                s_IDIdx = ( s_IDIdx + 1 ) % g_numStringIDs;
+                DoNotOptimize( pString );
+            };
+            runner.AddBenchmark( benchmark );
+        }
+
+        // AABB Tree
+        //-------------------------------------------------------------------------
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name = "AABBTree/InsertRemove";
+            benchmark.m_numOperationsPerSample = 1;
+            benchmark.m_setupFunction = [] () { CreateRandomBoxes( g_aabbTreeBoxes, g_numAABBTreeBoxes, 200.0f ); };
+            benchmark.m_runFunction = [] ()
+            {
+                Math::AABBTree tree;
+                for ( uint64_t i = 0; i < g_numAABBTreeBoxes; i++ )
+                {
+                    tree.InsertBox( g_aabbTreeBoxes[i], i + 1 );
+                }
+
+                for ( uint64_t i = 0; i < g_numAABBTreeBoxes; i++ )
+                {
+                    tree.RemoveBox( i + 1 );
+                }
+            };
+            runner.AddBenchmark( benchmark );
+        }
+
+        {
+            Benchmark benchmark;
+            benchmark.m_name = "AABBTree/FindOverlaps";
+            benchmark.m_numOperationsPerSample = g_numAABBTreeQueries;
+            benchmark.m_setupFunction = [] ()
+            {
+                CreateRandomBoxes( g_aabbTreeBoxes, g_numAABBTreeBoxes, 200.0f );
+
+                g_pAABBTree = EE::New<Math::AABBTree>();
+                for ( uint64_t i = 0; i < g_numAABBTreeBoxes; i++ )
+                {
+                    g_pAABBTree->InsertBox( g_aabbTreeBoxes[i], i + 1 );
+                }
+            };
+            benchmark.m_runFunction = [] ()
+            {
+                static int32_t s_queryIdx = 0;
+                static TVector<uint64_t> s_results;
+
+                AABB const queryBox( g_aabbTreeBoxes[s_queryIdx].GetCenter(), Vector( 10.0f ) );
+                s_results.clear();
+                g_pAABBTree->FindOverlaps( queryBox, s_results );
+                s_queryIdx = ( s_queryIdx + 1 ) % g_numAABBTreeBoxes;
+                DoNotOptimize( s_results );
+            };
+            benchmark.m_teardownFunction = [] () { EE::Delete( g_pAABBTree ); };
+            runner.AddBenchmark( benchmark );
+        }
+
+        // Hash Maps
+        //-------------------------------------------------------------------------
+
+        RegisterHashMapBenchmarks<THashMap<uint32_t, uint64_t>>( runner, "THashMap" );
+        RegisterHashMapBenchmarks<TFlatHashMap<uint32_t, uint64_t>>( runner, "TFlatHashMap" );
+
+        // Task System
+        //-------------------------------------------------------------------------
+
+        TaskSystem* pTaskSystem = context.m_pTaskSystem;
+        EE_ASSERT( pTaskSystem != nullptr && pTaskSystem->IsInitialized() );
+
+        runner.AddBenchmark( "TaskSystem/ScheduleAndWait", 16, [pTaskSystem] ()
+        {
+            EmptyTask task( 1 );
+            pTaskSystem->ScheduleTask( &task );
+            pTaskSystem->WaitForTask( &task );
+        } );
+
+        runner.AddBenchmark( "TaskSystem/ScheduleAndWaitParallelFor", 16, [pTaskSystem] ()
+        {
+            EmptyTask task( 256 );
+            pTaskSystem->ScheduleTask( &task );
+            pTaskSystem->WaitForTask( &task );
+        } );
+    }
+}
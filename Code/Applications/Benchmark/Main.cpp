@@ -0,0 +1,138 @@
+#include "Benchmarks.h"
+#include "Applications/Shared/ApplicationGlobalState.h"
+#include "Applications/Shared/cmdParser/cmdParser.h"
+#include "_AutoGenerated/EngineTypeRegistration.h"
+#include "System/TypeSystem/TypeRegistry.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Log.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+using namespace EE;
+
+//-------------------------------------------------------------------------
+
+int main( int argc, char *argv[] )
+{
+    EE::ApplicationGlobalState State;
+
+    std::cout.setf( std::ios::fixed, std::ios::floatfield );
+    std::cout.precision( 2 );
+
+    // Read CMD line arguments
+    //-------------------------------------------------------------------------
+
+    cli::Parser cmdParser( argc, argv );
+    cmdParser.set_optional<int>( "warmup", "Warmup", 100, "Number of warm-up iterations per benchmark." );
+    cmdParser.set_optional<int>( "samples", "Samples", 50, "Number of timed samples per benchmark." );
+    cmdParser.set_optional<std::string>( "filter", "Filter", "", "Only run benchmarks whose name contains this string." );
+    cmdParser.set_optional<std::string>( "output", "Output", "", "Write the results as JSON to this path." );
+    cmdParser.set_optional<std::string>( "baseline", "Baseline", "", "Compare the results against this baseline JSON file." );
+    cmdParser.set_optional<float>( "threshold", "Threshold", 0.1f, "Allowed relative increase of the median time before a benchmark is flagged as a regression." );
+
+    if ( !cmdParser.run() )
+    {
+        EE_LOG_ERROR( "Benchmark", "Benchmark", "Invalid commandline arguments" );
+        return 1;
+    }
+
+    Benchmark::Settings settings;
+    settings.m_numWarmupIterations = cmdParser.get<int>( "warmup" );
+    settings.m_numSamples = cmdParser.get<int>( "samples" );
+    settings.m_filter = cmdParser.get<std::string>( "filter" ).c_str();
+    settings.m_regressionThreshold = cmdParser.get<float>( "threshold" );
+
+    std::string const outputPath = cmdParser.get<std::string>( "output" );
+    std::string const baselinePath = cmdParser.get<std::string>( "baseline" );
+
+    if ( settings.m_numSamples <= 0 || settings.m_numWarmupIterations < 0 )
+    {
+        EE_LOG_ERROR( "Benchmark", "Benchmark", "Invalid sample or warm-up count" );
+        return 1;
+    }
+
+    // Initialize core systems
+    //-------------------------------------------------------------------------
+
+    TypeSystem::TypeRegistry typeRegistry;
+    AutoGenerated::Engine::RegisterTypes( typeRegistry );
+
+    TaskSystem taskSystem;
+    taskSystem.Initialize();
+
+    // Run benchmarks
+    //-------------------------------------------------------------------------
+
+    std::cout << std::endl;
+    std::cout << "===============================================" << std::endl;
+    std::cout << " * Esoterica Benchmarks" << std::endl;
+    std::cout << "===============================================" << std::endl << std::endl;
+
+    int32_t result = 0;
+
+    {
+        Benchmark::Context context;
+        context.m_pTypeRegistry = &typeRegistry;
+        context.m_pTaskSystem = &taskSystem;
+
+        Benchmark::Runner runner( settings );
+        Benchmark::RegisterSystemBenchmarks( runner, context );
+        Benchmark::RegisterEngineBenchmarks( runner, context );
+        runner.Run();
+
+        if ( !runner.GetFailedBenchmarks().empty() )
+        {
+            std::cout << std::endl << "Validation failures:" << std::endl;
+            for ( auto const& benchmarkName : runner.GetFailedBenchmarks() )
+            {
+                std::cout << " ! " << benchmarkName.c_str() << std::endl;
+            }
+            result = 1;
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( !outputPath.empty() )
+        {
+            FileSystem::Path const resultsPath( outputPath.c_str() );
+            if ( runner.WriteResultsToFile( resultsPath ) )
+            {
+                std::cout << std::endl << "Results written to: " << resultsPath.c_str() << std::endl;
+            }
+            else
+            {
+                EE_LOG_ERROR( "Benchmark", "Benchmark", "Failed to write results to: %s", resultsPath.c_str() );
+                result = 1;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( !baselinePath.empty() )
+        {
+            TVector<Benchmark::Comparison> comparisons;
+            bool const noRegressions = runner.CompareAgainstBaseline( FileSystem::Path( baselinePath.c_str() ), comparisons );
+
+            std::cout << std::endl << "Baseline Comparison:" << std::endl;
+            for ( auto const& comparison : comparisons )
+            {
+                std::cout << ( comparison.m_isRegression ? " ! " : "   " ) << comparison.m_name.c_str() << ": " << comparison.m_baselineMedian << "ns -> " << comparison.m_currentMedian << "ns (" << ( comparison.m_relativeChange * 100.0f ) << "%)" << std::endl;
+            }
+
+            if ( !noRegressions )
+            {
+                std::cout << std::endl << "Regressions detected!" << std::endl;
+                result = 1;
+            }
+        }
+    }
+
+    // Shutdown core systems
+    //-------------------------------------------------------------------------
+
+    taskSystem.Shutdown();
+    AutoGenerated::Engine::UnregisterTypes( typeRegistry );
+
+    return result;
+}
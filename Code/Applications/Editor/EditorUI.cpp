@@ -37,7 +37,6 @@ namespace EE
     {
         m_context.Initialize( context );
         m_pResourceBrowser = EE::New<ResourceBrowser>( m_context );
-        m_resourceDatabaseUpdateEventBindingID = m_context.GetResourceDatabase()->OnDatabaseUpdated().Bind( [this] () { m_pResourceBrowser->RebuildBrowserTree(); } );
 
         //-------------------------------------------------------------------------
 
@@ -49,11 +48,6 @@ namespace EE
 
     void EditorUI::Shutdown( UpdateContext const& context )
     {
-        if ( m_resourceDatabaseUpdateEventBindingID.IsValid() )
-        {
-            m_context.GetResourceDatabase()->OnDatabaseUpdated().Unbind( m_resourceDatabaseUpdateEventBindingID );
-        }
-
         EE::Delete( m_pResourceBrowser );
         m_context.Shutdown( context );
     }
@@ -44,7 +44,6 @@ namespace EE
         ImGuiWindowClass                    m_editorWindowClass;
 
         ResourceBrowser*                    m_pResourceBrowser = nullptr;
-        EventBindingID                      m_resourceDatabaseUpdateEventBindingID;
         float                               m_dataBrowserViewWidth = 150;
 
         ResourceID                          m_startupMap;
@@ -24,6 +24,11 @@ namespace EE
     {
         cli::Parser cmdParser( argc, argv );
         cmdParser.set_optional<std::string>( "map", "map", "", "The startup map." );
+        cmdParser.set_optional<int>( "benchmark", "benchmark", 0, "Run headless (no rendering/tools) for the specified number of frames and record the world update timings." );
+        cmdParser.set_optional<int>( "benchmarkwarmup", "benchmarkwarmup", 30, "Number of headless benchmark frames to run before recording." );
+        cmdParser.set_optional<float>( "benchmarktimestep", "benchmarktimestep", 1.0f / 60.0f, "The fixed time step (in seconds) used for the headless benchmark." );
+        cmdParser.set_optional<int>( "benchmarkcrowd", "benchmarkcrowd", 0, "Number of synthetic crowd entities to spawn for the headless benchmark." );
+        cmdParser.set_optional<std::string>( "benchmarkoutput", "benchmarkoutput", "", "Write the headless benchmark results as JSON to this path." );
 
         if ( !cmdParser.run() )
         {
@@ -36,6 +41,26 @@ namespace EE
             m_engine.m_startupMap = ResourcePath( map.c_str() );
         }
 
+        // Headless Benchmark
+        //-------------------------------------------------------------------------
+
+        auto& benchmarkSettings = m_engine.m_headlessBenchmarkSettings;
+        benchmarkSettings.m_numFrames = cmdParser.get<int>( "benchmark" );
+        benchmarkSettings.m_numWarmupFrames = cmdParser.get<int>( "benchmarkwarmup" );
+        benchmarkSettings.m_fixedTimeStep = cmdParser.get<float>( "benchmarktimestep" );
+        benchmarkSettings.m_numCrowdEntities = cmdParser.get<int>( "benchmarkcrowd" );
+
+        std::string const benchmarkOutput = cmdParser.get<std::string>( "benchmarkoutput" );
+        if ( !benchmarkOutput.empty() )
+        {
+            benchmarkSettings.m_resultsPath = FileSystem::Path( benchmarkOutput.c_str() );
+        }
+
+        if ( benchmarkSettings.m_numFrames < 0 || benchmarkSettings.m_numWarmupFrames < 0 || benchmarkSettings.m_numCrowdEntities < 0 || benchmarkSettings.m_fixedTimeStep <= 0.0f )
+        {
+            return FatalError( "Invalid headless benchmark arguments!" );
+        }
+
         return true;
     }
 
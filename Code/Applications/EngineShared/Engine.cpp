@@ -130,22 +130,32 @@ namespace EE
 
         // Initialize entity world manager and load startup map
         m_pEntityWorldManager->Initialize( *m_pSystemRegistry );
+        m_pEntityWorldManager->SetConcurrentWorldUpdatesEnabled( iniFile.GetBoolOrDefault( "Entity:ConcurrentWorldUpdates", false ) );
         if ( m_startupMap.IsValid() )
         {
             auto const sceneResourceID = EE::ResourceID( m_startupMap );
             m_pEntityWorldManager->GetWorlds()[0]->LoadMap( sceneResourceID );
         }
 
-        // Initialize rendering system
-        m_renderingSystem.Initialize( m_pRenderDevice, Float2( windowDimensions ), m_engineModule.GetRendererRegistry(), m_pEntityWorldManager );
-        m_pSystemRegistry->RegisterSystem( &m_renderingSystem );
+        // Headless runs have no rendering or tools
+        if ( IsHeadless() )
+        {
+            m_pHeadlessBenchmark = EE::New<HeadlessBenchmark>( m_headlessBenchmarkSettings );
+            m_updateContext.UpdateDeltaTime( m_headlessBenchmarkSettings.m_fixedTimeStep.ToMilliseconds() );
+        }
+        else
+        {
+            // Initialize rendering system
+            m_renderingSystem.Initialize( m_pRenderDevice, Float2( windowDimensions ), m_engineModule.GetRendererRegistry(), m_pEntityWorldManager );
+            m_pSystemRegistry->RegisterSystem( &m_renderingSystem );
 
-        // Create tools UI
-        #if EE_DEVELOPMENT_TOOLS
-        CreateToolsUI();
-        EE_ASSERT( m_pToolsUI != nullptr );
-        m_pToolsUI->Initialize( m_updateContext );
-        #endif
+            // Create tools UI
+            #if EE_DEVELOPMENT_TOOLS
+            CreateToolsUI();
+            EE_ASSERT( m_pToolsUI != nullptr );
+            m_pToolsUI->Initialize( m_updateContext );
+            #endif
+        }
 
         m_initialized = true;
         return true;
@@ -166,17 +176,24 @@ namespace EE
 
         if ( m_finalInitStageReached )
         {
-            // Destroy development tools
-            #if EE_DEVELOPMENT_TOOLS
-            EE_ASSERT( m_pToolsUI != nullptr );
-            m_pToolsUI->Shutdown( m_updateContext );
-            DestroyToolsUI();
-            EE_ASSERT( m_pToolsUI == nullptr );
-            #endif
+            if ( IsHeadless() )
+            {
+                EE::Delete( m_pHeadlessBenchmark );
+            }
+            else
+            {
+                // Destroy development tools
+                #if EE_DEVELOPMENT_TOOLS
+                EE_ASSERT( m_pToolsUI != nullptr );
+                m_pToolsUI->Shutdown( m_updateContext );
+                DestroyToolsUI();
+                EE_ASSERT( m_pToolsUI == nullptr );
+                #endif
 
-            // Shutdown rendering system
-            m_pSystemRegistry->UnregisterSystem( &m_renderingSystem );
-            m_renderingSystem.Shutdown();
+                // Shutdown rendering system
+                m_pSystemRegistry->UnregisterSystem( &m_renderingSystem );
+                m_renderingSystem.Shutdown();
+            }
 
             // Wait for resource/object systems to complete all resource unloading
             m_pEntityWorldManager->Shutdown();
@@ -279,6 +296,11 @@ namespace EE
             return m_fatalErrorHandler( Log::GetFatalError().m_message );
         }
 
+        if ( IsHeadless() )
+        {
+            return UpdateHeadlessBenchmark();
+        }
+
         // Perform Frame Update
         //-------------------------------------------------------------------------
 
@@ -464,4 +486,108 @@ namespace EE
 
         return true;
     }
+
+    //-------------------------------------------------------------------------
+
+    bool Engine::UpdateHeadlessBenchmark()
+    {
+        EE_ASSERT( m_pHeadlessBenchmark != nullptr );
+
+        EntityWorld* pGameWorld = m_pEntityWorldManager->GetGameWorld();
+        EE_ASSERT( pGameWorld != nullptr );
+
+        Profiling::StartFrame();
+
+        // Wait for the map (and the synthetic crowd) to finish loading before we start recording
+        //-------------------------------------------------------------------------
+
+        if ( !m_pHeadlessBenchmark->IsStarted() )
+        {
+            Network::NetworkSystem::Update();
+            m_pEntityWorldManager->StartFrame();
+            m_pResourceSystem->Update();
+            m_pEntityWorldManager->UpdateLoading();
+            m_pEntityWorldManager->EndFrame();
+
+            if ( !m_pEntityWorldManager->IsBusyLoading() && !m_pResourceSystem->IsBusy() )
+            {
+                if ( !m_pHeadlessBenchmark->HasSpawnedCrowd() )
+                {
+                    m_pHeadlessBenchmark->SpawnCrowd( *m_pTypeRegistry, pGameWorld );
+                }
+                else
+                {
+                    m_pHeadlessBenchmark->Start( pGameWorld );
+                }
+            }
+
+            Profiling::EndFrame();
+            return true;
+        }
+
+        // Perform Frame Update
+        //-------------------------------------------------------------------------
+        // Same stage order as the regular update but without any tools, input or rendering
+
+        Milliseconds frameTime = 0;
+        {
+            ScopedTimer<PlatformClock> frameTimer( frameTime );
+
+            auto RunStage = [this] ( UpdateStage stage )
+            {
+                Milliseconds stageTime = 0;
+                {
+                    ScopedTimer<PlatformClock> stageTimer( stageTime );
+                    m_updateContext.m_stage = stage;
+
+                    if ( stage == UpdateStage::FrameStart )
+                    {
+                        Network::NetworkSystem::Update();
+                        m_pEntityWorldManager->StartFrame();
+                        m_pResourceSystem->Update();
+                        m_pEntityWorldManager->UpdateLoading();
+                    }
+
+                    m_pEntityWorldManager->UpdateWorlds( m_updateContext );
+
+                    if ( stage == UpdateStage::Physics )
+                    {
+                        m_pPhysicsSystem->Update( m_updateContext );
+                    }
+                    else if ( stage == UpdateStage::FrameEnd )
+                    {
+                        m_pEntityWorldManager->EndFrame();
+                    }
+                }
+
+                m_pHeadlessBenchmark->RecordStage( stage, stageTime );
+            };
+
+            RunStage( UpdateStage::FrameStart );
+            RunStage( UpdateStage::PrePhysics );
+            RunStage( UpdateStage::Physics );
+            RunStage( UpdateStage::PostPhysics );
+            RunStage( UpdateStage::Paused );
+            RunStage( UpdateStage::FrameEnd );
+        }
+
+        m_pHeadlessBenchmark->EndFrame( frameTime );
+
+        // Always advance by the fixed time step so that the simulation is identical across runs and machines
+        Milliseconds const fixedTimeStep = m_headlessBenchmarkSettings.m_fixedTimeStep.ToMilliseconds();
+        m_updateContext.UpdateDeltaTime( fixedTimeStep );
+        EngineClock::Update( fixedTimeStep );
+        Profiling::EndFrame();
+
+        // Exit once all frames are recorded
+        //-------------------------------------------------------------------------
+
+        if ( m_pHeadlessBenchmark->IsComplete() )
+        {
+            m_pHeadlessBenchmark->Finish();
+            return false;
+        }
+
+        return true;
+    }
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RenderingSystem.h"
+#include "HeadlessBenchmark.h"
 #include "Engine/ToolsUI/IToolsUI.h"
 #include "System/Types/Function.h"
 #include "Engine/UpdateContext.h"
@@ -34,8 +35,14 @@ namespace EE
         Render::RenderingSystem* GetRenderingSystem() { return &m_renderingSystem; }
         Input::InputSystem* GetInputSystem() { return m_pInputSystem; }
 
+        // Are we running without rendering and tools (i.e. the headless benchmark)
+        inline bool IsHeadless() const { return m_headlessBenchmarkSettings.IsEnabled(); }
+
     protected:
 
+        // Steps the game world at a fixed time step and records the update timings, returns false once the benchmark is complete
+        bool UpdateHeadlessBenchmark();
+
         virtual void RegisterTypes();
         virtual void UnregisterTypes();
 
@@ -81,6 +88,8 @@ namespace EE
         //-------------------------------------------------------------------------
 
         ResourcePath                                    m_startupMap;
+        HeadlessBenchmark::Settings                     m_headlessBenchmarkSettings;
+        HeadlessBenchmark*                              m_pHeadlessBenchmark = nullptr;
         bool                                            m_moduleInitStageReached = false;
         bool                                            m_moduleResourcesInitStageReached = false;
         bool                                            m_finalInitStageReached = false;
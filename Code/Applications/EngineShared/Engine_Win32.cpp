@@ -27,6 +27,12 @@ namespace EE
         {
             case WM_SIZE:
             {
+                // There is no render target to resize when running headless
+                if ( pEngine->IsHeadless() )
+                {
+                    break;
+                }
+
                 Int2 const newDimensions( LOWORD( lParam ), HIWORD( lParam ) );
                 if ( newDimensions.m_x > 0 && newDimensions.m_y > 0 )
                 {
@@ -0,0 +1,337 @@
+#include "HeadlessBenchmark.h"
+#include "Engine/Entity/EntityWorld.h"
+#include "Engine/Physics/Components/Component_PhysicsCapsule.h"
+#include "System/TypeSystem/TypeDescriptors.h"
+#include "System/TypeSystem/TypeRegistry.h"
+#include "System/Serialization/JsonSerialization.h"
+#include "System/Math/Math.h"
+#include "System/Log.h"
+#include <eastl/sort.h>
+#include <cmath>
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    static char const* const g_stageNames[(int8_t) UpdateStage::NumStages] = { "FrameStart", "PrePhysics", "Physics", "PostPhysics", "FrameEnd", "Paused" };
+
+    // Crowd layout
+    constexpr static float const g_crowdSpacing = 2.0f;
+    constexpr static float const g_crowdSpawnHeight = 2.0f;
+
+    //-------------------------------------------------------------------------
+
+    float const HeadlessBenchmark::TimingHistogram::s_bucketUpperBounds[s_numBuckets - 1] = { 0.01f, 0.025f, 0.05f, 0.1f, 0.25f, 0.5f, 1.0f, 2.5f, 5.0f, 10.0f, 16.6f, 33.3f, 100.0f };
+
+    // Get the value at the specified percentile from a sorted set of samples (nearest rank)
+    static float GetPercentile( TVector<float> const& sortedSamples, float percentile )
+    {
+        EE_ASSERT( !sortedSamples.empty() );
+        int32_t const numSamples = (int32_t) sortedSamples.size();
+        int32_t const rank = (int32_t) std::ceil( percentile * numSamples ) - 1;
+        return sortedSamples[Math::Clamp( rank, 0, numSamples - 1 )];
+    }
+
+    void HeadlessBenchmark::TimingHistogram::Finalize()
+    {
+        memset( m_bucketCounts, 0, sizeof( m_bucketCounts ) );
+
+        if ( m_samples.empty() )
+        {
+            return;
+        }
+
+        eastl::sort( m_samples.begin(), m_samples.end() );
+
+        double total = 0.0;
+        for ( auto sample : m_samples )
+        {
+            total += sample;
+
+            int32_t bucketIdx = 0;
+            while ( bucketIdx < ( s_numBuckets - 1 ) && sample > s_bucketUpperBounds[bucketIdx] )
+            {
+                bucketIdx++;
+            }
+            m_bucketCounts[bucketIdx]++;
+        }
+
+        m_min = m_samples.front();
+        m_max = m_samples.back();
+        m_mean = float( total / m_samples.size() );
+        m_median = GetPercentile( m_samples, 0.5f );
+        m_p95 = GetPercentile( m_samples, 0.95f );
+        m_p99 = GetPercentile( m_samples, 0.99f );
+    }
+
+    //-------------------------------------------------------------------------
+
+    HeadlessBenchmark::HeadlessBenchmark( Settings const& settings )
+        : m_settings( settings )
+    {
+        EE_ASSERT( m_settings.IsEnabled() );
+        EE_ASSERT( m_settings.m_numWarmupFrames >= 0 && m_settings.m_numCrowdEntities >= 0 );
+        EE_ASSERT( m_settings.m_fixedTimeStep > 0.0f );
+
+        m_frameTimes.m_samples.reserve( m_settings.m_numFrames );
+    }
+
+    void HeadlessBenchmark::SpawnCrowd( TypeSystem::TypeRegistry const& typeRegistry, EntityWorld* pWorld )
+    {
+        EE_ASSERT( pWorld != nullptr && !m_crowdSpawned );
+        m_crowdSpawned = true;
+
+        if ( m_settings.m_numCrowdEntities == 0 )
+        {
+            return;
+        }
+
+        // Describe a dynamic capsule, this goes through the same creation path as serialized map entities
+        //-------------------------------------------------------------------------
+
+        TypeSystem::TypeInfo const* pCapsuleTypeInfo = Physics::CapsuleComponent::s_pTypeInfo;
+        TypeSystem::PropertyInfo const* pActorTypePropertyInfo = pCapsuleTypeInfo->GetPropertyInfo( StringID( "m_actorType" ) );
+        EE_ASSERT( pActorTypePropertyInfo != nullptr );
+
+        TypeSystem::TypeDescriptor capsuleDescriptor( pCapsuleTypeInfo->m_ID );
+        capsuleDescriptor.m_properties.emplace_back( TypeSystem::PropertyDescriptor( typeRegistry, TypeSystem::PropertyPath( "m_actorType" ), *pActorTypePropertyInfo, "Dynamic" ) );
+
+        // Lay the crowd out in a square grid around the origin
+        //-------------------------------------------------------------------------
+
+        int32_t const gridDimension = (int32_t) Math::Ceiling( Math::Sqrt( (float) m_settings.m_numCrowdEntities ) );
+        float const gridOffset = ( gridDimension - 1 ) * g_crowdSpacing * 0.5f;
+
+        auto pPersistentMap = pWorld->GetPersistentMap();
+        for ( int32_t i = 0; i < m_settings.m_numCrowdEntities; i++ )
+        {
+            Vector const position( ( i % gridDimension ) * g_crowdSpacing - gridOffset, ( i / gridDimension ) * g_crowdSpacing - gridOffset, g_crowdSpawnHeight );
+
+            auto pCapsuleComponent = capsuleDescriptor.CreateTypeInstance<Physics::CapsuleComponent>( typeRegistry, pCapsuleTypeInfo );
+            pCapsuleComponent->SetLocalTransform( Transform( pCapsuleComponent->GetLocalTransform().GetRotation(), position ) );
+
+            auto pEntity = EE::New<Entity>( StringID( String( String::CtorSprintf(), "Benchmark Crowd %d", i ) ) );
+            pEntity->AddComponent( pCapsuleComponent );
+            pPersistentMap->AddEntity( pEntity );
+        }
+
+        EE_LOG_MESSAGE( "Benchmark", "Headless", "Spawned synthetic crowd of %d entities", m_settings.m_numCrowdEntities );
+    }
+
+    void HeadlessBenchmark::Start( EntityWorld* pWorld )
+    {
+        EE_ASSERT( pWorld != nullptr && m_pWorld == nullptr );
+        m_pWorld = pWorld;
+        m_pWorld->SetUpdateTimingRecordingEnabled( true );
+
+        EE_LOG_MESSAGE( "Benchmark", "Headless", "Starting headless benchmark: %d frames (%d warm-up) at %.2fms", m_settings.m_numFrames, m_settings.m_numWarmupFrames, m_settings.m_fixedTimeStep.ToMilliseconds().ToFloat() );
+    }
+
+    void HeadlessBenchmark::RecordStage( UpdateStage stage, Milliseconds stageTime )
+    {
+        EE_ASSERT( IsStarted() );
+
+        if ( !IsRecordingFrame() )
+        {
+            return;
+        }
+
+        m_stageTimes[(int8_t) stage].AddSample( stageTime );
+
+        auto const& worldTimings = m_pWorld->GetLastUpdateTimings( stage );
+        if ( !worldTimings.m_wasUpdated )
+        {
+            return;
+        }
+
+        m_entityUpdateTimes[(int8_t) stage].AddSample( worldTimings.m_entityUpdateTime );
+
+        for ( auto const& systemTiming : worldTimings.m_worldSystemUpdateTimes )
+        {
+            uint32_t const systemID = systemTiming.m_pSystem->GetSystemID();
+            auto systemIter = eastl::find_if( m_systemTimings.begin(), m_systemTimings.end(), [systemID, stage] ( SystemTimings const& timings ) { return timings.m_systemID == systemID && timings.m_stage == stage; } );
+            if ( systemIter == m_systemTimings.end() )
+            {
+                SystemTimings& newTimings = m_systemTimings.emplace_back();
+                newTimings.m_systemID = systemID;
+                newTimings.m_stage = stage;
+                newTimings.m_name = systemTiming.m_pSystem->GetTypeInfo()->GetTypeName();
+                systemIter = m_systemTimings.end() - 1;
+            }
+
+            systemIter->m_histogram.AddSample( systemTiming.m_updateTime );
+        }
+    }
+
+    void HeadlessBenchmark::EndFrame( Milliseconds frameTime )
+    {
+        EE_ASSERT( IsStarted() );
+
+        if ( IsRecordingFrame() )
+        {
+            m_frameTimes.AddSample( frameTime );
+            m_numRecordedFrames++;
+        }
+
+        m_frameIdx++;
+    }
+
+    bool HeadlessBenchmark::Finish()
+    {
+        EE_ASSERT( IsStarted() );
+        m_pWorld->SetUpdateTimingRecordingEnabled( false );
+
+        // Calculate statistics
+        //-------------------------------------------------------------------------
+
+        m_frameTimes.Finalize();
+
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            m_stageTimes[i].Finalize();
+            m_entityUpdateTimes[i].Finalize();
+        }
+
+        for ( auto& systemTimings : m_systemTimings )
+        {
+            systemTimings.m_histogram.Finalize();
+        }
+
+        // Log summary
+        //-------------------------------------------------------------------------
+
+        EE_LOG_MESSAGE( "Benchmark", "Headless", "Frame: median %.3fms, p99 %.3fms, max %.3fms", m_frameTimes.m_median, m_frameTimes.m_p99, m_frameTimes.m_max );
+
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            if ( m_stageTimes[i].HasSamples() )
+            {
+                EE_LOG_MESSAGE( "Benchmark", "Headless", "  %s: median %.3fms, p99 %.3fms", g_stageNames[i], m_stageTimes[i].m_median, m_stageTimes[i].m_p99 );
+            }
+        }
+
+        for ( auto const& systemTimings : m_systemTimings )
+        {
+            EE_LOG_MESSAGE( "Benchmark", "Headless", "    %s::%s: median %.3fms, p99 %.3fms", g_stageNames[(int8_t) systemTimings.m_stage], systemTimings.m_name.c_str(), systemTimings.m_histogram.m_median, systemTimings.m_histogram.m_p99 );
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_pWorld = nullptr;
+
+        if ( m_settings.m_resultsPath.IsValid() )
+        {
+            if ( !WriteResultsToFile() )
+            {
+                EE_LOG_ERROR( "Benchmark", "Headless", "Failed to write results to: %s", m_settings.m_resultsPath.c_str() );
+                return false;
+            }
+
+            EE_LOG_MESSAGE( "Benchmark", "Headless", "Results written to: %s", m_settings.m_resultsPath.c_str() );
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool HeadlessBenchmark::WriteResultsToFile() const
+    {
+        Serialization::JsonArchiveWriter archive;
+        auto pWriter = archive.GetWriter();
+
+        auto WriteHistogram = [pWriter] ( TimingHistogram const& histogram )
+        {
+            pWriter->StartObject();
+            pWriter->Key( "NumSamples" );
+            pWriter->Int( histogram.GetNumSamples() );
+            pWriter->Key( "MinMs" );
+            pWriter->Double( histogram.m_min );
+            pWriter->Key( "MeanMs" );
+            pWriter->Double( histogram.m_mean );
+            pWriter->Key( "MedianMs" );
+            pWriter->Double( histogram.m_median );
+            pWriter->Key( "P95Ms" );
+            pWriter->Double( histogram.m_p95 );
+            pWriter->Key( "P99Ms" );
+            pWriter->Double( histogram.m_p99 );
+            pWriter->Key( "MaxMs" );
+            pWriter->Double( histogram.m_max );
+            pWriter->Key( "Buckets" );
+            pWriter->StartArray();
+            for ( int32_t i = 0; i < TimingHistogram::s_numBuckets; i++ )
+            {
+                pWriter->Int( histogram.m_bucketCounts[i] );
+            }
+            pWriter->EndArray();
+            pWriter->EndObject();
+        };
+
+        //-------------------------------------------------------------------------
+
+        pWriter->StartObject();
+
+        pWriter->Key( "NumFrames" );
+        pWriter->Int( m_numRecordedFrames );
+        pWriter->Key( "NumWarmupFrames" );
+        pWriter->Int( m_settings.m_numWarmupFrames );
+        pWriter->Key( "FixedTimeStepMs" );
+        pWriter->Double( m_settings.m_fixedTimeStep.ToMilliseconds().ToFloat() );
+        pWriter->Key( "NumCrowdEntities" );
+        pWriter->Int( m_settings.m_numCrowdEntities );
+
+        pWriter->Key( "BucketUpperBoundsMs" );
+        pWriter->StartArray();
+        for ( auto bound : TimingHistogram::s_bucketUpperBounds )
+        {
+            pWriter->Double( bound );
+        }
+        pWriter->EndArray();
+
+        pWriter->Key( "Frame" );
+        WriteHistogram( m_frameTimes );
+
+        pWriter->Key( "Stages" );
+        pWriter->StartArray();
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            if ( !m_stageTimes[i].HasSamples() )
+            {
+                continue;
+            }
+
+            pWriter->StartObject();
+            pWriter->Key( "Name" );
+            pWriter->String( g_stageNames[i] );
+            pWriter->Key( "Total" );
+            WriteHistogram( m_stageTimes[i] );
+            pWriter->Key( "EntityUpdate" );
+            WriteHistogram( m_entityUpdateTimes[i] );
+
+            pWriter->Key( "WorldSystems" );
+            pWriter->StartArray();
+            for ( auto const& systemTimings : m_systemTimings )
+            {
+                if ( systemTimings.m_stage != (UpdateStage) i )
+                {
+                    continue;
+                }
+
+                pWriter->StartObject();
+                pWriter->Key( "Name" );
+                pWriter->String( systemTimings.m_name.c_str() );
+                pWriter->Key( "Timings" );
+                WriteHistogram( systemTimings.m_histogram );
+                pWriter->EndObject();
+            }
+            pWriter->EndArray();
+
+            pWriter->EndObject();
+        }
+        pWriter->EndArray();
+
+        pWriter->EndObject();
+
+        return archive.WriteToFile( m_settings.m_resultsPath );
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Engine/UpdateStage.h"
+#include "System/FileSystem/FileSystemPath.h"
+#include "System/Time/Time.h"
+#include "System/Types/Arrays.h"
+#include "System/Types/String.h"
+
+//-------------------------------------------------------------------------
+// Headless Benchmark
+//-------------------------------------------------------------------------
+// Steps the game world through all the update stages at a fixed time step for a set number of frames without rendering or tools.
+// Records the frame, stage and per-world-system timings so that we can measure the CPU cost (and scaling across cores) of a world.
+
+namespace EE
+{
+    class EntityWorld;
+    namespace TypeSystem { class TypeRegistry; }
+
+    //-------------------------------------------------------------------------
+
+    class HeadlessBenchmark
+    {
+    public:
+
+        struct Settings
+        {
+            inline bool IsEnabled() const { return m_numFrames > 0; }
+
+            int32_t                                 m_numFrames = 0;
+            int32_t                                 m_numWarmupFrames = 30;
+            Seconds                                 m_fixedTimeStep = 1.0f / 60.0f;
+            int32_t                                 m_numCrowdEntities = 0;
+            FileSystem::Path                        m_resultsPath;
+        };
+
+        // A set of timing samples that can be bucketed into a fixed log-scale histogram
+        class TimingHistogram
+        {
+        public:
+
+            constexpr static int32_t const s_numBuckets = 14;
+
+            // Upper bound (in ms) for each bucket, the last bucket is unbounded
+            static float const s_bucketUpperBounds[s_numBuckets - 1];
+
+        public:
+
+            inline void AddSample( Milliseconds sample ) { m_samples.emplace_back( sample.ToFloat() ); }
+            inline bool HasSamples() const { return !m_samples.empty(); }
+            inline int32_t GetNumSamples() const { return (int32_t) m_samples.size(); }
+
+            // Sort the samples and calculate all the statistics
+            void Finalize();
+
+        public:
+
+            TVector<float>                          m_samples;
+            int32_t                                 m_bucketCounts[s_numBuckets] = { 0 };
+            float                                   m_min = 0.0f;
+            float                                   m_max = 0.0f;
+            float                                   m_mean = 0.0f;
+            float                                   m_median = 0.0f;
+            float                                   m_p95 = 0.0f;
+            float                                   m_p99 = 0.0f;
+        };
+
+    private:
+
+        struct SystemTimings
+        {
+            uint32_t                                m_systemID = 0;
+            UpdateStage                             m_stage = UpdateStage::FrameStart;
+            String                                  m_name;
+            TimingHistogram                         m_histogram;
+        };
+
+    public:
+
+        HeadlessBenchmark( Settings const& settings );
+
+        inline Settings const& GetSettings() const { return m_settings; }
+
+        // Have we recorded all requested frames
+        inline bool IsComplete() const { return m_numRecordedFrames >= m_settings.m_numFrames; }
+
+        // Create the synthetic crowd in the persistent map of the supplied world (the entities will be loaded during the next world loading update)
+        void SpawnCrowd( TypeSystem::TypeRegistry const& typeRegistry, EntityWorld* pWorld );
+        inline bool HasSpawnedCrowd() const { return m_crowdSpawned; }
+
+        // Start measuring the supplied world - this is called once all loading has completed
+        void Start( EntityWorld* pWorld );
+        inline bool IsStarted() const { return m_pWorld != nullptr; }
+
+        // Record the timings for a single update stage
+        void RecordStage( UpdateStage stage, Milliseconds stageTime );
+
+        // Record the total frame time, this will also advance the frame counter
+        void EndFrame( Milliseconds frameTime );
+
+        // Stop recording, calculate all statistics, log the summary and write the results file (if requested)
+        bool Finish();
+
+    private:
+
+        bool IsRecordingFrame() const { return m_frameIdx >= m_settings.m_numWarmupFrames; }
+        bool WriteResultsToFile() const;
+
+    private:
+
+        Settings                                    m_settings;
+        EntityWorld*                                m_pWorld = nullptr;
+        int32_t                                     m_frameIdx = 0;
+        int32_t                                     m_numRecordedFrames = 0;
+        bool                                        m_crowdSpawned = false;
+
+        TimingHistogram                             m_frameTimes;
+        TimingHistogram                             m_stageTimes[(int8_t) UpdateStage::NumStages];
+        TimingHistogram                             m_entityUpdateTimes[(int8_t) UpdateStage::NumStages];
+        TVector<SystemTimings>                      m_systemTimings;
+    };
+}
@@ -2,6 +2,7 @@
 #include "ClangVisitors_TranslationUnit.h"
 #include "Applications/Reflector/ReflectorSettingsAndUtils.h"
 #include "Applications/Reflector/Database/ReflectionDatabase.h"
+#include "System/Threading/TaskSystem.h"
 #include "System/Time/Timers.h"
 #include "System/Platform/PlatformHelpers_Win32.h"
 #include <fstream>
@@ -10,44 +11,90 @@
 
 namespace EE::TypeSystem::Reflection
 {
-    ClangParser::ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath )
+    ClangParser::ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath, TaskSystem* pTaskSystem )
         : m_context( pSolution, pDatabase )
+        , m_pTaskSystem( pTaskSystem )
         , m_totalParsingTime( 0 )
         , m_totalVisitingTime( 0 )
         , m_reflectionDataPath( reflectionDataPath )
-    {}
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+    }
 
-    bool ClangParser::Parse( TVector<HeaderInfo*> const& headers, Pass pass )
+    bool ClangParser::CreateTranslationUnits( TVector<HeaderInfo*> const& headers, Pass pass, TVector<ProjectTranslationUnit>& outTranslationUnits )
     {
-        m_context.m_detectDevOnlyTypesAndProperties = ( pass == SecondPass );
+        outTranslationUnits.clear();
 
-        // Create single amalgamated header file for all headers to parse
-        //-------------------------------------------------------------------------
+        // Projects are sorted by dependencies so the translation units will be in dependency order
+        for ( ProjectInfo const& prj : m_context.m_pSolution->m_projects )
+        {
+            ProjectTranslationUnit translationUnit;
+            translationUnit.m_pProject = &prj;
 
-        std::ofstream reflectorFileStream;
-        FileSystem::Path const reflectorHeader = m_reflectionDataPath + "Reflector.h";
-        reflectorHeader.EnsureDirectoryExists();
-        reflectorFileStream.open( reflectorHeader.c_str(), std::ios::out | std::ios::trunc );
-        EE_ASSERT( !reflectorFileStream.fail() );
+            String includeStr;
+            for ( HeaderInfo const* pHeader : headers )
+            {
+                if ( pHeader->m_projectID != prj.m_ID )
+                {
+                    continue;
+                }
+
+                // Exclude dev tools
+                if ( pass == SecondPass && pHeader->IsInToolsLayer() )
+                {
+                    continue;
+                }
+
+                translationUnit.m_headersToVisit.push_back( pHeader->m_ID );
+                includeStr += "#include \"" + pHeader->m_filePath.GetString() + "\"\n";
+            }
 
-        String includeStr;
-        m_context.m_headersToVisit.clear();
-        for ( HeaderInfo const* pHeader : headers )
-        {
-            // Exclude dev tools
-            if ( pass == SecondPass && pHeader->IsInToolsLayer() )
+            if ( translationUnit.m_headersToVisit.empty() )
             {
                 continue;
             }
 
-            m_context.m_headersToVisit.push_back( pHeader->m_ID );
-            includeStr += "#include \"" + pHeader->m_filePath.GetString() + "\"\n";
+            // Create the translation unit header for this project
+            //-------------------------------------------------------------------------
+
+            translationUnit.m_filePath = m_reflectionDataPath + ( "Reflector_" + prj.m_name + ".h" );
+            translationUnit.m_filePath.EnsureDirectoryExists();
+
+            std::ofstream reflectorFileStream;
+            reflectorFileStream.open( translationUnit.m_filePath.c_str(), std::ios::out | std::ios::trunc );
+            if ( reflectorFileStream.fail() )
+            {
+                m_context.LogError( "Failed to create translation unit: %s", translationUnit.m_filePath.c_str() );
+                return false;
+            }
+
+            reflectorFileStream.write( includeStr.c_str(), includeStr.size() );
+            reflectorFileStream.close();
+
+            outTranslationUnits.emplace_back( translationUnit );
         }
 
-        reflectorFileStream.write( includeStr.c_str(), includeStr.size() );
-        reflectorFileStream.close();
+        return true;
+    }
+
+    bool ClangParser::Parse( TVector<HeaderInfo*> const& headers, Pass pass )
+    {
+        m_context.m_detectDevOnlyTypesAndProperties = ( pass == SecondPass );
+        m_totalParsingTime = 0;
+        m_totalVisitingTime = 0;
+
+        // Create a translation unit per project
+        //-------------------------------------------------------------------------
+
+        TVector<ProjectTranslationUnit> translationUnits;
+        if ( !CreateTranslationUnits( headers, pass, translationUnits ) )
+        {
+            return false;
+        }
 
         // Clang args
+        //-------------------------------------------------------------------------
+
         TInlineVector<String, 10> fullIncludePaths;
         TInlineVector<char const*, 10> clangArgs;
         int32_t const numIncludePaths = sizeof( Settings::g_includePaths ) / sizeof( Settings::g_includePaths[0] );
@@ -56,7 +103,6 @@ namespace EE::TypeSystem::Reflection
             String const fullPath = m_context.m_pSolution->m_path + Settings::g_includePaths[i];
             String const shortPath = Platform::Win32::GetShortPath( fullPath );
             fullIncludePaths.push_back( "-I" + shortPath );
-            clangArgs.push_back( fullIncludePaths.back().c_str() );
 
             if ( !FileSystem::Exists( fullPath ) )
             {
@@ -65,6 +111,12 @@ namespace EE::TypeSystem::Reflection
             }
         }
 
+        // Only take the string pointers once the include path list is complete, since adding elements might have moved the strings
+        for ( auto const& includePath : fullIncludePaths )
+        {
+            clangArgs.push_back( includePath.c_str() );
+        }
+
         clangArgs.push_back( "-x" );
         clangArgs.push_back( "c++" );
         clangArgs.push_back( "-std=c++17" );
@@ -82,59 +134,113 @@ namespace EE::TypeSystem::Reflection
             clangArgs.push_back( Settings::g_devToolsExclusionDefine );
         }
 
+        // Parse all translation units in parallel
         //-------------------------------------------------------------------------
+        // This is the expensive part, the visiting (which writes to the database) is done serially afterwards
+
+        struct ParseTask : public ITaskSet
+        {
+            ParseTask( TVector<ProjectTranslationUnit>& translationUnits, TInlineVector<char const*, 10> const& clangArgs )
+                : m_translationUnits( translationUnits )
+                , m_clangArgs( clangArgs )
+            {
+                m_SetSize = (uint32_t) translationUnits.size();
+                m_MinRange = 1;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                uint32_t const clangOptions = CXTranslationUnit_DetailedPreprocessingRecord | CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_IncludeBriefCommentsInCodeCompletion;
+
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    // Each translation unit gets its own index since indices should not be shared across threads
+                    ProjectTranslationUnit& translationUnit = m_translationUnits[i];
+                    translationUnit.m_index = clang_createIndex( 0, 1 );
+                    translationUnit.m_result = clang_parseTranslationUnit2( translationUnit.m_index, translationUnit.m_filePath.c_str(), m_clangArgs.data(), (int32_t) m_clangArgs.size(), 0, 0, clangOptions, &translationUnit.m_tu );
+                }
+            }
 
-        // Set up clang
-        auto idx = clang_createIndex( 0, 1 );
-        uint32_t const clangOptions = CXTranslationUnit_DetailedPreprocessingRecord | CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_IncludeBriefCommentsInCodeCompletion;
+        private:
+
+            TVector<ProjectTranslationUnit>&        m_translationUnits;
+            TInlineVector<char const*, 10> const&   m_clangArgs;
+        };
 
-        // Parse Headers
-        CXTranslationUnit tu;
-        CXErrorCode result = CXError_Failure;
         {
             ScopedTimer<PlatformClock> timer( m_totalParsingTime );
-            result = clang_parseTranslationUnit2( idx, reflectorHeader.c_str(), clangArgs.data(), clangArgs.size(), 0, 0, clangOptions, &tu );
+            ParseTask parseTask( translationUnits, clangArgs );
+            m_pTaskSystem->ScheduleTask( &parseTask );
+            m_pTaskSystem->WaitForTask( &parseTask );
         }
 
-        // Handle result of parse
-        if ( result == CXError_Success )
-        {
-            ScopedTimer<PlatformClock> timer( m_totalVisitingTime );
-            m_context.Reset( &tu );
-            auto cursor = clang_getTranslationUnitCursor( tu );
-            clang_visitChildren( cursor, VisitTranslationUnit, &m_context );
-        }
-        else
+        // Visit the translation units in project dependency order
+        //-------------------------------------------------------------------------
+        // Types from dependent projects need to be in the database before we visit the projects that use them
+
+        for ( ProjectTranslationUnit& translationUnit : translationUnits )
         {
-            switch ( result )
+            if ( translationUnit.m_result == CXError_Success )
             {
-                case CXError_Failure:
-                m_context.LogError( "Clang Unknown failure" );
-                break;
-
-                case CXError_Crashed:
-                m_context.LogError( "Clang crashed" );
-                break;
-
-                case CXError_InvalidArguments:
-                m_context.LogError( "Clang Invalid arguments" );
-                break;
+                // Scoped timers overwrite their result, so each translation unit is timed separately and accumulated
+                Milliseconds translationUnitVisitingTime = 0;
+                {
+                    ScopedTimer<PlatformClock> timer( translationUnitVisitingTime );
+                    m_context.Reset( &translationUnit.m_tu );
+                    m_context.m_headersToVisit = translationUnit.m_headersToVisit;
+                    auto cursor = clang_getTranslationUnitCursor( translationUnit.m_tu );
+                    clang_visitChildren( cursor, VisitTranslationUnit, &m_context );
+                }
+                m_totalVisitingTime += translationUnitVisitingTime;
+            }
+            else
+            {
+                switch ( translationUnit.m_result )
+                {
+                    case CXError_Failure:
+                    m_context.LogError( "Clang Unknown failure" );
+                    break;
+
+                    case CXError_Crashed:
+                    m_context.LogError( "Clang crashed" );
+                    break;
+
+                    case CXError_InvalidArguments:
+                    m_context.LogError( "Clang Invalid arguments" );
+                    break;
+
+                    case CXError_ASTReadError:
+                    m_context.LogError( "Clang AST read error" );
+                    break;
+                }
+            }
 
-                case CXError_ASTReadError:
-                m_context.LogError( "Clang AST read error" );
+            // If we have an error from the parser, prepend the translation unit to it
+            if ( m_context.ErrorOccured() )
+            {
+                m_context.LogError( "%s --> %s", translationUnit.m_filePath.c_str(), m_context.GetErrorMessage() );
                 break;
             }
         }
-        clang_disposeIndex( idx );
 
+        // Release all translation units
         //-------------------------------------------------------------------------
 
-        // If we have an error from the parser, prepend the header to it
-        if ( m_context.ErrorOccured() )
+        for ( ProjectTranslationUnit& translationUnit : translationUnits )
         {
-            m_context.LogError( "%s --> %s", reflectorHeader.c_str(), m_context.GetErrorMessage() );
+            if ( translationUnit.m_tu != nullptr )
+            {
+                clang_disposeTranslationUnit( translationUnit.m_tu );
+            }
+
+            if ( translationUnit.m_index != nullptr )
+            {
+                clang_disposeIndex( translationUnit.m_index );
+            }
         }
 
+        //-------------------------------------------------------------------------
+
         return !m_context.ErrorOccured();
     }
 }
\ No newline at end of file
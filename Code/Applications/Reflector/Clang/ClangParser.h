@@ -5,6 +5,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::TypeSystem::Reflection
 {
     class ClangParser
@@ -17,9 +21,22 @@ namespace EE::TypeSystem::Reflection
             SecondPass
         };
 
+    private:
+
+        // Each project with headers to reflect gets its own translation unit, all translation units are parsed in parallel
+        struct ProjectTranslationUnit
+        {
+            ProjectInfo const*              m_pProject = nullptr;
+            FileSystem::Path                m_filePath;
+            TVector<HeaderID>               m_headersToVisit;
+            CXIndex                         m_index = nullptr;
+            CXTranslationUnit               m_tu = nullptr;
+            CXErrorCode                     m_result = CXError_Failure;
+        };
+
     public:
 
-        ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath );
+        ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath, TaskSystem* pTaskSystem );
 
         inline Milliseconds GetParsingTime() const { return m_totalParsingTime; }
         inline Milliseconds GetVisitingTime() const { return m_totalVisitingTime; }
@@ -27,9 +44,14 @@ namespace EE::TypeSystem::Reflection
         bool Parse( TVector<HeaderInfo*> const& headers, Pass pass );
         String GetErrorMessage() const { return m_context.GetErrorMessage(); }
 
+    private:
+
+        bool CreateTranslationUnits( TVector<HeaderInfo*> const& headers, Pass pass, TVector<ProjectTranslationUnit>& outTranslationUnits );
+
     private:
 
         ClangParserContext                  m_context;
+        TaskSystem*                         m_pTaskSystem = nullptr;
         Milliseconds                        m_totalParsingTime;
         Milliseconds                        m_totalVisitingTime;
         FileSystem::Path                    m_reflectionDataPath;
@@ -8,6 +8,7 @@
 #include "System/FileSystem/FileSystemUtils.h"
 #include "System/Time/Timers.h"
 #include "System/Algorithm/TopologicalSort.h"
+#include "System/Algorithm/Hash.h"
 
 #include <eastl/sort.h>
 #include <fstream>
@@ -197,11 +198,16 @@ namespace EE::TypeSystem::Reflection
         return true;
     }
 
-    uint64_t Reflector::CalculateHeaderChecksum( FileSystem::Path const& engineIncludePath, FileSystem::Path const& filePath )
+    uint64_t Reflector::CalculateHeaderChecksum( FileSystem::Path const& filePath )
     {
-        static char const* headerString = "Note: including file: ";
-        uint64_t checksum = FileSystem::GetFileModifiedTime( filePath );
-        return checksum;
+        // Use the file contents rather than the timestamp, so that touching or re-syncing a file doesn't trigger a reparse
+        Blob fileData;
+        if ( !FileSystem::LoadFile( filePath, fileData ) )
+        {
+            return 0;
+        }
+
+        return Hash::XXHash::GetHash64( fileData );
     }
 
     bool Reflector::ParseProject( FileSystem::Path const& prjPath )
@@ -606,31 +612,21 @@ namespace EE::TypeSystem::Reflection
                         }
                     }
 
-                    // Try to get existing record
+                    // Always calculate the content hash since it needs to be stored in the database for dirty headers
+                    header.m_checksum = CalculateHeaderChecksum( header.m_filePath );
+                    if ( header.m_checksum == 0 )
+                    {
+                        return LogError( "Failed to perform up to date check for: %s", header.m_filePath.c_str() );
+                    }
+
+                    // Try to get existing record - only headers whose contents have changed need to be reflected again
+                    HeaderInfo const* pExistingRecord = m_database.GetHeaderDesc( header.m_ID );
                     if ( !isDirty )
                     {
-                        HeaderInfo const* pExistingRecord = m_database.GetHeaderDesc( header.m_ID );
                         if ( pExistingRecord != nullptr )
                         {
                             EE_ASSERT( pExistingRecord->m_ID != 0 );
-
-                            // Check timestamp
-                            if ( header.m_timestamp > pExistingRecord->m_timestamp )
-                            {
-                                isDirty = true;
-                            }
-                            else
-                            {
-                                header.m_checksum = CalculateHeaderChecksum( m_solution.m_path, header.m_filePath );
-                                if ( header.m_checksum == 0 )
-                                {
-                                    return LogError( "Failed to perform up to date check for: %s", header.m_filePath.c_str() );
-                                }
-                                else if ( header.m_checksum != pExistingRecord->m_checksum )
-                                {
-                                    isDirty = true;
-                                }
-                            }
+                            isDirty = ( header.m_checksum != pExistingRecord->m_checksum );
                         }
                         else
                         {
@@ -638,12 +634,16 @@ namespace EE::TypeSystem::Reflection
                         }
                     }
 
-                    // Update file checksum if file is dirty
+                    // Update the header record if the file is dirty or if only the timestamp changed
                     if ( isDirty )
                     {
                         m_database.UpdateHeaderRecord( header );
                         prj.m_dirtyHeaders.push_back( i );
                     }
+                    else if ( header.m_timestamp != pExistingRecord->m_timestamp )
+                    {
+                        m_database.UpdateHeaderRecord( header );
+                    }
                 }
             }
 
@@ -700,7 +700,7 @@ namespace EE::TypeSystem::Reflection
             std::cout << " * Reflecting C++ Code - First Pass - ";
 
             // Parse headers
-            ClangParser clangParser( &m_solution, &m_database, m_reflectionDataPath );
+            ClangParser clangParser( &m_solution, &m_database, m_reflectionDataPath, &m_taskSystem );
             if ( !clangParser.Parse( headersToParse, ClangParser::FirstPass ) )
             {
                 std::cout << "Error occurred!\n\n  Error: " << clangParser.GetErrorMessage().c_str() << std::endl;
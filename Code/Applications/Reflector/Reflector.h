@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Applications/Reflector/Database/ReflectionDatabase.h"
+#include "System/Threading/TaskSystem.h"
 #include "System/Time/Time.h"
 #include "System/Types/String.h"
 
@@ -27,7 +28,8 @@ namespace EE::TypeSystem::Reflection
 
     public:
 
-        Reflector() = default;
+        Reflector() { m_taskSystem.Initialize(); }
+        ~Reflector() { m_taskSystem.Shutdown(); }
 
         bool ParseSolution( FileSystem::Path const& slnPath );
         bool Clean();
@@ -39,7 +41,7 @@ namespace EE::TypeSystem::Reflection
         bool ParseProject( FileSystem::Path const& prjPath );
 
         HeaderProcessResult ProcessHeaderFile( FileSystem::Path const& filePath, String& exportMacro );
-        uint64_t CalculateHeaderChecksum( FileSystem::Path const& engineIncludePath, FileSystem::Path const& filePath );
+        uint64_t CalculateHeaderChecksum( FileSystem::Path const& filePath );
 
         bool UpToDateCheck();
         bool ReflectRegisteredHeaders();
@@ -50,6 +52,7 @@ namespace EE::TypeSystem::Reflection
         FileSystem::Path                    m_reflectionDataPath;
         SolutionInfo                        m_solution;
         ReflectionDatabase                  m_database;
+        TaskSystem                          m_taskSystem;
 
         // Up to data checks
         TVector<HeaderTimestamp>            m_registeredHeaderTimestamps;
@@ -4,6 +4,7 @@
 #include "Applications/Shared/cmdParser/cmdParser.h"
 #include "System/Resource/ResourceSettings.h"
 #include "System/FileSystem/FileSystemUtils.h"
+#include "System/Threading/TaskSystem.h"
 #include "System/IniFile.h"
 #include "System/Log.h"
 
@@ -127,6 +128,8 @@ int main( int argc, char* argv[] )
 
     Resource::CompilerRegistry compilerRegistry( typeRegistry, settings.m_rawResourcePath );
 
+    TaskSystem taskSystem;
+    taskSystem.Initialize();
 
     // Execute compilation command
     //-------------------------------------------------------------------------
@@ -140,7 +143,7 @@ int main( int argc, char* argv[] )
     auto CompileResource = [&] ()
     {
         // Try create compilation context
-        Resource::CompileContext compileContext( settings.m_rawResourcePath, settings.m_compiledResourcePath, argParser.m_resourceID, argParser.m_isForPackagedBuild );
+        Resource::CompileContext compileContext( settings.m_rawResourcePath, settings.m_compiledResourcePath, argParser.m_resourceID, argParser.m_isForPackagedBuild, settings.m_rawAssetCachePath, &taskSystem );
         if ( !compileContext.IsValid() )
         {
             return -1;
@@ -168,6 +171,8 @@ int main( int argc, char* argv[] )
 
     int32_t const result = CompileResource();
 
+    taskSystem.Shutdown();
+
     // Unregister all types
     //-------------------------------------------------------------------------
 
@@ -1,6 +1,7 @@
 #include "ResourceServer.h"
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "EngineTools/Resource/ResourceCompiler.h"
+#include "EngineTools/RawAssets/RawAssetCache.h"
 #include "Engine/Entity/EntityDescriptors.h"
 #include "Engine/Entity/EntitySerialization.h"
 #include "System/Resource/ResourceProviders/ResourceNetworkMessages.h"
@@ -50,6 +51,14 @@ namespace EE::Resource
             return false;
         }
 
+        // Trim the raw asset cache, this is done here since the compiler processes run concurrently
+        //-------------------------------------------------------------------------
+
+        if ( m_settings.m_rawAssetCachePath.IsValid() )
+        {
+            RawAssets::RawAssetCache::TrimCache( m_settings.m_rawAssetCachePath, uint64_t( m_settings.m_rawAssetCacheMaxSizeMB ) * 1024 * 1024 );
+        }
+
         // Open network connection
         //-------------------------------------------------------------------------
 
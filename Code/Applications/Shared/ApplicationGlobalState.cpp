@@ -1,5 +1,6 @@
 #include "ApplicationGlobalState.h"
 #include "System/TypeSystem/CoreTypeIDs.h"
+#include "System/Resource/ResourcePathTable.h"
 #include "System/Memory/Memory.h"
 #include "System/Types/StringID.h"
 #include "System/Profiling.h"
@@ -29,6 +30,7 @@ namespace EE
 
         Log::Initialize();
 
+        ResourcePathTable::Initialize();
         TypeSystem::CoreTypeRegistry::Initialize();
 
         g_platformInitialized = true;
@@ -44,6 +46,7 @@ namespace EE
             m_primaryState = false;
 
             TypeSystem::CoreTypeRegistry::Shutdown();
+            ResourcePathTable::Shutdown();
 
             Log::Shutdown();
 
@@ -258,6 +258,10 @@ namespace EE
 
         ReadLayoutSettings();
 
+        // Logging is done asynchronously, the log thread streams all entries to the log file
+        FileSystem::Path const logFilePath( m_applicationNameNoWhitespace + "Log.txt" );
+        Log::EnableAsyncMode( logFilePath );
+
         // Window
         //-------------------------------------------------------------------------
 
@@ -303,8 +307,8 @@ namespace EE
         bool const shutdownResult = Shutdown();
         m_initialized = false;
 
-        FileSystem::Path const LogFilePath( m_applicationNameNoWhitespace + "Log.txt" );
-        Log::SaveToFile( LogFilePath );
+        // Flushes all remaining entries to the log file
+        Log::DisableAsyncMode();
 
         //-------------------------------------------------------------------------
 
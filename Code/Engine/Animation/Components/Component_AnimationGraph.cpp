@@ -67,8 +67,53 @@ namespace EE::Animation
     void AnimationGraphComponent::EvaluateGraph( Seconds deltaTime, Transform const& characterWorldTransform, Physics::Scene* pPhysicsScene )
     {
         EE_ASSERT( HasGraph() );
-        auto const result = m_pGraphInstance->EvaluateGraph( deltaTime, characterWorldTransform, pPhysicsScene );
-        m_rootMotionDelta = result.m_rootMotionDelta;
+
+        Seconds const evaluationDeltaTime = deltaTime + m_skippedDeltaTime;
+        auto const result = m_pGraphInstance->EvaluateGraph( evaluationDeltaTime, characterWorldTransform, pPhysicsScene );
+
+        // Remove any root motion we already applied on skipped frames so that the total root motion applied matches the graph
+        if ( m_skippedDeltaTime > 0.0f )
+        {
+            m_rootMotionDelta = result.m_rootMotionDelta * m_extrapolatedRootMotionDelta.GetInverse();
+        }
+        else
+        {
+            m_rootMotionDelta = result.m_rootMotionDelta;
+        }
+
+        m_lastEvaluatedRootMotionDelta = result.m_rootMotionDelta;
+        m_lastEvaluationDeltaTime = evaluationDeltaTime;
+        m_extrapolatedRootMotionDelta = Transform::Identity;
+        m_skippedDeltaTime = 0.0f;
+        m_wasEvaluatedThisFrame = true;
+    }
+
+    void AnimationGraphComponent::SkipGraphEvaluation( Seconds deltaTime )
+    {
+        EE_ASSERT( HasGraph() );
+
+        m_wasEvaluatedThisFrame = false;
+
+        // Paused components dont accumulate time or produce root motion
+        if ( m_updateRate == AnimationUpdateRate::Paused )
+        {
+            m_rootMotionDelta = Transform::Identity;
+            return;
+        }
+
+        // Extrapolate the root motion based on the last evaluation, this will be corrected on the next evaluation
+        if ( m_lastEvaluationDeltaTime > 0.0f )
+        {
+            float const t = Math::Clamp( deltaTime.ToFloat() / m_lastEvaluationDeltaTime.ToFloat(), 0.0f, 1.0f );
+            m_rootMotionDelta = Transform::Slerp( Transform::Identity, m_lastEvaluatedRootMotionDelta, t );
+        }
+        else
+        {
+            m_rootMotionDelta = Transform::Identity;
+        }
+
+        m_extrapolatedRootMotionDelta = m_rootMotionDelta * m_extrapolatedRootMotionDelta;
+        m_skippedDeltaTime += deltaTime;
     }
 
     void AnimationGraphComponent::ExecutePrePhysicsTasks( Seconds deltaTime, Transform const& characterWorldTransform )
@@ -6,6 +6,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { class SpatialEntityComponent; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Animation
 {
     enum class TaskSystemDebugMode;
@@ -13,11 +17,23 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    // How often should we evaluate a graph component - set by the animation world system based on the significance of the character
+    enum class AnimationUpdateRate : uint8_t
+    {
+        EveryFrame = 0,
+        EverySecondFrame,
+        EveryFourthFrame,
+        Paused,
+    };
+
+    //-------------------------------------------------------------------------
+
     class EE_ENGINE_API AnimationGraphComponent final : public EntityComponent
     {
         EE_REGISTER_ENTITY_COMPONENT( AnimationGraphComponent );
 
         friend class AnimationDebugView;
+        friend class AnimationWorldSystem;
         friend class GraphController;
 
     public:
@@ -58,14 +74,63 @@ namespace EE::Animation
         void ResetGraphState();
 
         // This function will evaluate the graph and produce the desired root motion delta for the character
+        // Note: if previous evaluations were skipped, the graph will be evaluated for the accumulated time and the root motion delta will be corrected for the extrapolated root motion already applied
         void EvaluateGraph( Seconds deltaTime, Transform const& characterWorldTransform, Physics::Scene* pPhysicsScene );
 
+        // This function is called instead of 'EvaluateGraph' on frames where the update rate scheduler skips this component
+        // It accumulates the skipped time and sets the root motion delta to an extrapolation of the last evaluated root motion
+        void SkipGraphEvaluation( Seconds deltaTime );
+
         // This function will execute all pre-physics tasks - it assumes that the character has already been moved in the scene, so expects the final transform for this frame
         void ExecutePrePhysicsTasks( Seconds deltaTime, Transform const& characterWorldTransform );
 
         // The function will execute the post-physics tasks (if any)
         void ExecutePostPhysicsTasks();
 
+        // Update Rate
+        //-------------------------------------------------------------------------
+
+        inline AnimationUpdateRate GetUpdateRate() const { return m_updateRate; }
+
+        // Set the update rate for this component, this is managed by the animation world system
+        inline void SetUpdateRate( AnimationUpdateRate updateRate ) { m_updateRate = updateRate; }
+
+        // Set the frame offset used to stagger the evaluation of throttled components across frames
+        inline void SetUpdateFrameOffset( uint8_t offset ) { m_updateFrameOffset = offset; }
+
+        // Get the number of frames between each evaluation (0 for paused components)
+        inline int32_t GetUpdateInterval() const
+        {
+            constexpr static int32_t const intervals[] = { 1, 2, 4, 0 };
+            return intervals[(uint8_t) m_updateRate];
+        }
+
+        // Should we evaluate the graph on the specified frame given our update rate and stagger offset
+        inline bool ShouldEvaluateGraph( uint64_t frameID ) const
+        {
+            int32_t const interval = GetUpdateInterval();
+            return ( interval == 1 ) || ( interval > 1 && ( ( frameID + m_updateFrameOffset ) % interval ) == 0 );
+        }
+
+        // Was the graph evaluated this frame (i.e. do we have a new pose)
+        inline bool WasEvaluatedThisFrame() const { return m_wasEvaluatedThisFrame; }
+
+        // Parallel Evaluation
+        //-------------------------------------------------------------------------
+
+        // Hand off the pre-physics update of this component to the animation world system's parallel evaluation job
+        // The root component (if set) will have the root motion applied to it, if this component is set to apply root motion
+        inline void RequestParallelEvaluation( Transform const& characterWorldTransform, SpatialEntityComponent* pRootComponent )
+        {
+            EE_ASSERT( !m_requiresManualUpdate );
+            m_pendingCharacterWorldTransform = characterWorldTransform;
+            m_pPendingRootComponent = pRootComponent;
+            m_isParallelEvaluationPending = true;
+        }
+
+        // Get the estimated cost (in microseconds) of evaluating this graph, this is used to balance the parallel evaluation job
+        inline float GetEstimatedEvaluationCost() const { return m_estimatedEvaluationCost; }
+
         // Control Parameters
         //-------------------------------------------------------------------------
 
@@ -120,6 +185,10 @@ namespace EE::Animation
 
         // Draw all debug visualizations
         void DrawDebug( Drawing::DrawContext& drawingContext );
+
+        // Get the time spent on the last graph evaluation and on the last pre-physics task execution
+        inline Milliseconds GetDebugGraphEvaluationTime() const { return m_debugGraphEvaluationTime; }
+        inline Milliseconds GetDebugTaskExecutionTime() const { return m_debugTaskExecutionTime; }
         #endif
 
     protected:
@@ -134,6 +203,27 @@ namespace EE::Animation
         GraphInstance*                                          m_pGraphInstance = nullptr;
         SampledEventsBuffer                                     m_sampledEventsBuffer;
         Transform                                               m_rootMotionDelta = Transform::Identity;
+
+        // Update rate scheduling
+        Transform                                               m_lastEvaluatedRootMotionDelta = Transform::Identity;
+        Transform                                               m_extrapolatedRootMotionDelta = Transform::Identity; // The root motion applied on skipped frames since the last evaluation
+        Seconds                                                 m_lastEvaluationDeltaTime = 0.0f;
+        Seconds                                                 m_skippedDeltaTime = 0.0f;
+        AnimationUpdateRate                                     m_updateRate = AnimationUpdateRate::EveryFrame;
+        uint8_t                                                 m_updateFrameOffset = 0;
+        bool                                                    m_wasEvaluatedThisFrame = false;
+
+        // Parallel evaluation
+        Transform                                               m_pendingCharacterWorldTransform = Transform::Identity;
+        SpatialEntityComponent*                                 m_pPendingRootComponent = nullptr;
+        float                                                   m_estimatedEvaluationCost = 0.0f;
+        bool                                                    m_isParallelEvaluationPending = false;
+
+        #if EE_DEVELOPMENT_TOOLS
+        Milliseconds                                            m_debugGraphEvaluationTime = 0.0f;
+        Milliseconds                                            m_debugTaskExecutionTime = 0.0f;
+        #endif
+
         EE_EXPOSE bool                                          m_requiresManualUpdate = false;  // Does this component require a manual update via a custom entity system?
         EE_EXPOSE bool                                          m_applyRootMotionToEntity = false; // Should we apply the root motion delta automatically to the character once we evaluate the graph. (Note: only works if we dont require a manual update)
     };
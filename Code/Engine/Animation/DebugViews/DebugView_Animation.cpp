@@ -322,6 +322,48 @@ namespace EE::Animation
         }
     }
 
+    void AnimationDebugView::DrawEvaluationTimingsView( EntityWorld const* pWorld, AnimationWorldSystem* pAnimationWorldSystem )
+    {
+        constexpr static char const* const updateRateNames[] = { "Every Frame", "Every Second Frame", "Every Fourth Frame", "Paused" };
+
+        if ( ImGui::BeginTable( "EvaluationTimingsTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable ) )
+        {
+            ImGui::TableSetupColumn( "Component", ImGuiTableColumnFlags_WidthStretch );
+            ImGui::TableSetupColumn( "Update Rate", ImGuiTableColumnFlags_WidthFixed, 120 );
+            ImGui::TableSetupColumn( "Graph (ms)", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Tasks (ms)", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Estimated Cost (us)", ImGuiTableColumnFlags_WidthFixed, 120 );
+            ImGui::TableHeadersRow();
+
+            InlineString componentName;
+            for ( AnimationGraphComponent* pGraphComponent : pAnimationWorldSystem->m_graphComponents )
+            {
+                auto pEntity = pWorld->FindEntity( pGraphComponent->GetEntityID() );
+                EE_ASSERT( pEntity != nullptr );
+
+                ImGui::TableNextRow();
+
+                ImGui::TableNextColumn();
+                componentName.sprintf( "%s (%s)", pGraphComponent->GetName().c_str(), pEntity->GetName().c_str() );
+                ImGui::Text( componentName.c_str() );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( updateRateNames[(uint8_t) pGraphComponent->GetUpdateRate()] );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", pGraphComponent->GetDebugGraphEvaluationTime().ToFloat() );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", pGraphComponent->GetDebugTaskExecutionTime().ToFloat() );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.1f", pGraphComponent->GetEstimatedEvaluationCost() );
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
     //-------------------------------------------------------------------------
 
     AnimationDebugView::AnimationDebugView()
@@ -374,6 +416,29 @@ namespace EE::Animation
 
     void AnimationDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
+        ImGuiX::TextSeparator( "Performance" );
+
+        bool isParallelEvaluationEnabled = m_pAnimationWorldSystem->IsParallelEvaluationEnabled();
+        if ( ImGui::Checkbox( "Parallel Evaluation", &isParallelEvaluationEnabled ) )
+        {
+            m_pAnimationWorldSystem->SetParallelEvaluationEnabled( isParallelEvaluationEnabled );
+        }
+
+        bool isUpdateRateThrottlingEnabled = m_pAnimationWorldSystem->IsUpdateRateThrottlingEnabled();
+        if ( ImGui::Checkbox( "Update Rate Throttling", &isUpdateRateThrottlingEnabled ) )
+        {
+            m_pAnimationWorldSystem->SetUpdateRateThrottlingEnabled( isUpdateRateThrottlingEnabled );
+        }
+
+        if ( ImGui::MenuItem( "Show Evaluation Timings" ) )
+        {
+            m_drawEvaluationTimings = true;
+        }
+
+        ImGuiX::TextSeparator( "Graphs" );
+
+        //-------------------------------------------------------------------------
+
         InlineString componentName;
         for ( AnimationGraphComponent* pGraphComponent : m_pAnimationWorldSystem->m_graphComponents )
         {
@@ -388,6 +453,9 @@ namespace EE::Animation
             componentName.sprintf( "%s (%s)", pGraphComponent->GetName().c_str(), pEntity->GetName().c_str() );
             if ( ImGui::BeginMenu( componentName.c_str() ) )
             {
+                constexpr static char const* const updateRateNames[] = { "Every Frame", "Every Second Frame", "Every Fourth Frame", "Paused" };
+                ImGui::Text( "Update Rate: %s", updateRateNames[(uint8_t) pGraphComponent->GetUpdateRate()] );
+
                 ImGuiX::TextSeparator( "Graph" );
 
                 if ( ImGui::MenuItem( "Show Control Parameters" ) )
@@ -433,6 +501,18 @@ namespace EE::Animation
 
                 //-------------------------------------------------------------------------
 
+                ImGuiX::TextSeparator( "Value Nodes" );
+                {
+                    GraphInstance* pGraphInstance = pGraphComponent->GetDebugGraphInstance();
+                    bool areValueProgramsEnabled = pGraphInstance->AreValueProgramsEnabled();
+                    if ( ImGui::Checkbox( "Use Compiled Value Programs", &areValueProgramsEnabled ) )
+                    {
+                        pGraphInstance->SetValueProgramsEnabled( areValueProgramsEnabled );
+                    }
+                }
+
+                //-------------------------------------------------------------------------
+
                 ImGuiX::TextSeparator( "Tasks" );
 
                 if ( ImGui::MenuItem( "Show Active Tasks" ) )
@@ -478,6 +558,18 @@ namespace EE::Animation
 
     void AnimationDebugView::DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass )
     {
+        if ( m_drawEvaluationTimings )
+        {
+            ImGui::SetNextWindowSize( ImVec2( 700, 400 ), ImGuiCond_FirstUseEver );
+            if ( ImGui::Begin( "Animation Evaluation Timings", &m_drawEvaluationTimings, ImGuiWindowFlags_NoSavedSettings ) )
+            {
+                DrawEvaluationTimingsView( m_pWorld, m_pAnimationWorldSystem );
+            }
+            ImGui::End();
+        }
+
+        //-------------------------------------------------------------------------
+
         InlineString title;
 
         for ( int32_t i = (int32_t) m_componentRuntimeSettings.size() - 1; i >= 0; i-- )
@@ -39,6 +39,7 @@ namespace EE::Animation
         static void DrawGraphActiveTasksDebugView( GraphInstance* pGraphInstance );
         static void DrawRootMotionDebugView( GraphInstance* pGraphInstance );
         static void DrawGraphSampledEventsView( GraphInstance* pGraphInstance );
+        static void DrawEvaluationTimingsView( EntityWorld const* pWorld, AnimationWorldSystem* pAnimationWorldSystem );
 
     private:
 
@@ -64,6 +65,7 @@ namespace EE::Animation
         EntityWorld const*                      m_pWorld = nullptr;
         AnimationWorldSystem*                   m_pAnimationWorldSystem = nullptr;
         TVector<ComponentDebugState>         m_componentRuntimeSettings;
+        bool                                    m_drawEvaluationTimings = false;
     };
 }
 #endif
\ No newline at end of file
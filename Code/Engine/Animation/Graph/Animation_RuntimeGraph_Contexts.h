@@ -5,6 +5,7 @@
 #include "System/Math/Transform.h"
 #include "System/Time/Time.h"
 #include "System/Types/Arrays.h"
+#include "System/Types/FlatHashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -20,6 +21,7 @@ namespace EE::Animation
     class GraphNode;
     class GraphDataSet;
     class GraphInstance;
+    class ValueProgramInterpreter;
 
     //-------------------------------------------------------------------------
     // Instantiation Context
@@ -87,7 +89,7 @@ namespace EE::Animation
 
         TVector<GraphNode*> const&                  m_nodePtrs;
         TInlineVector<GraphInstance*, 20> const&    m_childGraphInstances;
-        THashMap<StringID, int16_t> const&          m_parameterLookupMap;
+        TFlatHashMap<StringID, int16_t> const&      m_parameterLookupMap;
         GraphDataSet const*                         m_pDataSet;
         uint64_t                                    m_userID;
     };
@@ -152,7 +154,14 @@ namespace EE::Animation
 
         #if EE_DEVELOPMENT_TOOLS
         // Flag a node as active
-        inline void TrackActiveNode( int16_t nodeIdx ) { EE_ASSERT( nodeIdx != InvalidIndex ); m_pActiveNodes->emplace_back( nodeIdx ); }
+        inline void TrackActiveNode( int16_t nodeIdx )
+        {
+            EE_ASSERT( nodeIdx != InvalidIndex );
+            if ( m_pActiveNodes != nullptr )
+            {
+                m_pActiveNodes->emplace_back( nodeIdx );
+            }
+        }
 
         // Root Motion
         inline RootMotionDebugger* GetRootMotionDebugger() { return m_pRootMotionDebugger; }
@@ -178,6 +187,7 @@ namespace EE::Animation
         // Set at initialization time
         TaskSystem*                             m_pTaskSystem = nullptr;
         Pose const*                             m_pPreviousPose = nullptr;
+        ValueProgramInterpreter*                m_pValueProgramInterpreter = nullptr; // Optional, only needed if the graph has compiled value programs
 
         // Runtime Values
         Transform                               m_worldTransform = Transform::Identity;
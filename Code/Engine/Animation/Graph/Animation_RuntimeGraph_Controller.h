@@ -27,15 +27,17 @@ namespace EE::Animation
 
         public:
 
+            // A typed handle to a single control parameter
+            // The parameter is resolved once when binding, setting the value then writes directly into the parameter node
+            // Only the parameter index is stored since the parameter nodes belong to the graph instance and so are not stable across graph instance recreation
             template<typename ParameterType>
             class ControlParameter final
             {
-
             public:
 
                 ControlParameter( char const* parameterName ) : m_ID( parameterName ) {}
 
-                inline bool IsBound() const { return m_index != InvalidIndex; }
+                inline bool IsBound() const { return m_parameterIdx != InvalidIndex; }
 
                 // Bind a control Parameter to a graph instance
                 bool TryBind( GraphControllerBase * pController )
@@ -43,9 +45,11 @@ namespace EE::Animation
                     EE_ASSERT( m_ID.IsValid() );
                     EE_ASSERT( pController != nullptr && pController->m_pGraphInstance != nullptr );
 
+                    m_parameterIdx = InvalidIndex;
+
                     // Try to find parameter
-                    m_index = pController->m_pGraphInstance->GetControlParameterIndex( m_ID );
-                    if ( m_index == InvalidIndex )
+                    int16_t const parameterIdx = pController->m_pGraphInstance->GetControlParameterIndex( m_ID );
+                    if ( parameterIdx == InvalidIndex )
                     {
                         #if EE_DEVELOPMENT_TOOLS
                         EE_LOG_WARNING( "Animation", "Failed to bind to control parameter (%s): parameter not found. Controller (%s) and graph (%s)", m_ID.c_str(), pController->GetName(), pController->m_pGraphInstance->GetResourceID().c_str() );
@@ -55,25 +59,25 @@ namespace EE::Animation
                     }
 
                     // Validate parameter type
-                    if ( pController->m_pGraphInstance->GetControlParameterType( m_index ) != ValueTypeValidation<ParameterType>::Type )
+                    if ( pController->m_pGraphInstance->GetControlParameterType( parameterIdx ) != ValueTypeValidation<ParameterType>::Type )
                     {
                         #if EE_DEVELOPMENT_TOOLS
                         EE_LOG_WARNING( "Animation", "Failed to bind to control parameter (%s): type mismatch. Controller (%s) and graph (%s)", m_ID.c_str(), pController->GetName(), pController->m_pGraphInstance->GetResourceID().c_str() );
                         #endif
 
-                        m_index = InvalidIndex;
                         return false;
                     }
 
+                    m_parameterIdx = parameterIdx;
                     return true;
                 }
 
                 // Set Control Parameter Value
                 void Set( GraphControllerBase* pController, ParameterType const& value )
                 {
-                    if ( m_index != InvalidIndex )
+                    if ( m_parameterIdx != InvalidIndex )
                     {
-                        pController->m_pGraphInstance->SetControlParameterValue<ParameterType>( m_index, value );
+                        pController->m_pGraphInstance->GetControlParameterNode<ParameterType>( m_parameterIdx )->SetParameterValue( value );
                     }
                     else
                     {
@@ -86,7 +90,104 @@ namespace EE::Animation
             private:
 
                 StringID                        m_ID;
-                int16_t                         m_index = InvalidIndex;
+                int16_t                         m_parameterIdx = InvalidIndex;
+            };
+
+            // A set of control parameters that are all set at once from a packed struct of values
+            // Each parameter is mapped to a member of the struct, all parameters are resolved to indices when binding and setting the block writes each value directly into its parameter node
+            template<typename ParameterBlockType>
+            class ControlParameterBlock final
+            {
+                struct Binding
+                {
+                    StringID                    m_ID;
+                    int16_t                     m_parameterIdx = InvalidIndex;
+                    uint16_t                    m_offset = 0;
+                    GraphValueType              m_valueType = GraphValueType::Unknown;
+                };
+
+            public:
+
+                // Map a parameter to a member of the parameter block, needs to be called before binding
+                template<typename ParameterType>
+                void AddParameter( char const* parameterName, ParameterType ParameterBlockType::* pMember )
+                {
+                    static_assert( ValueTypeValidation<ParameterType>::Type != GraphValueType::Unknown, "Unsupported parameter type" );
+
+                    ParameterBlockType const block;
+                    auto& binding = m_bindings.emplace_back();
+                    binding.m_ID = StringID( parameterName );
+                    binding.m_offset = uint16_t( reinterpret_cast<uint8_t const*>( &( block.*pMember ) ) - reinterpret_cast<uint8_t const*>( &block ) );
+                    binding.m_valueType = ValueTypeValidation<ParameterType>::Type;
+                }
+
+                // Are all the parameters in this block bound
+                inline bool IsBound() const { return m_numBoundParameters == (int32_t) m_bindings.size(); }
+
+                // Bind all the parameters in this block to a graph instance, returns false if any of the parameters failed to bind
+                bool TryBind( GraphControllerBase* pController )
+                {
+                    EE_ASSERT( pController != nullptr && pController->m_pGraphInstance != nullptr );
+
+                    m_numBoundParameters = 0;
+                    for ( auto& binding : m_bindings )
+                    {
+                        binding.m_parameterIdx = InvalidIndex;
+
+                        int16_t const parameterIdx = pController->m_pGraphInstance->GetControlParameterIndex( binding.m_ID );
+                        if ( parameterIdx == InvalidIndex )
+                        {
+                            #if EE_DEVELOPMENT_TOOLS
+                            EE_LOG_WARNING( "Animation", "Failed to bind to control parameter (%s): parameter not found. Controller (%s) and graph (%s)", binding.m_ID.c_str(), pController->GetName(), pController->m_pGraphInstance->GetResourceID().c_str() );
+                            #endif
+                            continue;
+                        }
+
+                        if ( pController->m_pGraphInstance->GetControlParameterType( parameterIdx ) != binding.m_valueType )
+                        {
+                            #if EE_DEVELOPMENT_TOOLS
+                            EE_LOG_WARNING( "Animation", "Failed to bind to control parameter (%s): type mismatch. Controller (%s) and graph (%s)", binding.m_ID.c_str(), pController->GetName(), pController->m_pGraphInstance->GetResourceID().c_str() );
+                            #endif
+                            continue;
+                        }
+
+                        binding.m_parameterIdx = parameterIdx;
+                        m_numBoundParameters++;
+                    }
+
+                    return IsBound();
+                }
+
+                // Set all the bound parameters from the supplied values, unbound parameters are skipped
+                void Set( GraphControllerBase* pController, ParameterBlockType const& values )
+                {
+                    uint8_t const* pValues = reinterpret_cast<uint8_t const*>( &values );
+                    for ( auto const& binding : m_bindings )
+                    {
+                        if ( binding.m_parameterIdx == InvalidIndex )
+                        {
+                            continue;
+                        }
+
+                        ValueNode* pNode = pController->m_pGraphInstance->GetControlParameterNode( binding.m_parameterIdx );
+                        void const* pValue = pValues + binding.m_offset;
+                        switch ( binding.m_valueType )
+                        {
+                            case GraphValueType::Bool: static_cast<GraphNodes::ControlParameterBoolNode*>( pNode )->SetParameterValue( *reinterpret_cast<bool const*>( pValue ) ); break;
+                            case GraphValueType::ID: static_cast<GraphNodes::ControlParameterIDNode*>( pNode )->SetParameterValue( *reinterpret_cast<StringID const*>( pValue ) ); break;
+                            case GraphValueType::Int: static_cast<GraphNodes::ControlParameterIntNode*>( pNode )->SetParameterValue( *reinterpret_cast<int32_t const*>( pValue ) ); break;
+                            case GraphValueType::Float: static_cast<GraphNodes::ControlParameterFloatNode*>( pNode )->SetParameterValue( *reinterpret_cast<float const*>( pValue ) ); break;
+                            case GraphValueType::Vector: static_cast<GraphNodes::ControlParameterVectorNode*>( pNode )->SetParameterValue( *reinterpret_cast<Vector const*>( pValue ) ); break;
+                            case GraphValueType::Target: static_cast<GraphNodes::ControlParameterTargetNode*>( pNode )->SetParameterValue( *reinterpret_cast<Target const*>( pValue ) ); break;
+                            default: EE_UNREACHABLE_CODE(); break;
+                        }
+                    }
+                }
+
+            private:
+
+                TInlineVector<Binding, 8>       m_bindings;
+                int32_t                         m_numBoundParameters = 0;
             };
 
         protected:
@@ -143,6 +244,7 @@ namespace EE::Animation
     public:
 
         template<typename T> using ControlParameter = Internal::GraphControllerBase::ControlParameter<T>;
+        template<typename T> using ControlParameterBlock = Internal::GraphControllerBase::ControlParameterBlock<T>;
         using GraphControllerBase::GraphControllerBase;
 
     protected:
@@ -180,6 +282,7 @@ namespace EE::Animation
     public:
 
         template<typename T> using ControlParameter = Internal::GraphControllerBase::ControlParameter<T>;
+        template<typename T> using ControlParameterBlock = Internal::GraphControllerBase::ControlParameterBlock<T>;
 
     public:
 
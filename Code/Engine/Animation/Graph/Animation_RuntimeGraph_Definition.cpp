@@ -3,4 +3,16 @@
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
-{}
\ No newline at end of file
+{
+    int16_t GraphDefinition::GetControlParameterIndex( StringID parameterID ) const
+    {
+        // The lookup map also contains the virtual parameters, control parameters are always the first nodes so their node index is the parameter index
+        auto const foundIter = m_parameterLookupMap.find( parameterID );
+        if ( foundIter != m_parameterLookupMap.end() && foundIter->second < (int16_t) m_controlParameterIDs.size() )
+        {
+            return foundIter->second;
+        }
+
+        return InvalidIndex;
+    }
+}
\ No newline at end of file
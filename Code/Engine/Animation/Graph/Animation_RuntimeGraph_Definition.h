@@ -1,7 +1,9 @@
 #pragma once
 #include "Animation_RuntimeGraph_Node.h"
 #include "Animation_RuntimeGraph_DataSet.h"
+#include "Animation_RuntimeGraph_ValueProgram.h"
 #include "System/Resource/ResourcePtr.h"
+#include "System/Types/FlatHashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -10,7 +12,7 @@ namespace EE::Animation
     class EE_ENGINE_API GraphDefinition final : public Resource::IResource
     {
         EE_REGISTER_RESOURCE( 'ag', "Animation Graph" );
-        EE_SERIALIZE( m_persistentNodeIndices, m_instanceNodeStartOffsets, m_instanceRequiredMemory, m_instanceRequiredAlignment, m_rootNodeIdx, m_controlParameterIDs, m_virtualParameterIDs, m_virtualParameterNodeIndices, m_childGraphSlots, m_externalGraphSlots );
+        EE_SERIALIZE( m_persistentNodeIndices, m_instanceNodeStartOffsets, m_instanceRequiredMemory, m_instanceRequiredAlignment, m_rootNodeIdx, m_controlParameterIDs, m_virtualParameterIDs, m_virtualParameterNodeIndices, m_childGraphSlots, m_externalGraphSlots, m_valuePrograms );
 
         friend class GraphDefinitionCompiler;
         friend class AnimationGraphCompiler;
@@ -45,6 +47,9 @@ namespace EE::Animation
 
         virtual bool IsValid() const override { return m_rootNodeIdx != InvalidIndex; }
 
+        // Find the node index for a given control parameter ID, returns InvalidIndex if not found
+        int16_t GetControlParameterIndex( StringID parameterID ) const;
+
         #if EE_DEVELOPMENT_TOOLS
         String const& GetNodePath( int16_t nodeIdx ) const{ return m_nodePaths[nodeIdx]; }
         #endif
@@ -61,7 +66,8 @@ namespace EE::Animation
         TVector<int16_t>                            m_virtualParameterNodeIndices;
         TVector<ChildGraphSlot>                     m_childGraphSlots;
         TVector<ExternalGraphSlot>                  m_externalGraphSlots;
-        THashMap<StringID, int16_t>                 m_parameterLookupMap;
+        GraphValuePrograms                          m_valuePrograms;
+        TFlatHashMap<StringID, int16_t>             m_parameterLookupMap;
 
         #if EE_DEVELOPMENT_TOOLS
         TVector<String>                             m_nodePaths;
@@ -89,12 +89,16 @@ namespace EE::Animation
             pGraphDef->m_nodeSettings[i]->InstantiateNode( context, InstantiationOptions::CreateNode );
         }
 
+        // Bind the compiled value programs to the instantiated nodes
+        m_valueProgramInterpreter.Initialize( &pGraphDef->m_valuePrograms, m_nodes.data() );
+
         // Set up graph context
         //-------------------------------------------------------------------------
 
         // Initialize context
         m_graphContext.Initialize( isStandaloneGraphInstance ? m_pTaskSystem : pTaskSystem );
         EE_ASSERT( m_graphContext.IsValid() );
+        m_graphContext.m_pValueProgramInterpreter = &m_valueProgramInterpreter;
 
         #if EE_DEVELOPMENT_TOOLS
         m_graphContext.SetDebugSystems( &m_rootMotionDebugger, &m_activeNodes );
@@ -132,7 +136,9 @@ namespace EE::Animation
         m_pRootNode = nullptr;
 
         // Shutdown context
+        m_graphContext.m_pValueProgramInterpreter = nullptr;
         m_graphContext.Shutdown();
+        m_valueProgramInterpreter.Shutdown();
 
         //-------------------------------------------------------------------------
 
@@ -385,6 +391,19 @@ namespace EE::Animation
         return m_pTaskSystem->GetCharacterWorldTransform();
     }
 
+    void GraphInstance::SetValueProgramsEnabled( bool areEnabled )
+    {
+        m_valueProgramInterpreter.SetProgramsEnabled( areEnabled );
+
+        for ( auto const& childGraph : m_childGraphs )
+        {
+            if ( childGraph.m_pInstance != nullptr )
+            {
+                childGraph.m_pInstance->SetValueProgramsEnabled( areEnabled );
+            }
+        }
+    }
+
     void GraphInstance::GetChildGraphsForDebug( TVector<DebuggableChildGraph>& outChildGraphInstances, String const& pathPrefix ) const
     {
         for ( auto const& childGraph : m_childGraphs )
@@ -2,6 +2,7 @@
 #include "Animation_RuntimeGraph_Definition.h"
 #include "Animation_RuntimeGraph_RootMotionDebugger.h"
 #include "Animation_RuntimeGraph_Contexts.h"
+#include "Nodes/Animation_RuntimeGraphNode_Parameters.h"
 #include "System/Types/PointerID.h"
 
 //-------------------------------------------------------------------------
@@ -126,18 +127,10 @@ namespace EE::Animation
 
         inline int32_t GetNumControlParameters() const { return (int32_t) m_pGraphVariation->m_pGraphDefinition->m_controlParameterIDs.size(); }
 
+        // Get the index for a specified parameter - prefer resolving parameters once (i.e. via a controller's ControlParameter) instead of per frame
         inline int16_t GetControlParameterIndex( StringID parameterID ) const
         {
-            int32_t const numParams = GetNumControlParameters();
-            for ( int16_t i = 0; i < numParams; i++ )
-            {
-                if ( m_pGraphVariation->m_pGraphDefinition->m_controlParameterIDs[i] == parameterID )
-                {
-                    return i;
-                }
-            }
-
-            return InvalidIndex;
+            return m_pGraphVariation->m_pGraphDefinition->GetControlParameterIndex( parameterID );
         }
 
         inline StringID GetControlParameterID( int16_t parameterNodeIdx )
@@ -166,6 +159,21 @@ namespace EE::Animation
             return static_cast<ValueNode*>( m_nodes[parameterNodeIdx] )->GetValue<T>( const_cast<GraphContext&>( m_graphContext ) );
         }
 
+        // Get the actual parameter node, this allows for setting the parameter value directly without any lookups or virtual calls
+        inline ValueNode* GetControlParameterNode( int16_t parameterNodeIdx ) const
+        {
+            EE_ASSERT( IsControlParameter( parameterNodeIdx ) );
+            return static_cast<ValueNode*>( m_nodes[parameterNodeIdx] );
+        }
+
+        template<typename T>
+        inline typename GraphNodes::ControlParameterNodeType<T>::Type* GetControlParameterNode( int16_t parameterNodeIdx ) const
+        {
+            ValueNode* pParameterNode = GetControlParameterNode( parameterNodeIdx );
+            EE_ASSERT( pParameterNode->GetValueType() == ValueTypeValidation<T>::Type );
+            return static_cast<typename GraphNodes::ControlParameterNodeType<T>::Type*>( pParameterNode );
+        }
+
         // External Graphs
         //-------------------------------------------------------------------------
 
@@ -236,6 +244,12 @@ namespace EE::Animation
         // Get all connected external graphs
         inline TVector<ExternalGraph> const& GetExternalGraphsForDebug() const { return m_externalGraphs; }
 
+        // Are the compiled value programs used to evaluate the value nodes
+        inline bool AreValueProgramsEnabled() const { return m_valueProgramInterpreter.AreProgramsEnabled(); }
+
+        // Toggle the compiled value programs - when disabled, all value nodes are evaluated through the regular node path (useful for debugging)
+        void SetValueProgramsEnabled( bool areEnabled );
+
         // Get the value of a specified value node
         template<typename T>
         inline T GetRuntimeNodeDebugValue( int16_t nodeIdx ) const
@@ -273,6 +287,7 @@ namespace EE::Animation
 
         TaskSystem*                             m_pTaskSystem = nullptr;
         GraphContext                            m_graphContext;
+        ValueProgramInterpreter                 m_valueProgramInterpreter;
         TVector<ChildGraph>                     m_childGraphs;
         TVector<ExternalGraph>                  m_externalGraphs;
 
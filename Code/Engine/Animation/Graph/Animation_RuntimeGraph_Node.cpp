@@ -1,4 +1,5 @@
 #include "Animation_RuntimeGraph_Node.h"
+#include "Animation_RuntimeGraph_ValueProgram.h"
 
 //-------------------------------------------------------------------------
 
@@ -189,4 +190,12 @@ namespace EE::Animation
         return info;
     }
     #endif
+
+    //-------------------------------------------------------------------------
+
+    void ValueNode::GetValueFromProgram( GraphContext& context, void* pValue )
+    {
+        EE_ASSERT( context.m_pValueProgramInterpreter != nullptr );
+        context.m_pValueProgramInterpreter->Evaluate( m_valueProgramIdx, context, pValue );
+    }
 }
\ No newline at end of file
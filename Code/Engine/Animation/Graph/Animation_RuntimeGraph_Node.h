@@ -231,6 +231,8 @@ namespace EE::Animation
 
     class EE_ENGINE_API ValueNode : public GraphNode
     {
+        friend class ValueProgramInterpreter;
+
     public:
 
         template<typename T>
@@ -238,7 +240,17 @@ namespace EE::Animation
         {
             EE_ASSERT( ValueTypeValidation<T>::Type == GetValueType() );
             T Value;
-            GetValueInternal( context, &Value );
+
+            // If this node is the root of a compiled value program, run the program instead of the node logic
+            if ( m_valueProgramIdx != InvalidIndex )
+            {
+                GetValueFromProgram( context, &Value );
+            }
+            else
+            {
+                GetValueInternal( context, &Value );
+            }
+
             return Value;
         }
 
@@ -253,6 +265,14 @@ namespace EE::Animation
 
         virtual void GetValueInternal( GraphContext& context, void* pValue ) = 0;
         virtual void SetValueInternal( void const* pValue ) { EE_ASSERT( false ); };
+
+    private:
+
+        void GetValueFromProgram( GraphContext& context, void* pValue );
+
+    private:
+
+        int16_t                         m_valueProgramIdx = InvalidIndex; // Set by the interpreter if this node is the root of a value program
     };
 
     //-------------------------------------------------------------------------
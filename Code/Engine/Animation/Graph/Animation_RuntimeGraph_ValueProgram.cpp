@@ -0,0 +1,346 @@
+#include "Animation_RuntimeGraph_ValueProgram.h"
+#include "Animation_RuntimeGraph_Contexts.h"
+#include "Nodes/Animation_RuntimeGraphNode_Parameters.h"
+#include "Nodes/Animation_RuntimeGraphNode_Vectors.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    void ValueProgramInterpreter::Initialize( GraphValuePrograms const* pPrograms, GraphNode* const* pNodes )
+    {
+        EE_ASSERT( m_pPrograms == nullptr && m_pNodes == nullptr );
+        EE_ASSERT( pPrograms != nullptr && pNodes != nullptr );
+
+        m_pPrograms = pPrograms;
+        m_pNodes = pNodes;
+        m_registers.resize( m_pPrograms->m_numRegisters, Vector::Zero );
+
+        // A program can run other programs through its 'LoadXXXNode' instructions, so every register written by a program must belong to that program alone
+        #if EE_DEVELOPMENT_TOOLS
+        TVector<int16_t> registerOwners( m_pPrograms->m_numRegisters, InvalidIndex );
+        int16_t const numPrograms = (int16_t) m_pPrograms->m_programs.size();
+        for ( int16_t programIdx = 0; programIdx < numPrograms; programIdx++ )
+        {
+            ValueProgram const& program = m_pPrograms->m_programs[programIdx];
+            for ( uint32_t i = 0; i < program.m_numInstructions; i++ )
+            {
+                ValueProgramInstruction const& instruction = m_pPrograms->m_instructions[program.m_firstInstructionIdx + i];
+                if ( instruction.m_opCode == ValueProgramOpCode::Jump || instruction.m_opCode == ValueProgramOpCode::JumpIfTrue || instruction.m_opCode == ValueProgramOpCode::JumpIfFalse )
+                {
+                    continue;
+                }
+
+                EE_ASSERT( instruction.m_result >= 0 && instruction.m_result < m_pPrograms->m_numRegisters );
+                EE_ASSERT( registerOwners[instruction.m_result] == InvalidIndex || registerOwners[instruction.m_result] == programIdx );
+                registerOwners[instruction.m_result] = programIdx;
+            }
+        }
+        #endif
+
+        SetProgramsEnabled( true );
+    }
+
+    void ValueProgramInterpreter::Shutdown()
+    {
+        SetProgramsEnabled( false );
+
+        m_registers.clear();
+        m_pPrograms = nullptr;
+        m_pNodes = nullptr;
+    }
+
+    void ValueProgramInterpreter::SetProgramsEnabled( bool areEnabled )
+    {
+        EE_ASSERT( m_pPrograms != nullptr );
+
+        int16_t const numPrograms = (int16_t) m_pPrograms->m_programs.size();
+        for ( int16_t programIdx = 0; programIdx < numPrograms; programIdx++ )
+        {
+            auto pRootNode = static_cast<ValueNode*>( m_pNodes[m_pPrograms->m_programs[programIdx].m_rootNodeIdx] );
+            pRootNode->m_valueProgramIdx = areEnabled ? programIdx : InvalidIndex;
+        }
+
+        m_areProgramsEnabled = areEnabled;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ValueProgramInterpreter::Evaluate( int16_t programIdx, GraphContext& context, void* pOutValue )
+    {
+        EE_ASSERT( m_pPrograms != nullptr && programIdx >= 0 && programIdx < m_pPrograms->m_programs.size() );
+        ValueProgram const& program = m_pPrograms->m_programs[programIdx];
+
+        // The root node is used to cache the result for the current update
+        GraphNode* pRootNode = m_pNodes[program.m_rootNodeIdx];
+        if ( !pRootNode->WasUpdated( context ) )
+        {
+            pRootNode->MarkNodeActive( context );
+            Execute( program, context );
+        }
+
+        //-------------------------------------------------------------------------
+
+        Vector const& result = m_registers[program.m_resultRegisterIdx];
+        switch ( program.m_resultType )
+        {
+            case GraphValueType::Bool:
+            {
+                *reinterpret_cast<bool*>( pOutValue ) = result.m_x != 0.0f;
+            }
+            break;
+
+            case GraphValueType::Float:
+            {
+                *reinterpret_cast<float*>( pOutValue ) = result.m_x;
+            }
+            break;
+
+            case GraphValueType::Vector:
+            {
+                *reinterpret_cast<Vector*>( pOutValue ) = result;
+            }
+            break;
+
+            default:
+            {
+                EE_UNREACHABLE_CODE();
+            }
+            break;
+        }
+    }
+
+    void ValueProgramInterpreter::Execute( ValueProgram const& program, GraphContext& context )
+    {
+        ValueProgramInstruction const* pInstructions = &m_pPrograms->m_instructions[program.m_firstInstructionIdx];
+        Float4 const* pConstants = m_pPrograms->m_constants.data();
+        Vector* pRegisters = m_registers.data();
+
+        auto ToBool = [] ( Vector const& value ) { return value.m_x != 0.0f; };
+        auto FromBool = [] ( bool value ) { return value ? Vector::One : Vector::Zero; };
+
+        int32_t instructionIdx = 0;
+        while ( instructionIdx < program.m_numInstructions )
+        {
+            ValueProgramInstruction const& instruction = pInstructions[instructionIdx];
+            instructionIdx++;
+
+            switch ( instruction.m_opCode )
+            {
+                case ValueProgramOpCode::LoadConstant:
+                {
+                    pRegisters[instruction.m_result] = Vector( pConstants[instruction.m_operandA] );
+                }
+                break;
+
+                case ValueProgramOpCode::LoadBoolParameter:
+                {
+                    auto pParameterNode = static_cast<GraphNodes::ControlParameterBoolNode const*>( m_pNodes[instruction.m_operandA] );
+                    pRegisters[instruction.m_result] = FromBool( pParameterNode->GetParameterValue() );
+                }
+                break;
+
+                case ValueProgramOpCode::LoadFloatParameter:
+                {
+                    auto pParameterNode = static_cast<GraphNodes::ControlParameterFloatNode const*>( m_pNodes[instruction.m_operandA] );
+                    pRegisters[instruction.m_result] = Vector( pParameterNode->GetParameterValue() );
+                }
+                break;
+
+                case ValueProgramOpCode::LoadVectorParameter:
+                {
+                    auto pParameterNode = static_cast<GraphNodes::ControlParameterVectorNode const*>( m_pNodes[instruction.m_operandA] );
+                    pRegisters[instruction.m_result] = pParameterNode->GetParameterValue();
+                }
+                break;
+
+                case ValueProgramOpCode::LoadBoolNode:
+                {
+                    auto pValueNode = static_cast<ValueNode*>( m_pNodes[instruction.m_operandA] );
+                    pRegisters[instruction.m_result] = FromBool( pValueNode->GetValue<bool>( context ) );
+                }
+                break;
+
+                case ValueProgramOpCode::LoadFloatNode:
+                {
+                    auto pValueNode = static_cast<ValueNode*>( m_pNodes[instruction.m_operandA] );
+                    pRegisters[instruction.m_result] = Vector( pValueNode->GetValue<float>( context ) );
+                }
+                break;
+
+                case ValueProgramOpCode::LoadVectorNode:
+                {
+                    auto pValueNode = static_cast<ValueNode*>( m_pNodes[instruction.m_operandA] );
+                    pRegisters[instruction.m_result] = pValueNode->GetValue<Vector>( context );
+                }
+                break;
+
+                //-------------------------------------------------------------------------
+
+                case ValueProgramOpCode::Jump:
+                {
+                    instructionIdx = instruction.m_operandA;
+                }
+                break;
+
+                case ValueProgramOpCode::JumpIfTrue:
+                {
+                    if ( ToBool( pRegisters[instruction.m_operandA] ) )
+                    {
+                        instructionIdx = instruction.m_operandB;
+                    }
+                }
+                break;
+
+                case ValueProgramOpCode::JumpIfFalse:
+                {
+                    if ( !ToBool( pRegisters[instruction.m_operandA] ) )
+                    {
+                        instructionIdx = instruction.m_operandB;
+                    }
+                }
+                break;
+
+                //-------------------------------------------------------------------------
+
+                case ValueProgramOpCode::BoolNot:
+                {
+                    pRegisters[instruction.m_result] = FromBool( !ToBool( pRegisters[instruction.m_operandA] ) );
+                }
+                break;
+
+                //-------------------------------------------------------------------------
+
+                case ValueProgramOpCode::FloatAdd:
+                {
+                    pRegisters[instruction.m_result] = Vector( pRegisters[instruction.m_operandA].m_x + pRegisters[instruction.m_operandB].m_x );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatSub:
+                {
+                    pRegisters[instruction.m_result] = Vector( pRegisters[instruction.m_operandA].m_x - pRegisters[instruction.m_operandB].m_x );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatMul:
+                {
+                    pRegisters[instruction.m_result] = Vector( pRegisters[instruction.m_operandA].m_x * pRegisters[instruction.m_operandB].m_x );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatDiv:
+                {
+                    float const valueB = pRegisters[instruction.m_operandB].m_x;
+                    if ( Math::IsNearZero( valueB ) )
+                    {
+                        EE_LOG_WARNING( "Animation", "TODO", "Dividing by zero in FloatMathNode" );
+                        pRegisters[instruction.m_result] = Vector( FLT_MAX );
+                    }
+                    else
+                    {
+                        pRegisters[instruction.m_result] = Vector( pRegisters[instruction.m_operandA].m_x / valueB );
+                    }
+                }
+                break;
+
+                case ValueProgramOpCode::FloatAbs:
+                {
+                    pRegisters[instruction.m_result] = Vector( Math::Abs( pRegisters[instruction.m_operandA].m_x ) );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatClamp:
+                {
+                    Float4 const& range = pConstants[instruction.m_operandB];
+                    pRegisters[instruction.m_result] = Vector( Math::Clamp( pRegisters[instruction.m_operandA].m_x, range.m_x, range.m_y ) );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatRemap:
+                {
+                    Float4 const& ranges = pConstants[instruction.m_operandB];
+                    pRegisters[instruction.m_result] = Vector( Math::RemapRangeClamped( pRegisters[instruction.m_operandA].m_x, ranges.m_x, ranges.m_y, ranges.m_z, ranges.m_w ) );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatReverseDirection:
+                {
+                    float const inputValue = pRegisters[instruction.m_operandA].m_x;
+                    pRegisters[instruction.m_result] = Vector( ( inputValue < 0.0f ) ? -180.0f - inputValue : 180.0f - inputValue );
+                }
+                break;
+
+                //-------------------------------------------------------------------------
+
+                case ValueProgramOpCode::FloatGreaterThanEqual:
+                {
+                    pRegisters[instruction.m_result] = FromBool( pRegisters[instruction.m_operandA].m_x >= pRegisters[instruction.m_operandB].m_x );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatLessThanEqual:
+                {
+                    pRegisters[instruction.m_result] = FromBool( pRegisters[instruction.m_operandA].m_x <= pRegisters[instruction.m_operandB].m_x );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatNearEqual:
+                {
+                    pRegisters[instruction.m_result] = FromBool( Math::IsNearEqual( pRegisters[instruction.m_operandA].m_x, pRegisters[instruction.m_operandB].m_x, pConstants[instruction.m_operandC].m_x ) );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatGreaterThan:
+                {
+                    pRegisters[instruction.m_result] = FromBool( pRegisters[instruction.m_operandA].m_x > pRegisters[instruction.m_operandB].m_x );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatLessThan:
+                {
+                    pRegisters[instruction.m_result] = FromBool( pRegisters[instruction.m_operandA].m_x < pRegisters[instruction.m_operandB].m_x );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatInRangeInclusive:
+                {
+                    float const value = pRegisters[instruction.m_operandA].m_x;
+                    Float4 const& range = pConstants[instruction.m_operandB];
+                    pRegisters[instruction.m_result] = FromBool( value >= range.m_x && value <= range.m_y );
+                }
+                break;
+
+                case ValueProgramOpCode::FloatInRangeExclusive:
+                {
+                    float const value = pRegisters[instruction.m_operandA].m_x;
+                    Float4 const& range = pConstants[instruction.m_operandB];
+                    pRegisters[instruction.m_result] = FromBool( value > range.m_x && value < range.m_y );
+                }
+                break;
+
+                //-------------------------------------------------------------------------
+
+                case ValueProgramOpCode::VectorNegate:
+                {
+                    pRegisters[instruction.m_result] = pRegisters[instruction.m_operandA].GetNegated();
+                }
+                break;
+
+                case ValueProgramOpCode::VectorInfo:
+                {
+                    auto const info = (GraphNodes::VectorInfoNode::Info) instruction.m_operandB;
+                    pRegisters[instruction.m_result] = Vector( GraphNodes::VectorInfoNode::GetInfo( pRegisters[instruction.m_operandA], info ) );
+                }
+                break;
+
+                default:
+                {
+                    EE_UNREACHABLE_CODE();
+                }
+                break;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Animation_RuntimeGraph_Node.h"
+#include "System/Math/Vector.h"
+
+//-------------------------------------------------------------------------
+// Value Programs
+//-------------------------------------------------------------------------
+// The stateless value node DAGs (math, comparisons, logic, etc.) are flattened by the graph compiler into small register based programs.
+// Evaluating a program avoids the virtual call and cache miss per node that the regular pull-based node evaluation incurs.
+// Each program is rooted at a value node, the root node's regular GetValue call will run the program instead of the node logic.
+//
+// All registers are vectors: floats are stored in X and bools are stored as 0/1 in X.
+// Nodes that can't be flattened (i.e. stateful nodes) are evaluated through the regular node path via the 'LoadXXXNode' instructions.
+
+namespace EE::Animation
+{
+    class GraphContext;
+    class GraphNode;
+
+    //-------------------------------------------------------------------------
+
+    enum class ValueProgramOpCode : uint8_t
+    {
+        LoadConstant = 0,                   // Result = Constant[A]
+        LoadBoolParameter,                  // Result = ControlParameter[A]
+        LoadFloatParameter,                 // Result = ControlParameter[A]
+        LoadVectorParameter,                // Result = ControlParameter[A]
+        LoadBoolNode,                       // Result = Node[A]->GetValue()
+        LoadFloatNode,                      // Result = Node[A]->GetValue()
+        LoadVectorNode,                     // Result = Node[A]->GetValue()
+
+        Jump,                               // Jump to instruction A
+        JumpIfTrue,                         // If Register[A] is true, jump to instruction B
+        JumpIfFalse,                        // If Register[A] is false, jump to instruction B
+
+        BoolNot,                            // Result = !Register[A]
+
+        FloatAdd,                           // Result = Register[A] + Register[B]
+        FloatSub,                           // Result = Register[A] - Register[B]
+        FloatMul,                           // Result = Register[A] * Register[B]
+        FloatDiv,                           // Result = Register[A] / Register[B]
+        FloatAbs,                           // Result = Abs( Register[A] )
+        FloatClamp,                         // Result = Clamp( Register[A], Constant[B].x, Constant[B].y )
+        FloatRemap,                         // Result = RemapRangeClamped( Register[A], Constant[B].xy, Constant[B].zw )
+        FloatReverseDirection,              // Result = ReverseDirection( Register[A] )
+
+        FloatGreaterThanEqual,              // Result = Register[A] >= Register[B]
+        FloatLessThanEqual,                 // Result = Register[A] <= Register[B]
+        FloatNearEqual,                     // Result = IsNearEqual( Register[A], Register[B], Constant[C].x )
+        FloatGreaterThan,                   // Result = Register[A] > Register[B]
+        FloatLessThan,                      // Result = Register[A] < Register[B]
+        FloatInRangeInclusive,              // Result = Constant[B].x <= Register[A] <= Constant[B].y
+        FloatInRangeExclusive,              // Result = Constant[B].x < Register[A] < Constant[B].y
+
+        VectorNegate,                       // Result = -Register[A]
+        VectorInfo,                         // Result = VectorInfoNode::GetInfo( Register[A], B )
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct ValueProgramInstruction
+    {
+        EE_SERIALIZE( m_opCode, m_result, m_operandA, m_operandB, m_operandC );
+
+        ValueProgramInstruction() = default;
+
+        ValueProgramInstruction( ValueProgramOpCode opCode, int16_t result, int16_t operandA = InvalidIndex, int16_t operandB = InvalidIndex, int16_t operandC = InvalidIndex )
+            : m_opCode( opCode )
+            , m_result( result )
+            , m_operandA( operandA )
+            , m_operandB( operandB )
+            , m_operandC( operandC )
+        {}
+
+        ValueProgramOpCode                          m_opCode = ValueProgramOpCode::LoadConstant;
+        int16_t                                     m_result = InvalidIndex;
+        int16_t                                     m_operandA = InvalidIndex;
+        int16_t                                     m_operandB = InvalidIndex;
+        int16_t                                     m_operandC = InvalidIndex;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct ValueProgram
+    {
+        EE_SERIALIZE( m_rootNodeIdx, m_firstInstructionIdx, m_numInstructions, m_resultRegisterIdx, m_resultType );
+
+        int16_t                                     m_rootNodeIdx = InvalidIndex;
+        uint32_t                                    m_firstInstructionIdx = 0;
+        uint16_t                                    m_numInstructions = 0; // Jump targets are relative to the first instruction of the program
+        int16_t                                     m_resultRegisterIdx = InvalidIndex;
+        GraphValueType                              m_resultType = GraphValueType::Unknown;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // All the compiled value programs for a graph definition
+    struct GraphValuePrograms
+    {
+        EE_SERIALIZE( m_programs, m_instructions, m_constants, m_numRegisters );
+
+        inline bool IsEmpty() const { return m_programs.empty(); }
+
+        inline void Clear()
+        {
+            m_programs.clear();
+            m_instructions.clear();
+            m_constants.clear();
+            m_numRegisters = 0;
+        }
+
+    public:
+
+        TVector<ValueProgram>                       m_programs;
+        TVector<ValueProgramInstruction>            m_instructions;
+        TVector<Float4>                             m_constants;
+        int16_t                                     m_numRegisters = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Per graph instance state needed to run the value programs - every program has its own scratch registers since programs can be nested (via the LoadXXXNode instructions)
+    // Each program has its own result register so the result of the last evaluation is kept around and can be reused for the rest of the update
+    class EE_ENGINE_API ValueProgramInterpreter
+    {
+    public:
+
+        ValueProgramInterpreter() = default;
+        ~ValueProgramInterpreter() { EE_ASSERT( m_pPrograms == nullptr ); }
+
+        // Set the programs and the node instances they operate on. The supplied nodes need to have been instantiated!
+        void Initialize( GraphValuePrograms const* pPrograms, GraphNode* const* pNodes );
+        void Shutdown();
+
+        // Enable/disable the programs - when disabled all value nodes are evaluated via the regular node path
+        void SetProgramsEnabled( bool areEnabled );
+        inline bool AreProgramsEnabled() const { return m_areProgramsEnabled; }
+
+        // Get the result of the specified program, the program is only run once per graph update
+        void Evaluate( int16_t programIdx, GraphContext& context, void* pOutValue );
+
+    private:
+
+        void Execute( ValueProgram const& program, GraphContext& context );
+
+    private:
+
+        GraphValuePrograms const*                   m_pPrograms = nullptr;
+        GraphNode* const*                           m_pNodes = nullptr;
+        TVector<Vector>                             m_registers;
+        bool                                        m_areProgramsEnabled = false;
+    };
+}
\ No newline at end of file
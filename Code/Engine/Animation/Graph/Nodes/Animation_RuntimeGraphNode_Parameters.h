@@ -20,6 +20,10 @@ namespace EE::Animation::GraphNodes
             virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
         };
 
+        // Direct access to the parameter value without going through the virtual value interface
+        EE_FORCE_INLINE bool GetParameterValue() const { return m_value; }
+        EE_FORCE_INLINE void SetParameterValue( bool value ) { m_value = value; }
+
     private:
 
         virtual void GetValueInternal( GraphContext& context, void* pOutValue ) override;
@@ -42,6 +46,10 @@ namespace EE::Animation::GraphNodes
             virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
         };
 
+        // Direct access to the parameter value without going through the virtual value interface
+        EE_FORCE_INLINE StringID GetParameterValue() const { return m_value; }
+        EE_FORCE_INLINE void SetParameterValue( StringID value ) { m_value = value; }
+
     private:
 
         virtual void GetValueInternal( GraphContext& context, void* pOutValue ) override;
@@ -64,6 +72,10 @@ namespace EE::Animation::GraphNodes
             virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
         };
 
+        // Direct access to the parameter value without going through the virtual value interface
+        EE_FORCE_INLINE int32_t GetParameterValue() const { return m_value; }
+        EE_FORCE_INLINE void SetParameterValue( int32_t value ) { m_value = value; }
+
     private:
 
         virtual void GetValueInternal( GraphContext& context, void* pOutValue ) override;
@@ -86,6 +98,10 @@ namespace EE::Animation::GraphNodes
             virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
         };
 
+        // Direct access to the parameter value without going through the virtual value interface
+        EE_FORCE_INLINE float GetParameterValue() const { return m_value; }
+        EE_FORCE_INLINE void SetParameterValue( float value ) { m_value = value; }
+
     private:
 
         virtual void GetValueInternal( GraphContext& context, void* pOutValue ) override;
@@ -108,6 +124,10 @@ namespace EE::Animation::GraphNodes
             virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
         };
 
+        // Direct access to the parameter value without going through the virtual value interface
+        EE_FORCE_INLINE Vector const& GetParameterValue() const { return m_value; }
+        EE_FORCE_INLINE void SetParameterValue( Vector const& value ) { m_value = value; }
+
     private:
 
         virtual void GetValueInternal( GraphContext& context, void* pOutValue ) override;
@@ -130,6 +150,10 @@ namespace EE::Animation::GraphNodes
             virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
         };
 
+        // Direct access to the parameter value without going through the virtual value interface
+        EE_FORCE_INLINE Target const& GetParameterValue() const { return m_value; }
+        EE_FORCE_INLINE void SetParameterValue( Target const& value ) { m_value = value; }
+
     private:
 
         virtual void GetValueInternal( GraphContext& context, void* pOutValue ) override;
@@ -140,6 +164,17 @@ namespace EE::Animation::GraphNodes
         Target m_value;
     };
 
+    //-------------------------------------------------------------------------
+
+    // Maps a parameter value type to its control parameter node type
+    template<typename T> struct ControlParameterNodeType {};
+    template<> struct ControlParameterNodeType<bool> { using Type = ControlParameterBoolNode; };
+    template<> struct ControlParameterNodeType<StringID> { using Type = ControlParameterIDNode; };
+    template<> struct ControlParameterNodeType<int32_t> { using Type = ControlParameterIntNode; };
+    template<> struct ControlParameterNodeType<float> { using Type = ControlParameterFloatNode; };
+    template<> struct ControlParameterNodeType<Vector> { using Type = ControlParameterVectorNode; };
+    template<> struct ControlParameterNodeType<Target> { using Type = ControlParameterTargetNode; };
+
     //-------------------------------------------------------------------------
     // Virtual control parameters
     //-------------------------------------------------------------------------
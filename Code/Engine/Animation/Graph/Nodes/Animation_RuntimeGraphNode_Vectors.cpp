@@ -26,53 +26,60 @@ namespace EE::Animation::GraphNodes
         FloatValueNode::ShutdownInternal( context );
     }
 
-    void VectorInfoNode::GetValueInternal( GraphContext& context, void* pOutValue )
+    float VectorInfoNode::GetInfo( Vector const& vector, Info info )
     {
-        EE_ASSERT( context.IsValid() && m_pInputValueNode != nullptr );
-        auto pSettings = GetSettings<VectorInfoNode>();
+        float result = 0.0f;
 
-        if ( !WasUpdated( context ) )
+        switch ( info )
         {
-            MarkNodeActive( context );
-
-            Vector const inputVector = m_pInputValueNode->GetValue<Vector>( context );
-            switch ( pSettings->m_desiredInfo )
-            {
-            case Info::X: m_value = inputVector.m_x; break;
-            case Info::Y: m_value = inputVector.m_y; break;
-            case Info::Z: m_value = inputVector.m_z; break;
-            case Info::W: m_value = inputVector.m_w; break;
+            case Info::X: result = vector.m_x; break;
+            case Info::Y: result = vector.m_y; break;
+            case Info::Z: result = vector.m_z; break;
+            case Info::W: result = vector.m_w; break;
 
             case Info::Length:
             {
-                m_value = inputVector.GetLength3();
+                result = vector.GetLength3();
             }
             break;
 
             case Info::AngleHorizontal:
             {
-                m_value = (float) Math::GetYawAngleBetweenVectors( Vector::WorldForward, inputVector );
+                result = (float) Math::GetYawAngleBetweenVectors( Vector::WorldForward, vector );
             }
             break;
 
             case Info::AngleVertical:
             {
-                m_value = (float) Quaternion::FromRotationBetweenVectors( Vector::WorldForward, inputVector ).ToEulerAngles().GetPitch();
+                result = (float) Quaternion::FromRotationBetweenVectors( Vector::WorldForward, vector ).ToEulerAngles().GetPitch();
             }
             break;
 
             case Info::SizeHorizontal:
             {
-                m_value = inputVector.GetLength3();
+                result = vector.GetLength3();
             }
             break;
 
             case Info::SizeVertical:
             {
-                m_value = Vector( inputVector.m_x, 0.0f, inputVector.m_z ).GetLength3();
+                result = Vector( vector.m_x, 0.0f, vector.m_z ).GetLength3();
             }
             break;
-            }
+        }
+
+        return result;
+    }
+
+    void VectorInfoNode::GetValueInternal( GraphContext& context, void* pOutValue )
+    {
+        EE_ASSERT( context.IsValid() && m_pInputValueNode != nullptr );
+        auto pSettings = GetSettings<VectorInfoNode>();
+
+        if ( !WasUpdated( context ) )
+        {
+            MarkNodeActive( context );
+            m_value = GetInfo( m_pInputValueNode->GetValue<Vector>( context ), pSettings->m_desiredInfo );
         }
 
         *reinterpret_cast<float*>( pOutValue ) = m_value;
@@ -38,6 +38,11 @@ namespace EE::Animation::GraphNodes
             Info                        m_desiredInfo = Info::X;
         };
 
+    public:
+
+        // Calculate the requested info for the supplied vector
+        static float GetInfo( Vector const& vector, Info info );
+
     private:
 
         virtual void InitializeInternal( GraphContext& context ) override;
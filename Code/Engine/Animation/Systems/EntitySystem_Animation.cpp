@@ -1,6 +1,7 @@
 #include "EntitySystem_Animation.h"
 #include "Engine/Animation/Components/Component_AnimationClipPlayer.h"
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
+#include "Engine/Animation/Systems/WorldSystem_Animation.h"
 #include "Engine/Render/Components/Component_SkeletalMesh.h"
 #include "Engine/Physics/Systems/WorldSystem_Physics.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
@@ -171,6 +172,7 @@ namespace EE::Animation
         if ( updateStage == UpdateStage::PrePhysics )
         {
             auto pPhysicsWorldSystem = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>();
+            bool const useParallelEvaluation = ctx.GetWorldSystem<AnimationWorldSystem>()->IsParallelEvaluationEnabled();
 
             for ( auto pAnimComponent : m_animGraphs )
             {
@@ -181,8 +183,24 @@ namespace EE::Animation
 
                 if ( !pAnimComponent->RequiresManualUpdate() )
                 {
+                    // Defer the evaluation to the animation world system, this will be run later this stage as part of the parallel evaluation job
+                    if ( useParallelEvaluation )
+                    {
+                        pAnimComponent->RequestParallelEvaluation( characterWorldTransform, m_pRootComponent );
+                        continue;
+                    }
+
                     // Evaluate the graph nodes and calculate the root motion delta
-                    pAnimComponent->EvaluateGraph( ctx.GetDeltaTime(), characterWorldTransform, pPhysicsWorldSystem->GetScene() );
+                    // If the update rate scheduler skips this frame, the root motion is extrapolated instead and the pose is left as-is
+                    bool const shouldEvaluateGraph = pAnimComponent->ShouldEvaluateGraph( ctx.GetFrameID() );
+                    if ( shouldEvaluateGraph )
+                    {
+                        pAnimComponent->EvaluateGraph( ctx.GetDeltaTime(), characterWorldTransform, pPhysicsWorldSystem->GetScene() );
+                    }
+                    else
+                    {
+                        pAnimComponent->SkipGraphEvaluation( ctx.GetDeltaTime() );
+                    }
 
                     // Apply the root motion if desired
                     Transform adjustedCharacterTransform = characterWorldTransform;
@@ -198,7 +216,10 @@ namespace EE::Animation
                     }
 
                     // Calculate pose tasks
-                    pAnimComponent->ExecutePrePhysicsTasks( ctx.GetDeltaTime(), adjustedCharacterTransform );
+                    if ( shouldEvaluateGraph )
+                    {
+                        pAnimComponent->ExecutePrePhysicsTasks( ctx.GetDeltaTime(), adjustedCharacterTransform );
+                    }
                 }
             }
         }
@@ -212,9 +233,17 @@ namespace EE::Animation
                 }
 
                 // Calculate the final pose tasks
+                int32_t numInterpolationFrames = 1;
                 if ( !pAnimComponent->RequiresManualUpdate() )
                 {
+                    // Skipped frames keep the previous pose, the mesh interpolates towards it in 'FinalizePose'
+                    if ( !pAnimComponent->WasEvaluatedThisFrame() )
+                    {
+                        continue;
+                    }
+
                     pAnimComponent->ExecutePostPhysicsTasks();
+                    numInterpolationFrames = Math::Max( 1, pAnimComponent->GetUpdateInterval() );
                 }
 
                 // Set poses
@@ -237,7 +266,7 @@ namespace EE::Animation
                         continue;
                     }
 
-                    pMeshComponent->SetPose( pPose );
+                    pMeshComponent->SetPose( pPose, numInterpolationFrames );
                 }
             }
         }
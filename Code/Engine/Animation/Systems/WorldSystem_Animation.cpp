@@ -1,15 +1,102 @@
 #include "WorldSystem_Animation.h"
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Engine/Entity/Entity.h"
+#include "Engine/Entity/EntitySpatialComponent.h"
+#include "Engine/Physics/Systems/WorldSystem_Physics.h"
+#include "Engine/Render/RenderViewport.h"
 #include "System/Drawing/DebugDrawing.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Time/Timers.h"
+#include "System/Profiling.h"
+#include <eastl/sort.h>
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
+    // Characters closer than this are always evaluated every frame
+    constexpr static float const g_fullRateDistance = 15.0f;
+
+    // Characters further than this have the lowest significance
+    constexpr static float const g_minimumRateDistance = 40.0f;
+
+    // Significance of characters that are not visible
+    constexpr static float const g_offscreenSignificance = 0.1f;
+
+    // How quickly the estimated evaluation cost of a graph follows the measured cost
+    constexpr static float const g_evaluationCostSmoothing = 0.2f;
+
+    //-------------------------------------------------------------------------
+
+    ComponentID const& AnimationWorldSystem::ScheduledGraph::GetID() const
+    {
+        return m_pComponent->GetID();
+    }
+
+    //-------------------------------------------------------------------------
+
+    float AnimationWorldSystem::CalculateDefaultSignificance( Entity const* pEntity, AnimationGraphComponent const* pComponent, Render::Viewport const* pViewport )
+    {
+        if ( pViewport == nullptr || !pEntity->IsSpatialEntity() )
+        {
+            return 1.0f;
+        }
+
+        //-------------------------------------------------------------------------
+
+        OBB const& worldBounds = pEntity->GetRootSpatialComponentWorldBounds();
+        if ( !pViewport->GetViewVolume().Contains( worldBounds.GetAABB() ) )
+        {
+            return g_offscreenSignificance;
+        }
+
+        float const distance = pViewport->GetViewPosition().GetDistance3( pEntity->GetWorldTransform().GetTranslation() );
+        if ( distance <= g_fullRateDistance )
+        {
+            return 1.0f;
+        }
+
+        float const t = Math::Clamp( ( distance - g_fullRateDistance ) / ( g_minimumRateDistance - g_fullRateDistance ), 0.0f, 1.0f );
+        return Math::Lerp( 1.0f, g_offscreenSignificance, t );
+    }
+
+    AnimationUpdateRate AnimationWorldSystem::GetUpdateRateForSignificance( float significance )
+    {
+        if ( significance <= 0.0f )
+        {
+            return AnimationUpdateRate::Paused;
+        }
+
+        if ( significance < 0.25f )
+        {
+            return AnimationUpdateRate::EveryFourthFrame;
+        }
+
+        if ( significance < 0.5f )
+        {
+            return AnimationUpdateRate::EverySecondFrame;
+        }
+
+        return AnimationUpdateRate::EveryFrame;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<EE::TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
+
+        ResetSignificanceFunction();
+    }
+
     void AnimationWorldSystem::ShutdownSystem()
     {
         EE_ASSERT( m_graphComponents.empty() );
+        EE_ASSERT( m_scheduledGraphs.empty() );
+        m_significanceFunction = nullptr;
+        m_pTaskSystem = nullptr;
     }
 
     void AnimationWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -17,6 +104,16 @@ namespace EE::Animation
         if ( auto pGraphComponent = TryCast<AnimationGraphComponent>( pComponent ) )
         {
             m_graphComponents.Add( pGraphComponent );
+
+            // Only automatically updated graphs are throttled, manually updated graphs are the responsibility of their owning system
+            if ( !pGraphComponent->RequiresManualUpdate() )
+            {
+                m_scheduledGraphs.Add( ScheduledGraph( pEntity, pGraphComponent ) );
+
+                // Stagger the components so that throttled graphs are spread evenly across frames
+                pGraphComponent->SetUpdateFrameOffset( m_nextUpdateFrameOffset );
+                m_nextUpdateFrameOffset = ( m_nextUpdateFrameOffset + 1 ) % 4;
+            }
         }
     }
 
@@ -25,11 +122,29 @@ namespace EE::Animation
         if ( auto pGraphComponent = TryCast<AnimationGraphComponent>( pComponent ) )
         {
             m_graphComponents.Remove( pGraphComponent->GetID() );
+
+            if ( m_scheduledGraphs.HasItemForID( pGraphComponent->GetID() ) )
+            {
+                m_scheduledGraphs.Remove( pGraphComponent->GetID() );
+                pGraphComponent->SetUpdateRate( AnimationUpdateRate::EveryFrame );
+            }
         }
     }
 
     void AnimationWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        if ( ctx.GetUpdateStage() == UpdateStage::PrePhysics )
+        {
+            ExecuteParallelEvaluation( ctx );
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        UpdateScheduledGraphRates( ctx );
+
+        //-------------------------------------------------------------------------
+
         #if EE_DEVELOPMENT_TOOLS
         Drawing::DrawContext drawingCtx = ctx.GetDrawingContext();
         for ( auto pComponent : m_graphComponents )
@@ -38,4 +153,210 @@ namespace EE::Animation
         }
         #endif
     }
+
+    void AnimationWorldSystem::UpdateScheduledGraphRates( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Animation Update Rate Scheduling" );
+
+        // Tools worlds (previews, workspaces) always run at full rate
+        bool const shouldThrottle = m_isUpdateRateThrottlingEnabled && ctx.IsGameWorld();
+
+        Render::Viewport const* pViewport = ctx.GetViewport();
+        for ( auto& scheduledGraph : m_scheduledGraphs )
+        {
+            AnimationUpdateRate updateRate = AnimationUpdateRate::EveryFrame;
+            if ( shouldThrottle )
+            {
+                float const significance = m_significanceFunction( scheduledGraph.m_pEntity, scheduledGraph.m_pComponent, pViewport );
+                updateRate = GetUpdateRateForSignificance( significance );
+            }
+
+            scheduledGraph.m_pComponent->SetUpdateRate( updateRate );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::ExecuteParallelEvaluation( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Parallel Graph Evaluation" );
+
+        // Gather all graphs that requested a parallel evaluation
+        //-------------------------------------------------------------------------
+
+        m_parallelEvaluationList.clear();
+        for ( auto& scheduledGraph : m_scheduledGraphs )
+        {
+            auto pComponent = scheduledGraph.m_pComponent;
+            if ( pComponent->m_isParallelEvaluationPending )
+            {
+                pComponent->m_isParallelEvaluationPending = false;
+                EE_ASSERT( pComponent->HasGraph() );
+                m_parallelEvaluationList.emplace_back( pComponent );
+            }
+        }
+
+        if ( m_parallelEvaluationList.empty() )
+        {
+            return;
+        }
+
+        // Sort the most expensive graphs first so that they get picked up first and dont end up as stragglers at the end of the jobs
+        auto comparator = [] ( AnimationGraphComponent* const& pComponentA, AnimationGraphComponent* const& pComponentB )
+        {
+            return pComponentA->m_estimatedEvaluationCost > pComponentB->m_estimatedEvaluationCost;
+        };
+
+        eastl::sort( m_parallelEvaluationList.begin(), m_parallelEvaluationList.end(), comparator );
+
+        // Jobs
+        //-------------------------------------------------------------------------
+
+        struct GraphEvaluationTask final : public ITaskSet
+        {
+            GraphEvaluationTask( TVector<AnimationGraphComponent*> const& components, uint64_t frameID, Seconds deltaTime, Physics::Scene* pPhysicsScene )
+                : m_components( components )
+                , m_frameID( frameID )
+                , m_deltaTime( deltaTime )
+                , m_pPhysicsScene( pPhysicsScene )
+            {
+                m_SetSize = (uint32_t) components.size();
+                m_MinRange = 1;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_ANIMATION( "Graph Evaluation Task" );
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    AnimationWorldSystem::EvaluateGraphForParallelUpdate( m_components[i], m_frameID, m_deltaTime, m_pPhysicsScene );
+                }
+            }
+
+        private:
+
+            TVector<AnimationGraphComponent*> const&    m_components;
+            uint64_t                                    m_frameID;
+            Seconds                                     m_deltaTime;
+            Physics::Scene*                             m_pPhysicsScene = nullptr;
+        };
+
+        struct PoseTaskExecutionTask final : public ITaskSet
+        {
+            PoseTaskExecutionTask( TVector<AnimationGraphComponent*> const& components, Seconds deltaTime )
+                : m_components( components )
+                , m_deltaTime( deltaTime )
+            {
+                m_SetSize = (uint32_t) components.size();
+                m_MinRange = 1;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_ANIMATION( "Pose Task Execution Task" );
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    AnimationWorldSystem::ExecutePrePhysicsTasksForParallelUpdate( m_components[i], m_deltaTime );
+                }
+            }
+
+        private:
+
+            TVector<AnimationGraphComponent*> const&    m_components;
+            Seconds                                     m_deltaTime;
+        };
+
+        //-------------------------------------------------------------------------
+
+        auto pPhysicsScene = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>()->GetScene();
+
+        GraphEvaluationTask graphEvaluationTask( m_parallelEvaluationList, ctx.GetFrameID(), ctx.GetDeltaTime(), pPhysicsScene );
+        m_pTaskSystem->ScheduleTask( &graphEvaluationTask );
+        m_pTaskSystem->WaitForTask( &graphEvaluationTask );
+
+        // Root motion is applied serially, setting a world transform updates the whole attachment hierarchy so spatially attached characters cannot be moved concurrently
+        {
+            EE_PROFILE_SCOPE_ANIMATION( "Apply Root Motion" );
+            for ( auto pComponent : m_parallelEvaluationList )
+            {
+                ApplyRootMotionForParallelUpdate( pComponent );
+            }
+        }
+
+        PoseTaskExecutionTask poseTaskExecutionTask( m_parallelEvaluationList, ctx.GetDeltaTime() );
+        m_pTaskSystem->ScheduleTask( &poseTaskExecutionTask );
+        m_pTaskSystem->WaitForTask( &poseTaskExecutionTask );
+    }
+
+    void AnimationWorldSystem::EvaluateGraphForParallelUpdate( AnimationGraphComponent* pComponent, uint64_t frameID, Seconds deltaTime, Physics::Scene* pPhysicsScene )
+    {
+        Timer<PlatformClock> timer;
+
+        // Evaluate the graph nodes and calculate the root motion delta
+        bool const shouldEvaluateGraph = pComponent->ShouldEvaluateGraph( frameID );
+        if ( shouldEvaluateGraph )
+        {
+            pComponent->EvaluateGraph( deltaTime, pComponent->m_pendingCharacterWorldTransform, pPhysicsScene );
+        }
+        else
+        {
+            pComponent->SkipGraphEvaluation( deltaTime );
+        }
+
+        // Shift the character world transform used for the pose tasks, the root component itself is only moved once all the jobs have completed
+        if ( pComponent->m_pPendingRootComponent != nullptr && pComponent->ShouldApplyRootMotionToEntity() )
+        {
+            pComponent->m_pendingCharacterWorldTransform = pComponent->GetRootMotionDelta() * pComponent->m_pendingCharacterWorldTransform;
+        }
+
+        //-------------------------------------------------------------------------
+
+        // Only evaluated frames are representative of the graph's cost, skipped frames would drag the estimate down and skew the scheduling
+        Milliseconds const elapsedTime = timer.GetElapsedTimeMilliseconds();
+        if ( shouldEvaluateGraph )
+        {
+            pComponent->m_estimatedEvaluationCost = Math::Lerp( pComponent->m_estimatedEvaluationCost, elapsedTime.ToFloat() * 1000.0f, g_evaluationCostSmoothing );
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        pComponent->m_debugGraphEvaluationTime = elapsedTime;
+        #endif
+    }
+
+    void AnimationWorldSystem::ApplyRootMotionForParallelUpdate( AnimationGraphComponent* pComponent )
+    {
+        SpatialEntityComponent* pRootComponent = pComponent->m_pPendingRootComponent;
+        if ( pRootComponent != nullptr && pComponent->ShouldApplyRootMotionToEntity() )
+        {
+            Transform worldTransform = pRootComponent->GetWorldTransform();
+            worldTransform = pComponent->GetRootMotionDelta() * worldTransform;
+            pRootComponent->SetWorldTransform( worldTransform );
+        }
+
+        pComponent->m_pPendingRootComponent = nullptr;
+    }
+
+    void AnimationWorldSystem::ExecutePrePhysicsTasksForParallelUpdate( AnimationGraphComponent* pComponent, Seconds deltaTime )
+    {
+        // Nothing to do for skipped graphs, their pose remains unchanged
+        if ( !pComponent->WasEvaluatedThisFrame() )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            pComponent->m_debugTaskExecutionTime = 0.0f;
+            #endif
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        Timer<PlatformClock> timer;
+        pComponent->ExecutePrePhysicsTasks( deltaTime, pComponent->m_pendingCharacterWorldTransform );
+
+        Milliseconds const elapsedTime = timer.GetElapsedTimeMilliseconds();
+        pComponent->m_estimatedEvaluationCost += elapsedTime.ToFloat() * 1000.0f * g_evaluationCostSmoothing;
+
+        #if EE_DEVELOPMENT_TOOLS
+        pComponent->m_debugTaskExecutionTime = elapsedTime;
+        #endif
+    }
 }
\ No newline at end of file
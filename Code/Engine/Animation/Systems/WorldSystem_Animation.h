@@ -3,36 +3,114 @@
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "System/Types/IDVector.h"
+#include "System/Types/Function.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class TaskSystem; }
+namespace EE::Render { class Viewport; }
+namespace EE::Physics { class Scene; }
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
     class AnimationGraphComponent;
+    enum class AnimationUpdateRate : uint8_t;
 
     //-------------------------------------------------------------------------
 
-    class AnimationWorldSystem : public IEntityWorldSystem
+    class EE_ENGINE_API AnimationWorldSystem : public IEntityWorldSystem
     {
         friend class AnimationDebugView;
 
+        // Graph components that are automatically updated and so can have their update rate throttled
+        struct ScheduledGraph
+        {
+            ScheduledGraph( Entity const* pEntity, AnimationGraphComponent* pComponent ) : m_pEntity( pEntity ), m_pComponent( pComponent ) {}
+
+            ComponentID const& GetID() const;
+
+        public:
+
+            Entity const*                                       m_pEntity = nullptr;
+            AnimationGraphComponent*                            m_pComponent = nullptr;
+        };
+
+    public:
+
+        // Returns how significant a character is, in the range [0, 1], this is used to select the update rate for its graph
+        // A significance of 0 will pause the graph evaluation entirely
+        using SignificanceFunction = TFunction<float( Entity const*, AnimationGraphComponent const*, Render::Viewport const* )>;
+
+        // The default significance function: based on the distance to the viewport and on visibility
+        static float CalculateDefaultSignificance( Entity const* pEntity, AnimationGraphComponent const* pComponent, Render::Viewport const* pViewport );
+
+        // Get the update rate for a given significance value
+        static AnimationUpdateRate GetUpdateRateForSignificance( float significance );
+
     public:
 
-        EE_REGISTER_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::FrameEnd ) );
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::PrePhysics ), RequiresUpdate( UpdateStage::FrameEnd ) );
 
         #if EE_DEVELOPMENT_TOOLS
         inline TVector<AnimationGraphComponent*> const& GetRegisteredGraphComponents() const { return m_graphComponents.GetVector(); }
         #endif
 
+        // Update rate throttling
+        //-------------------------------------------------------------------------
+
+        inline bool IsUpdateRateThrottlingEnabled() const { return m_isUpdateRateThrottlingEnabled; }
+
+        // Enable/disable update rate throttling, when disabled all graphs are evaluated every frame
+        inline void SetUpdateRateThrottlingEnabled( bool isEnabled ) { m_isUpdateRateThrottlingEnabled = isEnabled; }
+
+        // Override the significance function used to select the update rate for each character
+        inline void SetSignificanceFunction( SignificanceFunction&& function ) { EE_ASSERT( function ); m_significanceFunction = eastl::move( function ); }
+
+        // Restore the default significance function
+        inline void ResetSignificanceFunction() { m_significanceFunction = &AnimationWorldSystem::CalculateDefaultSignificance; }
+
+        // Parallel evaluation
+        //-------------------------------------------------------------------------
+        // When enabled, the animation entity systems hand off the pre-physics graph evaluation and pose tasks of automatically updated graphs to this system.
+        // All graphs are then evaluated together as fine-grained jobs, balanced by their estimated cost, instead of inside each entity's update.
+        // Root motion is applied serially once all graphs have been evaluated, since moving a root component updates its whole attachment hierarchy.
+        // Note: this changes the update ordering - root motion is applied after all the pre-physics entity updates rather than during the owning entity's update,
+        // so any entity system reading the character transform in pre-physics will see the previous frame's root motion. Disable this if you rely on that ordering.
+
+        inline bool IsParallelEvaluationEnabled() const { return m_isParallelEvaluationEnabled; }
+        inline void SetParallelEvaluationEnabled( bool isEnabled ) { m_isParallelEvaluationEnabled = isEnabled; }
+
     private:
 
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
+        // Select the update rate for all the scheduled graphs, this is done at the end of the frame for the next frame
+        void UpdateScheduledGraphRates( EntityWorldUpdateContext const& ctx );
+
+        // Evaluate all graphs that requested a parallel evaluation this frame
+        void ExecuteParallelEvaluation( EntityWorldUpdateContext const& ctx );
+
+        // Per-component work for the parallel evaluation jobs
+        static void EvaluateGraphForParallelUpdate( AnimationGraphComponent* pComponent, uint64_t frameID, Seconds deltaTime, Physics::Scene* pPhysicsScene );
+        static void ApplyRootMotionForParallelUpdate( AnimationGraphComponent* pComponent );
+        static void ExecutePrePhysicsTasksForParallelUpdate( AnimationGraphComponent* pComponent, Seconds deltaTime );
+
     private:
 
         TIDVector<ComponentID, AnimationGraphComponent*>          m_graphComponents;
+        TIDVector<ComponentID, ScheduledGraph>                    m_scheduledGraphs;
+        SignificanceFunction                                      m_significanceFunction;
+        uint8_t                                                   m_nextUpdateFrameOffset = 0;
+        bool                                                      m_isUpdateRateThrottlingEnabled = true;
+
+        EE::TaskSystem*                                           m_pTaskSystem = nullptr;
+        TVector<AnimationGraphComponent*>                         m_parallelEvaluationList;
+        bool                                                      m_isParallelEvaluationEnabled = true;
     };
-} 
\ No newline at end of file
+} 
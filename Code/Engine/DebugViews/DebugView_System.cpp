@@ -110,15 +110,17 @@ namespace EE
 
                 //-------------------------------------------------------------------------
 
-                auto const& logEntries = Log::GetLogEntries();
-
                 ImGuiListClipper clipper;
-                clipper.Begin( (int32_t) logEntries.size() );
+                clipper.Begin( Log::GetNumLogEntries() );
                 while ( clipper.Step() )
                 {
-                    for ( int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++ )
+                    // Only copy the visible range of the log history
+                    Log::GetLogEntries( clipper.DisplayStart, clipper.DisplayEnd - clipper.DisplayStart, m_visibleLogEntries );
+                    int32_t const numVisibleEntries = (int32_t) m_visibleLogEntries.size();
+
+                    for ( int i = clipper.DisplayStart; i < clipper.DisplayStart + numVisibleEntries; i++ )
                     {
-                        auto const& entry = logEntries[i];
+                        auto const& entry = m_visibleLogEntries[i - clipper.DisplayStart];
 
                         switch ( entry.m_severity )
                         {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Entity/EntityWorldDebugView.h"
+#include "System/Log.h"
 
 //-------------------------------------------------------------------------
 
@@ -47,6 +48,7 @@ namespace EE
     private:
 
         InlineString                                        m_logFilter = "TODO";
+        TVector<Log::LogEntry>                              m_visibleLogEntries;
     };
 }
 #endif
\ No newline at end of file
@@ -145,6 +145,13 @@ namespace EE::EntityModel
             m_entityDescriptors.emplace_back( entityDesc );
         }
 
+        inline void AddEntity( SerializedEntityDescriptor&& entityDesc )
+        {
+            EE_ASSERT( entityDesc.IsValid() );
+            m_entityLookupMap.insert( TPair<StringID, int32_t>( entityDesc.m_name, (int32_t) m_entityDescriptors.size() ) );
+            m_entityDescriptors.emplace_back( eastl::move( entityDesc ) );
+        }
+
         void GenerateSpatialAttachmentInfo();
 
         void Clear() { m_entityDescriptors.clear(); m_entityLookupMap.clear(); m_entitySpatialAttachmentInfo.clear(); }
@@ -3,6 +3,7 @@
 #include "EntityWorldDebugView.h"
 #include "System/Resource/ResourceSystem.h"
 #include "System/Profiling.h"
+#include "System/Time/Timers.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include <eastl/sort.h>
 
@@ -44,6 +45,10 @@ namespace EE
         m_activationContext = EntityModel::ActivationContext( m_pTaskSystem );
         EE_ASSERT( m_activationContext.IsValid() );
 
+        #if EE_DEVELOPMENT_TOOLS
+        m_debugDrawingSystem.SetTaskSystem( m_pTaskSystem );
+        #endif
+
         // Create World Systems
         //-------------------------------------------------------------------------
 
@@ -129,6 +134,10 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        #if EE_DEVELOPMENT_TOOLS
+        m_debugDrawingSystem.SetTaskSystem( nullptr );
+        #endif
+
         m_pTaskSystem = nullptr;
         m_initialized = false;
     }
@@ -215,7 +224,7 @@ namespace EE
 
     void EntityWorld::Update( UpdateContext const& context )
     {
-        EE_ASSERT( Threading::IsMainThread() );
+        // Worlds can be updated concurrently by the world manager so this is not restricted to the main thread
         EE_ASSERT( !m_isSuspended );
 
         struct EntityUpdateTask final : public ITaskSet
@@ -276,6 +285,12 @@ namespace EE
         UpdateStage const updateStage = context.GetUpdateStage();
         bool const isWorldPaused = IsPaused() && !m_timeStepRequested;
 
+        StageUpdateTimings& stageTimings = m_stageUpdateTimings[(int8_t) updateStage];
+        if ( m_recordUpdateTimings )
+        {
+            stageTimings.Reset();
+        }
+
         // Skip all non-pause updates for paused worlds
         if ( isWorldPaused && updateStage != UpdateStage::Paused )
         {
@@ -295,10 +310,18 @@ namespace EE
         // Update entities
         //-------------------------------------------------------------------------
 
+        Timer<PlatformClock> timer;
+
         EntityUpdateTask entityUpdateTask( entityWorldUpdateContext, m_entityUpdateList );
         m_pTaskSystem->ScheduleTask( &entityUpdateTask );
         m_pTaskSystem->WaitForTask( &entityUpdateTask );
 
+        if ( m_recordUpdateTimings )
+        {
+            stageTimings.m_entityUpdateTime = timer.GetElapsedTimeMilliseconds();
+            stageTimings.m_wasUpdated = true;
+        }
+
         // Force execution on main thread for debugging purposes
         //entityUpdateTask.ExecuteRange( { 0u, (uint32_t) m_entityUpdateList.size() }, 0 );
 
@@ -309,7 +332,17 @@ namespace EE
         {
             EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
             EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
-            pSystem->UpdateSystem( entityWorldUpdateContext );
+
+            if ( m_recordUpdateTimings )
+            {
+                timer.Start();
+                pSystem->UpdateSystem( entityWorldUpdateContext );
+                stageTimings.m_worldSystemUpdateTimes.push_back( { pSystem, timer.GetElapsedTimeMilliseconds() } );
+            }
+            else
+            {
+                pSystem->UpdateSystem( entityWorldUpdateContext );
+            }
         }
 
         //-------------------------------------------------------------------------
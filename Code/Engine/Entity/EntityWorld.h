@@ -33,6 +33,25 @@ namespace EE
         friend class EntityDebugView;
         friend class EntityWorldUpdateContext;
 
+    public:
+
+        // Optional timing info for a single world system update
+        struct SystemUpdateTiming
+        {
+            IEntityWorldSystem const*                   m_pSystem = nullptr;
+            Milliseconds                                m_updateTime = 0.0f;
+        };
+
+        // Optional timing info for all the updates run for a given stage
+        struct StageUpdateTimings
+        {
+            inline void Reset() { m_entityUpdateTime = 0.0f; m_worldSystemUpdateTimes.clear(); m_wasUpdated = false; }
+
+            Milliseconds                                m_entityUpdateTime = 0.0f;
+            TInlineVector<SystemUpdateTiming, 16>       m_worldSystemUpdateTimes;
+            bool                                        m_wasUpdated = false;
+        };
+
     public:
 
         EntityWorld( EntityWorldType worldType = EntityWorldType::Game ) : m_worldType( worldType ) {}
@@ -64,6 +83,15 @@ namespace EE
         // Any queued requests will be handled here as will any requests to the resource system.
         void UpdateLoading();
 
+        // Enable recording of the entity/world system update timings - this is off by default since it adds some overhead to every update
+        inline void SetUpdateTimingRecordingEnabled( bool isEnabled ) { m_recordUpdateTimings = isEnabled; }
+
+        // Are we recording update timings
+        inline bool IsRecordingUpdateTimings() const { return m_recordUpdateTimings; }
+
+        // Get the timings recorded for the last update of the specified stage
+        inline StageUpdateTimings const& GetLastUpdateTimings( UpdateStage stage ) const { EE_ASSERT( m_recordUpdateTimings ); return m_stageUpdateTimings[(int8_t) stage]; }
+
         //-------------------------------------------------------------------------
         // Systems
         //-------------------------------------------------------------------------
@@ -253,6 +281,10 @@ namespace EE
         TVector<Entity*>                                                        m_entityUpdateList;
         TVector<IEntityWorldSystem*>                                            m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
 
+        // Update Timings
+        StageUpdateTimings                                                      m_stageUpdateTimings[(int8_t) UpdateStage::NumStages];
+        bool                                                                    m_recordUpdateTimings = false;
+
         // Time Scaling + Pause
         float                                                                   m_timeScale = 1.0f; // <= 0 means that the world is paused
         Seconds                                                                 m_timeStepLength = 1.0f / 30.0f;
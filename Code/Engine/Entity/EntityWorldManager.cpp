@@ -7,12 +7,72 @@
 #include "Engine/Camera/Components/Component_Camera.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include "Engine/UpdateContext.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
 #include "System/Systems.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    namespace
+    {
+        // Run the current stage's update for a single world, this only touches the world's own state so it is safe to run concurrently with the other worlds
+        static void UpdateWorld( EntityWorld* pWorld, UpdateContext const& context )
+        {
+            EE_ASSERT( pWorld != nullptr && !pWorld->IsSuspended() );
+
+            // Reflect input state
+            //-------------------------------------------------------------------------
+
+            if ( context.GetUpdateStage() == UpdateStage::FrameStart )
+            {
+                auto pPlayerManager = pWorld->GetWorldSystem<PlayerManager>();
+                auto pWorldInputState = pWorld->GetInputState();
+
+                if ( pPlayerManager->IsPlayerEnabled() )
+                {
+                    auto pInputSystem = context.GetSystem<Input::InputSystem>();
+                    pInputSystem->ReflectState( context.GetDeltaTime(), pWorld->GetTimeScale(), *pWorldInputState );
+                }
+                else
+                {
+                    pWorldInputState->Clear();
+                }
+            }
+
+            // Run world updates
+            //-------------------------------------------------------------------------
+
+            pWorld->Update( context );
+
+            // Update world view
+            //-------------------------------------------------------------------------
+            // We explicitly reflect the camera at the end of the post-physics stage as we assume it has been updated at that point
+
+            if ( context.GetUpdateStage() == UpdateStage::PostPhysics && pWorld->GetViewport() != nullptr )
+            {
+                auto pViewport = pWorld->GetViewport();
+                auto pCameraManager = pWorld->GetWorldSystem<CameraManager>();
+                if ( pCameraManager->HasActiveCamera() )
+                {
+                    auto pActiveCamera = pCameraManager->GetActiveCamera();
+
+                    // Update camera view dimensions if needed
+                    if ( pViewport->GetDimensions() != pActiveCamera->GetViewVolume().GetViewDimensions() )
+                    {
+                        pActiveCamera->UpdateViewDimensions( pViewport->GetDimensions() );
+                    }
+
+                    // Update world viewport
+                    pViewport->SetViewVolume( pActiveCamera->GetViewVolume() );
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     EntityWorldManager::~EntityWorldManager()
     {
         EE_ASSERT( m_worlds.empty() && m_worldSystemTypeInfos.empty() );
@@ -21,6 +81,8 @@ namespace EE
     void EntityWorldManager::Initialize( SystemRegistry const& systemsRegistry )
     {
         m_pSystemsRegistry = &systemsRegistry;
+        m_pTaskSystem = systemsRegistry.GetSystem<TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
 
         //-------------------------------------------------------------------------
 
@@ -56,6 +118,7 @@ namespace EE
         //-------------------------------------------------------------------------
 
         m_worldSystemTypeInfos.clear();
+        m_pTaskSystem = nullptr;
         m_pSystemsRegistry = nullptr;
     }
 
@@ -180,58 +243,52 @@ namespace EE
         // World Update
         //-------------------------------------------------------------------------
 
+        TInlineVector<EntityWorld*, 5> worldsToUpdate;
         for ( auto const& pWorld : m_worlds )
         {
-            if ( pWorld->IsSuspended() )
+            if ( !pWorld->IsSuspended() )
             {
-                continue;
+                worldsToUpdate.emplace_back( pWorld );
             }
+        }
 
-            // Reflect input state
-            //-------------------------------------------------------------------------
-
-            if ( context.GetUpdateStage() == UpdateStage::FrameStart )
+        // Each world only touches its own state and the read-only parts of the shared systems during its update, so the worlds can be updated in parallel
+        // We wait for all the world updates to complete so the stage barrier is kept across all worlds
+        if ( m_concurrentWorldUpdatesEnabled && worldsToUpdate.size() > 1 )
+        {
+            struct WorldUpdateTask final : public ITaskSet
             {
-                auto pPlayerManager = pWorld->GetWorldSystem<PlayerManager>();
-                auto pWorldInputState = pWorld->GetInputState();
-
-                if ( pPlayerManager->IsPlayerEnabled() )
+                WorldUpdateTask( UpdateContext const& context, TInlineVector<EntityWorld*, 5> const& worldsToUpdate )
+                    : m_context( context )
+                    , m_worldsToUpdate( worldsToUpdate )
                 {
-                    auto pInputSystem = context.GetSystem<Input::InputSystem>();
-                    pInputSystem->ReflectState( context.GetDeltaTime(), pWorld->GetTimeScale(), *pWorldInputState );
+                    m_SetSize = (uint32_t) worldsToUpdate.size();
                 }
-                else
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
                 {
-                    pWorldInputState->Clear();
+                    for ( uint64_t i = range.start; i < range.end; ++i )
+                    {
+                        EE_PROFILE_SCOPE_ENTITY( "Update World" );
+                        UpdateWorld( m_worldsToUpdate[i], m_context );
+                    }
                 }
-            }
 
-            // Run world updates
-            //-------------------------------------------------------------------------
+            private:
 
-            pWorld->Update( context );
-
-            // Update world view
-            //-------------------------------------------------------------------------
-            // We explicitly reflect the camera at the end of the post-physics stage as we assume it has been updated at that point
+                UpdateContext const&                        m_context;
+                TInlineVector<EntityWorld*, 5> const&       m_worldsToUpdate;
+            };
 
-            if ( context.GetUpdateStage() == UpdateStage::PostPhysics && pWorld->GetViewport() != nullptr )
+            WorldUpdateTask worldUpdateTask( context, worldsToUpdate );
+            m_pTaskSystem->ScheduleTask( &worldUpdateTask );
+            m_pTaskSystem->WaitForTask( &worldUpdateTask );
+        }
+        else
+        {
+            for ( auto pWorld : worldsToUpdate )
             {
-                auto pViewport = pWorld->GetViewport();
-                auto pCameraManager = pWorld->GetWorldSystem<CameraManager>();
-                if ( pCameraManager->HasActiveCamera() )
-                {
-                    auto pActiveCamera = pCameraManager->GetActiveCamera();
-
-                    // Update camera view dimensions if needed
-                    if ( pViewport->GetDimensions() != pActiveCamera->GetViewVolume().GetViewDimensions() )
-                    {
-                        pActiveCamera->UpdateViewDimensions( pViewport->GetDimensions() );
-                    }
-
-                    // Update world viewport
-                    pViewport->SetViewVolume( pActiveCamera->GetViewVolume() );
-                }
+                UpdateWorld( pWorld, context );
             }
         }
 
@@ -11,6 +11,7 @@ namespace EE
     class UpdateContext;
     class EntityWorld;
     class SystemRegistry;
+    class TaskSystem;
     enum class EntityWorldType : uint8_t;
     namespace TypeSystem { class TypeInfo; }
     namespace Render { class Viewport; }
@@ -67,6 +68,10 @@ namespace EE
         // Run the world update - updates all entities, systems and camera
         void UpdateWorlds( UpdateContext const& context );
 
+        // Should the worlds be updated concurrently? Each world's stage update is run as its own task and all worlds complete a stage before the next stage starts
+        inline bool AreConcurrentWorldUpdatesEnabled() const { return m_concurrentWorldUpdatesEnabled; }
+        inline void SetConcurrentWorldUpdatesEnabled( bool isEnabled ) { m_concurrentWorldUpdatesEnabled = isEnabled; }
+
         // Hot Reload
         //-------------------------------------------------------------------------
 
@@ -78,8 +83,10 @@ namespace EE
     private:
 
         SystemRegistry const*                               m_pSystemsRegistry = nullptr;
+        TaskSystem*                                         m_pTaskSystem = nullptr;
         TInlineVector<EntityWorld*, 5>                      m_worlds;
         TVector<TypeSystem::TypeInfo const*>                m_worldSystemTypeInfos;
+        bool                                                m_concurrentWorldUpdatesEnabled = false;
 
         #if EE_DEVELOPMENT_TOOLS
         TVector<TypeSystem::TypeInfo const*>                m_debugViewTypeInfos;
@@ -123,6 +123,11 @@ namespace EE::Physics
         physx::PxRigidActor*                            m_pPhysicsActor = nullptr;
         physx::PxShape*                                 m_pPhysicsShape = nullptr;
 
+        // The last two simulated poses for dynamic actors, the component transform is interpolated between them
+        Transform                                       m_previousPhysicsPose;
+        Transform                                       m_currentPhysicsPose;
+        bool                                            m_isPhysicsPoseInterpolating = false; // Was this actor moved by the last simulation step
+
         #if EE_DEVELOPMENT_TOOLS
         String                                          m_debugName; // Keep a debug name here since the physx SDK doesnt store the name data
         #endif
@@ -166,6 +166,27 @@ namespace EE::Physics
         ImGui::Checkbox( "Draw Dynamic Actor Bounds", &m_pPhysicsWorldSystem->m_drawDynamicActorBounds );
         ImGui::Checkbox( "Draw Kinematic Actor Bounds", &m_pPhysicsWorldSystem->m_drawKinematicActorBounds );
 
+        //-------------------------------------------------------------------------
+        // Simulation
+        //-------------------------------------------------------------------------
+
+        ImGui::Separator();
+
+        PhysicsWorldSystem::SimulationSettings simulationSettings = m_pPhysicsWorldSystem->GetSimulationSettings();
+        float simulationRate = 1.0f / simulationSettings.m_fixedTimeStep;
+
+        bool simulationSettingsUpdated = false;
+        simulationSettingsUpdated |= ImGui::SliderFloat( "Simulation Rate (Hz)", &simulationRate, 10.0f, 240.0f );
+        simulationSettingsUpdated |= ImGui::SliderInt( "Substeps", &simulationSettings.m_numSubsteps, 1, 8 );
+        simulationSettingsUpdated |= ImGui::SliderInt( "Max Steps Per Frame", &simulationSettings.m_maxStepsPerFrame, 1, 16 );
+        simulationSettingsUpdated |= ImGui::Checkbox( "Run Asynchronously", &simulationSettings.m_runAsynchronously );
+
+        if ( simulationSettingsUpdated )
+        {
+            simulationSettings.m_fixedTimeStep = 1.0f / Math::Max( simulationRate, 1.0f );
+            m_pPhysicsWorldSystem->SetSimulationSettings( simulationSettings );
+        }
+
         //-------------------------------------------------------------------------
         // Component Debug
         //-------------------------------------------------------------------------
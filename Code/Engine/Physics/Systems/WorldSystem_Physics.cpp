@@ -98,6 +98,9 @@ namespace EE::Physics
         m_pScene = m_pPhysicsSystem->CreateScene();
         EE_ASSERT( m_pScene != nullptr );
 
+        m_pScratchBuffer = EE::Alloc( s_scratchBufferSize, 16 );
+        m_timeAccumulator = 0.0f;
+
         #if EE_DEVELOPMENT_TOOLS
         SetDebugFlags( 1 << PxVisualizationParameter::eCOLLISION_SHAPES );
         #endif
@@ -105,15 +108,26 @@ namespace EE::Physics
 
     void PhysicsWorldSystem::ShutdownSystem()
     {
+        // Never release the scene while it is simulating
+        if ( m_isSimulationRunning )
+        {
+            m_pScene->AcquireWriteLock();
+            CompleteSimulation();
+            m_pScene->ReleaseWriteLock();
+        }
+
         // Destroy scene
         EE::Delete( m_pScene );
         m_pPhysicsSystem = nullptr;
 
+        EE::Free( m_pScratchBuffer );
+
         PhysicsShapeComponent::OnStaticActorTransformUpdated().Unbind( m_shapeTransformChangedBindingID );
 
         EE_ASSERT( m_staticActorShapeUpdateList.empty() );
         EE_ASSERT( m_physicsShapeComponents.empty() );
         EE_ASSERT( m_dynamicShapeComponents.empty() );
+        EE_ASSERT( m_interpolatingDynamicComponents.empty() && m_settledDynamicComponents.empty() );
     }
 
     //-------------------------------------------------------------------------
@@ -156,6 +170,13 @@ namespace EE::Physics
                 m_dynamicShapeComponents.Remove( pPhysicsComponent->GetID() );
             }
 
+            if ( pPhysicsComponent->m_isPhysicsPoseInterpolating )
+            {
+                m_interpolatingDynamicComponents.erase_first_unsorted( pPhysicsComponent );
+                pPhysicsComponent->m_isPhysicsPoseInterpolating = false;
+            }
+
+            m_settledDynamicComponents.erase( eastl::remove( m_settledDynamicComponents.begin(), m_settledDynamicComponents.end(), pPhysicsComponent ), m_settledDynamicComponents.end() );
             m_staticActorShapeUpdateList.erase_first_unsorted( pPhysicsComponent );
             m_physicsShapeComponents.Remove( pComponent->GetID() );
 
@@ -251,6 +272,8 @@ namespace EE::Physics
 
         pPhysicsActor->userData = pComponent;
         pComponent->m_pPhysicsActor = pPhysicsActor;
+        pComponent->m_previousPhysicsPose = FromPx( actorPose );
+        pComponent->m_currentPhysicsPose = pComponent->m_previousPhysicsPose;
 
         #if EE_DEVELOPMENT_TOOLS
         pPhysicsActor->setName( pComponent->m_debugName.c_str() );
@@ -584,35 +607,47 @@ namespace EE::Physics
     
     void PhysicsWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
-        PxScene* pPxScene = m_pScene->m_pScene;
-
-        if ( ctx.GetUpdateStage() == UpdateStage::Physics )
+        if ( ctx.GetUpdateStage() == UpdateStage::PrePhysics )
         {
-            m_pScene->AcquireWriteLock();
+            // Kick off the first step as late as possible in the pre-physics stage, the write lock is released while the scene simulates
+            if ( m_simulationSettings.m_runAsynchronously )
             {
-                EE_PROFILE_SCOPE_PHYSICS( "Simulate" );
-             
-                // Handle any static component updates this should not happen in the running game
-                for ( auto pShapeComponent : m_staticActorShapeUpdateList )
+                m_pScene->AcquireWriteLock();
                 {
-                    if ( ctx.IsGameWorld() )
+                    EE_PROFILE_SCOPE_PHYSICS( "Start Simulation" );
+                    UpdateStaticActors( ctx );
+
+                    m_numPendingSteps = CalculateNumSteps( ctx.GetDeltaTime() );
+                    if ( m_numPendingSteps > 0 )
                     {
-                        EE_LOG_ENTITY_ERROR( pShapeComponent, "Physics", "Someone moved a static physics actor: %s with entity ID %u. This should not be done!", pShapeComponent->GetName().c_str(), pShapeComponent->GetEntityID().m_ID );
+                        BeginFixedStep();
+                        m_isSimulationRunning = true;
                     }
-
-                    UpdateStaticActorAndShape( pShapeComponent );
                 }
-                m_staticActorShapeUpdateList.clear();
-
-                // TODO: run at fixed time step
-                pPxScene->simulate( ctx.GetDeltaTime() );
+                m_pScene->ReleaseWriteLock();
             }
+        }
+        else if ( ctx.GetUpdateStage() == UpdateStage::Physics )
+        {
+            m_pScene->AcquireWriteLock();
+            {
+                EE_PROFILE_SCOPE_PHYSICS( "Step Simulation" );
 
-            //-------------------------------------------------------------------------
+                if ( m_isSimulationRunning )
+                {
+                    CompleteSimulation();
+                }
+                else if ( !m_simulationSettings.m_runAsynchronously )
+                {
+                    UpdateStaticActors( ctx );
 
-            {
-                EE_PROFILE_SCOPE_PHYSICS( "Fetch Results" );
-                pPxScene->fetchResults( true );
+                    int32_t const numSteps = CalculateNumSteps( ctx.GetDeltaTime() );
+                    for ( int32_t stepIdx = 0; stepIdx < numSteps; stepIdx++ )
+                    {
+                        BeginFixedStep();
+                        CompleteFixedStep();
+                    }
+                }
             }
             m_pScene->ReleaseWriteLock();
         }
@@ -620,42 +655,62 @@ namespace EE::Physics
         {
             EE_PROFILE_SCOPE_PHYSICS( "Update Dynamic Objects" );
 
+            // This should never be the case since we complete the simulation in the physics stage, but we cant touch any poses while the scene is simulating
+            if ( m_isSimulationRunning )
+            {
+                m_pScene->AcquireWriteLock();
+                CompleteSimulation();
+                m_pScene->ReleaseWriteLock();
+            }
+
             #if EE_DEVELOPMENT_TOOLS
             Drawing::DrawContext drawingContext = ctx.GetDrawingContext();
             #endif
 
-            m_pScene->AcquireReadLock();
-
+            // All poses were read at the end of the simulation step so we dont need to touch the scene here
             //-------------------------------------------------------------------------
 
-            for ( auto const& pDynamicPhysicsComponent : m_dynamicShapeComponents )
+            // Actors that came to rest during the last step get snapped to their final pose once
+            for ( auto pSettledComponent : m_settledDynamicComponents )
             {
-                // Transfer physics pose back to component
-                if ( pDynamicPhysicsComponent->m_pPhysicsActor != nullptr && pDynamicPhysicsComponent->m_actorType == ActorType::Dynamic )
+                if ( !pSettledComponent->m_isPhysicsPoseInterpolating )
                 {
-                    auto physicsPose = pDynamicPhysicsComponent->m_pPhysicsActor->getGlobalPose();
-                    pDynamicPhysicsComponent->SetWorldTransform( FromPx( physicsPose ) );
+                    pSettledComponent->SetWorldTransform( pSettledComponent->m_currentPhysicsPose );
                 }
+            }
+            m_settledDynamicComponents.clear();
 
-                // Debug
-                //-------------------------------------------------------------------------
+            // How far are we between the last two simulated states
+            float const interpolationFactor = Math::Clamp( m_timeAccumulator / m_simulationSettings.m_fixedTimeStep, 0.0f, 1.0f );
 
-                #if EE_DEVELOPMENT_TOOLS
-                if ( m_drawDynamicActorBounds && pDynamicPhysicsComponent->m_actorType == ActorType::Dynamic )
-                {
-                    drawingContext.DrawBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::Orange.GetAlphaVersion( 0.5f ) );
-                    drawingContext.DrawWireBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::Orange );
-                }
+            for ( auto pInterpolatingComponent : m_interpolatingDynamicComponents )
+            {
+                Transform const interpolatedPose = Transform::Lerp( pInterpolatingComponent->m_previousPhysicsPose, pInterpolatingComponent->m_currentPhysicsPose, interpolationFactor );
+                pInterpolatingComponent->SetWorldTransform( interpolatedPose );
+            }
+
+            // Debug
+            //-------------------------------------------------------------------------
 
-                if ( m_drawKinematicActorBounds && pDynamicPhysicsComponent->m_actorType == ActorType::Kinematic )
+            #if EE_DEVELOPMENT_TOOLS
+            if ( m_drawDynamicActorBounds || m_drawKinematicActorBounds )
+            {
+                for ( auto const& pDynamicPhysicsComponent : m_dynamicShapeComponents )
                 {
-                    drawingContext.DrawBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::HotPink.GetAlphaVersion( 0.5f ) );
-                    drawingContext.DrawWireBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::HotPink );
+                    if ( m_drawDynamicActorBounds && pDynamicPhysicsComponent->m_actorType == ActorType::Dynamic )
+                    {
+                        drawingContext.DrawBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::Orange.GetAlphaVersion( 0.5f ) );
+                        drawingContext.DrawWireBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::Orange );
+                    }
+
+                    if ( m_drawKinematicActorBounds && pDynamicPhysicsComponent->m_actorType == ActorType::Kinematic )
+                    {
+                        drawingContext.DrawBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::HotPink.GetAlphaVersion( 0.5f ) );
+                        drawingContext.DrawWireBox( pDynamicPhysicsComponent->GetWorldBounds(), Colors::HotPink );
+                    }
                 }
-                #endif
             }
-
-            m_pScene->ReleaseReadLock();
+            #endif
         }
         else
         {
@@ -663,6 +718,146 @@ namespace EE::Physics
         }
     }
 
+    //-------------------------------------------------------------------------
+
+    void PhysicsWorldSystem::SetSimulationSettings( SimulationSettings const& settings )
+    {
+        m_simulationSettings.m_fixedTimeStep = Math::Max( settings.m_fixedTimeStep, 1.0f / 1000.0f );
+        m_simulationSettings.m_numSubsteps = Math::Max( settings.m_numSubsteps, 1 );
+        m_simulationSettings.m_maxStepsPerFrame = Math::Max( settings.m_maxStepsPerFrame, 1 );
+        m_simulationSettings.m_runAsynchronously = settings.m_runAsynchronously;
+        m_timeAccumulator = Math::Min( m_timeAccumulator, m_simulationSettings.m_fixedTimeStep );
+    }
+
+    void PhysicsWorldSystem::UpdateStaticActors( EntityWorldUpdateContext const& ctx )
+    {
+        // Handle any static component updates this should not happen in the running game
+        for ( auto pShapeComponent : m_staticActorShapeUpdateList )
+        {
+            if ( ctx.IsGameWorld() )
+            {
+                EE_LOG_ENTITY_ERROR( pShapeComponent, "Physics", "Someone moved a static physics actor: %s with entity ID %u. This should not be done!", pShapeComponent->GetName().c_str(), pShapeComponent->GetEntityID().m_ID );
+            }
+
+            UpdateStaticActorAndShape( pShapeComponent );
+        }
+        m_staticActorShapeUpdateList.clear();
+    }
+
+    int32_t PhysicsWorldSystem::CalculateNumSteps( float deltaTime )
+    {
+        // Calculate the number of steps needed, dropping any time beyond our catch-up budget
+        float const fixedTimeStep = m_simulationSettings.m_fixedTimeStep;
+        m_timeAccumulator += deltaTime;
+
+        int32_t numSteps = (int32_t) Math::Floor( m_timeAccumulator / fixedTimeStep );
+        if ( numSteps > m_simulationSettings.m_maxStepsPerFrame )
+        {
+            numSteps = m_simulationSettings.m_maxStepsPerFrame;
+            m_timeAccumulator = numSteps * fixedTimeStep;
+        }
+
+        m_timeAccumulator = Math::Max( m_timeAccumulator - ( numSteps * fixedTimeStep ), 0.0f );
+        return numSteps;
+    }
+
+    void PhysicsWorldSystem::BeginFixedStep()
+    {
+        EE_ASSERT( m_pScratchBuffer != nullptr );
+        EE_ASSERT( m_numRemainingSubsteps == 0 );
+
+        // Everything that moved in the previous step is now at its last simulated pose, if it moves again it will be re-added when gathering the active actors
+        for ( auto pInterpolatingComponent : m_interpolatingDynamicComponents )
+        {
+            pInterpolatingComponent->m_previousPhysicsPose = pInterpolatingComponent->m_currentPhysicsPose;
+            pInterpolatingComponent->m_isPhysicsPoseInterpolating = false;
+            m_settledDynamicComponents.emplace_back( pInterpolatingComponent );
+        }
+        m_interpolatingDynamicComponents.clear();
+
+        // Start the first substep, we store the substep settings since they might be changed before the step completes
+        m_substepTimeStep = m_simulationSettings.m_fixedTimeStep / m_simulationSettings.m_numSubsteps;
+        m_numRemainingSubsteps = m_simulationSettings.m_numSubsteps;
+
+        EE_PROFILE_SCOPE_PHYSICS( "Simulate" );
+        m_pScene->m_pScene->simulate( m_substepTimeStep, nullptr, m_pScratchBuffer, s_scratchBufferSize );
+    }
+
+    void PhysicsWorldSystem::CompleteFixedStep()
+    {
+        EE_ASSERT( m_numRemainingSubsteps > 0 );
+        PxScene* pPxScene = m_pScene->m_pScene;
+
+        while ( true )
+        {
+            {
+                EE_PROFILE_SCOPE_PHYSICS( "Fetch Results" );
+                pPxScene->fetchResults( true );
+            }
+
+            GatherActiveDynamicActors();
+
+            if ( --m_numRemainingSubsteps == 0 )
+            {
+                break;
+            }
+
+            EE_PROFILE_SCOPE_PHYSICS( "Simulate" );
+            pPxScene->simulate( m_substepTimeStep, nullptr, m_pScratchBuffer, s_scratchBufferSize );
+        }
+
+        // Read back the new poses for all moved actors in a single pass
+        {
+            EE_PROFILE_SCOPE_PHYSICS( "Read Active Actor Poses" );
+            for ( auto pInterpolatingComponent : m_interpolatingDynamicComponents )
+            {
+                pInterpolatingComponent->m_currentPhysicsPose = FromPx( pInterpolatingComponent->m_pPhysicsActor->getGlobalPose() );
+            }
+        }
+    }
+
+    void PhysicsWorldSystem::CompleteSimulation()
+    {
+        EE_ASSERT( m_isSimulationRunning && m_numPendingSteps > 0 );
+
+        // Complete the step that was started in the pre-physics stage, any catch-up steps are run synchronously
+        CompleteFixedStep();
+        for ( int32_t stepIdx = 1; stepIdx < m_numPendingSteps; stepIdx++ )
+        {
+            BeginFixedStep();
+            CompleteFixedStep();
+        }
+
+        m_numPendingSteps = 0;
+        m_isSimulationRunning = false;
+    }
+
+    void PhysicsWorldSystem::GatherActiveDynamicActors()
+    {
+        PxU32 numActiveActors = 0;
+        PxActor** ppActiveActors = m_pScene->m_pScene->getActiveActors( numActiveActors );
+
+        for ( PxU32 i = 0; i < numActiveActors; i++ )
+        {
+            // Kinematic actors (i.e. characters, ragdoll control bodies) and articulation links are driven from outside the simulation
+            PxRigidDynamic* pRigidDynamicActor = ppActiveActors[i]->is<PxRigidDynamic>();
+            if ( pRigidDynamicActor == nullptr || pRigidDynamicActor->getRigidBodyFlags().isSet( PxRigidBodyFlag::eKINEMATIC ) )
+            {
+                continue;
+            }
+
+            auto pDynamicPhysicsComponent = reinterpret_cast<PhysicsShapeComponent*>( pRigidDynamicActor->userData );
+            EE_ASSERT( pDynamicPhysicsComponent != nullptr && pDynamicPhysicsComponent->m_actorType == ActorType::Dynamic );
+
+            // An actor can be reported by multiple substeps
+            if ( !pDynamicPhysicsComponent->m_isPhysicsPoseInterpolating )
+            {
+                pDynamicPhysicsComponent->m_isPhysicsPoseInterpolating = true;
+                m_interpolatingDynamicComponents.emplace_back( pDynamicPhysicsComponent );
+            }
+        }
+    }
+
     //------------------------------------------------------------------------- 
     // Debug
     //-------------------------------------------------------------------------
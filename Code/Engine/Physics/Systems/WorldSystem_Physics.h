@@ -51,7 +51,24 @@ namespace EE::Physics
 
     public:
 
-        EE_REGISTER_ENTITY_WORLD_SYSTEM( PhysicsWorldSystem, RequiresUpdate( UpdateStage::Physics ), RequiresUpdate( UpdateStage::PostPhysics ) );
+        // The simulation is run at a fixed time step, the dynamic actor transforms are interpolated between the last two simulated states
+        struct SimulationSettings
+        {
+            float                                               m_fixedTimeStep = 1.0f / 60.0f;
+            int32_t                                             m_numSubsteps = 1;          // The number of simulate calls per fixed time step
+            int32_t                                             m_maxStepsPerFrame = 4;     // The max number of fixed time steps we will run in a single frame to catch up, any time beyond this is dropped
+            bool                                                m_runAsynchronously = false; // Start the simulation at the end of the pre-physics stage and only wait for the results at the end of the physics stage
+        };
+
+        // PhysX requires the scratch block to be a multiple of 16K and 16 byte aligned
+        constexpr static uint32_t const s_scratchBufferSize = 16 * 1024 * 16;
+
+    public:
+
+        // World systems are updated in descending priority value order, so the pre-physics update (which starts the async step) runs after all other pre-physics systems (i.e. animation, character movement, AI)
+        // This ensures that all root motion, kinematic and ragdoll writes for this frame land in the step
+        // The physics stage update also runs last in its stage, so all other physics stage systems (i.e. navmesh) run while the step simulates and we only wait for the results right before the post-physics consumers
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( PhysicsWorldSystem, RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::Highest ), RequiresUpdate( UpdateStage::Physics, UpdatePriority::Highest ), RequiresUpdate( UpdateStage::PostPhysics ) );
 
     public:
 
@@ -64,6 +81,10 @@ namespace EE::Physics
         // Get the scene
         Scene* GetScene() { return m_pScene; }
 
+        // Simulation settings
+        inline SimulationSettings const& GetSimulationSettings() const { return m_simulationSettings; }
+        void SetSimulationSettings( SimulationSettings const& settings );
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -101,6 +122,23 @@ namespace EE::Physics
         void UpdateStaticActorAndShape( PhysicsShapeComponent* pComponent ) const;
         void OnStaticShapeTransformUpdated( PhysicsShapeComponent* pComponent );
 
+        void UpdateStaticActors( EntityWorldUpdateContext const& ctx );
+
+        // Update the time accumulator and return the number of fixed time steps we need to run this frame
+        int32_t CalculateNumSteps( float deltaTime );
+
+        // A fixed step is split in two so that we can run other work while the first substep is simulating
+        // Begin starts the first substep and returns immediately, complete waits for the results and runs all remaining substeps
+        // Any scene queries made in between (under a read lock) are served from the previous step's state, any writes are buffered until the results are fetched
+        void BeginFixedStep();
+        void CompleteFixedStep();
+
+        // Wait for the asynchronously started step and run any remaining catch-up steps
+        void CompleteSimulation();
+
+        // Gather all the dynamic actors that were moved by the last simulation step from the scene's active actor list
+        void GatherActiveDynamicActors();
+
     private:
 
         PhysicsSystem*                                          m_pPhysicsSystem = nullptr;
@@ -113,6 +151,18 @@ namespace EE::Physics
         EventBindingID                                          m_shapeTransformChangedBindingID;
         TVector<PhysicsShapeComponent*>                         m_staticActorShapeUpdateList;
 
+        // Only dynamic actors that were moved by the last step are interpolated, actors that came to rest need a single final transform update
+        TVector<PhysicsShapeComponent*>                         m_interpolatingDynamicComponents;
+        TVector<PhysicsShapeComponent*>                         m_settledDynamicComponents;
+
+        SimulationSettings                                      m_simulationSettings;
+        float                                                   m_timeAccumulator = 0.0f;
+        float                                                   m_substepTimeStep = 0.0f;
+        int32_t                                                 m_numRemainingSubsteps = 0;
+        int32_t                                                 m_numPendingSteps = 0;
+        bool                                                    m_isSimulationRunning = false;
+        void*                                                   m_pScratchBuffer = nullptr;
+
         #if EE_DEVELOPMENT_TOOLS
         bool                                                    m_drawDynamicActorBounds = false;
         bool                                                    m_drawKinematicActorBounds = false;
@@ -40,6 +40,10 @@ namespace EE::Render
         m_boneTransforms.clear();
         m_skinningTransforms.clear();
         m_animToMeshBoneMap.clear();
+        m_interpolationSourceTransforms.clear();
+        m_interpolationTargetTransforms.clear();
+        m_numInterpolationFrames = m_interpolationFrameIdx = 0;
+        m_isPoseDirty = true;
         MeshComponent::Shutdown();
     }
 
@@ -98,13 +102,28 @@ namespace EE::Render
         m_pSkeleton = skeletonResourceID;
     }
 
-    void SkeletalMeshComponent::SetPose( Animation::Pose const* pPose )
+    void SkeletalMeshComponent::SetPose( Animation::Pose const* pPose, int32_t numInterpolationFrames )
     {
         EE_PROFILE_FUNCTION_RENDER();
         EE_ASSERT( IsInitialized() );
         EE_ASSERT( HasMeshResourceSet() && HasSkeletonResourceSet() );
         EE_ASSERT( !m_animToMeshBoneMap.empty() );
         EE_ASSERT( pPose != nullptr && pPose->HasGlobalTransforms() );
+        EE_ASSERT( numInterpolationFrames >= 1 );
+
+        // Set the target pose, if we are interpolating we keep the current pose as the interpolation source
+        TVector<Transform>* pTargetTransforms = &m_boneTransforms;
+        if ( numInterpolationFrames > 1 )
+        {
+            m_interpolationSourceTransforms = m_boneTransforms;
+            m_interpolationTargetTransforms = m_boneTransforms;
+            pTargetTransforms = &m_interpolationTargetTransforms;
+        }
+
+        m_numInterpolationFrames = ( numInterpolationFrames > 1 ) ? numInterpolationFrames : 0;
+        m_interpolationFrameIdx = 0;
+
+        //-------------------------------------------------------------------------
 
         int32_t const numAnimBones = pPose->GetNumBones();
         for ( auto animBoneIdx = 0; animBoneIdx < numAnimBones; animBoneIdx++ )
@@ -113,9 +132,11 @@ namespace EE::Render
             if ( meshBoneIdx != InvalidIndex )
             {
                 Transform const boneTransform = pPose->GetGlobalTransform( animBoneIdx );
-                m_boneTransforms[meshBoneIdx] = boneTransform;
+                ( *pTargetTransforms )[meshBoneIdx] = boneTransform;
             }
         }
+
+        m_isPoseDirty = true;
     }
 
     void SkeletalMeshComponent::ResetPose()
@@ -131,6 +152,8 @@ namespace EE::Render
         else
         {
             m_boneTransforms = m_pMesh->GetBindPose();
+            m_numInterpolationFrames = m_interpolationFrameIdx = 0;
+            m_isPoseDirty = true;
         }
     }
 
@@ -139,9 +162,31 @@ namespace EE::Render
         EE_PROFILE_FUNCTION_RENDER();
         EE_ASSERT( m_pMesh.IsValid() && m_pMesh.IsLoaded() );
 
+        // Step the pose interpolation
+        if ( IsInterpolatingPose() )
+        {
+            m_interpolationFrameIdx++;
+            float const t = float( m_interpolationFrameIdx ) / m_numInterpolationFrames;
+
+            auto const numBones = m_boneTransforms.size();
+            for ( auto i = 0; i < numBones; i++ )
+            {
+                m_boneTransforms[i] = Transform::Lerp( m_interpolationSourceTransforms[i], m_interpolationTargetTransforms[i], t );
+            }
+
+            m_isPoseDirty = true;
+        }
+
+        // Nothing to do if the pose hasnt changed since the last finalize (i.e. the animation update was skipped)
+        if ( !m_isPoseDirty )
+        {
+            return;
+        }
+
         NotifySocketsUpdated();
         UpdateBounds();
         UpdateSkinningTransforms();
+        m_isPoseDirty = false;
     }
 
     //-------------------------------------------------------------------------
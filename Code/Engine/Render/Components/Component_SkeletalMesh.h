@@ -49,12 +49,17 @@ namespace EE::Render
         {
             EE_ASSERT( boneIdx >= 0 && boneIdx < m_boneTransforms.size() );
             m_boneTransforms[boneIdx] = transform;
+            m_isPoseDirty = true;
         }
 
         // This function will finalize the pose, run any procedural bone solvers and generate the skinning transforms
         // Only run this function once per frame once you have set the final global pose
+        // If a pose was set with interpolation, this will step the interpolation towards the set pose
         void FinalizePose();
 
+        // Are we still interpolating towards the last set pose
+        inline bool IsInterpolatingPose() const { return m_interpolationFrameIdx < m_numInterpolationFrames; }
+
         // Get the skinning transforms for this mesh - these are the global transforms relative to the bind pose
         inline TVector<Matrix> const& GetSkinningTransforms() const { return m_skinningTransforms; }
 
@@ -65,7 +70,10 @@ namespace EE::Render
         inline Animation::Skeleton const* GetSkeleton() const { return m_pSkeleton.GetPtr(); }
         void SetSkeleton( ResourceID skeletonResourceID );
 
-        void SetPose( Animation::Pose const* pPose );
+        // Set the pose for the mesh
+        // If the number of interpolation frames is greater than one, the mesh will interpolate from its current pose to the new pose over that many calls to 'FinalizePose'
+        // This is used for characters whose animation is updated at a reduced rate
+        void SetPose( Animation::Pose const* pPose, int32_t numInterpolationFrames = 1 );
 
         void ResetPose();
 
@@ -97,6 +105,13 @@ namespace EE::Render
         TVector<int32_t>                                  m_animToMeshBoneMap;
         TVector<Transform>                              m_boneTransforms;
         TVector<Matrix>                                 m_skinningTransforms;
+
+        // Pose interpolation for reduced update rates
+        TVector<Transform>                              m_interpolationSourceTransforms;
+        TVector<Transform>                              m_interpolationTargetTransforms;
+        int32_t                                         m_numInterpolationFrames = 0;
+        int32_t                                         m_interpolationFrameIdx = 0;
+        bool                                            m_isPoseDirty = true;
     };
 
     //-------------------------------------------------------------------------
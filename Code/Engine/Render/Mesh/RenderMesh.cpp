@@ -12,6 +12,38 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    Vector Mesh::GetVertexPosition( int32_t vertexIdx ) const
+    {
+        EE_ASSERT( vertexIdx >= 0 && vertexIdx < GetNumVertices() );
+        uint8_t const* pVertex = m_vertices.data() + ( vertexIdx * m_vertexBuffer.m_byteStride );
+
+        if ( HasCompressedVertices() )
+        {
+            auto pCompressedVertex = reinterpret_cast<CompressedStaticMeshVertex const*>( pVertex );
+            Vector const normalizedPosition( VertexCompression::UNorm16ToFloat( pCompressedVertex->m_position[0] ), VertexCompression::UNorm16ToFloat( pCompressedVertex->m_position[1] ), VertexCompression::UNorm16ToFloat( pCompressedVertex->m_position[2] ) );
+            return Vector::MultiplyAdd( normalizedPosition, m_positionDequantizationScale, m_positionDequantizationOffset ).GetWithW1();
+        }
+
+        return Vector( reinterpret_cast<StaticMeshVertex const*>( pVertex )->m_position ).GetWithW1();
+    }
+
+    Vector Mesh::GetVertexNormal( int32_t vertexIdx ) const
+    {
+        EE_ASSERT( vertexIdx >= 0 && vertexIdx < GetNumVertices() );
+        uint8_t const* pVertex = m_vertices.data() + ( vertexIdx * m_vertexBuffer.m_byteStride );
+
+        if ( HasCompressedVertices() )
+        {
+            auto pCompressedVertex = reinterpret_cast<CompressedStaticMeshVertex const*>( pVertex );
+            Float2 const encodedNormal( VertexCompression::SNorm16ToFloat( pCompressedVertex->m_normal[0] ), VertexCompression::SNorm16ToFloat( pCompressedVertex->m_normal[1] ) );
+            return VertexCompression::DecodeOctahedralNormal( encodedNormal );
+        }
+
+        return Vector( reinterpret_cast<StaticMeshVertex const*>( pVertex )->m_normal ).GetWithW0();
+    }
+
+    //-------------------------------------------------------------------------
+
     #if EE_DEVELOPMENT_TOOLS
     void Mesh::DrawNormals( Drawing::DrawContext& drawingContext, Transform const& worldTransform ) const
     {
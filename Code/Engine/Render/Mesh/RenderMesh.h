@@ -20,6 +20,8 @@ namespace EE::Drawing { class DrawContext; }
 // Notes:
 // * EE uses CCW to determine the facing direction
 // * Meshes use the triangle list topology
+// * Generated LODs share the vertex buffer with the authored mesh (LOD0) and only add additional index ranges
+// * Compressed vertex formats store positions quantized against the mesh bounds, use the dequantization offset/scale to get the real position
 
 namespace EE::Render
 {
@@ -28,7 +30,7 @@ namespace EE::Render
         friend class MeshCompiler;
         friend class MeshLoader;
 
-        EE_SERIALIZE( m_vertices, m_indices, m_sections, m_materials, m_vertexBuffer, m_indexBuffer, m_bounds );
+        EE_SERIALIZE( m_vertices, m_indices, m_sections, m_LODs, m_materials, m_vertexBuffer, m_indexBuffer, m_bounds, m_positionDequantizationOffset, m_positionDequantizationScale );
 
     public:
 
@@ -44,6 +46,15 @@ namespace EE::Render
             uint32_t                        m_numIndices = 0;
         };
 
+        // A generated LOD - has an index range per section of the authored mesh
+        struct EE_ENGINE_API LOD
+        {
+            EE_SERIALIZE( m_sections, m_screenSizeThreshold );
+
+            TVector<GeometrySection>        m_sections;
+            float                           m_screenSizeThreshold = 0.0f; // Switch to this LOD once the screen size drops below this threshold, thresholds decrease with each LOD
+        };
+
     public:
 
         virtual bool IsValid() const override
@@ -59,6 +70,13 @@ namespace EE::Render
         inline int32_t const GetNumVertices() const { return m_vertexBuffer.m_byteSize / m_vertexBuffer.m_byteStride; }
         inline VertexFormat const& GetVertexFormat() const { return m_vertexBuffer.m_vertexFormat; }
         inline RenderBuffer const& GetVertexBuffer() const { return m_vertexBuffer; }
+        inline bool HasCompressedVertices() const { return m_vertexBuffer.m_vertexFormat == VertexFormat::StaticMeshCompressed || m_vertexBuffer.m_vertexFormat == VertexFormat::SkeletalMeshCompressed; }
+        inline Vector const& GetPositionDequantizationOffset() const { return m_positionDequantizationOffset; }
+        inline Vector const& GetPositionDequantizationScale() const { return m_positionDequantizationScale; }
+
+        // Decode a single vertex's position and normal, this is slow and only intended for tools/debug usage
+        Vector GetVertexPosition( int32_t vertexIdx ) const;
+        Vector GetVertexNormal( int32_t vertexIdx ) const;
 
         // Indices
         inline TVector<uint32_t> const& GetIndices() const { return m_indices; }
@@ -70,6 +88,22 @@ namespace EE::Render
         inline uint32_t GetNumSections() const { return (uint32_t) m_sections.size(); }
         inline GeometrySection GetSection( uint32_t i ) const { EE_ASSERT( i < GetNumSections() ); return m_sections[i]; }
 
+        // LODs - LOD0 is the authored mesh
+        inline int32_t GetNumLODs() const { return 1 + (int32_t) m_LODs.size(); }
+        inline TVector<GeometrySection> const& GetLODSections( int32_t LOD ) const { EE_ASSERT( LOD >= 0 && LOD < GetNumLODs() ); return ( LOD == 0 ) ? m_sections : m_LODs[LOD - 1].m_sections; }
+
+        // Select the LOD to use for the specified screen size (the projected bounding sphere diameter as a fraction of the viewport height)
+        inline int32_t SelectLOD( float screenSize ) const
+        {
+            int32_t selectedLOD = 0;
+            int32_t const numGeneratedLODs = (int32_t) m_LODs.size();
+            while ( selectedLOD < numGeneratedLODs && screenSize < m_LODs[selectedLOD].m_screenSizeThreshold )
+            {
+                selectedLOD++;
+            }
+            return selectedLOD;
+        }
+
         // Materials
         TVector<TResourcePtr<Material>> const& GetMaterials() const { return m_materials; }
 
@@ -83,9 +117,12 @@ namespace EE::Render
         Blob                                m_vertices;
         TVector<uint32_t>                   m_indices;
         TVector<GeometrySection>            m_sections;
+        TVector<LOD>                        m_LODs;
         TVector<TResourcePtr<Material>>     m_materials;
         VertexBuffer                        m_vertexBuffer;
         RenderBuffer                        m_indexBuffer;
         OBB                                 m_bounds;
+        Vector                              m_positionDequantizationOffset = Vector::Zero;
+        Vector                              m_positionDequantizationScale = Vector::One;
     };
 }
\ No newline at end of file
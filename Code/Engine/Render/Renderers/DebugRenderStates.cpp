@@ -3,6 +3,7 @@
 #include "System/ThirdParty/stb/stb_truetype.h"
 #include "System/Fonts/FontData_Proggy.h"
 #include "System/Fonts/FontDecompressor.h"
+#include "System/Log.h"
 
 //-------------------------------------------------------------------------
 
@@ -350,6 +351,215 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    bool DebugPrimitiveInstanceRenderState::Initialize( RenderDevice* pRenderDevice )
+    {
+        EE_ASSERT( pRenderDevice != nullptr );
+
+        // Generate the unit shapes
+        //-------------------------------------------------------------------------
+
+        m_shapeVertices.clear();
+        for ( uint8_t i = 0; i < (uint8_t) Drawing::PrimitiveCommand::Type::NumTypes; i++ )
+        {
+            m_shapeVertexOffsets[i] = (uint32_t) m_shapeVertices.size();
+            Drawing::PrimitiveCommand::GetUnitShapeVertices( (Drawing::PrimitiveCommand::Type) i, m_shapeVertices );
+            m_shapeVertexCounts[i] = (uint32_t) m_shapeVertices.size() - m_shapeVertexOffsets[i];
+        }
+
+        if ( m_shapeVertices.size() > MaxShapeVertices )
+        {
+            EE_LOG_ERROR( "Render", "Debug Renderer", "Debug primitive shapes need %u vertices, the shape buffer only fits %u", (uint32_t) m_shapeVertices.size(), MaxShapeVertices );
+            return false;
+        }
+
+        m_shapeVertices.resize( MaxShapeVertices, Float4::Zero );
+
+        //-------------------------------------------------------------------------
+        // VERTEX SHADER
+        //-------------------------------------------------------------------------
+
+        TVector<RenderBuffer> cbuffers;
+
+        // World transform const buffer
+        RenderBuffer buffer;
+        buffer.m_byteSize = 16 * 5; // float4x4 + float2
+        buffer.m_byteStride = 16;   // Vector4 aligned
+        buffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        buffer.m_type = RenderBuffer::Type::Constant;
+        cbuffers.push_back( buffer );
+
+        // Shape vertices const buffer
+        buffer.m_byteSize = sizeof( Float4 ) * MaxShapeVertices;
+        buffer.m_byteStride = 16;   // Vector4 aligned
+        buffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        buffer.m_type = RenderBuffer::Type::Constant;
+        cbuffers.push_back( buffer );
+
+        // VS - all the vertex data is per instance, the shape vertices are fetched from the shape buffer using the vertex ID
+        VertexLayoutDescriptor vertexLayoutDesc;
+        vertexLayoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R32G32B32A32, 0, offsetof( InstanceData, m_transform ), true ) );
+        vertexLayoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R32G32B32A32, 1, offsetof( InstanceData, m_transform ) + 16, true ) );
+        vertexLayoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R32G32B32A32, 2, offsetof( InstanceData, m_transform ) + 32, true ) );
+        vertexLayoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R32G32B32A32, 3, offsetof( InstanceData, m_transform ) + 48, true ) );
+        vertexLayoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R32G32B32A32, 4, offsetof( InstanceData, m_shapeParameters ), true ) );
+        vertexLayoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Color, DataFormat::Float_R32G32B32A32, 0, offsetof( InstanceData, m_color ), true ) );
+        vertexLayoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R32, 5, offsetof( InstanceData, m_thickness ), true ) );
+        vertexLayoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::UInt_R32, 6, offsetof( InstanceData, m_shapeVertexOffset ), true ) );
+        vertexLayoutDesc.CalculateByteSize();
+
+        m_vertexShader = VertexShader( g_byteCode_VS_DebugRendererPrimitives, sizeof( g_byteCode_VS_DebugRendererPrimitives ), cbuffers, vertexLayoutDesc );
+        pRenderDevice->CreateShader( m_vertexShader );
+        cbuffers.clear();
+
+        // Create instance buffer
+        m_instanceBuffer.m_byteStride = sizeof( InstanceData );
+        m_instanceBuffer.m_byteSize = m_instanceBuffer.m_byteStride * MaxInstancesPerDrawCall;
+        m_instanceBuffer.m_type = RenderBuffer::Type::Vertex;
+        m_instanceBuffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        pRenderDevice->CreateBuffer( m_instanceBuffer, nullptr );
+
+        if ( !m_instanceBuffer.IsValid() )
+        {
+            return false;
+        }
+
+        // Create vertex layout and input binding
+        pRenderDevice->CreateShaderInputBinding( m_vertexShader, vertexLayoutDesc, m_inputBinding );
+
+        // Allocate staging memory for instance data
+        m_stagingInstanceData.resize( m_instanceBuffer.m_byteSize );
+
+        //-------------------------------------------------------------------------
+        // GEOMETRY SHADER
+        //-------------------------------------------------------------------------
+
+        // View dimensions
+        buffer.m_byteSize = 16 * 5; // float4x4 + float2
+        buffer.m_byteStride = 16;   // Vector4 aligned
+        buffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        buffer.m_type = RenderBuffer::Type::Constant;
+        cbuffers.push_back( buffer );
+
+        // GS
+        m_geometryShader = GeometryShader( g_byteCode_GS_DebugRendererLines, sizeof( g_byteCode_GS_DebugRendererLines ), cbuffers );
+        pRenderDevice->CreateShader( m_geometryShader );
+        cbuffers.clear();
+
+        //-------------------------------------------------------------------------
+        // PIXEL SHADER
+        //-------------------------------------------------------------------------
+
+        // Selection ID buffer
+        buffer.m_byteSize = 16;
+        buffer.m_byteStride = 16;
+        buffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        buffer.m_type = RenderBuffer::Type::Constant;
+        cbuffers.push_back( buffer );
+
+        // PS
+        m_pixelShader = PixelShader( g_byteCode_PS_DebugRendererLines, sizeof( g_byteCode_PS_DebugRendererLines ), cbuffers );
+        pRenderDevice->CreateShader( m_pixelShader );
+        cbuffers.clear();
+
+        //-------------------------------------------------------------------------
+        // RASTERIZER
+        //-------------------------------------------------------------------------
+
+        // Blend state for transparency
+        {
+            m_blendState.m_srcValue = BlendValue::SourceAlpha;
+            m_blendState.m_dstValue = BlendValue::InverseSourceAlpha;
+            m_blendState.m_blendOp = BlendOp::Add;
+            m_blendState.m_srcAlphaValue = BlendValue::Zero;
+            m_blendState.m_dstAlphaValue = BlendValue::One;
+            m_blendState.m_blendOpAlpha = BlendOp::Add;
+            m_blendState.m_blendEnable = true;
+
+            pRenderDevice->CreateBlendState( m_blendState );
+
+            if ( !m_blendState.IsValid() )
+            {
+                return false;
+            }
+        }
+
+        // Set Rasterizer state for drawing
+        {
+            m_rasterizerState.m_cullMode = CullMode::None;
+            m_rasterizerState.m_windingMode = WindingMode::CounterClockwise;
+            m_rasterizerState.m_fillMode = FillMode::Solid;
+
+            pRenderDevice->CreateRasterizerState( m_rasterizerState );
+
+            if ( !m_rasterizerState.IsValid() )
+            {
+                return false;
+            }
+        }
+
+        // Set up PSO
+        m_PSO.m_pVertexShader = &m_vertexShader;
+        m_PSO.m_pGeometryShader = &m_geometryShader;
+        m_PSO.m_pPixelShader = &m_pixelShader;
+        m_PSO.m_pBlendState = &m_blendState;
+        m_PSO.m_pRasterizerState = &m_rasterizerState;
+
+        return true;
+    }
+
+    void DebugPrimitiveInstanceRenderState::Shutdown( RenderDevice* pRenderDevice )
+    {
+        EE_ASSERT( pRenderDevice != nullptr );
+
+        m_PSO.Clear();
+
+        if ( m_blendState.IsValid() )
+        {
+            pRenderDevice->DestroyBlendState( m_blendState );
+        }
+
+        if ( m_rasterizerState.IsValid() )
+        {
+            pRenderDevice->DestroyRasterizerState( m_rasterizerState );
+        }
+
+        if ( m_instanceBuffer.IsValid() )
+        {
+            pRenderDevice->DestroyBuffer( m_instanceBuffer );
+        }
+
+        pRenderDevice->DestroyShaderInputBinding( m_inputBinding );
+        pRenderDevice->DestroyShader( m_vertexShader );
+        pRenderDevice->DestroyShader( m_geometryShader );
+        pRenderDevice->DestroyShader( m_pixelShader );
+
+        m_shapeVertices.clear();
+    }
+
+    void DebugPrimitiveInstanceRenderState::SetState( RenderContext const& renderContext, Viewport const& viewport )
+    {
+        renderContext.SetPipelineState( m_PSO );
+        renderContext.SetVertexBuffer( m_instanceBuffer );
+        renderContext.SetShaderInputBinding( m_inputBinding );
+
+        struct CB
+        {
+            Matrix m_viewProjectionMatrix;
+            Float4 m_viewport;
+        };
+
+        CB cb;
+        cb.m_viewProjectionMatrix = viewport.GetViewVolume().GetViewProjectionMatrix();
+        cb.m_viewport.m_x = (float) viewport.GetDimensions().m_x;
+        cb.m_viewport.m_y = (float) viewport.GetDimensions().m_y;
+
+        renderContext.WriteToBuffer( m_vertexShader.GetConstBuffer( 0 ), &cb, sizeof( CB ) );
+        renderContext.WriteToBuffer( m_vertexShader.GetConstBuffer( 1 ), m_shapeVertices.data(), m_shapeVertices.size() * sizeof( Float4 ) );
+        renderContext.WriteToBuffer( m_geometryShader.GetConstBuffer( 0 ), &cb, sizeof( CB ) );
+    }
+
+    //-------------------------------------------------------------------------
+
     bool DebugPrimitiveRenderState::Initialize( RenderDevice* pRenderDevice )
     {
         EE_ASSERT( pRenderDevice != nullptr );
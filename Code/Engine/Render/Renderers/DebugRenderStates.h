@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "System/Render/RenderDevice.h"
 #include "Engine/Render/RenderViewport.h"
+#include "System/Drawing/DebugDrawingCommands.h"
 
 //-------------------------------------------------------------------------
 
@@ -37,6 +38,48 @@ namespace EE::Render
         PipelineState                   m_PSO;
     };
 
+    //-------------------------------------------------------------------------
+    // Each wireframe shape type is a shared unit shape line list, drawn instanced with the line geometry and pixel shaders
+
+    struct EE_ENGINE_API DebugPrimitiveInstanceRenderState
+    {
+        constexpr static uint32_t const MaxInstancesPerDrawCall = 20000;
+        constexpr static uint32_t const MaxShapeVertices = 512; // Needs to match the shape constant buffer size in the primitive vertex shader
+
+        struct InstanceData
+        {
+            Float4                      m_transform[4];
+            Float4                      m_shapeParameters;
+            Float4                      m_color;
+            float                       m_thickness;
+            uint32_t                    m_shapeVertexOffset;
+        };
+
+    public:
+
+        bool Initialize( RenderDevice* pRenderDevice );
+        void Shutdown( RenderDevice* pRenderDevice );
+        void SetState( RenderContext const& renderContext, Viewport const& viewport );
+
+    public:
+
+        VertexShader                    m_vertexShader;
+        GeometryShader                  m_geometryShader;
+        PixelShader                     m_pixelShader;
+        ShaderInputBindingHandle        m_inputBinding;
+        VertexBuffer                    m_instanceBuffer;
+        BlendState                      m_blendState;
+        RasterizerState                 m_rasterizerState;
+        Blob                            m_stagingInstanceData;
+
+        // The shape vertices for all the primitive types, stored back to back
+        TVector<Float4>                 m_shapeVertices;
+        uint32_t                        m_shapeVertexOffsets[(uint8_t) Drawing::PrimitiveCommand::Type::NumTypes];
+        uint32_t                        m_shapeVertexCounts[(uint8_t) Drawing::PrimitiveCommand::Type::NumTypes];
+
+        PipelineState                   m_PSO;
+    };
+
     //-------------------------------------------------------------------------
 
     struct EE_ENGINE_API DebugPointRenderState
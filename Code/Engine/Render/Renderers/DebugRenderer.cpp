@@ -29,6 +29,11 @@ namespace EE::Render
             return false;
         }
 
+        if ( !m_primitiveInstanceRS.Initialize( m_pRenderDevice ) )
+        {
+            return false;
+        }
+
         if ( !m_primitiveRS.Initialize( m_pRenderDevice ) )
         {
             return false;
@@ -60,6 +65,7 @@ namespace EE::Render
         {
             m_textRS.Shutdown( m_pRenderDevice );
             m_primitiveRS.Shutdown( m_pRenderDevice );
+            m_primitiveInstanceRS.Shutdown( m_pRenderDevice );
             m_lineRS.Shutdown( m_pRenderDevice );
             m_pointRS.Shutdown( m_pRenderDevice );
         }
@@ -128,6 +134,66 @@ namespace EE::Render
         }
     }
 
+    void DebugRenderer::DrawPrimitiveInstances( RenderContext const& renderContext, Viewport const& viewport, TVector<PrimitiveCommand> const& commands )
+    {
+        if ( commands.empty() )
+        {
+            return;
+        }
+
+        // Set render state
+        renderContext.SetPrimitiveTopology( Topology::LineList );
+
+        //-------------------------------------------------------------------------
+
+        auto pInstances = reinterpret_cast<DebugPrimitiveInstanceRenderState::InstanceData*>( m_primitiveInstanceRS.m_stagingInstanceData.data() );
+
+        // Each shape type is drawn as a single instanced draw of its unit shape, split if there are more instances than fit in the instance buffer
+        for ( uint8_t shapeIdx = 0; shapeIdx < (uint8_t) PrimitiveCommand::Type::NumTypes; shapeIdx++ )
+        {
+            uint32_t const shapeVertexOffset = m_primitiveInstanceRS.m_shapeVertexOffsets[shapeIdx];
+            uint32_t const shapeVertexCount = m_primitiveInstanceRS.m_shapeVertexCounts[shapeIdx];
+
+            auto DrawInstances = [&] ( uint32_t numInstances )
+            {
+                renderContext.WriteToBuffer( m_primitiveInstanceRS.m_instanceBuffer, pInstances, numInstances * sizeof( DebugPrimitiveInstanceRenderState::InstanceData ) );
+                renderContext.DrawInstanced( shapeVertexCount, numInstances );
+            };
+
+            uint32_t numInstances = 0;
+            for ( auto const& cmd : commands )
+            {
+                if ( (uint8_t) cmd.m_type != shapeIdx )
+                {
+                    continue;
+                }
+
+                Matrix transform( NoInit );
+                auto& instance = pInstances[numInstances++];
+                cmd.GetShapeTransform( transform, instance.m_shapeParameters );
+                for ( int32_t i = 0; i < 4; i++ )
+                {
+                    instance.m_transform[i] = transform.GetRow( i ).ToFloat4();
+                }
+
+                instance.m_color = cmd.m_color;
+                instance.m_thickness = cmd.m_thickness;
+                instance.m_shapeVertexOffset = shapeVertexOffset;
+
+                if ( numInstances == DebugPrimitiveInstanceRenderState::MaxInstancesPerDrawCall )
+                {
+                    DrawInstances( numInstances );
+                    numInstances = 0;
+                }
+            }
+
+            if ( numInstances > 0 )
+            {
+                DrawInstances( numInstances );
+            }
+        }
+    }
+
     void DebugRenderer::DrawTriangles( RenderContext const& renderContext, Viewport const& viewport, TVector<TriangleCommand> const& commands )
     {
         // Set render state
@@ -457,6 +523,29 @@ namespace EE::Render
             DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_transparentDepthOff.m_lineCommands );
         }
 
+        //-------------------------------------------------------------------------
+        // Draw Primitive Shapes
+        //-------------------------------------------------------------------------
+
+        {
+            EE_PROFILE_SCOPE_RENDER( "DebugDrawing::DrawPrimitiveShapes" );
+            m_primitiveInstanceRS.SetState( renderContext, viewport );
+
+            renderContext.SetDepthTestMode( DepthTestMode::On );
+            DebugRenderer::DrawPrimitiveInstances( renderContext, viewport, m_drawCommands.m_opaqueDepthOn.m_primitiveCommands );
+
+            renderContext.SetDepthTestMode( DepthTestMode::Off );
+            DebugRenderer::DrawPrimitiveInstances( renderContext, viewport, m_drawCommands.m_opaqueDepthOff.m_primitiveCommands );
+
+            //-------------------------------------------------------------------------
+
+            renderContext.SetDepthTestMode( DepthTestMode::On );
+            DebugRenderer::DrawPrimitiveInstances( renderContext, viewport, m_drawCommands.m_transparentDepthOn.m_primitiveCommands );
+
+            renderContext.SetDepthTestMode( DepthTestMode::Off );
+            DebugRenderer::DrawPrimitiveInstances( renderContext, viewport, m_drawCommands.m_transparentDepthOff.m_primitiveCommands );
+        }
+
         //-------------------------------------------------------------------------
         // Draw Primitives
         //-------------------------------------------------------------------------
@@ -27,6 +27,7 @@ namespace EE::Render
 
         void DrawPoints( RenderContext const& renderContext, Viewport const& viewport, TVector<Drawing::PointCommand> const& commands );
         void DrawLines( RenderContext const& renderContext, Viewport const& viewport, TVector<Drawing::LineCommand> const& commands );
+        void DrawPrimitiveInstances( RenderContext const& renderContext, Viewport const& viewport, TVector<Drawing::PrimitiveCommand> const& commands );
         void DrawTriangles( RenderContext const& renderContext, Viewport const& viewport, TVector<Drawing::TriangleCommand> const& commands );
         void DrawText( RenderContext const& renderContext, Viewport const& viewport, TVector<Drawing::TextCommand> const& commands, IntRange cmdRange );
 
@@ -35,6 +36,7 @@ namespace EE::Render
         RenderDevice*                               m_pRenderDevice = nullptr;
 
         DebugLineRenderState                        m_lineRS;
+        DebugPrimitiveInstanceRenderState           m_primitiveInstanceRS;
         DebugPointRenderState                       m_pointRS;
         DebugPrimitiveRenderState                   m_primitiveRS;
         DebugTextRenderState                        m_textRS;
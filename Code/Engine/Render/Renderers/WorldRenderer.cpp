@@ -92,6 +92,10 @@ namespace EE::Render
         m_vertexShaderStatic = VertexShader( g_byteCode_VS_StaticPrimitive, sizeof( g_byteCode_VS_StaticPrimitive ), cbuffers, vertexLayoutDescStatic );
         m_pRenderDevice->CreateShader( m_vertexShaderStatic );
 
+        auto const vertexLayoutDescStaticCompressed = VertexLayoutRegistry::GetDescriptorForFormat( VertexFormat::StaticMeshCompressed );
+        m_vertexShaderStaticCompressed = VertexShader( g_byteCode_VS_StaticPrimitiveCompressed, sizeof( g_byteCode_VS_StaticPrimitiveCompressed ), cbuffers, vertexLayoutDescStaticCompressed );
+        m_pRenderDevice->CreateShader( m_vertexShaderStaticCompressed );
+
         // Create Skeletal Mesh Vertex Shader
         //-------------------------------------------------------------------------
 
@@ -107,7 +111,11 @@ namespace EE::Render
         m_vertexShaderSkeletal = VertexShader( g_byteCode_VS_SkinnedPrimitive, sizeof( g_byteCode_VS_SkinnedPrimitive ), cbuffers, vertexLayoutDescSkeletal );
         pRenderDevice->CreateShader( m_vertexShaderSkeletal );
 
-        if ( !m_vertexShaderStatic.IsValid() )
+        auto const vertexLayoutDescSkeletalCompressed = VertexLayoutRegistry::GetDescriptorForFormat( VertexFormat::SkeletalMeshCompressed );
+        m_vertexShaderSkeletalCompressed = VertexShader( g_byteCode_VS_SkinnedPrimitiveCompressed, sizeof( g_byteCode_VS_SkinnedPrimitiveCompressed ), cbuffers, vertexLayoutDescSkeletalCompressed );
+        pRenderDevice->CreateShader( m_vertexShaderSkeletalCompressed );
+
+        if ( !m_vertexShaderStatic.IsValid() || !m_vertexShaderStaticCompressed.IsValid() )
         {
             return false;
         }
@@ -287,6 +295,18 @@ namespace EE::Render
             return false;
         }
 
+        m_pRenderDevice->CreateShaderInputBinding( m_vertexShaderStaticCompressed, vertexLayoutDescStaticCompressed, m_inputBindingStaticCompressed );
+        if ( !m_inputBindingStaticCompressed.IsValid() )
+        {
+            return false;
+        }
+
+        m_pRenderDevice->CreateShaderInputBinding( m_vertexShaderSkeletalCompressed, vertexLayoutDescSkeletalCompressed, m_inputBindingSkeletalCompressed );
+        if ( !m_inputBindingSkeletalCompressed.IsValid() )
+        {
+            return false;
+        }
+
         // Set up pipeline states
         //-------------------------------------------------------------------------
 
@@ -316,6 +336,21 @@ namespace EE::Render
         m_pipelineStateSkeletalShadow.m_pBlendState = &m_blendState;
         m_pipelineStateSkeletalShadow.m_pRasterizerState = &m_rasterizerState;
 
+        // The compressed vertex format states only differ in the vertex shader used
+        m_pipelineStateStaticCompressed = m_pipelineStateStatic;
+        m_pipelineStateStaticCompressed.m_pVertexShader = &m_vertexShaderStaticCompressed;
+        m_pipelineStateStaticCompressedPicking = m_pipelineStateStaticPicking;
+        m_pipelineStateStaticCompressedPicking.m_pVertexShader = &m_vertexShaderStaticCompressed;
+        m_pipelineStateStaticCompressedShadow = m_pipelineStateStaticShadow;
+        m_pipelineStateStaticCompressedShadow.m_pVertexShader = &m_vertexShaderStaticCompressed;
+
+        m_pipelineStateSkeletalCompressed = m_pipelineStateSkeletal;
+        m_pipelineStateSkeletalCompressed.m_pVertexShader = &m_vertexShaderSkeletalCompressed;
+        m_pipelineStateSkeletalCompressedPicking = m_pipelineStateSkeletalPicking;
+        m_pipelineStateSkeletalCompressedPicking.m_pVertexShader = &m_vertexShaderSkeletalCompressed;
+        m_pipelineStateSkeletalCompressedShadow = m_pipelineStateSkeletalShadow;
+        m_pipelineStateSkeletalCompressedShadow.m_pVertexShader = &m_vertexShaderSkeletalCompressed;
+
         m_pipelineSkybox.m_pVertexShader = &m_vertexShaderSkybox;
         m_pipelineSkybox.m_pPixelShader = &m_pixelShaderSkybox;
 
@@ -341,6 +376,8 @@ namespace EE::Render
     {
         m_pipelineStateStatic.Clear();
         m_pipelineStateSkeletal.Clear();
+        m_pipelineStateStaticCompressed.Clear();
+        m_pipelineStateSkeletalCompressed.Clear();
 
         if ( m_inputBindingStatic.IsValid() )
         {
@@ -352,6 +389,16 @@ namespace EE::Render
             m_pRenderDevice->DestroyShaderInputBinding( m_inputBindingSkeletal );
         }
 
+        if ( m_inputBindingStaticCompressed.IsValid() )
+        {
+            m_pRenderDevice->DestroyShaderInputBinding( m_inputBindingStaticCompressed );
+        }
+
+        if ( m_inputBindingSkeletalCompressed.IsValid() )
+        {
+            m_pRenderDevice->DestroyShaderInputBinding( m_inputBindingSkeletalCompressed );
+        }
+
         if ( m_rasterizerState.IsValid() )
         {
             m_pRenderDevice->DestroyRasterizerState( m_rasterizerState );
@@ -387,6 +434,16 @@ namespace EE::Render
             m_pRenderDevice->DestroyShader( m_vertexShaderSkeletal );
         }
 
+        if ( m_vertexShaderStaticCompressed.IsValid() )
+        {
+            m_pRenderDevice->DestroyShader( m_vertexShaderStaticCompressed );
+        }
+
+        if ( m_vertexShaderSkeletalCompressed.IsValid() )
+        {
+            m_pRenderDevice->DestroyShader( m_vertexShaderSkeletalCompressed );
+        }
+
         if ( m_pixelShader.IsValid() )
         {
             m_pRenderDevice->DestroyShader( m_pixelShader );
@@ -528,6 +585,7 @@ namespace EE::Render
         //-------------------------------------------------------------------------
 
         PipelineState* pPipelineState = renderTarget.HasPickingRT() ? &m_pipelineStateStaticPicking : &m_pipelineStateStatic;
+        PipelineState* pCompressedPipelineState = renderTarget.HasPickingRT() ? &m_pipelineStateStaticCompressedPicking : &m_pipelineStateStaticCompressed;
         SetupRenderStates( viewport, pPipelineState->m_pPixelShader, data );
 
         renderContext.SetPipelineState( *pPipelineState );
@@ -536,15 +594,32 @@ namespace EE::Render
 
         //-------------------------------------------------------------------------
 
-        for ( StaticMeshComponent const* pMeshComponent : data.m_staticMeshComponents )
+        bool isCompressedStateSet = false;
+
+        for ( auto meshIdx = 0u; meshIdx < data.m_staticMeshComponents.size(); meshIdx++ )
         {
+            StaticMeshComponent const* pMeshComponent = data.m_staticMeshComponents[meshIdx];
             auto pMesh = pMeshComponent->GetMesh();
+            auto const& subMeshes = pMesh->GetLODSections( data.m_staticMeshLODs[meshIdx] );
+
+            // Only switch vertex shaders when the vertex format changes
+            bool const hasCompressedVertices = pMesh->HasCompressedVertices();
+            if ( hasCompressedVertices != isCompressedStateSet )
+            {
+                renderContext.SetPipelineState( hasCompressedVertices ? *pCompressedPipelineState : *pPipelineState );
+                renderContext.SetShaderInputBinding( hasCompressedVertices ? m_inputBindingStaticCompressed : m_inputBindingStatic );
+                isCompressedStateSet = hasCompressedVertices;
+            }
+
             Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
             ObjectTransforms transforms = data.m_transforms;
             transforms.m_worldTransform = worldTransform;
             transforms.m_worldTransform.SetTranslation( worldTransform.GetTranslation() );
             transforms.m_normalTransform = transforms.m_worldTransform.GetInverse().Transpose();
-            renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+            transforms.m_positionDequantizationScale = pMesh->GetPositionDequantizationScale();
+            transforms.m_positionDequantizationOffset = pMesh->GetPositionDequantizationOffset();
+            VertexShader const& vertexShader = hasCompressedVertices ? m_vertexShaderStaticCompressed : m_vertexShaderStatic;
+            renderContext.WriteToBuffer( vertexShader.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
             if ( renderTarget.HasPickingRT() )
             {
@@ -569,7 +644,7 @@ namespace EE::Render
                     SetDefaultMaterial( renderContext, *pPipelineState->m_pPixelShader );
                 }
 
-                auto const& subMesh = pMesh->GetSection( i );
+                auto const& subMesh = subMeshes[i];
                 renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
             }
         }
@@ -586,6 +661,7 @@ namespace EE::Render
         //-------------------------------------------------------------------------
 
         PipelineState* pPipelineState = renderTarget.HasPickingRT() ? &m_pipelineStateSkeletalPicking : &m_pipelineStateSkeletal;
+        PipelineState* pCompressedPipelineState = renderTarget.HasPickingRT() ? &m_pipelineStateSkeletalCompressedPicking : &m_pipelineStateSkeletalCompressed;
         SetupRenderStates( viewport, pPipelineState->m_pPixelShader, data );
 
         renderContext.SetPipelineState( *pPipelineState );
@@ -595,14 +671,26 @@ namespace EE::Render
         //-------------------------------------------------------------------------
 
         SkeletalMesh const* pCurrentMesh = nullptr;
+        VertexShader const* pCurrentVertexShader = &m_vertexShaderSkeletal;
 
-        for ( SkeletalMeshComponent const* pMeshComponent : data.m_skeletalMeshComponents )
+        for ( auto meshIdx = 0u; meshIdx < data.m_skeletalMeshComponents.size(); meshIdx++ )
         {
+            SkeletalMeshComponent const* pMeshComponent = data.m_skeletalMeshComponents[meshIdx];
             if ( pMeshComponent->GetMesh() != pCurrentMesh )
             {
                 pCurrentMesh = pMeshComponent->GetMesh();
                 EE_ASSERT( pCurrentMesh != nullptr && pCurrentMesh->IsValid() );
 
+                // Only switch vertex shaders when the vertex format changes
+                bool const hasCompressedVertices = pCurrentMesh->HasCompressedVertices();
+                VertexShader const* pRequiredVertexShader = hasCompressedVertices ? &m_vertexShaderSkeletalCompressed : &m_vertexShaderSkeletal;
+                if ( pRequiredVertexShader != pCurrentVertexShader )
+                {
+                    pCurrentVertexShader = pRequiredVertexShader;
+                    renderContext.SetPipelineState( hasCompressedVertices ? *pCompressedPipelineState : *pPipelineState );
+                    renderContext.SetShaderInputBinding( hasCompressedVertices ? m_inputBindingSkeletalCompressed : m_inputBindingSkeletal );
+                }
+
                 renderContext.SetVertexBuffer( pCurrentMesh->GetVertexBuffer() );
                 renderContext.SetIndexBuffer( pCurrentMesh->GetIndexBuffer() );
             }
@@ -615,9 +703,11 @@ namespace EE::Render
             transforms.m_worldTransform = worldTransform;
             transforms.m_worldTransform.SetTranslation( worldTransform.GetTranslation() );
             transforms.m_normalTransform = transforms.m_worldTransform.GetInverse().Transpose();
-            renderContext.WriteToBuffer( m_vertexShaderSkeletal.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+            transforms.m_positionDequantizationScale = pCurrentMesh->GetPositionDequantizationScale();
+            transforms.m_positionDequantizationOffset = pCurrentMesh->GetPositionDequantizationOffset();
+            renderContext.WriteToBuffer( pCurrentVertexShader->GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
-            auto const& bonesConstBuffer = m_vertexShaderSkeletal.GetConstBuffer( 1 );
+            auto const& bonesConstBuffer = pCurrentVertexShader->GetConstBuffer( 1 );
             auto const& boneTransforms = pMeshComponent->GetSkinningTransforms();
             EE_ASSERT( boneTransforms.size() == pCurrentMesh->GetNumBones() );
             renderContext.WriteToBuffer( bonesConstBuffer, boneTransforms.data(), sizeof( Matrix ) * pCurrentMesh->GetNumBones() );
@@ -632,6 +722,7 @@ namespace EE::Render
             //-------------------------------------------------------------------------
 
             TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
+            auto const& subMeshes = pCurrentMesh->GetLODSections( data.m_skeletalMeshLODs[meshIdx] );
 
             auto const numSubMeshes = pCurrentMesh->GetNumSections();
             for ( auto i = 0u; i < numSubMeshes; i++ )
@@ -646,7 +737,7 @@ namespace EE::Render
                 }
 
                 // Draw mesh
-                auto const& subMesh = pCurrentMesh->GetSection( i );
+                auto const& subMesh = subMeshes[i];
                 renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
             }
         }
@@ -699,20 +790,33 @@ namespace EE::Render
         renderContext.SetShaderInputBinding( m_inputBindingStatic );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
-        for ( StaticMeshComponent const* pMeshComponent : data.m_staticMeshComponents )
+        bool isCompressedStateSet = false;
+
+        for ( auto meshIdx = 0u; meshIdx < data.m_staticMeshComponents.size(); meshIdx++ )
         {
+            StaticMeshComponent const* pMeshComponent = data.m_staticMeshComponents[meshIdx];
             auto pMesh = pMeshComponent->GetMesh();
+
+            bool const hasCompressedVertices = pMesh->HasCompressedVertices();
+            if ( hasCompressedVertices != isCompressedStateSet )
+            {
+                renderContext.SetPipelineState( hasCompressedVertices ? m_pipelineStateStaticCompressedShadow : m_pipelineStateStaticShadow );
+                renderContext.SetShaderInputBinding( hasCompressedVertices ? m_inputBindingStaticCompressed : m_inputBindingStatic );
+                isCompressedStateSet = hasCompressedVertices;
+            }
+
             Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
             transforms.m_worldTransform = worldTransform;
-            renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+            transforms.m_positionDequantizationScale = pMesh->GetPositionDequantizationScale();
+            transforms.m_positionDequantizationOffset = pMesh->GetPositionDequantizationOffset();
+            VertexShader const& vertexShader = hasCompressedVertices ? m_vertexShaderStaticCompressed : m_vertexShaderStatic;
+            renderContext.WriteToBuffer( vertexShader.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
             renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
             renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
 
-            auto const numSubMeshes = pMesh->GetNumSections();
-            for ( auto i = 0u; i < numSubMeshes; i++ )
+            for ( auto const& subMesh : pMesh->GetLODSections( data.m_staticMeshLODs[meshIdx] ) )
             {
-                auto const& subMesh = pMesh->GetSection( i );
                 renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
             }
         }
@@ -724,19 +828,34 @@ namespace EE::Render
         renderContext.SetShaderInputBinding( m_inputBindingSkeletal );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
-        for ( SkeletalMeshComponent const* pMeshComponent : data.m_skeletalMeshComponents )
+        isCompressedStateSet = false;
+
+        for ( auto meshIdx = 0u; meshIdx < data.m_skeletalMeshComponents.size(); meshIdx++ )
         {
+            SkeletalMeshComponent const* pMeshComponent = data.m_skeletalMeshComponents[meshIdx];
             auto pMesh = pMeshComponent->GetMesh();
 
+            bool const hasCompressedVertices = pMesh->HasCompressedVertices();
+            if ( hasCompressedVertices != isCompressedStateSet )
+            {
+                renderContext.SetPipelineState( hasCompressedVertices ? m_pipelineStateSkeletalCompressedShadow : m_pipelineStateSkeletalShadow );
+                renderContext.SetShaderInputBinding( hasCompressedVertices ? m_inputBindingSkeletalCompressed : m_inputBindingSkeletal );
+                isCompressedStateSet = hasCompressedVertices;
+            }
+
+            VertexShader const& vertexShader = hasCompressedVertices ? m_vertexShaderSkeletalCompressed : m_vertexShaderSkeletal;
+
             // Update Bones and Transforms
             //-------------------------------------------------------------------------
 
             Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
             transforms.m_worldTransform = worldTransform;
             transforms.m_worldTransform.SetTranslation( worldTransform.GetTranslation() );
-            renderContext.WriteToBuffer( m_vertexShaderSkeletal.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+            transforms.m_positionDequantizationScale = pMesh->GetPositionDequantizationScale();
+            transforms.m_positionDequantizationOffset = pMesh->GetPositionDequantizationOffset();
+            renderContext.WriteToBuffer( vertexShader.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
-            auto const& bonesConstBuffer = m_vertexShaderSkeletal.GetConstBuffer( 1 );
+            auto const& bonesConstBuffer = vertexShader.GetConstBuffer( 1 );
             auto const& boneTransforms = pMeshComponent->GetSkinningTransforms();
             EE_ASSERT( boneTransforms.size() == pMesh->GetNumBones() );
             renderContext.WriteToBuffer( bonesConstBuffer, boneTransforms.data(), sizeof( Matrix ) * pMesh->GetNumBones() );
@@ -746,11 +865,8 @@ namespace EE::Render
 
             // Draw sub-meshes
             //-------------------------------------------------------------------------
-            auto const numSubMeshes = pMesh->GetNumSections();
-            for ( auto i = 0u; i < numSubMeshes; i++ )
+            for ( auto const& subMesh : pMesh->GetLODSections( data.m_skeletalMeshLODs[meshIdx] ) )
             {
-                // Draw mesh
-                auto const& subMesh = pMesh->GetSection( i );
                 renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
             }
         }
@@ -783,6 +899,8 @@ namespace EE::Render
             nullptr,
             pWorldSystem->m_visibleStaticMeshComponents,
             pWorldSystem->m_visibleSkeletalMeshComponents,
+            pWorldSystem->m_visibleStaticMeshLODs,
+            pWorldSystem->m_visibleSkeletalMeshLODs,
         };
 
         renderData.m_transforms.m_viewprojTransform = viewport.GetViewVolume().GetViewProjectionMatrix();
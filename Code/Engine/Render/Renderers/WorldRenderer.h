@@ -89,6 +89,8 @@ namespace EE::Render
             Matrix  m_worldTransform = Matrix( ZeroInit );
             Matrix  m_normalTransform = Matrix( ZeroInit );
             Matrix  m_viewprojTransform = Matrix( ZeroInit );
+            Vector  m_positionDequantizationScale = Vector::One; // Only used by meshes with compressed vertices
+            Vector  m_positionDequantizationOffset = Vector::Zero;
         };
 
         struct RenderData //TODO: optimize - there should not be per frame updates
@@ -99,6 +101,8 @@ namespace EE::Render
             CubemapTexture const*                   m_pSkyboxTexture;
             TVector<StaticMeshComponent const*>&    m_staticMeshComponents;
             TVector<SkeletalMeshComponent const*>&  m_skeletalMeshComponents;
+            TVector<int8_t> const&                  m_staticMeshLODs;
+            TVector<int8_t> const&                  m_skeletalMeshLODs;
         };
 
     public:
@@ -135,6 +139,8 @@ namespace EE::Render
         RenderDevice*                                           m_pRenderDevice = nullptr;
         VertexShader                                            m_vertexShaderStatic;
         VertexShader                                            m_vertexShaderSkeletal;
+        VertexShader                                            m_vertexShaderStaticCompressed;
+        VertexShader                                            m_vertexShaderSkeletalCompressed;
         PixelShader                                             m_pixelShader;
         PixelShader                                             m_emptyPixelShader;
         BlendState                                              m_blendState;
@@ -144,10 +150,16 @@ namespace EE::Render
         SamplerState                                            m_shadowSampler;
         ShaderInputBindingHandle                                m_inputBindingStatic;
         ShaderInputBindingHandle                                m_inputBindingSkeletal;
+        ShaderInputBindingHandle                                m_inputBindingStaticCompressed;
+        ShaderInputBindingHandle                                m_inputBindingSkeletalCompressed;
         PipelineState                                           m_pipelineStateStatic;
         PipelineState                                           m_pipelineStateSkeletal;
         PipelineState                                           m_pipelineStateStaticShadow;
         PipelineState                                           m_pipelineStateSkeletalShadow;
+        PipelineState                                           m_pipelineStateStaticCompressed;
+        PipelineState                                           m_pipelineStateSkeletalCompressed;
+        PipelineState                                           m_pipelineStateStaticCompressedShadow;
+        PipelineState                                           m_pipelineStateSkeletalCompressedShadow;
         PipelineState                                           m_pipelineSkybox;
         ComputeShader                                           m_precomputeDFGComputeShader;
         Texture                                                 m_precomputedBRDF;
@@ -157,5 +169,7 @@ namespace EE::Render
         PixelShader                                             m_pixelShaderPicking;
         PipelineState                                           m_pipelineStateStaticPicking;
         PipelineState                                           m_pipelineStateSkeletalPicking;
+        PipelineState                                           m_pipelineStateStaticCompressedPicking;
+        PipelineState                                           m_pipelineStateSkeletalCompressedPicking;
     };
 }
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include "DebugShaderCommon.hlsli"
+
+#define kMaxShapeVertices 512
+
+cbuffer ViewData : register( b0 )
+{
+    float4x4                g_viewProjectionMatrix;
+    float2                  g_viewport;
+};
+
+// The line list vertices for all the unit shapes
+cbuffer ShapeData : register( b1 )
+{
+    float4                  g_shapeVertices[kMaxShapeVertices];
+};
+
+struct PrimitiveInstanceInput
+{
+    float4                  m_transformX        : TEXCOORD0;
+    float4                  m_transformY        : TEXCOORD1;
+    float4                  m_transformZ        : TEXCOORD2;
+    float4                  m_transformW        : TEXCOORD3;
+    float4                  m_shapeParameters   : TEXCOORD4;
+    float4                  m_color             : COLOR;
+    float                   m_thickness         : TEXCOORD5;
+    uint                    m_shapeVertexOffset : TEXCOORD6;
+};
+
+VertexShaderOutput main( PrimitiveInstanceInput input, uint vertexID : SV_VertexID )
+{
+    // The shape vertex xyz is scaled by the first shape parameter and the w weights the offset in the remaining parameters
+    float4 shapeVertex = g_shapeVertices[input.m_shapeVertexOffset + vertexID];
+    float3 localPosition = shapeVertex.xyz * input.m_shapeParameters.x + shapeVertex.w * input.m_shapeParameters.yzw;
+    float3 worldPosition = localPosition.x * input.m_transformX.xyz + localPosition.y * input.m_transformY.xyz + localPosition.z * input.m_transformZ.xyz + input.m_transformW.xyz;
+
+    VertexShaderOutput output;
+    output.m_position = mul( g_viewProjectionMatrix, float4( worldPosition, 1.0 ) );
+    output.m_color = input.m_color;
+    output.m_color.a *= smoothstep( 0.0, 1.0, input.m_thickness / kAntialiasing );
+    output.m_size = max( input.m_thickness, kAntialiasing );
+    output.m_edgeDistance = 0;
+    output.m_uv = float2( 0, 0 );
+    return output;
+}
\ No newline at end of file
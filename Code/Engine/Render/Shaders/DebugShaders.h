@@ -12,6 +12,7 @@
     #ifdef EE_DEBUG
         #include "_AutoGenerated/VS_DebugRendererPoints_x64_Debug.h"
         #include "_AutoGenerated/VS_DebugRendererLines_x64_Debug.h"
+        #include "_AutoGenerated/VS_DebugRendererPrimitives_x64_Debug.h"
         #include "_AutoGenerated/VS_DebugRendererTriangles_x64_Debug.h"
         #include "_AutoGenerated/VS_DebugRendererText_x64_Debug.h"
         #include "_AutoGenerated/GS_DebugRendererPoints_x64_Debug.h"
@@ -23,6 +24,7 @@
     #else
         #include "_AutoGenerated/VS_DebugRendererPoints_x64_Release.h"
         #include "_AutoGenerated/VS_DebugRendererLines_x64_Release.h"
+        #include "_AutoGenerated/VS_DebugRendererPrimitives_x64_Release.h"
         #include "_AutoGenerated/VS_DebugRendererTriangles_x64_Release.h"
         #include "_AutoGenerated/VS_DebugRendererText_x64_Release.h"
         #include "_AutoGenerated/GS_DebugRendererPoints_x64_Release.h"
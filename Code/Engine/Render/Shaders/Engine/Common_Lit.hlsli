@@ -3,8 +3,19 @@ cbuffer Transforms : register( b0 )
     matrix m_worldTransform; // TODO: move to per instance data and apply camera centric world transform in veretx shader(campos=(0, 0, 0)), currently done on CPU
     matrix m_normalTransform;
     matrix m_viewprojTransform;
+    float4 m_positionDequantizationScale; // Only used for compressed vertex formats
+    float4 m_positionDequantizationOffset;
 };
 
+// Decode an octahedral encoded unit vector (see VertexCompression::EncodeOctahedralNormal)
+float3 DecodeOctahedralNormal( float2 encoded )
+{
+    float3 n = float3( encoded.x, encoded.y, 1.0 - abs( encoded.x ) - abs( encoded.y ) );
+    float t = saturate( -n.z );
+    n.xy += float2( n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t );
+    return normalize( n );
+}
+
 // TODO sync with ENGINE, via header file!!!!
 
 static const uint LIGHTING_ENABLE_SUN = 1 << 0;
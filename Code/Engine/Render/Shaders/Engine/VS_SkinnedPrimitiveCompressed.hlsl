@@ -0,0 +1,37 @@
+#include "Common_Lit.hlsli"
+
+cbuffer Skeleton : register( b1 )
+{
+    matrix m_boneTransforms[255];
+};
+
+struct VertexShaderInput
+{
+    float4 m_pos : POSITION;                // UNORM16, quantized to the mesh bounds
+    float2 m_normal : NORMAL;               // SNORM16, octahedral encoded
+    float2 m_uv0 : TEXCOORD0;               // Half
+    float2 m_uv1 : TEXCOORD1;               // Half
+    uint4  m_boneIndices : BLENDINDICES0;   // UINT8
+    float4 m_boneWeights : BLENDWEIGHTS0;   // UNORM8, unused influences have a zero weight
+};
+
+PixelShaderInput main( VertexShaderInput vsInput )
+{
+    float3 pos = m_positionDequantizationOffset.xyz + ( vsInput.m_pos.xyz * m_positionDequantizationScale.xyz );
+    float3 normal = DecodeOctahedralNormal( vsInput.m_normal );
+
+    float3 blendPos = float3(0, 0, 0);
+    float3 blendNormal = float3(0, 0, 0);
+
+    for ( int i = 0; i < 4; ++i )
+    {
+        if ( vsInput.m_boneWeights[i] > 0.0 )
+        {
+            matrix boneTransform = m_boneTransforms[vsInput.m_boneIndices[i]];
+            blendPos += mul( boneTransform, float4(pos, 1.0) ).xyz * vsInput.m_boneWeights[i];
+            blendNormal += mul( boneTransform, float4(normal, 0.0) ).xyz * vsInput.m_boneWeights[i]; // HACK: check idea, assumes orthonormal matrix, without scaling
+        }
+    }
+
+    return GeneratePixelShaderInput(blendPos, blendNormal, vsInput.m_uv0);
+}
\ No newline at end of file
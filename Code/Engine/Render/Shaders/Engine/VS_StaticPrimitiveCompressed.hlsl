@@ -0,0 +1,16 @@
+#include "Common_Lit.hlsli"
+
+struct VertexShaderInput
+{
+    float4 m_pos : POSITION;        // UNORM16, quantized to the mesh bounds
+    float2 m_normal : NORMAL;       // SNORM16, octahedral encoded
+    float2 m_uv0 : TEXCOORD0;       // Half
+    float2 m_uv1 : TEXCOORD1;       // Half
+};
+ 
+PixelShaderInput main( VertexShaderInput vsInput )
+{
+    float3 pos = m_positionDequantizationOffset.xyz + ( vsInput.m_pos.xyz * m_positionDequantizationScale.xyz );
+    float3 normal = DecodeOctahedralNormal( vsInput.m_normal );
+    return GeneratePixelShaderInput(pos, normal, vsInput.m_uv0);
+}
\ No newline at end of file
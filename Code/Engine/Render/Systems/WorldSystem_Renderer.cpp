@@ -159,6 +159,7 @@ namespace EE::Render
         // Unregistrations occur at the start of the frame
         // The world might be paused so we might leave an invalid component in this array
         m_visibleStaticMeshComponents.clear();
+        m_visibleStaticMeshLODs.clear();
 
         if ( pMeshComponent->HasMeshResourceSet() )
         {
@@ -217,6 +218,7 @@ namespace EE::Render
         // Unregistrations occur at the start of the frame
         // The world might be paused so we might leave an invalid component in this array
         m_visibleSkeletalMeshComponents.clear();
+        m_visibleSkeletalMeshLODs.clear();
 
         // Remove component from mesh group
         if ( pMeshComponent->HasMeshResourceSet() )
@@ -293,7 +295,8 @@ namespace EE::Render
         // Culling
         //-------------------------------------------------------------------------
 
-        AABB const viewBounds = ctx.GetViewport()->GetViewVolume().GetAABB();
+        Math::ViewVolume const& viewVolume = ctx.GetViewport()->GetViewVolume();
+        AABB const viewBounds = viewVolume.GetAABB();
 
         m_visibleStaticMeshComponents.clear();
         {
@@ -328,6 +331,30 @@ namespace EE::Render
             }
         }
 
+        //-------------------------------------------------------------------------
+        // LOD Selection
+        //-------------------------------------------------------------------------
+
+        {
+            EE_PROFILE_SCOPE_RENDER( "Mesh LOD Selection" );
+
+            m_visibleStaticMeshLODs.resize( m_visibleStaticMeshComponents.size() );
+            for ( auto i = 0u; i < m_visibleStaticMeshComponents.size(); i++ )
+            {
+                StaticMeshComponent const* pMeshComponent = m_visibleStaticMeshComponents[i];
+                StaticMesh const* pMesh = pMeshComponent->GetMesh();
+                m_visibleStaticMeshLODs[i] = ( pMesh->GetNumLODs() > 1 ) ? (int8_t) pMesh->SelectLOD( CalculateScreenSize( viewVolume, pMeshComponent->GetWorldBounds() ) ) : 0;
+            }
+
+            m_visibleSkeletalMeshLODs.resize( m_visibleSkeletalMeshComponents.size() );
+            for ( auto i = 0u; i < m_visibleSkeletalMeshComponents.size(); i++ )
+            {
+                SkeletalMeshComponent const* pMeshComponent = m_visibleSkeletalMeshComponents[i];
+                SkeletalMesh const* pMesh = pMeshComponent->GetMesh();
+                m_visibleSkeletalMeshLODs[i] = ( pMesh->GetNumLODs() > 1 ) ? (int8_t) pMesh->SelectLOD( CalculateScreenSize( viewVolume, pMeshComponent->GetWorldBounds() ) ) : 0;
+            }
+        }
+
         //-------------------------------------------------------------------------
         // Debug
         //-------------------------------------------------------------------------
@@ -367,6 +394,33 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    float RendererWorldSystem::CalculateScreenSize( Math::ViewVolume const& viewVolume, OBB const& worldBounds )
+    {
+        float const boundingSphereRadius = worldBounds.m_extents.GetLength3();
+
+        if ( viewVolume.IsPerspective() )
+        {
+            // Clamp the distance to the radius to handle the camera being inside the bounds
+            float const distance = Math::Max( viewVolume.GetViewPosition().GetDistance3( worldBounds.m_center ), boundingSphereRadius );
+            if ( distance <= Math::Epsilon )
+            {
+                return 1.0f;
+            }
+
+            // Screen size is relative to the viewport height, so we need the vertical FOV (the view volume stores the horizontal FOV)
+            Float2 const viewDimensions = viewVolume.GetViewDimensions();
+            Radians const verticalFOV = Math::ViewVolume::ConvertHorizontalToVerticalFOV( viewDimensions.m_x, viewDimensions.m_y, viewVolume.GetFOV() );
+            float const halfFOV = (float) verticalFOV / 2;
+            return boundingSphereRadius / ( distance * Math::Tan( halfFOV ) );
+        }
+        else
+        {
+            return ( boundingSphereRadius * 2 ) / viewVolume.GetViewDimensions().m_y;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void RendererWorldSystem::OnStaticMeshMobilityUpdated( StaticMeshComponent* pComponent )
     {
         EE_ASSERT( pComponent != nullptr && pComponent->IsInitialized() );
@@ -6,6 +6,7 @@
 #include "Engine/Render/Mesh/SkeletalMesh.h"
 #include "System/Render/RenderDevice.h"
 #include "System/Math/AABBTree.h"
+#include "System/Math/ViewVolume.h"
 #include "System/Types/Event.h"
 #include "System/Systems.h"
 #include "System/Types/IDVector.h"
@@ -96,6 +97,12 @@ namespace EE::Render
         void RegisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
         void UnregisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
 
+        // LODs
+        //-------------------------------------------------------------------------
+
+        // Calculate the projected size of the bounds as a fraction of the viewport height
+        static float CalculateScreenSize( Math::ViewVolume const& viewVolume, OBB const& worldBounds );
+
     private:
 
         // Static meshes
@@ -103,6 +110,7 @@ namespace EE::Render
         TIDVector<ComponentID, StaticMeshComponent*>                    m_staticStaticMeshComponents;
         TIDVector<ComponentID, StaticMeshComponent*>                    m_dynamicStaticMeshComponents;
         TVector<StaticMeshComponent const*>                             m_visibleStaticMeshComponents;
+        TVector<int8_t>                                                 m_visibleStaticMeshLODs;                // The selected LOD for each visible static mesh
         EventBindingID                                                  m_staticMeshMobilityChangedEventBinding;
         EventBindingID                                                  m_staticMeshStaticTransformUpdatedEventBinding;
         Threading::Mutex                                                m_mobilityUpdateListLock;               // Mobility switches can occur on any thread so the list needs to be threadsafe. We use a simple lock for now since we dont expect too many switches
@@ -114,6 +122,7 @@ namespace EE::Render
         TIDVector<ComponentID, SkeletalMeshComponent*>                  m_registeredSkeletalMeshComponents;
         TIDVector<uint32_t, SkeletalMeshGroup>                          m_skeletalMeshGroups;
         TVector<SkeletalMeshComponent const*>                           m_visibleSkeletalMeshComponents;
+        TVector<int8_t>                                                 m_visibleSkeletalMeshLODs;              // The selected LOD for each visible skeletal mesh
 
         // Lights
         TIDVector<ComponentID, DirectionalLightComponent*>              m_registeredDirectionLightComponents;
@@ -0,0 +1,601 @@
+#include "WorldSystem_SpatialQueries.h"
+#include "Engine/Volumes/Components/Component_Volumes.h"
+#include "Engine/Physics/Components/Component_PhysicsCharacter.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+#include <EASTL/sort.h>
+#include <EASTL/algorithm.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    // Components that would be stored in more cells than this are kept in the oversized list instead
+    constexpr static int64_t const g_maxCellsPerProxy = 64;
+
+    // Queries that cover more cells than this are cheaper to run against all the proxies
+    constexpr static int64_t const g_maxCellsPerQuery = 1024;
+
+    // The smallest number of queries we will process per job
+    constexpr static uint32_t const g_minQueriesPerJob = 16;
+
+    // Additional tracked types, only modified during module initialization/shutdown
+    static TInlineVector<TypeSystem::TypeID, 16> g_trackedComponentTypes;
+
+    //-------------------------------------------------------------------------
+
+    EE_FORCE_INLINE static uint64_t GetCellKey( int32_t cellX, int32_t cellY )
+    {
+        return ( uint64_t( uint32_t( cellX ) ) << 32 ) | uint64_t( uint32_t( cellY ) );
+    }
+
+    EE_FORCE_INLINE static int32_t GetCellCoordinate( float value, float cellSize )
+    {
+        return (int32_t) Math::Floor( value / cellSize );
+    }
+
+    static void GetCellRange( AABB const& box, float cellSize, int32_t& outMinX, int32_t& outMinY, int32_t& outMaxX, int32_t& outMaxY )
+    {
+        Vector const boxMin = box.GetMin();
+        Vector const boxMax = box.GetMax();
+        outMinX = GetCellCoordinate( boxMin.GetX(), cellSize );
+        outMinY = GetCellCoordinate( boxMin.GetY(), cellSize );
+        outMaxX = GetCellCoordinate( boxMax.GetX(), cellSize );
+        outMaxY = GetCellCoordinate( boxMax.GetY(), cellSize );
+    }
+
+    EE_FORCE_INLINE static int64_t GetNumCells( int32_t minX, int32_t minY, int32_t maxX, int32_t maxY )
+    {
+        return ( int64_t( maxX ) - minX + 1 ) * ( int64_t( maxY ) - minY + 1 );
+    }
+
+    //-------------------------------------------------------------------------
+
+    template<typename QueryType, typename Executor>
+    struct SpatialQueryTask final : public ITaskSet
+    {
+        SpatialQueryTask( TVector<QueryType>& queries, Executor const& executor )
+            : m_queries( queries )
+            , m_executor( executor )
+        {
+            m_SetSize = (uint32_t) queries.size();
+            m_MinRange = g_minQueriesPerJob;
+        }
+
+        virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+        {
+            EE_PROFILE_SCOPE_ENTITY( "Spatial Query Task" );
+
+            for ( uint64_t i = range.start; i < range.end; ++i )
+            {
+                m_executor( m_queries[i] );
+            }
+        }
+
+    private:
+
+        TVector<QueryType>&                         m_queries;
+        Executor const&                             m_executor;
+    };
+
+    template<typename QueryType, typename Executor>
+    static void RunQueryBatch( TaskSystem* pTaskSystem, TVector<QueryType>& queries, Executor const& executor )
+    {
+        // Not worth going wide for small batches
+        if ( queries.size() <= g_minQueriesPerJob )
+        {
+            for ( auto& query : queries )
+            {
+                executor( query );
+            }
+
+            return;
+        }
+
+        SpatialQueryTask<QueryType, Executor> task( queries, executor );
+        pTaskSystem->ScheduleTask( &task );
+        pTaskSystem->WaitForTask( &task );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void SpatialQuerySystem::RegisterTrackedComponentType( TypeSystem::TypeID typeID )
+    {
+        EE_ASSERT( typeID.IsValid() );
+        EE_ASSERT( !VectorContains( g_trackedComponentTypes, typeID ) );
+        g_trackedComponentTypes.emplace_back( typeID );
+    }
+
+    void SpatialQuerySystem::UnregisterTrackedComponentType( TypeSystem::TypeID typeID )
+    {
+        EE_ASSERT( VectorContains( g_trackedComponentTypes, typeID ) );
+        g_trackedComponentTypes.erase_first_unsorted( typeID );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void SpatialQuerySystem::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<EE::TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
+        m_trackedBounds.Reset();
+    }
+
+    void SpatialQuerySystem::ShutdownSystem()
+    {
+        EE_ASSERT( m_componentToProxyIdx.empty() );
+        EE_ASSERT( m_cells.empty() && m_oversizedProxies.empty() && m_volumeProxies.empty() );
+        EE_ASSERT( m_volumeOccupancy.empty() );
+
+        m_proxies.clear();
+        m_freeProxyIndices.clear();
+        m_pTaskSystem = nullptr;
+    }
+
+    bool SpatialQuerySystem::ShouldTrackComponent( EntityComponent const* pComponent ) const
+    {
+        if ( !IsOfType<SpatialEntityComponent>( pComponent ) )
+        {
+            return false;
+        }
+
+        if ( IsOfType<VolumeComponent>( pComponent ) || IsOfType<Physics::CharacterComponent>( pComponent ) )
+        {
+            return true;
+        }
+
+        auto pTypeInfo = pComponent->GetTypeInfo();
+        for ( auto const& typeID : g_trackedComponentTypes )
+        {
+            if ( pTypeInfo->IsDerivedFrom( typeID ) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void SpatialQuerySystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        if ( !ShouldTrackComponent( pComponent ) )
+        {
+            return;
+        }
+
+        EE_ASSERT( m_componentToProxyIdx.find( pComponent->GetID().m_ID ) == m_componentToProxyIdx.end() );
+
+        // Create proxy
+        //-------------------------------------------------------------------------
+
+        int32_t proxyIdx = InvalidIndex;
+        if ( m_freeProxyIndices.empty() )
+        {
+            proxyIdx = (int32_t) m_proxies.size();
+            m_proxies.emplace_back();
+        }
+        else
+        {
+            proxyIdx = m_freeProxyIndices.back();
+            m_freeProxyIndices.pop_back();
+        }
+
+        auto pSpatialComponent = static_cast<SpatialEntityComponent*>( pComponent );
+
+        Proxy& proxy = m_proxies[proxyIdx];
+        proxy.m_pComponent = pSpatialComponent;
+        proxy.m_position = pSpatialComponent->GetPosition();
+        proxy.m_bounds = pSpatialComponent->GetWorldBounds().GetAABB();
+        proxy.m_isVolume = IsOfType<BoxVolumeComponent>( pComponent );
+        GetCellRange( proxy.m_bounds, m_cellSize, proxy.m_minCellX, proxy.m_minCellY, proxy.m_maxCellX, proxy.m_maxCellY );
+        AddProxyToCells( proxyIdx );
+
+        m_componentToProxyIdx[pComponent->GetID().m_ID] = proxyIdx;
+
+        if ( proxy.m_isVolume )
+        {
+            m_volumeProxies.emplace_back( proxyIdx );
+        }
+
+        m_trackedBounds = m_trackedBounds.IsValid() ? m_trackedBounds.GetMergedBox( proxy.m_bounds ) : proxy.m_bounds;
+    }
+
+    void SpatialQuerySystem::UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        auto iter = m_componentToProxyIdx.find( pComponent->GetID().m_ID );
+        if ( iter == m_componentToProxyIdx.end() )
+        {
+            return;
+        }
+
+        int32_t const proxyIdx = iter->second;
+        m_componentToProxyIdx.erase( iter );
+
+        RemoveProxyFromCells( proxyIdx );
+
+        if ( m_proxies[proxyIdx].m_isVolume )
+        {
+            m_volumeProxies.erase_first_unsorted( proxyIdx );
+        }
+
+        // Drop any occupancy involving this proxy, we dont fire exit events for components that are being unloaded
+        auto IsProxyOccupancy = [proxyIdx] ( VolumeOccupancy const& occupancy ) { return occupancy.m_volumeProxyIdx == proxyIdx || occupancy.m_occupantProxyIdx == proxyIdx; };
+        m_volumeOccupancy.erase( eastl::remove_if( m_volumeOccupancy.begin(), m_volumeOccupancy.end(), IsProxyOccupancy ), m_volumeOccupancy.end() );
+
+        // Release proxy
+        //-------------------------------------------------------------------------
+
+        m_proxies[proxyIdx] = Proxy();
+        m_freeProxyIndices.emplace_back( proxyIdx );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void SpatialQuerySystem::AddProxyToCells( int32_t proxyIdx )
+    {
+        Proxy& proxy = m_proxies[proxyIdx];
+        proxy.m_isOversized = GetNumCells( proxy.m_minCellX, proxy.m_minCellY, proxy.m_maxCellX, proxy.m_maxCellY ) > g_maxCellsPerProxy;
+
+        if ( proxy.m_isOversized )
+        {
+            m_oversizedProxies.emplace_back( proxyIdx );
+            return;
+        }
+
+        for ( int32_t y = proxy.m_minCellY; y <= proxy.m_maxCellY; y++ )
+        {
+            for ( int32_t x = proxy.m_minCellX; x <= proxy.m_maxCellX; x++ )
+            {
+                m_cells[GetCellKey( x, y )].emplace_back( proxyIdx );
+            }
+        }
+    }
+
+    void SpatialQuerySystem::RemoveProxyFromCells( int32_t proxyIdx )
+    {
+        Proxy const& proxy = m_proxies[proxyIdx];
+
+        if ( proxy.m_isOversized )
+        {
+            m_oversizedProxies.erase_first_unsorted( proxyIdx );
+            return;
+        }
+
+        for ( int32_t y = proxy.m_minCellY; y <= proxy.m_maxCellY; y++ )
+        {
+            for ( int32_t x = proxy.m_minCellX; x <= proxy.m_maxCellX; x++ )
+            {
+                auto cellIter = m_cells.find( GetCellKey( x, y ) );
+                EE_ASSERT( cellIter != m_cells.end() );
+                cellIter->second.erase_first_unsorted( proxyIdx );
+
+                if ( cellIter->second.empty() )
+                {
+                    m_cells.erase( cellIter );
+                }
+            }
+        }
+    }
+
+    void SpatialQuerySystem::UpdateProxies()
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Update Spatial Query Proxies" );
+
+        m_trackedBounds.Reset();
+
+        int32_t const numProxies = (int32_t) m_proxies.size();
+        for ( int32_t proxyIdx = 0; proxyIdx < numProxies; proxyIdx++ )
+        {
+            Proxy& proxy = m_proxies[proxyIdx];
+            if ( !proxy.IsValid() )
+            {
+                continue;
+            }
+
+            proxy.m_position = proxy.m_pComponent->GetPosition();
+
+            // Only re-bin the proxy if its bounds moved to a different set of cells
+            AABB const bounds = proxy.m_pComponent->GetWorldBounds().GetAABB();
+            if ( !bounds.GetCenter().IsNearEqual3( proxy.m_bounds.GetCenter() ) || !bounds.GetExtents().IsNearEqual3( proxy.m_bounds.GetExtents() ) )
+            {
+                proxy.m_bounds = bounds;
+
+                int32_t minCellX, minCellY, maxCellX, maxCellY;
+                GetCellRange( bounds, m_cellSize, minCellX, minCellY, maxCellX, maxCellY );
+                if ( minCellX != proxy.m_minCellX || minCellY != proxy.m_minCellY || maxCellX != proxy.m_maxCellX || maxCellY != proxy.m_maxCellY )
+                {
+                    RemoveProxyFromCells( proxyIdx );
+                    proxy.m_minCellX = minCellX;
+                    proxy.m_minCellY = minCellY;
+                    proxy.m_maxCellX = maxCellX;
+                    proxy.m_maxCellY = maxCellY;
+                    AddProxyToCells( proxyIdx );
+                }
+            }
+
+            m_trackedBounds = m_trackedBounds.IsValid() ? m_trackedBounds.GetMergedBox( proxy.m_bounds ) : proxy.m_bounds;
+        }
+    }
+
+    void SpatialQuerySystem::UpdateVolumeOccupancy()
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Update Volume Occupancy" );
+
+        m_newVolumeOccupancy.clear();
+
+        for ( int32_t volumeProxyIdx : m_volumeProxies )
+        {
+            Proxy const& volumeProxy = m_proxies[volumeProxyIdx];
+            OBB const& volumeBounds = volumeProxy.m_pComponent->GetWorldBounds();
+
+            ForEachProxyInBox( volumeProxy.m_bounds, [&] ( int32_t proxyIdx )
+            {
+                Proxy const& proxy = m_proxies[proxyIdx];
+                if ( !proxy.m_isVolume && volumeBounds.ContainsPoint( proxy.m_position ) )
+                {
+                    VolumeOccupancy& occupancy = m_newVolumeOccupancy.emplace_back();
+                    occupancy.m_volumeProxyIdx = volumeProxyIdx;
+                    occupancy.m_occupantProxyIdx = proxyIdx;
+                }
+            } );
+        }
+
+        eastl::sort( m_newVolumeOccupancy.begin(), m_newVolumeOccupancy.end() );
+
+        // Both lists are sorted so we can diff them in a single pass
+        //-------------------------------------------------------------------------
+
+        auto FireEvent = [this] ( TEvent<BoxVolumeComponent*, SpatialEntityComponent*> const& event, VolumeOccupancy const& occupancy )
+        {
+            auto pVolumeComponent = static_cast<BoxVolumeComponent*>( m_proxies[occupancy.m_volumeProxyIdx].m_pComponent );
+            event.Execute( pVolumeComponent, m_proxies[occupancy.m_occupantProxyIdx].m_pComponent );
+        };
+
+        size_t const numPrevious = m_volumeOccupancy.size();
+        size_t const numCurrent = m_newVolumeOccupancy.size();
+        size_t previousIdx = 0;
+        size_t currentIdx = 0;
+        while ( previousIdx < numPrevious || currentIdx < numCurrent )
+        {
+            if ( currentIdx == numCurrent || ( previousIdx < numPrevious && m_volumeOccupancy[previousIdx] < m_newVolumeOccupancy[currentIdx] ) )
+            {
+                FireEvent( m_volumeExitedEvent, m_volumeOccupancy[previousIdx] );
+                previousIdx++;
+            }
+            else if ( previousIdx == numPrevious || m_newVolumeOccupancy[currentIdx] < m_volumeOccupancy[previousIdx] )
+            {
+                FireEvent( m_volumeEnteredEvent, m_newVolumeOccupancy[currentIdx] );
+                currentIdx++;
+            }
+            else
+            {
+                previousIdx++;
+                currentIdx++;
+            }
+        }
+
+        m_volumeOccupancy.swap( m_newVolumeOccupancy );
+    }
+
+    void SpatialQuerySystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
+        // Pick up all the changes made since the last update (spawned entities, teleports, etc...)
+        if ( ctx.GetUpdateStage() == UpdateStage::FrameStart )
+        {
+            UpdateProxies();
+        }
+        // Pick up all the movement for this frame
+        else if ( ctx.GetUpdateStage() == UpdateStage::PostPhysics )
+        {
+            UpdateProxies();
+            UpdateVolumeOccupancy();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    template<typename Function>
+    void SpatialQuerySystem::ForEachProxyInBox( AABB const& box, Function&& function ) const
+    {
+        int32_t minCellX, minCellY, maxCellX, maxCellY;
+        GetCellRange( box, m_cellSize, minCellX, minCellY, maxCellX, maxCellY );
+
+        if ( GetNumCells( minCellX, minCellY, maxCellX, maxCellY ) > g_maxCellsPerQuery )
+        {
+            int32_t const numProxies = (int32_t) m_proxies.size();
+            for ( int32_t proxyIdx = 0; proxyIdx < numProxies; proxyIdx++ )
+            {
+                Proxy const& proxy = m_proxies[proxyIdx];
+                if ( proxy.IsValid() && proxy.m_bounds.Overlaps( box ) )
+                {
+                    function( proxyIdx );
+                }
+            }
+
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( int32_t y = minCellY; y <= maxCellY; y++ )
+        {
+            for ( int32_t x = minCellX; x <= maxCellX; x++ )
+            {
+                auto cellIter = m_cells.find( GetCellKey( x, y ) );
+                if ( cellIter == m_cells.end() )
+                {
+                    continue;
+                }
+
+                for ( int32_t proxyIdx : cellIter->second )
+                {
+                    // Proxies spanning multiple cells are only visited from the first cell they share with the query
+                    Proxy const& proxy = m_proxies[proxyIdx];
+                    if ( x != Math::Max( proxy.m_minCellX, minCellX ) || y != Math::Max( proxy.m_minCellY, minCellY ) )
+                    {
+                        continue;
+                    }
+
+                    if ( proxy.m_bounds.Overlaps( box ) )
+                    {
+                        function( proxyIdx );
+                    }
+                }
+            }
+        }
+
+        for ( int32_t proxyIdx : m_oversizedProxies )
+        {
+            if ( m_proxies[proxyIdx].m_bounds.Overlaps( box ) )
+            {
+                function( proxyIdx );
+            }
+        }
+    }
+
+    bool SpatialQuerySystem::PassesTypeFilter( Proxy const& proxy, TypeSystem::TypeID typeFilter ) const
+    {
+        return !typeFilter.IsValid() || proxy.m_pComponent->GetTypeInfo()->IsDerivedFrom( typeFilter );
+    }
+
+    template<typename ResultsType>
+    void SpatialQuerySystem::RunRadiusQuery( Vector const& center, float radius, TypeSystem::TypeID typeFilter, ResultsType& outResults ) const
+    {
+        EE_ASSERT( radius >= 0.0f );
+        outResults.clear();
+
+        Sphere const sphere( center, radius );
+        ForEachProxyInBox( AABB( center, radius ), [&] ( int32_t proxyIdx )
+        {
+            Proxy const& proxy = m_proxies[proxyIdx];
+            if ( proxy.m_bounds.Overlaps( sphere ) && PassesTypeFilter( proxy, typeFilter ) )
+            {
+                outResults.emplace_back( proxy.m_pComponent );
+            }
+        } );
+    }
+
+    template<typename ResultsType>
+    void SpatialQuerySystem::RunBoxQuery( AABB const& box, TypeSystem::TypeID typeFilter, ResultsType& outResults ) const
+    {
+        EE_ASSERT( box.IsValid() );
+        outResults.clear();
+
+        ForEachProxyInBox( box, [&] ( int32_t proxyIdx )
+        {
+            Proxy const& proxy = m_proxies[proxyIdx];
+            if ( PassesTypeFilter( proxy, typeFilter ) )
+            {
+                outResults.emplace_back( proxy.m_pComponent );
+            }
+        } );
+    }
+
+    template<typename ResultsType>
+    void SpatialQuerySystem::RunNearestQuery( Vector const& point, int32_t maxResults, float maxDistance, TypeSystem::TypeID typeFilter, ResultsType& outResults ) const
+    {
+        EE_ASSERT( maxResults > 0 && maxDistance >= 0.0f );
+        outResults.clear();
+
+        if ( !m_trackedBounds.IsValid() )
+        {
+            return;
+        }
+
+        struct Candidate
+        {
+            SpatialEntityComponent*                 m_pComponent = nullptr;
+            float                                   m_distanceSq = 0.0f;
+        };
+
+        TInlineVector<Candidate, 32> candidates;
+
+        // Distances are measured to the closest point of the component bounds so every component within the search radius is guaranteed to overlap the search box
+        // We keep doubling the search radius until we have enough candidates, the search never needs to go beyond the furthest corner of all the tracked bounds
+        float const maxTrackedDistance = ( ( m_trackedBounds.GetCenter() - point ).Abs() + m_trackedBounds.GetExtents() ).GetLength3();
+        float const searchLimit = Math::Min( maxDistance, maxTrackedDistance );
+        float searchRadius = Math::Min( m_cellSize, searchLimit );
+
+        while ( true )
+        {
+            candidates.clear();
+
+            float const searchRadiusSq = searchRadius * searchRadius;
+            ForEachProxyInBox( AABB( point, searchRadius ), [&] ( int32_t proxyIdx )
+            {
+                Proxy const& proxy = m_proxies[proxyIdx];
+                Vector const offset = Vector::Max( ( point - proxy.m_bounds.GetCenter() ).Abs() - proxy.m_bounds.GetExtents(), Vector::Zero );
+                float const distanceSq = offset.GetLengthSquared3();
+                if ( distanceSq <= searchRadiusSq && PassesTypeFilter( proxy, typeFilter ) )
+                {
+                    Candidate& candidate = candidates.emplace_back();
+                    candidate.m_pComponent = proxy.m_pComponent;
+                    candidate.m_distanceSq = distanceSq;
+                }
+            } );
+
+            if ( (int32_t) candidates.size() >= maxResults || searchRadius >= searchLimit )
+            {
+                break;
+            }
+
+            searchRadius = Math::Min( searchRadius * 2.0f, searchLimit );
+        }
+
+        //-------------------------------------------------------------------------
+
+        auto Comparator = [] ( Candidate const& a, Candidate const& b )
+        {
+            if ( a.m_distanceSq != b.m_distanceSq )
+            {
+                return a.m_distanceSq < b.m_distanceSq;
+            }
+
+            return a.m_pComponent->GetID().m_ID < b.m_pComponent->GetID().m_ID;
+        };
+
+        eastl::sort( candidates.begin(), candidates.end(), Comparator );
+
+        int32_t const numResults = Math::Min( (int32_t) candidates.size(), maxResults );
+        for ( int32_t i = 0; i < numResults; i++ )
+        {
+            outResults.emplace_back( candidates[i].m_pComponent );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void SpatialQuerySystem::FindInRadius( Vector const& center, float radius, TVector<SpatialEntityComponent*>& outResults, TypeSystem::TypeID typeFilter ) const
+    {
+        RunRadiusQuery( center, radius, typeFilter, outResults );
+    }
+
+    void SpatialQuerySystem::FindInBox( AABB const& box, TVector<SpatialEntityComponent*>& outResults, TypeSystem::TypeID typeFilter ) const
+    {
+        RunBoxQuery( box, typeFilter, outResults );
+    }
+
+    void SpatialQuerySystem::FindNearest( Vector const& point, int32_t maxResults, float maxDistance, TVector<SpatialEntityComponent*>& outResults, TypeSystem::TypeID typeFilter ) const
+    {
+        RunNearestQuery( point, maxResults, maxDistance, typeFilter, outResults );
+    }
+
+    void SpatialQuerySystem::RunQueries( TVector<RadiusQuery>& queries ) const
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Spatial Radius Queries" );
+        RunQueryBatch( m_pTaskSystem, queries, [this] ( RadiusQuery& query ) { RunRadiusQuery( query.m_center, query.m_radius, query.m_typeFilter, query.m_results ); } );
+    }
+
+    void SpatialQuerySystem::RunQueries( TVector<BoxQuery>& queries ) const
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Spatial Box Queries" );
+        RunQueryBatch( m_pTaskSystem, queries, [this] ( BoxQuery& query ) { RunBoxQuery( query.m_box, query.m_typeFilter, query.m_results ); } );
+    }
+
+    void SpatialQuerySystem::RunQueries( TVector<NearestQuery>& queries ) const
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Spatial Nearest Queries" );
+        RunQueryBatch( m_pTaskSystem, queries, [this] ( NearestQuery& query ) { RunNearestQuery( query.m_point, query.m_maxResults, query.m_maxDistance, query.m_typeFilter, query.m_results ); } );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Entity/EntityWorldSystem.h"
+#include "System/TypeSystem/TypeID.h"
+#include "System/Math/BoundingVolumes.h"
+#include "System/Types/HashMap.h"
+#include "System/Types/Event.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class TaskSystem;
+    class SpatialEntityComponent;
+    class BoxVolumeComponent;
+}
+
+//-------------------------------------------------------------------------
+// Spatial Query System
+//-------------------------------------------------------------------------
+// A shared spatial hash of the spatial components that gameplay systems need to run proximity queries against
+// Volumes and characters are always tracked, other component types need to be registered at module initialization time (before any world is created)
+//
+// Each component is stored in all the (2D) cells that its world AABB overlaps, components that would cover too many cells are kept in a separate list
+// The hash is only updated during this system's updates, only components whose world transform or bounds changed since the last update are re-binned
+// Both updates run after all other world systems in their stage (world systems update in descending priority value order, so 'Highest' is last)
+// So queries see the state as of the last system update: the end of the frame start stage or the end of the post-physics stage (after the physics pose write-back)
+//
+// Box volumes additionally get enter/exit events for any tracked (non-volume) component whose position is inside them
+
+namespace EE
+{
+    class EE_ENGINE_API SpatialQuerySystem final : public IEntityWorldSystem
+    {
+        struct Proxy
+        {
+            inline bool IsValid() const { return m_pComponent != nullptr; }
+
+        public:
+
+            SpatialEntityComponent*                             m_pComponent = nullptr;
+            Vector                                              m_position;
+            AABB                                                m_bounds;
+            int32_t                                             m_minCellX = 0;
+            int32_t                                             m_minCellY = 0;
+            int32_t                                             m_maxCellX = -1;
+            int32_t                                             m_maxCellY = -1;
+            bool                                                m_isOversized = false;
+            bool                                                m_isVolume = false;
+        };
+
+        struct VolumeOccupancy
+        {
+            inline bool operator<( VolumeOccupancy const& rhs ) const { return ( m_volumeProxyIdx != rhs.m_volumeProxyIdx ) ? m_volumeProxyIdx < rhs.m_volumeProxyIdx : m_occupantProxyIdx < rhs.m_occupantProxyIdx; }
+            inline bool operator==( VolumeOccupancy const& rhs ) const { return m_volumeProxyIdx == rhs.m_volumeProxyIdx && m_occupantProxyIdx == rhs.m_occupantProxyIdx; }
+
+            int32_t                                             m_volumeProxyIdx = InvalidIndex;
+            int32_t                                             m_occupantProxyIdx = InvalidIndex;
+        };
+
+    public:
+
+        // Batched queries - an invalid type ID means that all tracked components are considered
+        //-------------------------------------------------------------------------
+
+        struct RadiusQuery
+        {
+            Vector                                              m_center;
+            float                                               m_radius = 0.0f;
+            TypeSystem::TypeID                                  m_typeFilter;
+            TInlineVector<SpatialEntityComponent*, 8>           m_results;
+        };
+
+        struct BoxQuery
+        {
+            AABB                                                m_box;
+            TypeSystem::TypeID                                  m_typeFilter;
+            TInlineVector<SpatialEntityComponent*, 8>           m_results;
+        };
+
+        struct NearestQuery
+        {
+            Vector                                              m_point;
+            int32_t                                             m_maxResults = 1;
+            float                                               m_maxDistance = FLT_MAX;
+            TypeSystem::TypeID                                  m_typeFilter;
+            TInlineVector<SpatialEntityComponent*, 8>           m_results; // Sorted nearest first
+        };
+
+    public:
+
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( SpatialQuerySystem, RequiresUpdate( UpdateStage::FrameStart, UpdatePriority::Highest ), RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::Highest ) );
+
+        // Register an additional component type to be tracked, all derived types will also be tracked
+        static void RegisterTrackedComponentType( TypeSystem::TypeID typeID );
+        static void UnregisterTrackedComponentType( TypeSystem::TypeID typeID );
+
+        // Fired during the post-physics update whenever a tracked component enters/exits a box volume: ( volume, component )
+        inline TEventHandle<BoxVolumeComponent*, SpatialEntityComponent*> OnVolumeEntered() { return m_volumeEnteredEvent; }
+        inline TEventHandle<BoxVolumeComponent*, SpatialEntityComponent*> OnVolumeExited() { return m_volumeExitedEvent; }
+
+        // Queries - these are threadsafe with regards to each other, the batched versions are run in parallel when large enough
+        //-------------------------------------------------------------------------
+
+        void FindInRadius( Vector const& center, float radius, TVector<SpatialEntityComponent*>& outResults, TypeSystem::TypeID typeFilter = TypeSystem::TypeID() ) const;
+        void FindInBox( AABB const& box, TVector<SpatialEntityComponent*>& outResults, TypeSystem::TypeID typeFilter = TypeSystem::TypeID() ) const;
+        void FindNearest( Vector const& point, int32_t maxResults, float maxDistance, TVector<SpatialEntityComponent*>& outResults, TypeSystem::TypeID typeFilter = TypeSystem::TypeID() ) const;
+
+        void RunQueries( TVector<RadiusQuery>& queries ) const;
+        void RunQueries( TVector<BoxQuery>& queries ) const;
+        void RunQueries( TVector<NearestQuery>& queries ) const;
+
+        // Debug
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline int32_t GetNumTrackedComponents() const { return (int32_t) m_componentToProxyIdx.size(); }
+        inline int32_t GetNumOccupiedCells() const { return (int32_t) m_cells.size(); }
+        #endif
+
+    private:
+
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
+        virtual void ShutdownSystem() override final;
+        virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+
+        bool ShouldTrackComponent( EntityComponent const* pComponent ) const;
+
+        void AddProxyToCells( int32_t proxyIdx );
+        void RemoveProxyFromCells( int32_t proxyIdx );
+
+        // Re-bin all proxies whose component moved since the last update
+        void UpdateProxies();
+
+        // Update the volume occupancy and fire the enter/exit events
+        void UpdateVolumeOccupancy();
+
+        // Call the function for every proxy overlapping the box, each proxy is only visited once
+        template<typename Function>
+        void ForEachProxyInBox( AABB const& box, Function&& function ) const;
+
+        bool PassesTypeFilter( Proxy const& proxy, TypeSystem::TypeID typeFilter ) const;
+
+        template<typename ResultsType>
+        void RunRadiusQuery( Vector const& center, float radius, TypeSystem::TypeID typeFilter, ResultsType& outResults ) const;
+
+        template<typename ResultsType>
+        void RunBoxQuery( AABB const& box, TypeSystem::TypeID typeFilter, ResultsType& outResults ) const;
+
+        template<typename ResultsType>
+        void RunNearestQuery( Vector const& point, int32_t maxResults, float maxDistance, TypeSystem::TypeID typeFilter, ResultsType& outResults ) const;
+
+    private:
+
+        TaskSystem*                                             m_pTaskSystem = nullptr;
+
+        TVector<Proxy>                                          m_proxies;
+        TVector<int32_t>                                        m_freeProxyIndices;
+        THashMap<uint64_t, int32_t>                             m_componentToProxyIdx;
+        THashMap<uint64_t, TVector<int32_t>>                    m_cells;
+        TVector<int32_t>                                        m_oversizedProxies;
+        TVector<int32_t>                                        m_volumeProxies;
+        AABB                                                    m_trackedBounds; // The bounds of all tracked components, used to terminate the nearest queries
+        float                                                   m_cellSize = 4.0f;
+
+        TVector<VolumeOccupancy>                                m_volumeOccupancy;
+        TVector<VolumeOccupancy>                                m_newVolumeOccupancy;
+        TEvent<BoxVolumeComponent*, SpatialEntityComponent*>    m_volumeEnteredEvent;
+        TEvent<BoxVolumeComponent*, SpatialEntityComponent*>    m_volumeExitedEvent;
+    };
+}
\ No newline at end of file
@@ -16,7 +16,7 @@ namespace EE::Animation
     class AnimationGraphCompiler final : public Resource::Compiler
     {
         EE_REGISTER_TYPE( AnimationGraphCompiler );
-        static const int32_t s_version = 9;
+        static const int32_t s_version = 13;
 
     public:
 
@@ -1,5 +1,6 @@
 #include "Animation_ToolsGraph_Compilation.h"
 #include "Animation_ToolsGraph_Definition.h"
+#include "Animation_ToolsGraph_ValuePrograms.h"
 #include "Nodes/Animation_ToolsGraphNode_Parameters.h"
 #include "Nodes/Animation_ToolsGraphNode_Result.h"
 
@@ -131,6 +132,15 @@ namespace EE::Animation
         m_runtimeGraph.m_nodePaths.swap( m_context.m_compiledNodePaths );
         #endif
 
+        // Flatten value nodes
+        //-------------------------------------------------------------------------
+
+        ValueProgramCompiler valueProgramCompiler( m_runtimeGraph.m_nodeSettings );
+        if ( !valueProgramCompiler.Compile( m_runtimeGraph.m_valuePrograms ) )
+        {
+            m_context.LogWarning( "Graph value programs exceed the supported size limits, value nodes will be evaluated individually!" );
+        }
+
         //-------------------------------------------------------------------------
 
         return m_runtimeGraph.m_rootNodeIdx != InvalidIndex;
@@ -0,0 +1,485 @@
+#include "Animation_ToolsGraph_ValuePrograms.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Bools.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_ConstValues.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Floats.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Parameters.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Vectors.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    using namespace GraphNodes;
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        constexpr static int32_t const g_maxIndexValue = 0x7FFF;
+
+        // All runtime node settings are final so an exact type check is sufficient
+        template<typename T>
+        EE_FORCE_INLINE typename T::Settings const* GetSettingsAs( GraphNode::Settings const* pSettings )
+        {
+            return ( pSettings->GetTypeID() == T::Settings::GetStaticTypeID() ) ? static_cast<typename T::Settings const*>( pSettings ) : nullptr;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    ValueProgramCompiler::ValueProgramCompiler( TVector<GraphNode::Settings*> const& nodeSettings )
+        : m_nodeSettings( nodeSettings )
+    {}
+
+    bool ValueProgramCompiler::Compile( GraphValuePrograms& outPrograms )
+    {
+        outPrograms.Clear();
+        m_pPrograms = &outPrograms;
+        m_limitsExceeded = false;
+
+        // Find all program roots
+        //-------------------------------------------------------------------------
+
+        int32_t const numNodes = (int32_t) m_nodeSettings.size();
+        TVector<bool> isInputToFlattenableNode( numNodes, false );
+
+        TInlineVector<int16_t, 4> inputIndices;
+        for ( auto pSettings : m_nodeSettings )
+        {
+            if ( CanBeFlattened( pSettings ) )
+            {
+                inputIndices.clear();
+                GetInputNodeIndices( pSettings, inputIndices );
+                for ( auto inputIdx : inputIndices )
+                {
+                    isInputToFlattenableNode[inputIdx] = true;
+                }
+            }
+        }
+
+        TVector<int16_t> rootNodeIndices;
+        for ( int16_t nodeIdx = 0; nodeIdx < numNodes; nodeIdx++ )
+        {
+            if ( CanBeFlattened( m_nodeSettings[nodeIdx] ) && !isInputToFlattenableNode[nodeIdx] )
+            {
+                rootNodeIndices.emplace_back( nodeIdx );
+            }
+        }
+
+        // Compile programs
+        //-------------------------------------------------------------------------
+        // The first N registers are the result registers for the N programs, the results need to persist since they are cached for the whole graph update
+        // Each program then gets its own range of scratch registers: a 'LoadXXXNode' instruction can end up running another program (e.g. a stateful node with
+        // a flattened input) while the current program still has live scratch registers, so the programs can't share them
+
+        int32_t const numPrograms = (int32_t) rootNodeIndices.size();
+        m_firstScratchRegister = numPrograms;
+
+        for ( int32_t programIdx = 0; programIdx < numPrograms; programIdx++ )
+        {
+            GraphNode::Settings const* pRootSettings = m_nodeSettings[rootNodeIndices[programIdx]];
+            m_programStartIdx = outPrograms.m_instructions.size();
+            m_numUsedScratchRegisters = 0;
+            m_maxUsedScratchRegisters = 0;
+
+            CompileNode( pRootSettings, programIdx );
+            EE_ASSERT( m_numUsedScratchRegisters == 0 );
+            m_firstScratchRegister += m_maxUsedScratchRegisters;
+
+            ValueProgram& program = outPrograms.m_programs.emplace_back();
+            program.m_rootNodeIdx = pRootSettings->m_nodeIdx;
+            program.m_firstInstructionIdx = (uint32_t) m_programStartIdx;
+            program.m_numInstructions = (uint16_t) GetNextInstructionIdx();
+            program.m_resultRegisterIdx = (int16_t) programIdx;
+            program.m_resultType = GetResultType( pRootSettings );
+
+            if ( GetNextInstructionIdx() > g_maxIndexValue )
+            {
+                m_limitsExceeded = true;
+            }
+        }
+
+        int32_t const numRegisters = m_firstScratchRegister;
+        if ( numRegisters > g_maxIndexValue || m_limitsExceeded )
+        {
+            outPrograms.Clear();
+            m_pPrograms = nullptr;
+            return false;
+        }
+
+        outPrograms.m_numRegisters = (int16_t) numRegisters;
+        m_pPrograms = nullptr;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ValueProgramCompiler::CanBeFlattened( GraphNode::Settings const* pSettings ) const
+    {
+        // Only stateless nodes whose result only depends on their inputs can be flattened
+        return GetSettingsAs<FloatRemapNode>( pSettings ) != nullptr ||
+            GetSettingsAs<FloatClampNode>( pSettings ) != nullptr ||
+            GetSettingsAs<FloatAbsNode>( pSettings ) != nullptr ||
+            GetSettingsAs<FloatMathNode>( pSettings ) != nullptr ||
+            GetSettingsAs<FloatComparisonNode>( pSettings ) != nullptr ||
+            GetSettingsAs<FloatRangeComparisonNode>( pSettings ) != nullptr ||
+            GetSettingsAs<FloatSwitchNode>( pSettings ) != nullptr ||
+            GetSettingsAs<FloatReverseDirectionNode>( pSettings ) != nullptr ||
+            GetSettingsAs<AndNode>( pSettings ) != nullptr ||
+            GetSettingsAs<OrNode>( pSettings ) != nullptr ||
+            GetSettingsAs<NotNode>( pSettings ) != nullptr ||
+            GetSettingsAs<VectorInfoNode>( pSettings ) != nullptr ||
+            GetSettingsAs<VectorNegateNode>( pSettings ) != nullptr;
+    }
+
+    void ValueProgramCompiler::GetInputNodeIndices( GraphNode::Settings const* pSettings, TInlineVector<int16_t, 4>& outIndices ) const
+    {
+        auto AddInput = [&outIndices] ( int16_t nodeIdx )
+        {
+            if ( nodeIdx != InvalidIndex )
+            {
+                outIndices.emplace_back( nodeIdx );
+            }
+        };
+
+        if ( auto pRemapSettings = GetSettingsAs<FloatRemapNode>( pSettings ) ) { AddInput( pRemapSettings->m_inputValueNodeIdx ); }
+        else if ( auto pClampSettings = GetSettingsAs<FloatClampNode>( pSettings ) ) { AddInput( pClampSettings->m_inputValueNodeIdx ); }
+        else if ( auto pAbsSettings = GetSettingsAs<FloatAbsNode>( pSettings ) ) { AddInput( pAbsSettings->m_inputValueNodeIdx ); }
+        else if ( auto pMathSettings = GetSettingsAs<FloatMathNode>( pSettings ) )
+        {
+            AddInput( pMathSettings->m_inputValueNodeIdxA );
+            AddInput( pMathSettings->m_inputValueNodeIdxB );
+        }
+        else if ( auto pComparisonSettings = GetSettingsAs<FloatComparisonNode>( pSettings ) )
+        {
+            AddInput( pComparisonSettings->m_inputValueNodeIdx );
+            AddInput( pComparisonSettings->m_comparandValueNodeIdx );
+        }
+        else if ( auto pRangeComparisonSettings = GetSettingsAs<FloatRangeComparisonNode>( pSettings ) ) { AddInput( pRangeComparisonSettings->m_inputValueNodeIdx ); }
+        else if ( auto pSwitchSettings = GetSettingsAs<FloatSwitchNode>( pSettings ) )
+        {
+            AddInput( pSwitchSettings->m_switchValueNodeIdx );
+            AddInput( pSwitchSettings->m_trueValueNodeIdx );
+            AddInput( pSwitchSettings->m_falseValueNodeIdx );
+        }
+        else if ( auto pReverseSettings = GetSettingsAs<FloatReverseDirectionNode>( pSettings ) ) { AddInput( pReverseSettings->m_inputValueNodeIdx ); }
+        else if ( auto pAndSettings = GetSettingsAs<AndNode>( pSettings ) )
+        {
+            for ( auto conditionIdx : pAndSettings->m_conditionNodeIndices ) { AddInput( conditionIdx ); }
+        }
+        else if ( auto pOrSettings = GetSettingsAs<OrNode>( pSettings ) )
+        {
+            for ( auto conditionIdx : pOrSettings->m_conditionNodeIndices ) { AddInput( conditionIdx ); }
+        }
+        else if ( auto pNotSettings = GetSettingsAs<NotNode>( pSettings ) ) { AddInput( pNotSettings->m_inputValueNodeIdx ); }
+        else if ( auto pInfoSettings = GetSettingsAs<VectorInfoNode>( pSettings ) ) { AddInput( pInfoSettings->m_inputValueNodeIdx ); }
+        else if ( auto pNegateSettings = GetSettingsAs<VectorNegateNode>( pSettings ) ) { AddInput( pNegateSettings->m_inputValueNodeIdx ); }
+    }
+
+    GraphValueType ValueProgramCompiler::GetResultType( GraphNode::Settings const* pSettings ) const
+    {
+        if ( GetSettingsAs<FloatComparisonNode>( pSettings ) != nullptr ||
+            GetSettingsAs<FloatRangeComparisonNode>( pSettings ) != nullptr ||
+            GetSettingsAs<AndNode>( pSettings ) != nullptr ||
+            GetSettingsAs<OrNode>( pSettings ) != nullptr ||
+            GetSettingsAs<NotNode>( pSettings ) != nullptr )
+        {
+            return GraphValueType::Bool;
+        }
+
+        if ( GetSettingsAs<VectorNegateNode>( pSettings ) != nullptr )
+        {
+            return GraphValueType::Vector;
+        }
+
+        return GraphValueType::Float;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ValueProgramCompiler::CompileValue( int16_t nodeIdx, GraphValueType valueType, int32_t resultRegister )
+    {
+        EE_ASSERT( nodeIdx >= 0 && nodeIdx < m_nodeSettings.size() );
+        GraphNode::Settings const* pSettings = m_nodeSettings[nodeIdx];
+
+        // Inline flattenable nodes
+        if ( CanBeFlattened( pSettings ) )
+        {
+            EE_ASSERT( GetResultType( pSettings ) == valueType );
+            CompileNode( pSettings, resultRegister );
+            return;
+        }
+
+        // Constants
+        if ( auto pConstBoolSettings = GetSettingsAs<ConstBoolNode>( pSettings ) )
+        {
+            Emit( ValueProgramOpCode::LoadConstant, resultRegister, AddConstant( Float4( pConstBoolSettings->m_value ? 1.0f : 0.0f ) ) );
+            return;
+        }
+
+        if ( auto pConstFloatSettings = GetSettingsAs<ConstFloatNode>( pSettings ) )
+        {
+            Emit( ValueProgramOpCode::LoadConstant, resultRegister, AddConstant( Float4( pConstFloatSettings->m_value ) ) );
+            return;
+        }
+
+        if ( auto pConstVectorSettings = GetSettingsAs<ConstVectorNode>( pSettings ) )
+        {
+            Emit( ValueProgramOpCode::LoadConstant, resultRegister, AddConstant( pConstVectorSettings->m_value.ToFloat4() ) );
+            return;
+        }
+
+        // Control parameters
+        if ( GetSettingsAs<ControlParameterBoolNode>( pSettings ) != nullptr )
+        {
+            Emit( ValueProgramOpCode::LoadBoolParameter, resultRegister, nodeIdx );
+            return;
+        }
+
+        if ( GetSettingsAs<ControlParameterFloatNode>( pSettings ) != nullptr )
+        {
+            Emit( ValueProgramOpCode::LoadFloatParameter, resultRegister, nodeIdx );
+            return;
+        }
+
+        if ( GetSettingsAs<ControlParameterVectorNode>( pSettings ) != nullptr )
+        {
+            Emit( ValueProgramOpCode::LoadVectorParameter, resultRegister, nodeIdx );
+            return;
+        }
+
+        // Everything else goes through the regular node evaluation
+        switch ( valueType )
+        {
+            case GraphValueType::Bool: Emit( ValueProgramOpCode::LoadBoolNode, resultRegister, nodeIdx ); break;
+            case GraphValueType::Float: Emit( ValueProgramOpCode::LoadFloatNode, resultRegister, nodeIdx ); break;
+            case GraphValueType::Vector: Emit( ValueProgramOpCode::LoadVectorNode, resultRegister, nodeIdx ); break;
+
+            default:
+            {
+                EE_UNREACHABLE_CODE();
+            }
+            break;
+        }
+    }
+
+    void ValueProgramCompiler::CompileNode( GraphNode::Settings const* pSettings, int32_t resultRegister )
+    {
+        // Unary nodes calculate their input directly into the result register and then operate in-place
+
+        if ( auto pRemapSettings = GetSettingsAs<FloatRemapNode>( pSettings ) )
+        {
+            CompileValue( pRemapSettings->m_inputValueNodeIdx, GraphValueType::Float, resultRegister );
+            Float4 const ranges( pRemapSettings->m_inputRange.m_begin, pRemapSettings->m_inputRange.m_end, pRemapSettings->m_outputRange.m_begin, pRemapSettings->m_outputRange.m_end );
+            Emit( ValueProgramOpCode::FloatRemap, resultRegister, resultRegister, AddConstant( ranges ) );
+        }
+        else if ( auto pClampSettings = GetSettingsAs<FloatClampNode>( pSettings ) )
+        {
+            CompileValue( pClampSettings->m_inputValueNodeIdx, GraphValueType::Float, resultRegister );
+            Float4 const range( pClampSettings->m_clampRange.m_begin, pClampSettings->m_clampRange.m_end, 0.0f, 0.0f );
+            Emit( ValueProgramOpCode::FloatClamp, resultRegister, resultRegister, AddConstant( range ) );
+        }
+        else if ( auto pAbsSettings = GetSettingsAs<FloatAbsNode>( pSettings ) )
+        {
+            CompileValue( pAbsSettings->m_inputValueNodeIdx, GraphValueType::Float, resultRegister );
+            Emit( ValueProgramOpCode::FloatAbs, resultRegister, resultRegister );
+        }
+        else if ( auto pMathSettings = GetSettingsAs<FloatMathNode>( pSettings ) )
+        {
+            CompileValue( pMathSettings->m_inputValueNodeIdxA, GraphValueType::Float, resultRegister );
+
+            int32_t const registerB = AllocateScratchRegister();
+            if ( pMathSettings->m_inputValueNodeIdxB != InvalidIndex )
+            {
+                CompileValue( pMathSettings->m_inputValueNodeIdxB, GraphValueType::Float, registerB );
+            }
+            else
+            {
+                Emit( ValueProgramOpCode::LoadConstant, registerB, AddConstant( Float4( pMathSettings->m_valueB ) ) );
+            }
+
+            ValueProgramOpCode opCode = ValueProgramOpCode::FloatAdd;
+            switch ( pMathSettings->m_operator )
+            {
+                case FloatMathNode::Operator::Add: opCode = ValueProgramOpCode::FloatAdd; break;
+                case FloatMathNode::Operator::Sub: opCode = ValueProgramOpCode::FloatSub; break;
+                case FloatMathNode::Operator::Mul: opCode = ValueProgramOpCode::FloatMul; break;
+                case FloatMathNode::Operator::Div: opCode = ValueProgramOpCode::FloatDiv; break;
+            }
+
+            Emit( opCode, resultRegister, resultRegister, registerB );
+            ReleaseScratchRegister();
+
+            if ( pMathSettings->m_returnAbsoluteResult )
+            {
+                Emit( ValueProgramOpCode::FloatAbs, resultRegister, resultRegister );
+            }
+        }
+        else if ( auto pComparisonSettings = GetSettingsAs<FloatComparisonNode>( pSettings ) )
+        {
+            CompileValue( pComparisonSettings->m_inputValueNodeIdx, GraphValueType::Float, resultRegister );
+
+            int32_t const registerB = AllocateScratchRegister();
+            if ( pComparisonSettings->m_comparandValueNodeIdx != InvalidIndex )
+            {
+                CompileValue( pComparisonSettings->m_comparandValueNodeIdx, GraphValueType::Float, registerB );
+            }
+            else
+            {
+                Emit( ValueProgramOpCode::LoadConstant, registerB, AddConstant( Float4( pComparisonSettings->m_comparisonValue ) ) );
+            }
+
+            switch ( pComparisonSettings->m_comparison )
+            {
+                case FloatComparisonNode::Comparison::GreaterThanEqual: Emit( ValueProgramOpCode::FloatGreaterThanEqual, resultRegister, resultRegister, registerB ); break;
+                case FloatComparisonNode::Comparison::LessThanEqual: Emit( ValueProgramOpCode::FloatLessThanEqual, resultRegister, resultRegister, registerB ); break;
+                case FloatComparisonNode::Comparison::NearEqual: Emit( ValueProgramOpCode::FloatNearEqual, resultRegister, resultRegister, registerB, AddConstant( Float4( pComparisonSettings->m_epsilon ) ) ); break;
+                case FloatComparisonNode::Comparison::GreaterThan: Emit( ValueProgramOpCode::FloatGreaterThan, resultRegister, resultRegister, registerB ); break;
+                case FloatComparisonNode::Comparison::LessThan: Emit( ValueProgramOpCode::FloatLessThan, resultRegister, resultRegister, registerB ); break;
+            }
+
+            ReleaseScratchRegister();
+        }
+        else if ( auto pRangeComparisonSettings = GetSettingsAs<FloatRangeComparisonNode>( pSettings ) )
+        {
+            CompileValue( pRangeComparisonSettings->m_inputValueNodeIdx, GraphValueType::Float, resultRegister );
+            Float4 const range( pRangeComparisonSettings->m_range.m_begin, pRangeComparisonSettings->m_range.m_end, 0.0f, 0.0f );
+            Emit( pRangeComparisonSettings->m_isInclusiveCheck ? ValueProgramOpCode::FloatInRangeInclusive : ValueProgramOpCode::FloatInRangeExclusive, resultRegister, resultRegister, AddConstant( range ) );
+        }
+        else if ( auto pSwitchSettings = GetSettingsAs<FloatSwitchNode>( pSettings ) )
+        {
+            // Only the selected branch is evaluated, same as the node
+            int32_t const switchRegister = AllocateScratchRegister();
+            CompileValue( pSwitchSettings->m_switchValueNodeIdx, GraphValueType::Bool, switchRegister );
+            int32_t const jumpToFalseIdx = Emit( ValueProgramOpCode::JumpIfFalse, InvalidIndex, switchRegister );
+            ReleaseScratchRegister();
+
+            CompileValue( pSwitchSettings->m_trueValueNodeIdx, GraphValueType::Float, resultRegister );
+            int32_t const jumpToEndIdx = Emit( ValueProgramOpCode::Jump, InvalidIndex );
+
+            SetJumpTarget( jumpToFalseIdx, GetNextInstructionIdx() );
+            CompileValue( pSwitchSettings->m_falseValueNodeIdx, GraphValueType::Float, resultRegister );
+            SetJumpTarget( jumpToEndIdx, GetNextInstructionIdx() );
+        }
+        else if ( auto pReverseSettings = GetSettingsAs<FloatReverseDirectionNode>( pSettings ) )
+        {
+            CompileValue( pReverseSettings->m_inputValueNodeIdx, GraphValueType::Float, resultRegister );
+            Emit( ValueProgramOpCode::FloatReverseDirection, resultRegister, resultRegister );
+        }
+        else if ( GetSettingsAs<AndNode>( pSettings ) != nullptr || GetSettingsAs<OrNode>( pSettings ) != nullptr )
+        {
+            // Short-circuit evaluation: each condition is evaluated into the result register and we exit as soon as the result is known
+            auto pAndSettings = GetSettingsAs<AndNode>( pSettings );
+            auto const& conditionIndices = ( pAndSettings != nullptr ) ? pAndSettings->m_conditionNodeIndices : GetSettingsAs<OrNode>( pSettings )->m_conditionNodeIndices;
+            bool const isAnd = ( pAndSettings != nullptr );
+
+            if ( conditionIndices.empty() )
+            {
+                Emit( ValueProgramOpCode::LoadConstant, resultRegister, AddConstant( Float4( isAnd ? 1.0f : 0.0f ) ) );
+            }
+            else
+            {
+                TInlineVector<int32_t, 4> jumpToEndIndices;
+                int32_t const numConditions = (int32_t) conditionIndices.size();
+                for ( int32_t i = 0; i < numConditions; i++ )
+                {
+                    CompileValue( conditionIndices[i], GraphValueType::Bool, resultRegister );
+
+                    if ( i < numConditions - 1 )
+                    {
+                        jumpToEndIndices.emplace_back( Emit( isAnd ? ValueProgramOpCode::JumpIfFalse : ValueProgramOpCode::JumpIfTrue, InvalidIndex, resultRegister ) );
+                    }
+                }
+
+                int32_t const endIdx = GetNextInstructionIdx();
+                for ( auto jumpIdx : jumpToEndIndices )
+                {
+                    SetJumpTarget( jumpIdx, endIdx );
+                }
+            }
+        }
+        else if ( auto pNotSettings = GetSettingsAs<NotNode>( pSettings ) )
+        {
+            CompileValue( pNotSettings->m_inputValueNodeIdx, GraphValueType::Bool, resultRegister );
+            Emit( ValueProgramOpCode::BoolNot, resultRegister, resultRegister );
+        }
+        else if ( auto pInfoSettings = GetSettingsAs<VectorInfoNode>( pSettings ) )
+        {
+            CompileValue( pInfoSettings->m_inputValueNodeIdx, GraphValueType::Vector, resultRegister );
+            Emit( ValueProgramOpCode::VectorInfo, resultRegister, resultRegister, (int32_t) pInfoSettings->m_desiredInfo );
+        }
+        else if ( auto pNegateSettings = GetSettingsAs<VectorNegateNode>( pSettings ) )
+        {
+            CompileValue( pNegateSettings->m_inputValueNodeIdx, GraphValueType::Vector, resultRegister );
+            Emit( ValueProgramOpCode::VectorNegate, resultRegister, resultRegister );
+        }
+        else
+        {
+            EE_UNREACHABLE_CODE();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    int32_t ValueProgramCompiler::AllocateScratchRegister()
+    {
+        int32_t const registerIdx = m_firstScratchRegister + m_numUsedScratchRegisters;
+        m_numUsedScratchRegisters++;
+        m_maxUsedScratchRegisters = Math::Max( m_maxUsedScratchRegisters, m_numUsedScratchRegisters );
+        return registerIdx;
+    }
+
+    void ValueProgramCompiler::ReleaseScratchRegister()
+    {
+        EE_ASSERT( m_numUsedScratchRegisters > 0 );
+        m_numUsedScratchRegisters--;
+    }
+
+    int32_t ValueProgramCompiler::AddConstant( Float4 const& constant )
+    {
+        auto& constants = m_pPrograms->m_constants;
+        int32_t const numConstants = (int32_t) constants.size();
+        for ( int32_t i = 0; i < numConstants; i++ )
+        {
+            if ( constants[i] == constant )
+            {
+                return i;
+            }
+        }
+
+        constants.emplace_back( constant );
+        return numConstants;
+    }
+
+    int32_t ValueProgramCompiler::Emit( ValueProgramOpCode opCode, int32_t result, int32_t operandA, int32_t operandB, int32_t operandC )
+    {
+        if ( result > g_maxIndexValue || operandA > g_maxIndexValue || operandB > g_maxIndexValue || operandC > g_maxIndexValue )
+        {
+            m_limitsExceeded = true;
+        }
+
+        int32_t const instructionIdx = GetNextInstructionIdx();
+        m_pPrograms->m_instructions.emplace_back( opCode, (int16_t) result, (int16_t) operandA, (int16_t) operandB, (int16_t) operandC );
+        return instructionIdx;
+    }
+
+    void ValueProgramCompiler::SetJumpTarget( int32_t jumpInstructionIdx, int32_t targetInstructionIdx )
+    {
+        if ( targetInstructionIdx > g_maxIndexValue )
+        {
+            m_limitsExceeded = true;
+            return;
+        }
+
+        auto& instruction = m_pPrograms->m_instructions[m_programStartIdx + jumpInstructionIdx];
+        if ( instruction.m_opCode == ValueProgramOpCode::Jump )
+        {
+            instruction.m_operandA = (int16_t) targetInstructionIdx;
+        }
+        else
+        {
+            EE_ASSERT( instruction.m_opCode == ValueProgramOpCode::JumpIfTrue || instruction.m_opCode == ValueProgramOpCode::JumpIfFalse );
+            instruction.m_operandB = (int16_t) targetInstructionIdx;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_ValueProgram.h"
+
+//-------------------------------------------------------------------------
+// Value Program Compiler
+//-------------------------------------------------------------------------
+// Flattens the stateless value node DAGs of a compiled graph into register based value programs
+// A program is created for every flattenable node that is not itself an input of another flattenable node
+// Inputs that are shared between multiple programs are inlined into each of them, this is fine since the flattened nodes have no state
+
+namespace EE::Animation
+{
+    class ValueProgramCompiler
+    {
+    public:
+
+        ValueProgramCompiler( TVector<GraphNode::Settings*> const& nodeSettings );
+
+        // Compile all the value programs for the graph
+        // Returns false if the programs exceed the supported limits, in that case the output is cleared and the graph will use the regular node evaluation
+        bool Compile( GraphValuePrograms& outPrograms );
+
+    private:
+
+        bool CanBeFlattened( GraphNode::Settings const* pSettings ) const;
+        void GetInputNodeIndices( GraphNode::Settings const* pSettings, TInlineVector<int16_t, 4>& outIndices ) const;
+        GraphValueType GetResultType( GraphNode::Settings const* pSettings ) const;
+
+        // Emit the instructions to get the value of the specified node into the result register
+        void CompileValue( int16_t nodeIdx, GraphValueType valueType, int32_t resultRegister );
+
+        // Emit the instructions to calculate the result of a flattenable node into the result register
+        void CompileNode( GraphNode::Settings const* pSettings, int32_t resultRegister );
+
+        // Scratch registers are allocated like a stack from the current program's own scratch range
+        int32_t AllocateScratchRegister();
+        void ReleaseScratchRegister();
+
+        int32_t AddConstant( Float4 const& constant );
+        int32_t Emit( ValueProgramOpCode opCode, int32_t result, int32_t operandA = InvalidIndex, int32_t operandB = InvalidIndex, int32_t operandC = InvalidIndex );
+        inline int32_t GetNextInstructionIdx() const { return int32_t( m_pPrograms->m_instructions.size() - m_programStartIdx ); }
+        void SetJumpTarget( int32_t jumpInstructionIdx, int32_t targetInstructionIdx );
+
+    private:
+
+        TVector<GraphNode::Settings*> const&        m_nodeSettings;
+        GraphValuePrograms*                         m_pPrograms = nullptr;
+        size_t                                      m_programStartIdx = 0;
+        int32_t                                     m_firstScratchRegister = 0;
+        int32_t                                     m_numUsedScratchRegisters = 0;
+        int32_t                                     m_maxUsedScratchRegisters = 0;
+        bool                                        m_limitsExceeded = false;
+    };
+}
\ No newline at end of file
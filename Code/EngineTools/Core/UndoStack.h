@@ -48,6 +48,9 @@ namespace EE
         // Redoes the last action - returns the action that we redid
         IUndoableAction const* Redo();
 
+        // Get the most recently recorded action (i.e. the action that would be undone next)
+        inline IUndoableAction* GetLastRecordedAction() { return m_recordedActions.empty() ? nullptr : m_recordedActions.back(); }
+
         //-------------------------------------------------------------------------
 
         // Register a new action, this transfers ownership of the action memory to the stack
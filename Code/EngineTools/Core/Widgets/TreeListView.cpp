@@ -105,15 +105,18 @@ namespace EE
         return pFoundItem;
     }
 
-    void TreeListViewItem::UpdateVisibility( TFunction<bool( TreeListViewItem const* pItem )> const& isVisibleFunction, bool showParentItemsWithNoVisibleChildren )
+    bool TreeListViewItem::UpdateVisibility( TFunction<bool( TreeListViewItem const* pItem )> const& isVisibleFunction, bool showParentItemsWithNoVisibleChildren, TVector<TreeListViewItem*>* pOutChangedItems )
     {
+        bool const wasVisible = m_isVisible;
+        bool visibilityChanged = false;
+
         if ( HasChildren() )
         {
             // Always update child visibility before our own - this allows clients to affect our visibility based on our children's visibility
             bool hasVisibleChild = false;
             for ( auto& pChild : m_children )
             {
-                pChild->UpdateVisibility( isVisibleFunction );
+                visibilityChanged |= pChild->UpdateVisibility( isVisibleFunction, showParentItemsWithNoVisibleChildren, pOutChangedItems );
                 if ( pChild->IsVisible() )
                 {
                     hasVisibleChild = true;
@@ -134,6 +137,18 @@ namespace EE
         {
             m_isVisible = isVisibleFunction( this );
         }
+
+        if ( wasVisible != m_isVisible )
+        {
+            visibilityChanged = true;
+
+            if ( pOutChangedItems != nullptr )
+            {
+                pOutChangedItems->emplace_back( this );
+            }
+        }
+
+        return visibilityChanged;
     }
 
     //-------------------------------------------------------------------------
@@ -150,6 +165,18 @@ namespace EE
             return &m_rootItem;
         }
 
+        // Try the visual tree first
+        if ( m_visualTreeState == VisualTreeState::UpToDate )
+        {
+            int32_t const visualTreeIdx = GetVisualTreeIndex( uniqueID );
+            if ( visualTreeIdx != InvalidIndex )
+            {
+                return m_visualTree[visualTreeIdx].m_pItem;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
         auto SearchPredicate = [uniqueID] ( TreeListViewItem const* pItem )
         {
             return pItem->GetUniqueID() == uniqueID;
@@ -163,29 +190,128 @@ namespace EE
     {
         EE_ASSERT( m_rootItem.GetUniqueID() != uniqueID );
 
+        TreeListViewItem* pItemToDestroy = FindItem( uniqueID );
+        EE_ASSERT( pItemToDestroy != nullptr && pItemToDestroy->m_pParent != nullptr );
+        TreeListViewItem* pParentItem = pItemToDestroy->m_pParent;
+
         // Remove from visual tree
         //-------------------------------------------------------------------------
+        // If the parent loses its last child, it moves from the branch items to the leaf items of its siblings
+        // In that case we remove the parent's rows and re-add the parent at its new position once the item is destroyed
+
+        bool const parentBecomesLeaf = ( pParentItem != &m_rootItem && pParentItem->m_children.size() == 1 );
 
-        for ( auto i = 0; i < m_visualTree.size(); i++ )
+        if ( m_visualTreeState == VisualTreeState::UpToDate )
         {
-            if ( m_visualTree[i].m_pItem->GetUniqueID() == uniqueID )
+            RemoveItemFromVisualTree( parentBecomesLeaf ? pParentItem : pItemToDestroy );
+        }
+
+        // Clear any references to the destroyed items
+        //-------------------------------------------------------------------------
+
+        auto IsDestroyedItem = [pItemToDestroy] ( TreeListViewItem const* pItem )
+        {
+            for ( TreeListViewItem const* pCurrentItem = pItem; pCurrentItem != nullptr; pCurrentItem = pCurrentItem->m_pParent )
             {
-                m_visualTree.erase( m_visualTree.begin() + i );
-                break;
+                if ( pCurrentItem == pItemToDestroy )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        };
+
+        if ( m_pItemWithChangedExpansion != nullptr && IsDestroyedItem( m_pItemWithChangedExpansion ) )
+        {
+            m_pItemWithChangedExpansion = nullptr;
+        }
+
+        if ( m_pActiveItem != nullptr && IsDestroyedItem( m_pActiveItem ) )
+        {
+            m_pActiveItem = nullptr;
+            m_onActiveItemChanged.Execute();
+        }
+
+        bool selectionChanged = false;
+        for ( int32_t i = (int32_t) m_selection.size() - 1; i >= 0; i-- )
+        {
+            if ( IsDestroyedItem( m_selection[i] ) )
+            {
+                m_selection.erase( m_selection.begin() + i );
+                selectionChanged = true;
             }
         }
 
+        if ( selectionChanged )
+        {
+            NotifySelectionChanged();
+        }
+
         // Remove for regular tree
         //-------------------------------------------------------------------------
 
-        auto SearchPredicate = [uniqueID] ( TreeListViewItem const* pItem )
+        pParentItem->DestroyChild( uniqueID );
+
+        if ( parentBecomesLeaf && m_visualTreeState == VisualTreeState::UpToDate )
         {
-            return pItem->FindChild( uniqueID ) != nullptr;
-        };
+            AddItemToVisualTree( pParentItem );
+        }
+    }
+
+    void TreeListView::SetItemExpanded( TreeListViewItem* pItem, bool isExpanded )
+    {
+        EE_ASSERT( pItem != nullptr );
 
-        auto pFoundParentItem = m_rootItem.SearchChildren( SearchPredicate );
-        EE_ASSERT( pFoundParentItem != nullptr );
-        pFoundParentItem->DestroyChild( uniqueID );
+        if ( pItem->IsExpanded() == isExpanded )
+        {
+            return;
+        }
+
+        pItem->SetExpanded( isExpanded );
+        OnItemExpansionChanged( pItem );
+    }
+
+    void TreeListView::UpdateItemVisibility( TFunction<bool( TreeListViewItem const* pItem )> const& isVisibleFunction, bool showParentItemsWithNoVisibleChildren )
+    {
+        // A rebuild is pending so the new visibility will be picked up then
+        if ( m_visualTreeState != VisualTreeState::UpToDate )
+        {
+            m_rootItem.UpdateVisibility( isVisibleFunction, showParentItemsWithNoVisibleChildren );
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        TVector<TreeListViewItem*> changedItems;
+        m_rootItem.UpdateVisibility( isVisibleFunction, showParentItemsWithNoVisibleChildren, &changedItems );
+
+        if ( (int32_t) changedItems.size() > s_maxIncrementalVisibilityChanges )
+        {
+            RefreshVisualState();
+            return;
+        }
+
+        // Adding an item adds its visible subtree, so items might already have been added along with one of their parents
+        for ( auto pItem : changedItems )
+        {
+            if ( pItem == &m_rootItem )
+            {
+                continue;
+            }
+
+            if ( pItem->IsVisible() )
+            {
+                if ( GetVisualTreeIndex( pItem->GetUniqueID() ) == InvalidIndex )
+                {
+                    AddItemToVisualTree( pItem );
+                }
+            }
+            else
+            {
+                RemoveItemFromVisualTree( pItem );
+            }
+        }
     }
 
     void TreeListView::RebuildTree( bool maintainExpansionAndSelection )
@@ -230,6 +356,9 @@ namespace EE
         m_rootItem.DestroyChildren();
         m_rootItem.SetExpanded( true );
 
+        // The visual tree now references destroyed items, this also prevents any incremental updates while rebuilding
+        RefreshVisualState();
+
         // Rebuild Tree
         //-------------------------------------------------------------------------
 
@@ -269,7 +398,7 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
-    void TreeListView::TryAddItemToVisualTree( TreeListViewItem* pItem, int32_t hierarchyLevel )
+    void TreeListView::TryAddItemToVisualTree( TreeListViewItem* pItem, int32_t hierarchyLevel, TVector<VisualTreeItem>& outVisualItems ) const
     {
         EE_ASSERT( pItem != nullptr );
         EE_ASSERT( hierarchyLevel >= 0 );
@@ -281,28 +410,33 @@ namespace EE
             return;
         }
 
-        m_visualTree.emplace_back( pItem, hierarchyLevel );
+        outVisualItems.emplace_back( pItem, hierarchyLevel );
 
         //-------------------------------------------------------------------------
 
         if ( pItem->IsExpanded() )
         {
-            // Always add branch items first
-            for ( auto& pChildItem : pItem->m_children )
+            AddChildrenToVisualTree( pItem, hierarchyLevel + 1, outVisualItems );
+        }
+    }
+
+    void TreeListView::AddChildrenToVisualTree( TreeListViewItem* pItem, int32_t childHierarchyLevel, TVector<VisualTreeItem>& outVisualItems ) const
+    {
+        // Always add branch items first
+        for ( auto& pChildItem : pItem->m_children )
+        {
+            if ( pChildItem->HasChildren() )
             {
-                if ( pChildItem->HasChildren() )
-                {
-                    TryAddItemToVisualTree( pChildItem, hierarchyLevel + 1 );
-                }
+                TryAddItemToVisualTree( pChildItem, childHierarchyLevel, outVisualItems );
             }
+        }
 
-            // Add leaf items last
-            for ( auto& pChildItem : pItem->m_children )
+        // Add leaf items last
+        for ( auto& pChildItem : pItem->m_children )
+        {
+            if ( !pChildItem->HasChildren() )
             {
-                if ( !pChildItem->HasChildren() )
-                {
-                    TryAddItemToVisualTree( pChildItem, hierarchyLevel + 1 );
-                }
+                TryAddItemToVisualTree( pChildItem, childHierarchyLevel, outVisualItems );
             }
         }
     }
@@ -314,39 +448,252 @@ namespace EE
         //-------------------------------------------------------------------------
 
         m_visualTree.clear();
+        m_visualTreeIndices.clear();
+        m_firstDirtyVisualTreeIdx = 0;
+        m_pItemWithChangedExpansion = nullptr;
 
-        // Always add branch items first
-        for ( auto& pChildItem : m_rootItem.m_children )
+        AddChildrenToVisualTree( &m_rootItem, 0, m_visualTree );
+
+        //-------------------------------------------------------------------------
+
+        // Reset view
+        if ( m_visualTreeState == VisualTreeState::NeedsRebuildAndViewReset )
         {
-            if ( pChildItem->HasChildren() )
+            m_resetScrollPosition = true;
+        }
+
+        m_visualTreeState = VisualTreeState::UpToDate;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void TreeListView::UpdateVisualTreeIndices()
+    {
+        int32_t const numVisualItems = (int32_t) m_visualTree.size();
+        for ( int32_t i = m_firstDirtyVisualTreeIdx; i < numVisualItems; i++ )
+        {
+            m_visualTreeIndices[m_visualTree[i].m_pItem->GetUniqueID()] = i;
+        }
+
+        m_firstDirtyVisualTreeIdx = numVisualItems;
+    }
+
+    int32_t TreeListView::GetVisualTreeIndex( uint64_t uniqueID )
+    {
+        EE_ASSERT( m_visualTreeState == VisualTreeState::UpToDate );
+
+        UpdateVisualTreeIndices();
+
+        auto iter = m_visualTreeIndices.find( uniqueID );
+        return ( iter != m_visualTreeIndices.end() ) ? iter->second : InvalidIndex;
+    }
+
+    int32_t TreeListView::GetVisualSubtreeEndIndex( int32_t visualTreeIdx ) const
+    {
+        EE_ASSERT( visualTreeIdx >= 0 && visualTreeIdx < (int32_t) m_visualTree.size() );
+
+        int32_t const hierarchyLevel = m_visualTree[visualTreeIdx].m_hierarchyLevel;
+        int32_t const numVisualItems = (int32_t) m_visualTree.size();
+
+        int32_t endIdx = visualTreeIdx + 1;
+        while ( endIdx < numVisualItems && m_visualTree[endIdx].m_hierarchyLevel > hierarchyLevel )
+        {
+            endIdx++;
+        }
+
+        return endIdx;
+    }
+
+    void TreeListView::InsertVisualItems( int32_t insertionIdx, TVector<VisualTreeItem> const& visualItems )
+    {
+        EE_ASSERT( insertionIdx >= 0 && insertionIdx <= (int32_t) m_visualTree.size() );
+
+        if ( visualItems.empty() )
+        {
+            return;
+        }
+
+        m_visualTree.insert( m_visualTree.begin() + insertionIdx, visualItems.begin(), visualItems.end() );
+        m_firstDirtyVisualTreeIdx = Math::Min( m_firstDirtyVisualTreeIdx, insertionIdx );
+    }
+
+    void TreeListView::RemoveVisualItems( int32_t startIdx, int32_t endIdx )
+    {
+        EE_ASSERT( startIdx >= 0 && startIdx <= endIdx && endIdx <= (int32_t) m_visualTree.size() );
+
+        if ( startIdx == endIdx )
+        {
+            return;
+        }
+
+        for ( int32_t i = startIdx; i < endIdx; i++ )
+        {
+            m_visualTreeIndices.erase( m_visualTree[i].m_pItem->GetUniqueID() );
+        }
+
+        m_visualTree.erase( m_visualTree.begin() + startIdx, m_visualTree.begin() + endIdx );
+        m_firstDirtyVisualTreeIdx = Math::Min( m_firstDirtyVisualTreeIdx, startIdx );
+    }
+
+    int32_t TreeListView::GetVisualInsertionIndex( TreeListViewItem const* pItem, int32_t parentVisualTreeIdx )
+    {
+        EE_ASSERT( pItem != nullptr && pItem->m_pParent != nullptr );
+
+        // Siblings are laid out branch items first and leaf items last, in child order
+        // So the item goes right after the subtree of the closest preceding sibling (in that order) that is in the visual tree
+        TVector<TreeListViewItem*> const& siblings = pItem->m_pParent->m_children;
+        int32_t const itemIdx = VectorFindIndex( siblings, const_cast<TreeListViewItem*>( pItem ) );
+        EE_ASSERT( itemIdx != InvalidIndex );
+
+        auto GetSiblingSubtreeEndIndex = [this] ( TreeListViewItem const* pSibling ) -> int32_t
+        {
+            if ( !pSibling->IsVisible() )
+            {
+                return InvalidIndex;
+            }
+
+            int32_t const siblingVisualTreeIdx = GetVisualTreeIndex( pSibling->GetUniqueID() );
+            return ( siblingVisualTreeIdx != InvalidIndex ) ? GetVisualSubtreeEndIndex( siblingVisualTreeIdx ) : InvalidIndex;
+        };
+
+        // Preceding siblings of the same kind
+        bool const isBranchItem = pItem->HasChildren();
+        for ( int32_t i = itemIdx - 1; i >= 0; i-- )
+        {
+            if ( siblings[i]->HasChildren() == isBranchItem )
             {
-                TryAddItemToVisualTree( pChildItem, 0 );
+                int32_t const subtreeEndIdx = GetSiblingSubtreeEndIndex( siblings[i] );
+                if ( subtreeEndIdx != InvalidIndex )
+                {
+                    return subtreeEndIdx;
+                }
             }
         }
 
-        // Add leaf items last
-        for ( auto& pChildItem : m_rootItem.m_children )
+        // Leaf items come after all the branch items
+        if ( !isBranchItem )
         {
-            if ( !pChildItem->HasChildren() )
+            for ( int32_t i = (int32_t) siblings.size() - 1; i >= 0; i-- )
             {
-                TryAddItemToVisualTree( pChildItem, 0 );
+                if ( siblings[i]->HasChildren() )
+                {
+                    int32_t const subtreeEndIdx = GetSiblingSubtreeEndIndex( siblings[i] );
+                    if ( subtreeEndIdx != InvalidIndex )
+                    {
+                        return subtreeEndIdx;
+                    }
+                }
             }
         }
 
-        m_estimatedRowHeight = -1.0f;
-        m_estimatedTreeHeight = -1.0f;
+        return parentVisualTreeIdx + 1;
+    }
+
+    void TreeListView::AddItemToVisualTree( TreeListViewItem* pItem )
+    {
+        EE_ASSERT( m_visualTreeState == VisualTreeState::UpToDate );
+        EE_ASSERT( pItem != nullptr && pItem->m_pParent != nullptr );
+
+        // Items are only in the visual tree if their parent is expanded and in the visual tree
+        TreeListViewItem* pParentItem = pItem->m_pParent;
+        int32_t parentVisualTreeIdx = InvalidIndex;
+        int32_t hierarchyLevel = 0;
+
+        if ( pParentItem != &m_rootItem )
+        {
+            if ( !pParentItem->IsExpanded() )
+            {
+                return;
+            }
+
+            parentVisualTreeIdx = GetVisualTreeIndex( pParentItem->GetUniqueID() );
+            if ( parentVisualTreeIdx == InvalidIndex )
+            {
+                return;
+            }
+
+            hierarchyLevel = m_visualTree[parentVisualTreeIdx].m_hierarchyLevel + 1;
+        }
 
         //-------------------------------------------------------------------------
 
-        // Reset view
-        if ( m_visualTreeState == VisualTreeState::NeedsRebuildAndViewReset )
+        TVector<VisualTreeItem> visualItems;
+        TryAddItemToVisualTree( pItem, hierarchyLevel, visualItems );
+        if ( !visualItems.empty() )
         {
-            m_firstVisibleRowItemIdx = 0;
+            InsertVisualItems( GetVisualInsertionIndex( pItem, parentVisualTreeIdx ), visualItems );
         }
+    }
 
-        m_visualTreeState = VisualTreeState::UpToDate;
+    void TreeListView::RemoveItemFromVisualTree( TreeListViewItem const* pItem )
+    {
+        EE_ASSERT( m_visualTreeState == VisualTreeState::UpToDate );
+        EE_ASSERT( pItem != nullptr );
+
+        int32_t const visualTreeIdx = GetVisualTreeIndex( pItem->GetUniqueID() );
+        if ( visualTreeIdx != InvalidIndex )
+        {
+            RemoveVisualItems( visualTreeIdx, GetVisualSubtreeEndIndex( visualTreeIdx ) );
+        }
     }
 
+    void TreeListView::InsertItemIntoVisualTree( TreeListViewItem* pItem )
+    {
+        EE_ASSERT( pItem != nullptr && pItem->m_pParent != nullptr );
+
+        // A rebuild is pending so the item will be picked up then
+        if ( m_visualTreeState != VisualTreeState::UpToDate )
+        {
+            return;
+        }
+
+        // If the parent just got its first child, it moves from the leaf items to the branch items of its siblings
+        // The parent's row is moved to its new position, this also adds the new item if the parent is expanded
+        TreeListViewItem* pParentItem = pItem->m_pParent;
+        if ( pParentItem != &m_rootItem && pParentItem->m_children.size() == 1 )
+        {
+            RemoveItemFromVisualTree( pParentItem );
+            AddItemToVisualTree( pParentItem );
+        }
+        else
+        {
+            AddItemToVisualTree( pItem );
+        }
+    }
+
+    void TreeListView::OnItemExpansionChanged( TreeListViewItem* pItem )
+    {
+        EE_ASSERT( pItem != nullptr );
+
+        if ( m_visualTreeState != VisualTreeState::UpToDate )
+        {
+            return;
+        }
+
+        int32_t const visualTreeIdx = GetVisualTreeIndex( pItem->GetUniqueID() );
+        if ( visualTreeIdx == InvalidIndex )
+        {
+            return;
+        }
+
+        int32_t const subtreeEndIdx = GetVisualSubtreeEndIndex( visualTreeIdx );
+        if ( pItem->IsExpanded() )
+        {
+            if ( subtreeEndIdx == visualTreeIdx + 1 )
+            {
+                TVector<VisualTreeItem> visualItems;
+                AddChildrenToVisualTree( pItem, m_visualTree[visualTreeIdx].m_hierarchyLevel + 1, visualItems );
+                InsertVisualItems( visualTreeIdx + 1, visualItems );
+            }
+        }
+        else
+        {
+            RemoveVisualItems( visualTreeIdx + 1, subtreeEndIdx );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void TreeListView::OnItemDoubleClickedInternal( TreeListViewItem* pItem )
     {
         // Double click
@@ -412,8 +759,24 @@ namespace EE
         {
             if ( m_multiSelectionAllowed && ImGui::GetIO().KeyShift )
             {
-                // TODO
-                // Find selection bounds and bulk select everything between them
+                // Select everything in the visual tree between the last selected item and this one - the last selected item remains the anchor
+                bool const canUseVisualTree = ( m_visualTreeState == VisualTreeState::UpToDate ) && !m_selection.empty();
+                int32_t const itemIdx = canUseVisualTree ? GetVisualTreeIndex( pItem->GetUniqueID() ) : InvalidIndex;
+                int32_t const anchorIdx = canUseVisualTree ? GetVisualTreeIndex( m_selection.back()->GetUniqueID() ) : InvalidIndex;
+                if ( itemIdx == InvalidIndex || anchorIdx == InvalidIndex )
+                {
+                    SelectItem( pItem );
+                }
+                else
+                {
+                    m_selection.clear();
+                    int32_t const step = ( anchorIdx >= itemIdx ) ? 1 : -1;
+                    for ( int32_t i = itemIdx; i != anchorIdx + step; i += step )
+                    {
+                        m_selection.emplace_back( m_visualTree[i].m_pItem );
+                    }
+                    NotifySelectionChanged();
+                }
             }
             else  if ( m_multiSelectionAllowed && ImGui::GetIO().KeyCtrl )
             {
@@ -443,7 +806,7 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
-    void TreeListView::DrawVisualItem( VisualTreeItem& visualTreeItem )
+    void TreeListView::DrawVisualItem( VisualTreeItem const& visualTreeItem )
     {
         EE_ASSERT( visualTreeItem.m_pItem != nullptr && visualTreeItem.m_hierarchyLevel >= 0 );
 
@@ -516,10 +879,11 @@ namespace EE
             ImGui::TreePop();
         }
 
+        // The visual tree is updated once we are done drawing it
         if ( pItem->HasChildren() && pItem->IsExpanded() != newExpansionState )
         {
             pItem->SetExpanded( newExpansionState );
-            m_visualTreeState = VisualTreeState::NeedsRebuild;
+            m_pItemWithChangedExpansion = pItem;
         }
 
         // Handle selection
@@ -604,89 +968,46 @@ namespace EE
         ImGui::PushStyleVar( ImGuiStyleVar_ItemSpacing, ImVec2( ImGui::GetStyle().ItemSpacing.x, 0 ) ); // Ensure table border and scrollbar align
         ImGui::BeginChild( "TreeViewChild", ImVec2( 0, 0 ), false, 0 );
         {
-            constexpr ImGuiTableFlags const tableFlags = ImGuiTableFlags_BordersV | ImGuiTableFlags_NoPadOuterX | ImGuiTableFlags_BordersOuterH | ImGuiTableFlags_NoBordersInBody | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable;
-            float const totalVerticalSpaceAvailable = ImGui::GetContentRegionAvail().y;
-            float const maxVerticalScrollPosition = ImGui::GetScrollMaxY();
-
-            //-------------------------------------------------------------------------
-
-            // Calculate the required height in pixels for all rows based on the height of the first row. 
-            // We only render a single row here (so we dont bust the imgui index buffer limits for a single tree) - At low frame rates this will flicker
-            if ( m_estimatedTreeHeight < 0 )
+            if ( m_resetScrollPosition )
             {
-                if ( ImGui::BeginTable( "TreeViewTable", GetNumExtraColumns() + 1, tableFlags, ImVec2( ImGui::GetContentRegionAvail().x - ImGui::GetStyle().ItemSpacing.x / 2, 0 ) ) )
-                {
-                    ImGui::TableSetupColumn( "Label", ImGuiTableColumnFlags_NoHide );
-                    SetupExtraColumnHeaders();
-
-                    ImVec2 const prevCursorPos = ImGui::GetCursorPos();
-                    DrawVisualItem( m_visualTree[0] );
-                    ImGui::TableNextRow();
-                    ImVec2 const cursorPos = ImGui::GetCursorPos();
-                    m_estimatedRowHeight = cursorPos.y - prevCursorPos.y;
-
-                    ImGui::EndTable();
-                }
-
-                // Draw a dummy to fake the real size so as to not completely reset scrollbar position
-                //-------------------------------------------------------------------------
-
-                m_estimatedTreeHeight = float( m_visualTree.size() ) * m_estimatedRowHeight;
-                ImGui::Dummy( ImVec2( -1, m_estimatedTreeHeight - ImGui::GetCursorPos().y ) );
-
-                // Update scrollbar position
-                //-------------------------------------------------------------------------
-
-                m_firstVisibleRowItemIdx = Math::Clamp( m_firstVisibleRowItemIdx, 0, int32_t( m_visualTree.size() - 1 ) );
-                m_maintainVisibleRowIdx = true;
+                ImGui::SetScrollY( 0.0f );
+                m_resetScrollPosition = false;
             }
-            else // Draw clipped table
-            {
-                float const numRowIndices = float( m_visualTree.size() ) - 1;
-                float currentVerticalScrollPosition = ImGui::GetScrollY();
-
-                // If we want to maintain the current visible set of data, update the scroll bar position to keep the same first visible item
-                if ( m_maintainVisibleRowIdx )
-                {
-                    currentVerticalScrollPosition = ( m_firstVisibleRowItemIdx / numRowIndices * maxVerticalScrollPosition );
-                    ImGui::SetScrollY( currentVerticalScrollPosition );
-                    m_maintainVisibleRowIdx = false;
-                }
-
-                // Update visible item based on scrollbar position
-                m_firstVisibleRowItemIdx = (int32_t) Math::Round( ( currentVerticalScrollPosition / maxVerticalScrollPosition ) * numRowIndices );
-                m_firstVisibleRowItemIdx = Math::Clamp( m_firstVisibleRowItemIdx, 0, (int32_t) m_visualTree.size() - 1 );
 
-                // Calculate draw range
-                bool shouldDrawDummyRow = false;
-                int32_t const maxNumDrawableRows = (int32_t) Math::Floor( totalVerticalSpaceAvailable / m_estimatedRowHeight );
-                int32_t const itemsToDrawStartIdx = m_firstVisibleRowItemIdx;
-                int32_t itemsToDrawEndIdx = Math::Min( itemsToDrawStartIdx + maxNumDrawableRows, (int32_t) m_visualTree.size() - 1 );
+            //-------------------------------------------------------------------------
 
-                // Draw initial dummy to adjust scrollbar position
-                ImGui::Dummy( ImVec2( -1, currentVerticalScrollPosition ) );
+            constexpr ImGuiTableFlags const tableFlags = ImGuiTableFlags_BordersV | ImGuiTableFlags_NoPadOuterX | ImGuiTableFlags_BordersOuterH | ImGuiTableFlags_NoBordersInBody | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable;
+            if ( ImGui::BeginTable( "TreeViewTable", GetNumExtraColumns() + 1, tableFlags, ImVec2( ImGui::GetContentRegionAvail().x - ImGui::GetStyle().ItemSpacing.x / 2, 0 ) ) )
+            {
+                ImGui::TableSetupColumn( "Label", ImGuiTableColumnFlags_WidthStretch );
+                SetupExtraColumnHeaders();
 
-                // Draw table rows
-                if ( ImGui::BeginTable( "Tree View Browser", GetNumExtraColumns() + 1, tableFlags, ImVec2(ImGui::GetContentRegionAvail().x - ImGui::GetStyle().ItemSpacing.x / 2, 0)) )
+                // Only the rows in view are laid out and drawn, the clipper uses the height of the first row to space out the rest
+                ImGuiListClipper clipper;
+                clipper.Begin( (int32_t) m_visualTree.size() );
+                while ( clipper.Step() )
                 {
-                    ImGui::TableSetupColumn( "Label", ImGuiTableColumnFlags_WidthStretch );
-                    SetupExtraColumnHeaders();
-
-                    for ( int32_t i = itemsToDrawStartIdx; i <= itemsToDrawEndIdx; i++ )
+                    for ( int32_t i = clipper.DisplayStart; i < clipper.DisplayEnd; i++ )
                     {
                         DrawVisualItem( m_visualTree[i] );
                     }
-
-                    ImGui::EndTable();
                 }
 
-                // Draw final dummy to maintain scrollbar position
-                ImGui::Dummy( ImVec2( -1, m_estimatedTreeHeight - ImGui::GetCursorPos().y ) );
+                ImGui::EndTable();
             }
         }
         ImGui::EndChild();
         ImGui::PopStyleVar();
 
+        // Apply any expansion changes now that we are no longer iterating over the visual tree
+        //-------------------------------------------------------------------------
+
+        if ( m_pItemWithChangedExpansion != nullptr )
+        {
+            OnItemExpansionChanged( m_pItemWithChangedExpansion );
+            m_pItemWithChangedExpansion = nullptr;
+        }
+
         //-------------------------------------------------------------------------
 
         DrawAdditionalUI();
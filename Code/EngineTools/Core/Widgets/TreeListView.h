@@ -66,8 +66,9 @@ namespace EE
         inline bool IsVisible() const { return m_isVisible; }
         inline bool HasVisibleChildren() const { return !m_children.empty(); }
 
-        // Update visibility for this branch based on a user-supplied delegate
-        void UpdateVisibility( TFunction<bool( TreeListViewItem const* pItem )> const& isVisibleFunction, bool showParentItemsWithNoVisibleChildren = false );
+        // Update visibility for this branch based on a user-supplied delegate, returns true if the visibility of any item in this branch changed
+        // Optionally returns the list of items whose visibility changed (children are always listed before their parents)
+        bool UpdateVisibility( TFunction<bool( TreeListViewItem const* pItem )> const& isVisibleFunction, bool showParentItemsWithNoVisibleChildren = false, TVector<TreeListViewItem*>* pOutChangedItems = nullptr );
 
         // Drag and drop
         //-------------------------------------------------------------------------
@@ -79,6 +80,7 @@ namespace EE
         // Hierarchy
         //-------------------------------------------------------------------------
 
+        inline TreeListViewItem* GetParent() const { return m_pParent; }
         inline bool HasChildren() const { return !m_children.empty(); }
         inline TVector<TreeListViewItem*> const& GetChildren() { return m_children; }
         inline TVector<TreeListViewItem*> const& GetChildren() const { return m_children; }
@@ -90,6 +92,7 @@ namespace EE
             static_assert( std::is_base_of<TreeListViewItem, T>::value, "T must derive from TreeViewItem" );
             TreeListViewItem* pAddedItem = m_children.emplace_back( EE::New<T>( std::forward<ConstructorParams>( params )... ) );
             EE_ASSERT( pAddedItem->GetUniqueID() != 0 );
+            pAddedItem->m_pParent = this;
             return static_cast<T*>( pAddedItem );
         }
 
@@ -139,6 +142,7 @@ namespace EE
 
     protected:
 
+        TreeListViewItem*                       m_pParent = nullptr;
         TVector<TreeListViewItem*>              m_children;
         bool                                    m_isVisible = true;
         bool                                    m_isExpanded = false;
@@ -150,6 +154,9 @@ namespace EE
 
     class EE_ENGINETOOLS_API TreeListView
     {
+        // Each incremental visual tree change re-indexes the rows after it, past this many visibility changes a full rebuild is cheaper
+        constexpr static int32_t const s_maxIncrementalVisibilityChanges = 64;
+
         enum class VisualTreeState
         {
             None,
@@ -246,20 +253,32 @@ namespace EE
             m_rootItem.ForEachChildConst( function );
         }
 
-        void UpdateItemVisibility( TFunction<bool( TreeListViewItem const* pItem )> const& isVisibleFunction, bool showParentItemsWithNoVisibleChildren = false )
-        {
-            m_rootItem.UpdateVisibility( isVisibleFunction, showParentItemsWithNoVisibleChildren );
-            RefreshVisualState();
-        }
+        // Update the visibility of all items, only the rows of the items whose visibility changed are added to/removed from the visual tree
+        void UpdateItemVisibility( TFunction<bool( TreeListViewItem const* pItem )> const& isVisibleFunction, bool showParentItemsWithNoVisibleChildren = false );
 
     protected:
 
         inline int32_t GetNumItems() const { return (int32_t) m_visualTree.size(); }
 
+        // Find an item in the tree - this is O(1) for items in the visual tree
         TreeListViewItem* FindItem( uint64_t uniqueID );
 
+        // Create a new item under the specified parent (use the root item for top level items), the visual tree is updated incrementally
+        template< typename T, typename ... ConstructorParams >
+        T* CreateItem( TreeListViewItem* pParentItem, ConstructorParams&&... params )
+        {
+            EE_ASSERT( pParentItem != nullptr );
+            T* pCreatedItem = pParentItem->CreateChild<T>( std::forward<ConstructorParams>( params )... );
+            InsertItemIntoVisualTree( pCreatedItem );
+            return pCreatedItem;
+        }
+
+        // Destroy an item and all its children, the visual tree is updated incrementally
         void DestroyItem( uint64_t uniqueID );
 
+        // Set the expansion state of an item, the visual tree is updated incrementally
+        void SetItemExpanded( TreeListViewItem* pItem, bool isExpanded );
+
         //-------------------------------------------------------------------------
 
         // User overrideable function to draw any addition windows/dialogs that might be needed
@@ -300,10 +319,24 @@ namespace EE
 
         void HandleItemSelection( TreeListViewItem* pItem, bool isSelected );
 
-        void DrawVisualItem( VisualTreeItem& visualTreeItem );
-        void TryAddItemToVisualTree( TreeListViewItem* pItem, int32_t hierarchyLevel );
+        void DrawVisualItem( VisualTreeItem const& visualTreeItem );
+        void TryAddItemToVisualTree( TreeListViewItem* pItem, int32_t hierarchyLevel, TVector<VisualTreeItem>& outVisualItems ) const;
+        void AddChildrenToVisualTree( TreeListViewItem* pItem, int32_t childHierarchyLevel, TVector<VisualTreeItem>& outVisualItems ) const;
 
         void RebuildVisualTree();
+
+        // Incremental visual tree maintenance - these fall back to a full rebuild when the visual tree is not up to date
+        int32_t GetVisualTreeIndex( uint64_t uniqueID );
+        int32_t GetVisualSubtreeEndIndex( int32_t visualTreeIdx ) const;
+        void InsertVisualItems( int32_t insertionIdx, TVector<VisualTreeItem> const& visualItems );
+        void RemoveVisualItems( int32_t startIdx, int32_t endIdx );
+        int32_t GetVisualInsertionIndex( TreeListViewItem const* pItem, int32_t parentVisualTreeIdx );
+        void AddItemToVisualTree( TreeListViewItem* pItem );
+        void RemoveItemFromVisualTree( TreeListViewItem const* pItem );
+        void InsertItemIntoVisualTree( TreeListViewItem* pItem );
+        void OnItemExpansionChanged( TreeListViewItem* pItem );
+        void UpdateVisualTreeIndices();
+
         void OnItemDoubleClickedInternal( TreeListViewItem* pItem );
 
         void NotifySelectionChanged()
@@ -334,11 +367,11 @@ namespace EE
     private:
 
         TVector<VisualTreeItem>                                 m_visualTree;
+        THashMap<uint64_t, int32_t>                             m_visualTreeIndices;
+        int32_t                                                 m_firstDirtyVisualTreeIdx = 0; // Indices in the map from this index onwards are out of date
         VisualTreeState                                         m_visualTreeState = VisualTreeState::None;
-        float                                                   m_estimatedRowHeight = -1.0f;
-        float                                                   m_estimatedTreeHeight = -1.0f;
-        int32_t                                                   m_firstVisibleRowItemIdx = 0;
+        TreeListViewItem*                                       m_pItemWithChangedExpansion = nullptr;
         float                                                   m_itemControlColumnWidth = 0;
-        bool                                                    m_maintainVisibleRowIdx = false;
+        bool                                                    m_resetScrollPosition = false;
     };
 }
\ No newline at end of file
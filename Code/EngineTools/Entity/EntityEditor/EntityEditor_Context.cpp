@@ -3,23 +3,91 @@
 #include "Engine/Entity/EntitySerialization.h"
 #include "Engine/Volumes/Components/Component_Volumes.h"
 #include "System/TypeSystem/TypeRegistry.h"
+#include "System/TypeSystem/CoreTypeConversions.h"
+#include "System/Time/Time.h"
 #include "System/Log.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::EntityModel
 {
+    // Get the binary value of a property on a type instance - array element paths are not supported
+    static bool ReadPropertyValue( TypeSystem::TypeRegistry const& typeRegistry, IRegisteredType const* pTypeInstance, TypeSystem::PropertyPath const& path, Blob& outByteValue )
+    {
+        EE_ASSERT( pTypeInstance != nullptr && path.IsValid() );
+
+        TypeSystem::TypeInfo const* pTypeInfo = pTypeInstance->GetTypeInfo();
+        TypeSystem::PropertyInfo const* pPropertyInfo = nullptr;
+        void const* pPropertyAddress = pTypeInstance;
+
+        size_t const numPathElements = path.GetNumElements();
+        for ( size_t i = 0; i < numPathElements; i++ )
+        {
+            if ( pTypeInfo == nullptr || path[i].IsArrayElement() )
+            {
+                return false;
+            }
+
+            pPropertyInfo = pTypeInfo->GetPropertyInfo( path[i].m_propertyID );
+            if ( pPropertyInfo == nullptr )
+            {
+                return false;
+            }
+
+            pPropertyAddress = pPropertyInfo->GetPropertyAddress( pPropertyAddress );
+            pTypeInfo = TypeSystem::IsCoreType( pPropertyInfo->m_typeID ) ? nullptr : typeRegistry.GetTypeInfo( pPropertyInfo->m_typeID );
+        }
+
+        return TypeSystem::Conversion::ConvertNativeTypeToBinary( typeRegistry, *pPropertyInfo, pPropertyAddress, outByteValue );
+    }
+
+    static bool ContainsArrayElement( TypeSystem::PropertyPath const& path )
+    {
+        size_t const numPathElements = path.GetNumElements();
+        for ( size_t i = 0; i < numPathElements; i++ )
+        {
+            if ( path[i].IsArrayElement() )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static EntityComponent* FindComponentByName( Entity* pEntity, StringID componentName )
+    {
+        for ( auto pComponent : pEntity->GetComponents() )
+        {
+            if ( pComponent->GetName() == componentName )
+            {
+                return pComponent;
+            }
+        }
+
+        return nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+
     // Compound undoable action - handles all scene manipulation operations
-    // All operations are at the granularity of an entity, we dont manage component actions individually
+    // Structural operations are at the granularity of an entity (we snapshot and recreate the whole entity), we dont manage component actions individually
+    // Property modifications only record the changed property values and are applied in-place
     class EntityEditorUndoableAction final : public IUndoableAction
     {
-        struct SpatialState
+        // The changed property values for a single component
+        struct ComponentPropertyDelta
         {
-            StringID    m_entityName;
-            StringID    m_componentName;
-            Transform   m_transform;
+            StringID                            m_entityName;
+            StringID                            m_componentName;
+            TypeSystem::TypeDescriptor          m_valuesBefore;
+            TypeSystem::TypeDescriptor          m_valuesAfter;
+            bool                                m_requiresReload = true; // Transform changes can be applied without unloading the component
         };
 
+        // Consecutive transform manipulations of the same selection within this window are merged into a single undo step
+        constexpr static float const s_transformManipulationMergeWindow = 1.0f;
+
     public:
 
         enum Type
@@ -28,18 +96,25 @@ namespace EE::EntityModel
             CreateEntities,
             DeleteEntities,
             ModifyEntities,
-            MoveComponents,
+            ModifyProperties,
         };
 
     public:
 
-        EntityEditorUndoableAction( TypeSystem::TypeRegistry const& typeRegistry, EntityMap* pMap )
+        EntityEditorUndoableAction( TypeSystem::TypeRegistry const& typeRegistry, EntityWorld* pWorld, EntityMap* pMap )
             : m_typeRegistry( typeRegistry )
+            , m_pWorld( pWorld )
             , m_pMap( pMap )
         {
+            EE_ASSERT( m_pWorld != nullptr );
             EE_ASSERT( m_pMap != nullptr && m_pMap->IsActivated() );
         }
 
+        inline bool IsTransformManipulation() const { return m_actionType == ModifyProperties && m_isTransformManipulation; }
+
+        // Did this transform manipulation record any components
+        inline bool IsEmptyTransformManipulation() const { return IsTransformManipulation() && m_propertyDeltas.empty(); }
+
         void RecordCreate( TVector<Entity*> createdEntities )
         {
             m_actionType = Type::CreateEntities;
@@ -94,10 +169,275 @@ namespace EE::EntityModel
             }
 
             m_editedEntities.clear();
+
+            // If only property values were changed, we dont need to keep the entity snapshots around
+            if ( !m_entitiesWereDuplicated )
+            {
+                TryConvertToPropertyDeltas();
+            }
+        }
+
+        // Transform manipulation only ever modifies the local transforms of the supplied components so we only record those
+        void RecordBeginTransformManipulation( TVector<SpatialEntityComponent*> const& manipulatedComponents )
+        {
+            m_actionType = Type::ModifyProperties;
+            m_isTransformManipulation = true;
+            m_manipulationStartTime = PlatformClock::GetTime();
+
+            // A selection without any spatial components has no transforms to record
+            if ( manipulatedComponents.empty() )
+            {
+                return;
+            }
+
+            TypeSystem::PropertyPath const transformPropertyPath( "m_transform" );
+            for ( auto pComponent : manipulatedComponents )
+            {
+                auto pEntity = m_pMap->FindEntity( pComponent->GetEntityID() );
+                EE_ASSERT( pEntity != nullptr );
+
+                auto& delta = m_propertyDeltas.emplace_back();
+                delta.m_entityName = pEntity->GetName();
+                delta.m_componentName = pComponent->GetName();
+                delta.m_valuesBefore = TypeSystem::TypeDescriptor( pComponent->GetTypeID() );
+                delta.m_valuesAfter = TypeSystem::TypeDescriptor( pComponent->GetTypeID() );
+                delta.m_requiresReload = false;
+
+                auto& propertyDesc = delta.m_valuesBefore.m_properties.emplace_back();
+                propertyDesc.m_path = transformPropertyPath;
+                bool const result = ReadPropertyValue( m_typeRegistry, pComponent, transformPropertyPath, propertyDesc.m_byteValue );
+                EE_ASSERT( result );
+            }
+
+            m_manipulatedComponents = manipulatedComponents;
+        }
+
+        void RecordEndTransformManipulation()
+        {
+            EE_ASSERT( IsTransformManipulation() );
+            EE_ASSERT( m_manipulatedComponents.size() == m_propertyDeltas.size() );
+
+            int32_t const numComponents = (int32_t) m_manipulatedComponents.size();
+            for ( int32_t i = 0; i < numComponents; i++ )
+            {
+                auto& propertyDesc = m_propertyDeltas[i].m_valuesAfter.m_properties.emplace_back();
+                propertyDesc.m_path = m_propertyDeltas[i].m_valuesBefore.m_properties[0].m_path;
+                bool const result = ReadPropertyValue( m_typeRegistry, m_manipulatedComponents[i], propertyDesc.m_path, propertyDesc.m_byteValue );
+                EE_ASSERT( result );
+            }
+
+            m_manipulatedComponents.clear();
+            m_manipulationEndTime = PlatformClock::GetTime();
+        }
+
+        // Try to merge a transform manipulation that directly followed this one, returns true if the manipulation was merged
+        bool TryMergeTransformManipulation( EntityEditorUndoableAction const& nextAction )
+        {
+            if ( !IsTransformManipulation() || !nextAction.IsTransformManipulation() )
+            {
+                return false;
+            }
+
+            if ( ( nextAction.m_manipulationStartTime - m_manipulationEndTime ).ToSeconds() > s_transformManipulationMergeWindow )
+            {
+                return false;
+            }
+
+            // Only merge manipulations of the same selection
+            int32_t const numDeltas = (int32_t) m_propertyDeltas.size();
+            if ( numDeltas != (int32_t) nextAction.m_propertyDeltas.size() )
+            {
+                return false;
+            }
+
+            for ( int32_t i = 0; i < numDeltas; i++ )
+            {
+                if ( m_propertyDeltas[i].m_entityName != nextAction.m_propertyDeltas[i].m_entityName || m_propertyDeltas[i].m_componentName != nextAction.m_propertyDeltas[i].m_componentName )
+                {
+                    return false;
+                }
+            }
+
+            // Keep our initial values and take the final values of the next manipulation
+            for ( int32_t i = 0; i < numDeltas; i++ )
+            {
+                m_propertyDeltas[i].m_valuesAfter = nextAction.m_propertyDeltas[i].m_valuesAfter;
+            }
+
+            m_manipulationEndTime = nextAction.m_manipulationEndTime;
+            return true;
         }
 
     private:
 
+        // Create the property deltas from the recorded entity snapshots - fails for any structural changes (added/removed components, renames, array changes, etc...)
+        bool TryConvertToPropertyDeltas()
+        {
+            EE_ASSERT( m_actionType == ModifyEntities && !m_entitiesWereDuplicated );
+            EE_ASSERT( m_entityDescPreModification.size() == m_entityDescPostModification.size() );
+
+            TVector<ComponentPropertyDelta> propertyDeltas;
+
+            int32_t const numEntities = (int32_t) m_entityDescPreModification.size();
+            for ( int32_t i = 0; i < numEntities; i++ )
+            {
+                auto const& entityDescPre = m_entityDescPreModification[i];
+                auto const& entityDescPost = m_entityDescPostModification[i];
+
+                if ( entityDescPre.m_name != entityDescPost.m_name || entityDescPre.m_spatialParentName != entityDescPost.m_spatialParentName || entityDescPre.m_attachmentSocketID != entityDescPost.m_attachmentSocketID )
+                {
+                    return false;
+                }
+
+                if ( entityDescPre.m_systems.size() != entityDescPost.m_systems.size() || entityDescPre.m_components.size() != entityDescPost.m_components.size() )
+                {
+                    return false;
+                }
+
+                int32_t const numSystems = (int32_t) entityDescPre.m_systems.size();
+                for ( int32_t s = 0; s < numSystems; s++ )
+                {
+                    if ( entityDescPre.m_systems[s].m_typeID != entityDescPost.m_systems[s].m_typeID )
+                    {
+                        return false;
+                    }
+                }
+
+                //-------------------------------------------------------------------------
+
+                auto pEntity = m_pMap->FindEntityByName( entityDescPost.m_name );
+                EE_ASSERT( pEntity != nullptr );
+
+                int32_t const numComponents = (int32_t) entityDescPre.m_components.size();
+                for ( int32_t c = 0; c < numComponents; c++ )
+                {
+                    auto const& componentDescPre = entityDescPre.m_components[c];
+                    auto const& componentDescPost = entityDescPost.m_components[c];
+
+                    if ( componentDescPre.m_name != componentDescPost.m_name || componentDescPre.m_typeID != componentDescPost.m_typeID || componentDescPre.m_spatialParentName != componentDescPost.m_spatialParentName || componentDescPre.m_attachmentSocketID != componentDescPost.m_attachmentSocketID )
+                    {
+                        return false;
+                    }
+
+                    auto pComponent = FindComponentByName( pEntity, componentDescPost.m_name );
+                    EE_ASSERT( pComponent != nullptr );
+
+                    ComponentPropertyDelta delta;
+                    delta.m_entityName = entityDescPost.m_name;
+                    delta.m_componentName = componentDescPost.m_name;
+                    delta.m_valuesBefore = TypeSystem::TypeDescriptor( componentDescPost.m_typeID );
+                    delta.m_valuesAfter = TypeSystem::TypeDescriptor( componentDescPost.m_typeID );
+
+                    if ( !CalculatePropertyDelta( componentDescPre, componentDescPost, pComponent, delta ) )
+                    {
+                        return false;
+                    }
+
+                    if ( !delta.m_valuesAfter.m_properties.empty() )
+                    {
+                        propertyDeltas.emplace_back( eastl::move( delta ) );
+                    }
+                }
+            }
+
+            //-------------------------------------------------------------------------
+
+            m_actionType = ModifyProperties;
+            m_propertyDeltas = eastl::move( propertyDeltas );
+            m_entityDescPreModification.clear();
+            m_entityDescPostModification.clear();
+            return true;
+        }
+
+        // The descriptors only contain non-default values, so any value missing on one side is read from the relevant instance
+        bool CalculatePropertyDelta( SerializedComponentDescriptor const& componentDescPre, SerializedComponentDescriptor const& componentDescPost, EntityComponent const* pComponent, ComponentPropertyDelta& outDelta ) const
+        {
+            auto pDefaultInstance = pComponent->GetTypeInfo()->GetDefaultInstance();
+
+            // Modified values and values set from their default
+            for ( auto const& propertyPost : componentDescPost.m_properties )
+            {
+                auto pPropertyPre = componentDescPre.GetProperty( propertyPost.m_path );
+                if ( pPropertyPre != nullptr && pPropertyPre->m_byteValue == propertyPost.m_byteValue )
+                {
+                    continue;
+                }
+
+                if ( ContainsArrayElement( propertyPost.m_path ) )
+                {
+                    return false;
+                }
+
+                auto& valueBefore = outDelta.m_valuesBefore.m_properties.emplace_back();
+                valueBefore.m_path = propertyPost.m_path;
+                if ( pPropertyPre != nullptr )
+                {
+                    valueBefore.m_byteValue = pPropertyPre->m_byteValue;
+                }
+                else if ( !ReadPropertyValue( m_typeRegistry, pDefaultInstance, propertyPost.m_path, valueBefore.m_byteValue ) )
+                {
+                    return false;
+                }
+
+                auto& valueAfter = outDelta.m_valuesAfter.m_properties.emplace_back();
+                valueAfter.m_path = propertyPost.m_path;
+                valueAfter.m_byteValue = propertyPost.m_byteValue;
+            }
+
+            // Values reset to their default
+            for ( auto const& propertyPre : componentDescPre.m_properties )
+            {
+                if ( componentDescPost.GetProperty( propertyPre.m_path ) != nullptr )
+                {
+                    continue;
+                }
+
+                if ( ContainsArrayElement( propertyPre.m_path ) )
+                {
+                    return false;
+                }
+
+                auto& valueBefore = outDelta.m_valuesBefore.m_properties.emplace_back();
+                valueBefore.m_path = propertyPre.m_path;
+                valueBefore.m_byteValue = propertyPre.m_byteValue;
+
+                auto& valueAfter = outDelta.m_valuesAfter.m_properties.emplace_back();
+                valueAfter.m_path = propertyPre.m_path;
+                if ( !ReadPropertyValue( m_typeRegistry, pComponent, propertyPre.m_path, valueAfter.m_byteValue ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        void ApplyPropertyDeltas( bool applyValuesBefore )
+        {
+            for ( auto const& delta : m_propertyDeltas )
+            {
+                auto pEntity = m_pMap->FindEntityByName( delta.m_entityName );
+                EE_ASSERT( pEntity != nullptr );
+
+                auto pComponent = FindComponentByName( pEntity, delta.m_componentName );
+                EE_ASSERT( pComponent != nullptr );
+
+                if ( delta.m_requiresReload )
+                {
+                    m_pWorld->PrepareComponentForEditing( m_pMap->GetID(), pEntity->GetID(), pComponent->GetID() );
+                }
+
+                auto const& values = applyValuesBefore ? delta.m_valuesBefore : delta.m_valuesAfter;
+                values.ApplyPropertyValues( m_typeRegistry, pComponent );
+
+                // Reset the local transform to ensure that the world transform is recalculated
+                if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent ) )
+                {
+                    pSpatialComponent->SetLocalTransform( pSpatialComponent->GetLocalTransform() );
+                }
+            }
+        }
+
         virtual void Undo() override
         {
             switch ( m_actionType )
@@ -146,9 +486,9 @@ namespace EE::EntityModel
                 }
                 break;
 
-                case EntityEditorUndoableAction::MoveComponents:
+                case EntityEditorUndoableAction::ModifyProperties:
                 {
-
+                    ApplyPropertyDeltas( true );
                 }
                 break;
 
@@ -205,9 +545,9 @@ namespace EE::EntityModel
                 }
                 break;
 
-                case EntityEditorUndoableAction::MoveComponents:
+                case EntityEditorUndoableAction::ModifyProperties:
                 {
-
+                    ApplyPropertyDeltas( false );
                 }
                 break;
 
@@ -220,6 +560,7 @@ namespace EE::EntityModel
     private:
 
         TypeSystem::TypeRegistry const&         m_typeRegistry;
+        EntityWorld*                            m_pWorld = nullptr;
         EntityMap*                              m_pMap = nullptr;
         Type                                    m_actionType = Invalid;
 
@@ -235,9 +576,12 @@ namespace EE::EntityModel
         TVector<SerializedEntityDescriptor>     m_entityDescPostModification;
         bool                                    m_entitiesWereDuplicated = false;
 
-        // Data: Move
-        TVector<SpatialState>                   m_componentSpatialStatePreMove;
-        TVector<SpatialState>                   m_componentSpatialStatePostMove;
+        // Data: Modify Properties
+        TVector<ComponentPropertyDelta>         m_propertyDeltas;
+        TVector<SpatialEntityComponent*>        m_manipulatedComponents; // Temporary storage that is only valid between a Begin and End call
+        Nanoseconds                             m_manipulationStartTime;
+        Nanoseconds                             m_manipulationEndTime;
+        bool                                    m_isTransformManipulation = false;
     };
 }
 
@@ -319,6 +663,9 @@ namespace EE::EntityModel
         auto pUndoableAction = static_cast<EntityEditorUndoableAction const*>( pAction );
         // TODO: record addition info in undo command to be able to restore selection
         ClearSelection();
+
+        // Never merge with an action that has been undone/redone, it might no longer be on the undo stack
+        m_pLastTransformManipulationAction = nullptr;
     }
 
     void EntityEditorContext::BeginEditEntities( TVector<Entity*> const& entities )
@@ -327,7 +674,7 @@ namespace EE::EntityModel
         EE_ASSERT( m_pActiveUndoableAction == nullptr );
 
         // Record undo action
-        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pMap );
+        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pWorld, m_pMap );
         m_pActiveUndoableAction->RecordBeginEdit( entities );
     }
 
@@ -698,8 +1045,38 @@ namespace EE::EntityModel
         }
 
         // Create undo action
-        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pMap );
-        m_pActiveUndoableAction->RecordBeginEdit( m_selectedEntities, duplicateSelection );
+        // Duplicated entities need to be fully recorded, otherwise we only need to record the transforms of the manipulated components
+        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pWorld, m_pMap );
+        if ( duplicateSelection )
+        {
+            m_pActiveUndoableAction->RecordBeginEdit( m_selectedEntities, duplicateSelection );
+        }
+        else
+        {
+            TVector<SpatialEntityComponent*> manipulatedComponents;
+            if ( m_selectedComponents.size() > 0 )
+            {
+                for ( auto pComponent : m_selectedComponents )
+                {
+                    if ( auto pSC = TryCast<SpatialEntityComponent>( pComponent ) )
+                    {
+                        manipulatedComponents.emplace_back( pSC );
+                    }
+                }
+            }
+            else
+            {
+                for ( auto pSelectedEntity : m_selectedEntities )
+                {
+                    if ( pSelectedEntity->IsSpatialEntity() )
+                    {
+                        manipulatedComponents.emplace_back( pSelectedEntity->GetRootSpatialComponent() );
+                    }
+                }
+            }
+
+            m_pActiveUndoableAction->RecordBeginTransformManipulation( manipulatedComponents );
+        }
 
         // Apply transform modification
         ApplyTransformManipulation( newTransform );
@@ -745,8 +1122,31 @@ namespace EE::EntityModel
     {
         ApplyTransformManipulation( newTransform );
 
-        m_pActiveUndoableAction->RecordEndEdit();
-        m_undoStack.RegisterAction( m_pActiveUndoableAction );
+        if ( m_pActiveUndoableAction->IsTransformManipulation() )
+        {
+            m_pActiveUndoableAction->RecordEndTransformManipulation();
+        }
+        else
+        {
+            m_pActiveUndoableAction->RecordEndEdit();
+        }
+
+        // Manipulations that didnt move any components dont need an undo step
+        if ( m_pActiveUndoableAction->IsEmptyTransformManipulation() )
+        {
+            EE::Delete( m_pActiveUndoableAction );
+        }
+        // Merge consecutive manipulations of the same selection into a single undo step
+        else if ( m_pLastTransformManipulationAction != nullptr && m_undoStack.GetLastRecordedAction() == m_pLastTransformManipulationAction && m_pLastTransformManipulationAction->TryMergeTransformManipulation( *m_pActiveUndoableAction ) )
+        {
+            EE::Delete( m_pActiveUndoableAction );
+        }
+        else
+        {
+            m_undoStack.RegisterAction( m_pActiveUndoableAction );
+            m_pLastTransformManipulationAction = m_pActiveUndoableAction->IsTransformManipulation() ? m_pActiveUndoableAction : nullptr;
+        }
+
         m_pActiveUndoableAction = nullptr;
     }
 
@@ -770,7 +1170,7 @@ namespace EE::EntityModel
         SelectEntity( pEntity );
 
         // Record undo action
-        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pMap );
+        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pWorld, m_pMap );
         m_pActiveUndoableAction->RecordCreate( { pEntity } );
         m_undoStack.RegisterAction( m_pActiveUndoableAction );
         m_pActiveUndoableAction = nullptr;
@@ -811,7 +1211,7 @@ namespace EE::EntityModel
         ClearSelection();
 
         // Record undo action
-        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pMap );
+        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pWorld, m_pMap );
         m_pActiveUndoableAction->RecordDelete( { pEntity } );
         m_undoStack.RegisterAction( m_pActiveUndoableAction );
         m_pActiveUndoableAction = nullptr;
@@ -833,7 +1233,7 @@ namespace EE::EntityModel
         ClearSelection();
 
         // Record undo action
-        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pMap );
+        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pWorld, m_pMap );
         m_pActiveUndoableAction->RecordDelete( m_entityDeletionRequests );
         m_undoStack.RegisterAction( m_pActiveUndoableAction );
         m_pActiveUndoableAction = nullptr;
@@ -845,7 +1245,7 @@ namespace EE::EntityModel
         EE_ASSERT( pEntity != nullptr );
         EE_ASSERT( m_pMap->ContainsEntity( pEntity->GetID() ) );
 
-        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pMap );
+        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pWorld, m_pMap );
         m_pActiveUndoableAction->RecordBeginEdit( { pEntity } );
         pEntity->CreateSystem( pSystemTypeInfo );
         m_pActiveUndoableAction->RecordEndEdit();
@@ -861,7 +1261,7 @@ namespace EE::EntityModel
 
         ClearSelectedSystem(); // Todo only clear if the system is selected
 
-        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pMap );
+        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pWorld, m_pMap );
         m_pActiveUndoableAction->RecordBeginEdit( { pEntity } );
         pEntity->DestroySystem( systemTypeID );
         m_pActiveUndoableAction->RecordEndEdit();
@@ -881,7 +1281,7 @@ namespace EE::EntityModel
             m_pSelectedSystem = nullptr;
         }
 
-        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pMap );
+        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pWorld, m_pMap );
         m_pActiveUndoableAction->RecordBeginEdit( { pEntity } );
         pEntity->DestroySystem( pSystem->GetTypeID() );
         m_pActiveUndoableAction->RecordEndEdit();
@@ -895,7 +1295,7 @@ namespace EE::EntityModel
         EE_ASSERT( pEntity != nullptr );
         EE_ASSERT( m_pMap->ContainsEntity( pEntity->GetID() ) );
 
-        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pMap );
+        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pWorld, m_pMap );
         m_pActiveUndoableAction->RecordBeginEdit( { pEntity } );
         pEntity->CreateComponent( pComponentTypeInfo, parentSpatialComponentID );
         m_pActiveUndoableAction->RecordEndEdit();
@@ -911,7 +1311,7 @@ namespace EE::EntityModel
 
         m_selectedComponents.erase_first_unsorted( pComponent );
 
-        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pMap );
+        m_pActiveUndoableAction = EE::New<EntityEditorUndoableAction>( *m_pToolsContext->m_pTypeRegistry, m_pWorld, m_pMap );
         m_pActiveUndoableAction->RecordBeginEdit( { pEntity } );
         pEntity->DestroyComponent( pComponent->GetID() );
         m_pActiveUndoableAction->RecordEndEdit();
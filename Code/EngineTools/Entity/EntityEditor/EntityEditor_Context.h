@@ -144,6 +144,7 @@ namespace EE::EntityModel
 
         UndoStack&                              m_undoStack;
         EntityEditorUndoableAction*             m_pActiveUndoableAction = nullptr;
+        EntityEditorUndoableAction*             m_pLastTransformManipulationAction = nullptr; // Only used to check if we can merge with the previous manipulation, never dereferenced unless it's still the last recorded action
 
         // Selection: multi-tiered
         TVector<Entity*>                        m_selectedEntities;
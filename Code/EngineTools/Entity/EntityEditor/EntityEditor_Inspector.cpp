@@ -22,55 +22,55 @@ namespace EE::EntityModel
         EntityInternalItem( char const* pLabel )
             : TreeListViewItem()
             , m_nameID( pLabel )
-        {}
+        {
+            m_uniqueID = m_nameID.GetID();
+        }
 
         EntityInternalItem( IRegisteredType* pTypeInstance )
             : TreeListViewItem()
             , m_pInstance( pTypeInstance )
-        {}
-
-        inline IRegisteredType* GetTypeInstance() { return m_pInstance; }
-
-        virtual StringID GetNameID() const override
         {
-            if ( IsCategoryLabel() )
-            {
-                return m_nameID;
-            }
-            else if ( IsEntity() )
+            EE_ASSERT( m_pInstance != nullptr );
+
+            // The ID is cached since items are synchronized with the entity after its systems/components have been destroyed
+            if ( IsEntity() )
             {
-                return Cast<Entity>( m_pInstance )->GetName();
+                m_uniqueID = Cast<Entity>( m_pInstance )->GetID().ToUint64();
             }
             else if ( IsComponent() )
             {
-                return Cast<EntityComponent>( m_pInstance )->GetName();
+                m_uniqueID = Cast<EntityComponent>( m_pInstance )->GetID().ToUint64();
             }
             else
             {
-                return Cast<EntitySystem>( m_pInstance )->GetTypeID().ToStringID();
+                m_uniqueID = Cast<EntitySystem>( m_pInstance )->GetTypeID().ToStringID().GetID();
             }
         }
 
-        virtual uint64_t GetUniqueID() const override
+        inline IRegisteredType* GetTypeInstance() { return m_pInstance; }
+
+        virtual StringID GetNameID() const override
         {
             if ( IsCategoryLabel() )
             {
-                return m_nameID.GetID();
+                return m_nameID;
             }
             else if ( IsEntity() )
             {
-                return Cast<Entity>( m_pInstance )->GetID().ToUint64();
+                return Cast<Entity>( m_pInstance )->GetName();
             }
             else if ( IsComponent() )
             {
-                return Cast<EntityComponent>( m_pInstance )->GetID().ToUint64();
+                return Cast<EntityComponent>( m_pInstance )->GetName();
             }
             else
             {
-                return Cast<EntitySystem>( m_pInstance )->GetTypeID().ToStringID().GetID();
+                return Cast<EntitySystem>( m_pInstance )->GetTypeID().ToStringID();
             }
         }
 
+        virtual uint64_t GetUniqueID() const override { return m_uniqueID; }
+
         virtual bool HasContextMenu() const override { return !IsCategoryLabel(); }
 
         inline Entity* GetAsEntity() const { return TryCast<Entity>( m_pInstance ); }
@@ -88,6 +88,7 @@ namespace EE::EntityModel
 
         IRegisteredType*    m_pInstance = nullptr;
         StringID            m_nameID;
+        uint64_t            m_uniqueID = 0;
     };
 
     //-------------------------------------------------------------------------
@@ -107,7 +108,7 @@ namespace EE::EntityModel
         {
             if ( pEntityChanged == m_pEntity )
             {
-                RebuildTree();
+                SynchronizeTree();
             }
         };
 
@@ -338,6 +339,184 @@ namespace EE::EntityModel
         }
     }
 
+    void EntityEditorInspector::SynchronizeTree()
+    {
+        if ( m_pEntity == nullptr )
+        {
+            return;
+        }
+
+        // Items might be referencing systems/components that are about to be destroyed, so clear the tree until the entity is done updating
+        if ( m_pEntity->HasStateChangeActionsPending() )
+        {
+            RebuildTree();
+            return;
+        }
+
+        // Systems
+        //-------------------------------------------------------------------------
+
+        TInlineVector<IRegisteredType*, 10> systems;
+        for ( auto pSystem : m_pEntity->GetSystems() )
+        {
+            systems.emplace_back( pSystem );
+        }
+
+        SynchronizeCategory( "Systems", systems );
+
+        // Components
+        //-------------------------------------------------------------------------
+
+        TInlineVector<IRegisteredType*, 10> components;
+        TInlineVector<SpatialEntityComponent*, 10> spatialComponents;
+
+        for ( auto pComponent : m_pEntity->GetComponents() )
+        {
+            if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent ) )
+            {
+                spatialComponents.emplace_back( pSpatialComponent );
+            }
+            else
+            {
+                components.emplace_back( pComponent );
+            }
+        }
+
+        SynchronizeCategory( "Components", components );
+
+        // Spatial Components
+        //-------------------------------------------------------------------------
+
+        StringID const spatialCategoryID( "Spatial Components" );
+        TreeListViewItem* pSpatialCategoryItem = m_rootItem.FindChild( spatialCategoryID.GetID() );
+
+        if ( spatialComponents.empty() )
+        {
+            if ( pSpatialCategoryItem != nullptr )
+            {
+                DestroyItem( spatialCategoryID.GetID() );
+            }
+        }
+        else
+        {
+            if ( pSpatialCategoryItem == nullptr )
+            {
+                pSpatialCategoryItem = CreateItem<EntityInternalItem>( &m_rootItem, "Spatial Components" );
+                SetItemExpanded( pSpatialCategoryItem, true );
+            }
+
+            RemoveStaleSpatialItems( pSpatialCategoryItem, nullptr );
+            CreateMissingSpatialItems( pSpatialCategoryItem, m_pEntity->GetRootSpatialComponent(), spatialComponents );
+        }
+    }
+
+    void EntityEditorInspector::SynchronizeCategory( char const* pCategoryName, TInlineVector<IRegisteredType*, 10> const& instances )
+    {
+        StringID const categoryID( pCategoryName );
+        TreeListViewItem* pCategoryItem = m_rootItem.FindChild( categoryID.GetID() );
+
+        if ( instances.empty() )
+        {
+            if ( pCategoryItem != nullptr )
+            {
+                DestroyItem( categoryID.GetID() );
+            }
+
+            return;
+        }
+
+        if ( pCategoryItem == nullptr )
+        {
+            pCategoryItem = CreateItem<EntityInternalItem>( &m_rootItem, pCategoryName );
+            SetItemExpanded( pCategoryItem, true );
+        }
+
+        // Destroy the items for removed instances, this only compares pointers since these instances have already been destroyed
+        auto const& childItems = pCategoryItem->GetChildren();
+        for ( int32_t i = (int32_t) childItems.size() - 1; i >= 0; i-- )
+        {
+            auto pChildItem = static_cast<EntityInternalItem*>( childItems[i] );
+            if ( !VectorContains( instances, pChildItem->GetTypeInstance() ) )
+            {
+                DestroyItem( pChildItem->GetUniqueID() );
+            }
+        }
+
+        // Create the items for new instances
+        for ( auto pInstance : instances )
+        {
+            auto HasInstance = [pInstance] ( TreeListViewItem const* pItem ) { return static_cast<EntityInternalItem const*>( pItem )->GetTypeInstance() == pInstance; };
+            if ( pCategoryItem->FindChild( HasInstance ) == nullptr )
+            {
+                CreateItem<EntityInternalItem>( pCategoryItem, pInstance );
+            }
+        }
+    }
+
+    void EntityEditorInspector::RemoveStaleSpatialItems( TreeListViewItem* pParentItem, SpatialEntityComponent const* pParentComponent )
+    {
+        auto const& components = m_pEntity->GetComponents();
+
+        // Iterate over a copy since destroying items modifies the child list
+        TInlineVector<TreeListViewItem*, 10> const childItems( pParentItem->GetChildren().begin(), pParentItem->GetChildren().end() );
+        for ( auto pChildItem : childItems )
+        {
+            auto pChildInstance = static_cast<EntityInternalItem*>( pChildItem )->GetTypeInstance();
+
+            // Only compare pointers until we know the component still exists
+            auto IsChildComponent = [pChildInstance] ( EntityComponent* pComponent ) { return (IRegisteredType*) pComponent == pChildInstance; };
+            SpatialEntityComponent* pComponent = nullptr;
+            auto componentIter = eastl::find_if( components.begin(), components.end(), IsChildComponent );
+            if ( componentIter != components.end() )
+            {
+                pComponent = TryCast<SpatialEntityComponent>( *componentIter );
+            }
+
+            // Components that moved in the hierarchy are destroyed and recreated under their new parent
+            bool isValidItem = false;
+            if ( pComponent != nullptr )
+            {
+                if ( pParentComponent == nullptr )
+                {
+                    isValidItem = ( pComponent == m_pEntity->GetRootSpatialComponent() );
+                }
+                else
+                {
+                    isValidItem = pComponent->HasSpatialParent() && pComponent->GetSpatialParentID() == pParentComponent->GetID();
+                }
+            }
+
+            if ( isValidItem )
+            {
+                RemoveStaleSpatialItems( pChildItem, pComponent );
+            }
+            else
+            {
+                DestroyItem( pChildItem->GetUniqueID() );
+            }
+        }
+    }
+
+    void EntityEditorInspector::CreateMissingSpatialItems( TreeListViewItem* pParentItem, SpatialEntityComponent* pComponent, TInlineVector<SpatialEntityComponent*, 10> const& spatialComponents )
+    {
+        EE_ASSERT( pParentItem != nullptr && pComponent != nullptr );
+
+        TreeListViewItem* pItem = pParentItem->FindChild( pComponent->GetID().ToUint64() );
+        if ( pItem == nullptr )
+        {
+            pItem = CreateItem<EntityInternalItem>( pParentItem, pComponent );
+            SetItemExpanded( pItem, true );
+        }
+
+        for ( auto pSpatialComponent : spatialComponents )
+        {
+            if ( pSpatialComponent->HasSpatialParent() && pSpatialComponent->GetSpatialParentID() == pComponent->GetID() )
+            {
+                CreateMissingSpatialItems( pItem, pSpatialComponent, spatialComponents );
+            }
+        }
+    }
+
     void EntityEditorInspector::DrawItemContextMenu( TVector<TreeListViewItem*> const& selectedItemsWithContextMenus )
     {
         auto pItem = static_cast<EntityInternalItem*>( selectedItemsWithContextMenus[0] );
@@ -9,6 +9,7 @@ namespace EE
 {
     class Entity;
     class SpatialEntityComponent;
+    class IRegisteredType;
     class UpdateContext;
 
     namespace TypeSystem
@@ -57,6 +58,13 @@ namespace EE::EntityModel
     private:
 
         virtual void RebuildTreeInternal() override;
+
+        // Update the tree to match the entity, only the items for the systems and components that changed are created or destroyed
+        void SynchronizeTree();
+        void SynchronizeCategory( char const* pCategoryName, TInlineVector<IRegisteredType*, 10> const& instances );
+        void RemoveStaleSpatialItems( TreeListViewItem* pParentItem, SpatialEntityComponent const* pParentComponent );
+        void CreateMissingSpatialItems( TreeListViewItem* pParentItem, SpatialEntityComponent* pComponent, TInlineVector<SpatialEntityComponent*, 10> const& spatialComponents );
+
         virtual void DrawItemContextMenu( TVector<TreeListViewItem*> const& selectedItemsWithContextMenus ) override;
         virtual void OnSelectionChangedInternal() override;
 
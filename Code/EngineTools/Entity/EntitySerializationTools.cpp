@@ -6,10 +6,17 @@
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntitySerialization.h"
 #include "System/Serialization/TypeSerialization.h"
+#include "System/Serialization/BinarySerialization.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include "System/FileSystem/FileSystem.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Algorithm/Hash.h"
+#include "System/Types/UUID.h"
+#include "System/Profiling.h"
 #include "System/Log.h"
 #include <eastl/sort.h>
+#include <atomic>
+#include <filesystem>
 
 using namespace EE::Serialization;
 
@@ -32,8 +39,17 @@ namespace EE::EntityModel
 
     namespace
     {
+        // The parsing context only contains per-entity state so each thread can use its own context
         struct ParsingContext
         {
+            struct ComponentTypeEntry
+            {
+                int32_t                                 m_count = 0;
+                bool                                    m_isSingleton = false;
+            };
+
+        public:
+
             ParsingContext( TypeSystem::TypeRegistry const& typeRegistry ) : m_typeRegistry( typeRegistry ) {}
 
             inline void ClearComponentNames()
@@ -46,11 +62,6 @@ namespace EE::EntityModel
                 return m_componentNames.find( componentName ) != m_componentNames.end();
             }
 
-            inline bool DoesEntityExist( StringID entityName ) const
-            {
-                return m_entityNames.find( entityName ) != m_entityNames.end();
-            }
-
         public:
 
             TypeSystem::TypeRegistry const&             m_typeRegistry;
@@ -58,11 +69,35 @@ namespace EE::EntityModel
             // Parsing context ID - Entity/Component/etc...
             StringID                                    m_parsingContextName;
 
-            // Maps to allow for fast lookups of entity/component names for validation
-            THashMap<StringID, bool>                    m_entityNames;
+            // Maps to allow for fast lookups of component names/types for validation
             THashMap<StringID, bool>                    m_componentNames;
+            THashMap<TypeSystem::TypeID, ComponentTypeEntry> m_componentTypes;
         };
 
+        // Walk the type hierarchy of a component and return the first singleton type that conflicts with it (i.e. another component on the entity is of that type)
+        static TypeSystem::TypeInfo const* FindConflictingSingletonType( ParsingContext const& ctx, TypeSystem::TypeID componentTypeID, TypeSystem::TypeInfo const* pTypeInfo )
+        {
+            auto const foundIter = ctx.m_componentTypes.find( pTypeInfo->m_ID );
+            if ( foundIter != ctx.m_componentTypes.end() && foundIter->second.m_isSingleton )
+            {
+                // Either a parent singleton type is present or there are multiple components of this exact singleton type
+                if ( pTypeInfo->m_ID != componentTypeID || foundIter->second.m_count > 1 )
+                {
+                    return pTypeInfo;
+                }
+            }
+
+            for ( auto pParentTypeInfo : pTypeInfo->m_parentTypes )
+            {
+                if ( auto pConflictingTypeInfo = FindConflictingSingletonType( ctx, componentTypeID, pParentTypeInfo ) )
+                {
+                    return pConflictingTypeInfo;
+                }
+            }
+
+            return nullptr;
+        }
+
         //-------------------------------------------------------------------------
 
         static bool ReadAndConvertPropertyValue( ParsingContext& ctx, TypeSystem::TypeInfo const* pTypeInfo, Serialization::JsonValue::ConstMemberIterator memberIter, TypeSystem::PropertyDescriptor& outPropertyDesc )
@@ -314,6 +349,9 @@ namespace EE::EntityModel
                 // Validate singleton components
                 //-------------------------------------------------------------------------
                 // As soon as a given component is a singleton all components derived from it are singleton components
+                // Record all the component types present and then check each component's type hierarchy against them, rather than testing every pair of components
+
+                ctx.m_componentTypes.clear();
 
                 for ( int32_t i = 0; i < numComponents; i++ )
                 {
@@ -324,22 +362,18 @@ namespace EE::EntityModel
                     }
 
                     auto pDefaultComponentInstance = Cast<EntityComponent>( pComponentTypeInfo->GetDefaultInstance() );
-                    if ( !pDefaultComponentInstance->IsSingletonComponent() )
-                    {
-                        continue;
-                    }
+                    auto& componentTypeEntry = ctx.m_componentTypes[pComponentTypeInfo->m_ID];
+                    componentTypeEntry.m_isSingleton = pDefaultComponentInstance->IsSingletonComponent();
+                    componentTypeEntry.m_count++;
+                }
 
-                    for ( int32_t j = 0; j < numComponents; j++ )
+                for ( int32_t i = 0; i < numComponents; i++ )
+                {
+                    auto pComponentTypeInfo = ctx.m_typeRegistry.GetTypeInfo( outEntityDesc.m_components[i].m_typeID );
+                    auto pSingletonTypeInfo = FindConflictingSingletonType( ctx, pComponentTypeInfo->m_ID, pComponentTypeInfo );
+                    if ( pSingletonTypeInfo != nullptr )
                     {
-                        if ( i == j )
-                        {
-                            continue;
-                        }
-
-                        if ( ctx.m_typeRegistry.IsTypeDerivedFrom( outEntityDesc.m_components[j].m_typeID, outEntityDesc.m_components[i].m_typeID ) )
-                        {
-                            return Error( "Multiple singleton components of type (%s) found on the same entity (%s)", pComponentTypeInfo->GetTypeName(), outEntityDesc.m_name.c_str() );
-                        }
+                        return Error( "Multiple singleton components of type (%s) found on the same entity (%s)", pSingletonTypeInfo->GetTypeName(), outEntityDesc.m_name.c_str() );
                     }
                 }
 
@@ -402,42 +436,165 @@ namespace EE::EntityModel
             //-------------------------------------------------------------------------
 
             ctx.m_parsingContextName.Clear();
+            return true;
+        }
 
-            //-------------------------------------------------------------------------
+        //-------------------------------------------------------------------------
 
-            if ( ctx.DoesEntityExist( outEntityDesc.m_name ) )
+        struct EntityReadingTask : public ITaskSet
+        {
+            EntityReadingTask( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entitiesArrayValue, TVector<SerializedEntityDescriptor>& entityDescs )
+                : m_typeRegistry( typeRegistry )
+                , m_entitiesArrayValue( entitiesArrayValue )
+                , m_entityDescs( entityDescs )
             {
-                return Error( "Duplicate entity ID detected: %s", outEntityDesc.m_name.c_str() );
+                m_SetSize = (uint32_t) entityDescs.size();
+                m_MinRange = 16;
             }
-            else
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
             {
-                ctx.m_entityNames.insert( TPair<StringID, bool>( outEntityDesc.m_name, true ) );
-                return true;
+                EE_PROFILE_SCOPE_ENTITY( "Entity Reading Task" );
+
+                ParsingContext ctx( m_typeRegistry );
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    if ( !ReadEntityData( ctx, m_entitiesArrayValue[i], m_entityDescs[i] ) )
+                    {
+                        m_failed = true;
+                    }
+                }
             }
-        }
 
-        static bool ReadEntityArray( ParsingContext& ctx, Serialization::JsonValue const& entitiesArrayValue, SerializedEntityCollection& outCollection )
+        public:
+
+            std::atomic<bool>                                   m_failed = false;
+
+        private:
+
+            TypeSystem::TypeRegistry const&                     m_typeRegistry;
+            Serialization::JsonValue const&                     m_entitiesArrayValue;
+            TVector<SerializedEntityDescriptor>&                m_entityDescs;
+        };
+
+        static bool ReadEntityArray( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entitiesArrayValue, SerializedEntityCollection& outCollection, TaskSystem* pTaskSystem )
         {
             int32_t const numEntities = (int32_t) entitiesArrayValue.Size();
-            outCollection.Reserve( numEntities );
             for ( int32_t i = 0; i < numEntities; i++ )
             {
                 if ( !entitiesArrayValue[i].IsObject() )
                 {
                     return Error( "Malformed collection file, entities array can only contain objects" );
                 }
+            }
+
+            // Read all entity descriptors - entities are independent of one another so we can go wide for large collections
+            //-------------------------------------------------------------------------
+
+            TVector<SerializedEntityDescriptor> entityDescs;
+            entityDescs.resize( numEntities );
+
+            EntityReadingTask readingTask( typeRegistry, entitiesArrayValue, entityDescs );
+            if ( pTaskSystem == nullptr || numEntities <= 16 )
+            {
+                readingTask.ExecuteRange( { 0, (uint32_t) numEntities }, 0 );
+            }
+            else
+            {
+                pTaskSystem->ScheduleTask( &readingTask );
+                pTaskSystem->WaitForTask( &readingTask );
+            }
 
-                SerializedEntityDescriptor entityDesc;
-                if ( !ReadEntityData( ctx, entitiesArrayValue[i], entityDesc ) )
+            if ( readingTask.m_failed )
+            {
+                return false;
+            }
+
+            // Add entities in file order and validate names
+            //-------------------------------------------------------------------------
+
+            outCollection.Reserve( numEntities );
+            for ( int32_t i = 0; i < numEntities; i++ )
+            {
+                if ( outCollection.FindEntityIndex( entityDescs[i].m_name ) != InvalidIndex )
                 {
-                    return false;
+                    return Error( "Duplicate entity ID detected: %s", entityDescs[i].m_name.c_str() );
                 }
 
-                outCollection.AddEntity( entityDesc );
+                outCollection.AddEntity( eastl::move( entityDescs[i] ) );
+            }
+
+            return true;
+        }
+
+        //-------------------------------------------------------------------------
+        // Editor Cache
+        //-------------------------------------------------------------------------
+        // Binary copy of the parsed collection stored next to the source file, used to skip the JSON parsing entirely for unchanged files
+        // The cache is keyed on the contents of the source file, so any edit (or a source control sync) invalidates it
+        // The key also includes the layout of all reflected types since the cached property values are already converted to their binary form
+        // Note: Bump the cache version if the descriptor format or the property conversion changes
+
+        constexpr static uint32_t const s_editorCacheVersion = 2;
+
+        static FileSystem::Path GetEditorCacheFilePath( FileSystem::Path const& filePath )
+        {
+            return FileSystem::Path( filePath.GetFullPath() + ".editorcache" );
+        }
+
+        static uint64_t CalculateEditorCacheKey( TypeSystem::TypeRegistry const& typeRegistry, Blob const& fileData )
+        {
+            uint64_t const keyData[4] = { Hash::XXHash::GetHash64( fileData ), s_editorCacheVersion, (uint64_t) Serialization::GetBinarySerializationVersion(), typeRegistry.CalculateTypeLayoutHash() };
+            return Hash::XXHash::GetHash64( keyData, sizeof( keyData ) );
+        }
+
+        static bool TryReadEditorCache( FileSystem::Path const& cacheFilePath, uint64_t cacheKey, SerializedEntityCollection& outCollection )
+        {
+            if ( !FileSystem::Exists( cacheFilePath ) )
+            {
+                return false;
+            }
+
+            Serialization::BinaryInputArchive archive;
+            if ( !archive.ReadFromFile( cacheFilePath ) )
+            {
+                return false;
+            }
+
+            uint64_t storedKey = 0;
+            archive << storedKey;
+            if ( storedKey != cacheKey )
+            {
+                return false;
             }
 
+            archive << outCollection;
             return true;
         }
+
+        static void WriteEditorCache( FileSystem::Path const& cacheFilePath, uint64_t cacheKey, SerializedEntityCollection const& collection )
+        {
+            Serialization::BinaryOutputArchive archive;
+            archive << cacheKey << collection;
+
+            // Failing to write the cache (e.g. read-only data directory) is not an error, we'll just parse the JSON again next time
+            // Multiple tools can load the same file at once, so write to a unique temporary file and move it into place so readers never see a partial cache
+            String tempFileName( UUID::GenerateID().ToString().c_str() );
+            tempFileName += ".tmp";
+            FileSystem::Path const tempFilePath = cacheFilePath.GetParentDirectory() + tempFileName;
+            if ( !archive.WriteToFile( tempFilePath ) )
+            {
+                return;
+            }
+
+            // Any existing cache file is stale, so replace it
+            std::error_code ec;
+            std::filesystem::rename( tempFilePath.c_str(), cacheFilePath.c_str(), ec );
+            if ( ec )
+            {
+                FileSystem::EraseFile( tempFilePath );
+            }
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -453,16 +610,14 @@ namespace EE::EntityModel
         return ReadEntityData( ctx, entitiesObjectValue, outEntityDesc );
     }
 
-    bool ReadEntityCollectionFromJson( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entitiesArrayValue, SerializedEntityCollection& outCollection )
+    bool ReadEntityCollectionFromJson( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonValue const& entitiesArrayValue, SerializedEntityCollection& outCollection, TaskSystem* pTaskSystem )
     {
         if ( !entitiesArrayValue.IsArray() )
         {
             return Error( "Failed to read entity collection, json value is not an array" );
         }
 
-        ParsingContext ctx( typeRegistry );
-
-        if ( !ReadEntityArray( ctx, entitiesArrayValue, outCollection ) )
+        if ( !ReadEntityArray( typeRegistry, entitiesArrayValue, outCollection, pTaskSystem ) )
         {
             return false;
         }
@@ -474,7 +629,7 @@ namespace EE::EntityModel
         return true;
     }
 
-    bool ReadSerializedEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityCollection& outCollection )
+    bool ReadSerializedEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityCollection& outCollection, TaskSystem* pTaskSystem )
     {
         EE_ASSERT( filePath.IsValid() );
 
@@ -492,16 +647,24 @@ namespace EE::EntityModel
         //-------------------------------------------------------------------------
 
         // Load file into memory buffer
-        FILE* fp = fopen( filePath.c_str(), "r" );
-        fseek( fp, 0, SEEK_END );
-        size_t filesize = (size_t) ftell( fp );
-        fseek( fp, 0, SEEK_SET );
-
         Blob fileBuffer;
-        fileBuffer.resize( filesize + 1 );
-        size_t readLength = fread( fileBuffer.data(), 1, filesize, fp );
-        fileBuffer[readLength] = '\0';
-        fclose( fp );
+        if ( !FileSystem::LoadFile( filePath, fileBuffer ) )
+        {
+            return Error( "Failed to read source file %s", filePath.GetFullPath().c_str() );
+        }
+
+        // Try to read the editor cache
+        //-------------------------------------------------------------------------
+
+        FileSystem::Path const cacheFilePath = GetEditorCacheFilePath( filePath );
+        uint64_t const cacheKey = CalculateEditorCacheKey( typeRegistry, fileBuffer );
+        if ( TryReadEditorCache( cacheFilePath, cacheKey, outCollection ) )
+        {
+            return true;
+        }
+
+        outCollection.Clear();
+        fileBuffer.push_back( '\0' );
 
         // Parse JSON
         //-------------------------------------------------------------------------
@@ -521,12 +684,18 @@ namespace EE::EntityModel
         // Read Entities
         //-------------------------------------------------------------------------
 
-        return ReadEntityCollectionFromJson( typeRegistry, entityCollectionDocument["Entities"], outCollection );
+        if ( !ReadEntityCollectionFromJson( typeRegistry, entityCollectionDocument["Entities"], outCollection, pTaskSystem ) )
+        {
+            return false;
+        }
+
+        WriteEditorCache( cacheFilePath, cacheKey, outCollection );
+        return true;
     }
 
-    bool ReadSerializedEntityMapFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityMap& outMap )
+    bool ReadSerializedEntityMapFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityMap& outMap, TaskSystem* pTaskSystem )
     {
-        return ReadSerializedEntityCollectionFromFile( typeRegistry, filePath, outMap );
+        return ReadSerializedEntityCollectionFromFile( typeRegistry, filePath, outMap, pTaskSystem );
     }
 
     //-------------------------------------------------------------------------
@@ -8,6 +8,7 @@
 namespace EE
 {
     class Entity;
+    class TaskSystem;
     namespace FileSystem { class Path; }
     namespace TypeSystem { class TypeRegistry; }
 }
@@ -22,8 +23,10 @@ namespace EE::EntityModel
 
     //-------------------------------------------------------------------------
 
-    EE_ENGINETOOLS_API bool ReadSerializedEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityCollection& outCollection );
-    EE_ENGINETOOLS_API bool ReadSerializedEntityMapFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityMap& outMap );
+    // Reading will use the binary editor cache stored next to the file if it is up to date, else the JSON is parsed and the cache is updated
+    // If a task system is supplied, the entity descriptors will be created in parallel
+    EE_ENGINETOOLS_API bool ReadSerializedEntityCollectionFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityCollection& outCollection, TaskSystem* pTaskSystem = nullptr );
+    EE_ENGINETOOLS_API bool ReadSerializedEntityMapFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, SerializedEntityMap& outMap, TaskSystem* pTaskSystem = nullptr );
     EE_ENGINETOOLS_API bool WriteSerializedEntityCollectionToFile( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& collection, FileSystem::Path const& outFilePath );
     EE_ENGINETOOLS_API bool WriteMapToFile( TypeSystem::TypeRegistry const& typeRegistry, EntityMap const& map, FileSystem::Path const& outFilePath );
 }
\ No newline at end of file
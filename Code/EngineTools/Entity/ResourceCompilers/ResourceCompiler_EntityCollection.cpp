@@ -28,7 +28,7 @@ namespace EE::EntityModel
         {
             ScopedTimer<PlatformClock> timer( elapsedTime );
 
-            if ( !ReadSerializedEntityCollectionFromFile( *m_pTypeRegistry, ctx.m_inputFilePath, serializedCollection ) )
+            if ( !ReadSerializedEntityCollectionFromFile( *m_pTypeRegistry, ctx.m_inputFilePath, serializedCollection, ctx.m_pTaskSystem ) )
             {
                 return Resource::CompilationResult::Failure;
             }
@@ -29,7 +29,7 @@ namespace EE::EntityModel
         {
             ScopedTimer<PlatformClock> timer( elapsedTime );
 
-            if ( !ReadSerializedEntityMapFromFile( *m_pTypeRegistry, ctx.m_inputFilePath, map ) )
+            if ( !ReadSerializedEntityMapFromFile( *m_pTypeRegistry, ctx.m_inputFilePath, map, ctx.m_pTaskSystem ) )
             {
                 return Resource::CompilationResult::Failure;
             }
@@ -62,6 +62,28 @@ namespace EE::EntityModel
             pNavmeshComponentDesc->m_properties.emplace_back( TypeSystem::PropertyDescriptor( *m_pTypeRegistry, navmeshResourcePropertyPath, GetCoreTypeID( TypeSystem::CoreTypeID::TResourcePtr ), TypeSystem::TypeID(), navmeshResourcePath.GetString() ) );
         }
 
+        // The same applies to the cover database component, the cover types live in the game module so we need to refer to them by name
+        TypeSystem::TypeID const coverDatabaseComponentTypeID( "EE::CoverDatabaseComponent" );
+        auto const coverDatabaseComponents = map.GetComponentsOfType( *m_pTypeRegistry, coverDatabaseComponentTypeID, false );
+        if ( !coverDatabaseComponents.empty() )
+        {
+            if ( coverDatabaseComponents.size() > 1 )
+            {
+                Warning( "More than one cover database component found in this map, this is not supported... Ignoring all components apart from the first found!" );
+            }
+
+            TypeSystem::PropertyPath const coverDatabaseResourcePropertyPath( "m_pCoverDatabase" );
+
+            // Remove any values for the cover database resource property
+            auto pCoverDatabaseComponentDesc = coverDatabaseComponents[0].m_pComponent;
+            pCoverDatabaseComponentDesc->RemovePropertyValue( coverDatabaseResourcePropertyPath );
+
+            // Set cover database resource ptr
+            ResourcePath coverDatabaseResourcePath = ctx.m_resourceID.GetResourcePath();
+            coverDatabaseResourcePath.ReplaceExtension( "cov" );
+            pCoverDatabaseComponentDesc->m_properties.emplace_back( TypeSystem::PropertyDescriptor( *m_pTypeRegistry, coverDatabaseResourcePropertyPath, GetCoreTypeID( TypeSystem::CoreTypeID::TResourcePtr ), TypeSystem::TypeID(), coverDatabaseResourcePath.GetString() ) );
+        }
+
         //-------------------------------------------------------------------------
         // Serialize
         //-------------------------------------------------------------------------
@@ -9,7 +9,7 @@ namespace EE::EntityModel
     class EntityMapCompiler final : public Resource::Compiler
     {
         EE_REGISTER_TYPE( EntityMapCompiler );
-        static const int32_t s_version = 2;
+        static const int32_t s_version = 3;
 
     public:
 
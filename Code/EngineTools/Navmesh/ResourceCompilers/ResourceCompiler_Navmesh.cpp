@@ -61,7 +61,7 @@ namespace EE::Navmesh
         {
             ScopedTimer<PlatformClock> timer( elapsedTime );
 
-            if ( !EntityModel::ReadSerializedEntityMapFromFile( *m_pTypeRegistry, mapPath, serializedMap ) )
+            if ( !EntityModel::ReadSerializedEntityMapFromFile( *m_pTypeRegistry, mapPath, serializedMap, ctx.m_pTaskSystem ) )
             {
                 Error( "Entity map file (%s) is malformed!", mapPath.c_str() );
                 return Resource::CompilationResult::Failure;
@@ -14,11 +14,15 @@ namespace EE::RawAssets
 {
     class EE_ENGINETOOLS_API RawAnimation : public RawAsset
     {
+        // The skeleton is not serialized, it is supplied when creating the animation
+        EE_SERIALIZE( EE_SERIALIZE_BASE( RawAsset ), m_samplingFrameRate, m_start, m_end, m_duration, m_numFrames, m_tracks, m_rootTransforms );
 
     public:
 
         struct TrackData
         {
+            EE_SERIALIZE( m_localTransforms, m_globalTransforms, m_translationValueRangeX, m_translationValueRangeY, m_translationValueRangeZ, m_scaleValueRangeX, m_scaleValueRangeY, m_scaleValueRangeZ );
+
             TVector<Transform>                 m_localTransforms;
             TVector<Transform>                 m_globalTransforms;
             FloatRange                         m_translationValueRangeX;
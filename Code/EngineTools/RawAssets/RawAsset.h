@@ -5,6 +5,7 @@
 #include "System/Math/Matrix.h"
 #include "System/Types/String.h"
 #include "System/Types/StringID.h"
+#include "System/Serialization/BinarySerialization.h"
 
 //-------------------------------------------------------------------------
 
@@ -12,6 +13,7 @@ namespace EE::RawAssets
 {
     class EE_ENGINETOOLS_API RawAsset
     {
+        EE_SERIALIZE( m_warnings );
 
     public:
 
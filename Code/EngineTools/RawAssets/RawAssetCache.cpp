@@ -0,0 +1,224 @@
+#include "RawAssetCache.h"
+#include "RawMesh.h"
+#include "RawAnimation.h"
+#include "System/Algorithm/Hash.h"
+#include "System/FileSystem/FileSystem.h"
+#include "System/Types/UUID.h"
+#include "System/Serialization/BinarySerialization.h"
+#include "System/FileSystem/FileSystemUtils.h"
+#include "EngineTools/ThirdParty/cgltf/cgltf.h"
+#include <cstdio>
+#include <filesystem>
+
+//-------------------------------------------------------------------------
+
+namespace EE::RawAssets
+{
+    // Text gltf files usually store their data in external binary buffers, so the buffer contents need to be part of the key
+    static bool TryHashExternalGltfBuffers( FileSystem::Path const& sourceFilePath, Blob const& sourceFileData, uint64_t& inOutHash )
+    {
+        cgltf_options options = { cgltf_file_type_invalid, 0 };
+        cgltf_data* pSceneData = nullptr;
+        if ( cgltf_parse( &options, sourceFileData.data(), sourceFileData.size(), &pSceneData ) != cgltf_result_success )
+        {
+            return false;
+        }
+
+        bool result = true;
+        FileSystem::Path const parentDirectoryPath = sourceFilePath.GetParentDirectory();
+        for ( cgltf_size i = 0; i < pSceneData->buffers_count; i++ )
+        {
+            // Embedded buffers are already covered by the source file hash
+            char const* pURI = pSceneData->buffers[i].uri;
+            if ( pURI == nullptr || strncmp( pURI, "data:", 5 ) == 0 )
+            {
+                continue;
+            }
+
+            String bufferFileName( pURI );
+            cgltf_decode_uri( bufferFileName.data() );
+
+            Blob bufferData;
+            if ( !FileSystem::LoadFile( parentDirectoryPath + bufferFileName.c_str(), bufferData ) )
+            {
+                result = false;
+                break;
+            }
+
+            uint64_t const hashData[2] = { inOutHash, Hash::XXHash::GetHash64( bufferData ) };
+            inOutHash = Hash::XXHash::GetHash64( hashData, sizeof( hashData ) );
+        }
+
+        cgltf_free( pSceneData );
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    RawAssetCache::RawAssetCache( FileSystem::Path const& cacheDirectoryPath, FileSystem::Path const& sourceFilePath, char const* pImportSettings )
+    {
+        EE_ASSERT( sourceFilePath.IsValid() && pImportSettings != nullptr );
+
+        if ( !cacheDirectoryPath.IsValid() )
+        {
+            return;
+        }
+
+        // Hashing the source file is orders of magnitude cheaper than parsing it
+        Blob sourceFileData;
+        if ( !FileSystem::LoadFile( sourceFilePath, sourceFileData ) )
+        {
+            return;
+        }
+
+        // If we cant read the external buffers, let the reader deal with (and report) the error
+        uint64_t sourceHash = Hash::XXHash::GetHash64( sourceFileData );
+        if ( sourceFilePath.GetLowercaseExtensionAsString() == "gltf" && !TryHashExternalGltfBuffers( sourceFilePath, sourceFileData, sourceHash ) )
+        {
+            return;
+        }
+
+        uint64_t const keyData[3] = { sourceHash, Hash::XXHash::GetHash64( pImportSettings ), s_version };
+        m_key = Hash::XXHash::GetHash64( keyData, sizeof( keyData ) );
+
+        TInlineString<32> cacheFileName;
+        cacheFileName.sprintf( "%016llx.rawasset", m_key );
+        m_cacheFilePath = cacheDirectoryPath + cacheFileName.c_str();
+    }
+
+    uint64_t RawAssetCache::GetSkeletonHash( RawSkeleton const& rawSkeleton )
+    {
+        Serialization::BinaryOutputArchive archive;
+        archive << rawSkeleton;
+        return Hash::XXHash::GetHash64( archive.GetBinaryData(), archive.GetBinaryDataSize() );
+    }
+
+    //-------------------------------------------------------------------------
+
+    template<typename T>
+    bool RawAssetCache::TryLoadInternal( T& rawAsset ) const
+    {
+        if ( !IsEnabled() || !FileSystem::Exists( m_cacheFilePath ) )
+        {
+            return false;
+        }
+
+        Serialization::BinaryInputArchive archive;
+        if ( !archive.ReadFromFile( m_cacheFilePath ) )
+        {
+            return false;
+        }
+
+        // Guard against hash collisions in the file name and against entries written by an older cache version
+        uint64_t key = 0;
+        uint32_t version = 0;
+        archive << key << version;
+        if ( key != m_key || version != s_version )
+        {
+            return false;
+        }
+
+        archive << rawAsset;
+
+        // Update the modified time so that trimming the cache evicts the least recently used entries
+        std::error_code ec;
+        std::filesystem::last_write_time( m_cacheFilePath.c_str(), std::filesystem::file_time_type::clock::now(), ec );
+        return true;
+    }
+
+    template<typename T>
+    void RawAssetCache::StoreInternal( T const& rawAsset ) const
+    {
+        if ( !IsEnabled() )
+        {
+            return;
+        }
+
+        Serialization::BinaryOutputArchive archive;
+        archive << m_key << s_version << rawAsset;
+
+        // Multiple compiler processes can run at the same time, so write to a unique temporary file and then move it into place.
+        // If another process got there first, the existing entry is identical so we just discard ours.
+        String tempFileName( UUID::GenerateID().ToString().c_str() );
+        tempFileName += ".tmp";
+        FileSystem::Path const tempFilePath = m_cacheFilePath.GetParentDirectory() + tempFileName;
+        if ( !archive.WriteToFile( tempFilePath ) )
+        {
+            return;
+        }
+
+        if ( rename( tempFilePath.c_str(), m_cacheFilePath.c_str() ) != 0 )
+        {
+            FileSystem::EraseFile( tempFilePath );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RawAssetCache::TrimCache( FileSystem::Path const& cacheDirectoryPath, uint64_t maxCacheSizeInBytes )
+    {
+        if ( !cacheDirectoryPath.IsValid() || !FileSystem::Exists( cacheDirectoryPath ) )
+        {
+            return;
+        }
+
+        TVector<FileSystem::Path> cacheFilePaths;
+        if ( !FileSystem::GetDirectoryContents( cacheDirectoryPath, cacheFilePaths, FileSystem::DirectoryReaderOutput::OnlyFiles, FileSystem::DirectoryReaderMode::DontExpand, { "rawasset" } ) )
+        {
+            return;
+        }
+
+        struct CacheEntry
+        {
+            FileSystem::Path        m_path;
+            uint64_t                m_size;
+            uint64_t                m_modifiedTime;
+        };
+
+        TVector<CacheEntry> entries;
+        uint64_t totalSize = 0;
+        for ( auto const& cacheFilePath : cacheFilePaths )
+        {
+            std::error_code ec;
+            uint64_t const fileSize = std::filesystem::file_size( cacheFilePath.c_str(), ec );
+            if ( ec )
+            {
+                continue;
+            }
+
+            entries.push_back( { cacheFilePath, fileSize, FileSystem::GetFileModifiedTime( cacheFilePath ) } );
+            totalSize += fileSize;
+        }
+
+        if ( totalSize <= maxCacheSizeInBytes )
+        {
+            return;
+        }
+
+        // Evict the least recently used entries until we are within budget
+        eastl::sort( entries.begin(), entries.end(), [] ( CacheEntry const& a, CacheEntry const& b ) { return a.m_modifiedTime < b.m_modifiedTime; } );
+
+        for ( auto const& entry : entries )
+        {
+            if ( totalSize <= maxCacheSizeInBytes )
+            {
+                break;
+            }
+
+            if ( FileSystem::EraseFile( entry.m_path ) )
+            {
+                totalSize -= entry.m_size;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool RawAssetCache::TryLoad( RawMesh& rawMesh ) const { return TryLoadInternal( rawMesh ); }
+    bool RawAssetCache::TryLoad( RawSkeleton& rawSkeleton ) const { return TryLoadInternal( rawSkeleton ); }
+    bool RawAssetCache::TryLoad( RawAnimation& rawAnimation ) const { return TryLoadInternal( rawAnimation ); }
+
+    void RawAssetCache::Store( RawMesh const& rawMesh ) const { StoreInternal( rawMesh ); }
+    void RawAssetCache::Store( RawSkeleton const& rawSkeleton ) const { StoreInternal( rawSkeleton ); }
+    void RawAssetCache::Store( RawAnimation const& rawAnimation ) const { StoreInternal( rawAnimation ); }
+}
\ No newline at end of file
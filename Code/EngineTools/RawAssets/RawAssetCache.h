@@ -0,0 +1,61 @@
+#pragma once
+
+#include "EngineTools/_Module/API.h"
+#include "System/FileSystem/FileSystemPath.h"
+
+//-------------------------------------------------------------------------
+// Raw Asset Cache
+//-------------------------------------------------------------------------
+// Parsing FBX/glTF files is expensive and the same source file is usually read by a lot of different resources (i.e. all the takes in a character FBX)
+// The cache stores the parsed raw assets in a binary format on disk, so that subsequent reads (from any compiler process) can skip the source parsing
+// Entries are keyed by the source file contents (including any external gltf buffers) and the import settings used, so any change to either will result in a new entry
+// Stale entries are never invalidated in place, so the cache needs to be trimmed periodically to stay within its size budget
+
+namespace EE::RawAssets
+{
+    class RawMesh;
+    class RawSkeleton;
+    class RawAnimation;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINETOOLS_API RawAssetCache
+    {
+        // Update this value to invalidate all cached raw assets (i.e. when the raw asset formats or the readers change)
+        constexpr static uint32_t const s_version = 1;
+
+    public:
+
+        // The import settings string needs to uniquely describe all the settings that affect the resulting raw asset
+        // If the cache directory path is not valid or the source file cannot be read, the cache is disabled
+        RawAssetCache( FileSystem::Path const& cacheDirectoryPath, FileSystem::Path const& sourceFilePath, char const* pImportSettings );
+
+        inline bool IsEnabled() const { return m_cacheFilePath.IsValid(); }
+
+        // Try to load a previously cached raw asset, returns false if there is no cached entry
+        bool TryLoad( RawMesh& rawMesh ) const;
+        bool TryLoad( RawSkeleton& rawSkeleton ) const;
+        bool TryLoad( RawAnimation& rawAnimation ) const;
+
+        // Store a successfully read raw asset in the cache
+        void Store( RawMesh const& rawMesh ) const;
+        void Store( RawSkeleton const& rawSkeleton ) const;
+        void Store( RawAnimation const& rawAnimation ) const;
+
+        // Get a hash of the skeleton data, needed for the import settings of anything that is read relative to a skeleton
+        static uint64_t GetSkeletonHash( RawSkeleton const& rawSkeleton );
+
+        // Delete the least recently used entries until the total size of the cache is below the specified size
+        static void TrimCache( FileSystem::Path const& cacheDirectoryPath, uint64_t maxCacheSizeInBytes );
+
+    private:
+
+        template<typename T> bool TryLoadInternal( T& rawAsset ) const;
+        template<typename T> void StoreInternal( T const& rawAsset ) const;
+
+    private:
+
+        FileSystem::Path            m_cacheFilePath;
+        uint64_t                    m_key = 0;
+    };
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "RawAssetReader.h"
+#include "RawAssetCache.h"
 #include "Fbx/FbxSkeleton.h"
 #include "Fbx/FbxAnimation.h"
 #include "Fbx/FbxMesh.h"
@@ -36,22 +37,31 @@ namespace EE::RawAssets
     {
         EE_ASSERT( sourceFilePath.IsValid() && ctx.IsValid() );
 
-        TUniquePtr<RawAssets::RawMesh> pRawMesh = nullptr;
+        TInlineString<256> importSettings;
+        importSettings.sprintf( "StaticMesh|%s", nameOfMeshToCompile.c_str() );
+        RawAssetCache const cache( ctx.m_cacheDirectoryPath, sourceFilePath, importSettings.c_str() );
 
-        auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
-        if ( extension == "fbx" )
+        TUniquePtr<RawAssets::RawMesh> pRawMesh( EE::New<RawMesh>() );
+        bool const wasLoadedFromCache = cache.TryLoad( *pRawMesh );
+        if ( !wasLoadedFromCache )
         {
-            pRawMesh = Fbx::ReadStaticMesh( sourceFilePath, nameOfMeshToCompile );
-        }
-        else if ( extension == "gltf" || extension == "glb" )
-        {
-            pRawMesh = gltf::ReadStaticMesh( sourceFilePath, nameOfMeshToCompile );
-        }
-        else
-        {
-            char buffer[512];
-            Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
-            ctx.m_errorDelegate( buffer );
+            pRawMesh = nullptr;
+
+            auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
+            if ( extension == "fbx" )
+            {
+                pRawMesh = Fbx::ReadStaticMesh( sourceFilePath, nameOfMeshToCompile );
+            }
+            else if ( extension == "gltf" || extension == "glb" )
+            {
+                pRawMesh = gltf::ReadStaticMesh( sourceFilePath, nameOfMeshToCompile );
+            }
+            else
+            {
+                char buffer[512];
+                Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
+                ctx.m_errorDelegate( buffer );
+            }
         }
 
         //-------------------------------------------------------------------------
@@ -60,6 +70,10 @@ namespace EE::RawAssets
         {
             pRawMesh = nullptr;
         }
+        else if ( !wasLoadedFromCache )
+        {
+            cache.Store( *pRawMesh );
+        }
 
         //-------------------------------------------------------------------------
 
@@ -70,22 +84,31 @@ namespace EE::RawAssets
     {
         EE_ASSERT( sourceFilePath.IsValid() && ctx.IsValid() );
 
-        TUniquePtr<RawAssets::RawMesh> pRawMesh = nullptr;
+        TInlineString<256> importSettings;
+        importSettings.sprintf( "SkeletalMesh|%d", maxBoneInfluences );
+        RawAssetCache const cache( ctx.m_cacheDirectoryPath, sourceFilePath, importSettings.c_str() );
 
-        auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
-        if ( extension == "fbx" )
-        {
-            pRawMesh = Fbx::ReadSkeletalMesh( sourceFilePath, maxBoneInfluences );
-        }
-        else if ( extension == "gltf" || extension == "glb" )
+        TUniquePtr<RawAssets::RawMesh> pRawMesh( EE::New<RawMesh>() );
+        bool const wasLoadedFromCache = cache.TryLoad( *pRawMesh );
+        if ( !wasLoadedFromCache )
         {
-            pRawMesh = gltf::ReadSkeletalMesh( sourceFilePath, maxBoneInfluences );
-        }
-        else
-        {
-            char buffer[512];
-            Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
-            ctx.m_errorDelegate( buffer );
+            pRawMesh = nullptr;
+
+            auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
+            if ( extension == "fbx" )
+            {
+                pRawMesh = Fbx::ReadSkeletalMesh( sourceFilePath, maxBoneInfluences );
+            }
+            else if ( extension == "gltf" || extension == "glb" )
+            {
+                pRawMesh = gltf::ReadSkeletalMesh( sourceFilePath, maxBoneInfluences );
+            }
+            else
+            {
+                char buffer[512];
+                Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
+                ctx.m_errorDelegate( buffer );
+            }
         }
 
         //-------------------------------------------------------------------------
@@ -94,6 +117,10 @@ namespace EE::RawAssets
         {
             pRawMesh = nullptr;
         }
+        else if ( !wasLoadedFromCache )
+        {
+            cache.Store( *pRawMesh );
+        }
 
         //-------------------------------------------------------------------------
 
@@ -104,22 +131,31 @@ namespace EE::RawAssets
     {
         EE_ASSERT( sourceFilePath.IsValid() && ctx.IsValid() );
 
-        TUniquePtr<RawAssets::RawSkeleton> pRawSkeleton = nullptr;
+        TInlineString<256> importSettings;
+        importSettings.sprintf( "Skeleton|%s", skeletonRootBoneName.c_str() );
+        RawAssetCache const cache( ctx.m_cacheDirectoryPath, sourceFilePath, importSettings.c_str() );
 
-        auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
-        if ( extension == "fbx" )
+        TUniquePtr<RawAssets::RawSkeleton> pRawSkeleton( EE::New<RawSkeleton>() );
+        bool const wasLoadedFromCache = cache.TryLoad( *pRawSkeleton );
+        if ( !wasLoadedFromCache )
         {
-            pRawSkeleton = Fbx::ReadSkeleton( sourceFilePath, skeletonRootBoneName );
-        }
-        else if ( extension == "gltf" || extension == "glb" )
-        {
-            pRawSkeleton = gltf::ReadSkeleton( sourceFilePath, skeletonRootBoneName );
-        }
-        else
-        {
-            char buffer[512];
-            Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
-            ctx.m_errorDelegate( buffer );
+            pRawSkeleton = nullptr;
+
+            auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
+            if ( extension == "fbx" )
+            {
+                pRawSkeleton = Fbx::ReadSkeleton( sourceFilePath, skeletonRootBoneName );
+            }
+            else if ( extension == "gltf" || extension == "glb" )
+            {
+                pRawSkeleton = gltf::ReadSkeleton( sourceFilePath, skeletonRootBoneName );
+            }
+            else
+            {
+                char buffer[512];
+                Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
+                ctx.m_errorDelegate( buffer );
+            }
         }
 
         //-------------------------------------------------------------------------
@@ -128,6 +164,10 @@ namespace EE::RawAssets
         {
             pRawSkeleton = nullptr;
         }
+        else if ( !wasLoadedFromCache )
+        {
+            cache.Store( *pRawSkeleton );
+        }
 
         //-------------------------------------------------------------------------
 
@@ -138,27 +178,41 @@ namespace EE::RawAssets
     {
         EE_ASSERT( ctx.IsValid() && sourceFilePath.IsValid() && rawSkeleton.IsValid() );
 
-        TUniquePtr<RawAssets::RawAnimation> pRawAnimation = nullptr;
+        // The animation data depends on the skeleton it was read with
+        TInlineString<256> importSettings;
+        importSettings.sprintf( "Animation|%s|%016llx", animationName.c_str(), RawAssetCache::GetSkeletonHash( rawSkeleton ) );
+        RawAssetCache const cache( ctx.m_cacheDirectoryPath, sourceFilePath, importSettings.c_str() );
 
-        auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
-        if ( extension == "fbx" )
-        {
-            pRawAnimation = Fbx::ReadAnimation( sourceFilePath, rawSkeleton, animationName );
-        }
-        else if ( extension == "gltf" || extension == "glb" )
-        {
-            pRawAnimation = gltf::ReadAnimation( sourceFilePath, rawSkeleton, animationName );
-        }
-        else
+        // Cached animations are stored post-finalization
+        TUniquePtr<RawAssets::RawAnimation> pRawAnimation( EE::New<RawAnimation>( rawSkeleton ) );
+        bool const wasLoadedFromCache = cache.TryLoad( *pRawAnimation );
+        if ( !wasLoadedFromCache )
         {
-            TInlineString<512> errorString;
-            errorString.sprintf( "unsupported extension: %s", sourceFilePath.c_str() );
-            ctx.m_errorDelegate( errorString.c_str() );
-        }
+            pRawAnimation = nullptr;
 
-        //-------------------------------------------------------------------------
+            auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
+            if ( extension == "fbx" )
+            {
+                pRawAnimation = Fbx::ReadAnimation( sourceFilePath, rawSkeleton, animationName );
+            }
+            else if ( extension == "gltf" || extension == "glb" )
+            {
+                pRawAnimation = gltf::ReadAnimation( sourceFilePath, rawSkeleton, animationName );
+            }
+            else
+            {
+                TInlineString<512> errorString;
+                errorString.sprintf( "unsupported extension: %s", sourceFilePath.c_str() );
+                ctx.m_errorDelegate( errorString.c_str() );
+            }
 
-        pRawAnimation->Finalize();
+            //-------------------------------------------------------------------------
+
+            if ( pRawAnimation != nullptr )
+            {
+                pRawAnimation->Finalize();
+            }
+        }
 
         //-------------------------------------------------------------------------
 
@@ -166,6 +220,10 @@ namespace EE::RawAssets
         {
             pRawAnimation = nullptr;
         }
+        else if ( !wasLoadedFromCache )
+        {
+            cache.Store( *pRawAnimation );
+        }
 
         //-------------------------------------------------------------------------
 
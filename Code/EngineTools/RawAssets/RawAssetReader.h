@@ -21,6 +21,7 @@ namespace EE::RawAssets
 
         TFunction<void( char const* )>  m_warningDelegate;
         TFunction<void( char const* )>  m_errorDelegate;
+        FileSystem::Path                m_cacheDirectoryPath; // Optional: if set, parsed raw assets are cached in this directory (see RawAssetCache)
     };
 
     //-------------------------------------------------------------------------
@@ -12,11 +12,14 @@ namespace EE::RawAssets
 {
     class EE_ENGINETOOLS_API RawMesh : public RawAsset
     {
+        EE_SERIALIZE( EE_SERIALIZE_BASE( RawAsset ), m_geometrySections, m_skeleton, m_maxNumberOfBoneInfluences, m_isSkeletalMesh );
 
     public:
 
         struct VertexData
         {
+            EE_SERIALIZE( m_position, m_color, m_normal, m_tangent, m_binormal, m_texCoords, m_boneIndices, m_boneWeights );
+
             VertexData() = default;
 
             bool operator==( VertexData const& rhs ) const;
@@ -44,6 +47,8 @@ namespace EE::RawAssets
 
         struct GeometrySection
         {
+            EE_SERIALIZE( m_name, m_vertices, m_indices, m_numUVChannels, m_clockwiseWinding );
+
             GeometrySection() = default;
 
             inline uint32_t GetNumTriangles() const { return (uint32_t) m_indices.size() / 3; }
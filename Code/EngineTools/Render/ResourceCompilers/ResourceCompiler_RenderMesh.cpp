@@ -146,21 +146,218 @@ namespace EE::Render
         mesh.m_bounds = OBB( meshAlignedBounds );
     }
 
+    bool MeshCompiler::GenerateMeshLODs( MeshResourceDescriptor const& descriptor, Mesh& mesh ) const
+    {
+        if ( descriptor.m_LODs.empty() )
+        {
+            return true;
+        }
+
+        size_t const vertexSize = (size_t) mesh.m_vertexBuffer.m_byteStride;
+        size_t const numVertices = (size_t) mesh.GetNumVertices();
+        float const* pVertexPositions = (float const*) mesh.m_vertices.data(); // The position is always the first vertex element
+
+        bool allLODsGenerated = true;
+        uint32_t previousLODNumIndices = (uint32_t) mesh.m_indices.size();
+        float previousLODScreenSize = FLT_MAX;
+
+        TVector<uint32_t> simplifiedIndices;
+        for ( auto i = 0u; i < descriptor.m_LODs.size(); i++ )
+        {
+            MeshLODSettings const& settings = descriptor.m_LODs[i];
+            float const triangleRatio = Math::Clamp( settings.m_triangleRatio, 0.0f, 1.0f );
+            float const maxError = Math::Max( settings.m_maxError, 0.0f );
+
+            if ( settings.m_screenSize >= previousLODScreenSize )
+            {
+                Warning( "LOD %u screen size (%.3f) needs to be smaller than the previous LOD's screen size, skipping LOD!", i + 1, settings.m_screenSize );
+                allLODsGenerated = false;
+                continue;
+            }
+
+            // Simplify each section individually, locking the section borders so that adjacent sections stay connected
+            // Attribute and skinning seams are preserved since the simplifier never collapses across vertices that share a position
+            Mesh::LOD generatedLOD;
+            generatedLOD.m_screenSizeThreshold = settings.m_screenSize;
+
+            uint32_t const LODStartIndex = (uint32_t) mesh.m_indices.size();
+            float maxResultError = 0.0f;
+
+            for ( auto const& section : mesh.m_sections )
+            {
+                size_t const targetNumIndices = ( size_t( section.m_numIndices * triangleRatio ) / 3 ) * 3;
+                simplifiedIndices.resize( section.m_numIndices );
+
+                float resultError = 0.0f;
+                size_t const numSimplifiedIndices = meshopt_simplify( simplifiedIndices.data(), &mesh.m_indices[section.m_startIndex], section.m_numIndices, pVertexPositions, numVertices, vertexSize, targetNumIndices, maxError, meshopt_SimplifyLockBorder, &resultError );
+                maxResultError = Math::Max( maxResultError, resultError );
+
+                generatedLOD.m_sections.emplace_back( section.m_ID, (uint32_t) mesh.m_indices.size(), (uint32_t) numSimplifiedIndices );
+                mesh.m_indices.insert( mesh.m_indices.end(), simplifiedIndices.begin(), simplifiedIndices.begin() + numSimplifiedIndices );
+            }
+
+            // Discard LODs that don't meaningfully reduce the triangle count
+            uint32_t const LODNumIndices = (uint32_t) mesh.m_indices.size() - LODStartIndex;
+            if ( LODNumIndices == 0 || LODNumIndices >= previousLODNumIndices )
+            {
+                Warning( "LOD %u could not be simplified further within the max error (%.4f), skipping LOD!", i + 1, maxError );
+                mesh.m_indices.resize( LODStartIndex );
+                allLODsGenerated = false;
+                continue;
+            }
+
+            Message( "Generated LOD %u: %u triangles (error: %.4f)", i + 1, LODNumIndices / 3, maxResultError );
+            mesh.m_LODs.emplace_back( generatedLOD );
+            previousLODNumIndices = LODNumIndices;
+            previousLODScreenSize = settings.m_screenSize;
+        }
+
+        mesh.m_indexBuffer.m_byteSize = (uint32_t) mesh.m_indices.size() * sizeof( uint32_t );
+        return allLODsGenerated;
+    }
+
     void MeshCompiler::OptimizeMeshGeometry( Mesh& mesh ) const
     {
         size_t const vertexSize = (size_t) mesh.m_vertexBuffer.m_byteStride;
         size_t const numVertices = (size_t) mesh.GetNumVertices();
 
-        meshopt_optimizeVertexCache( &mesh.m_indices[0], &mesh.m_indices[0], mesh.m_indices.size(), mesh.m_vertices.size() );
+        // Triangles are only reordered within each section, since each section is drawn separately
+        for ( int32_t LOD = 0; LOD < mesh.GetNumLODs(); LOD++ )
+        {
+            for ( auto const& section : mesh.GetLODSections( LOD ) )
+            {
+                if ( section.m_numIndices == 0 )
+                {
+                    continue;
+                }
 
-        // Reorder indices for overdraw, balancing overdraw and vertex cache efficiency
-        const float kThreshold = 1.01f; // allow up to 1% worse ACMR to get more reordering opportunities for overdraw
-        meshopt_optimizeOverdraw( &mesh.m_indices[0], &mesh.m_indices[0], mesh.m_indices.size(), (float*) &mesh.m_vertices[0], numVertices, vertexSize, kThreshold );
+                uint32_t* pSectionIndices = &mesh.m_indices[section.m_startIndex];
+                meshopt_optimizeVertexCache( pSectionIndices, pSectionIndices, section.m_numIndices, numVertices );
 
-        // Vertex fetch optimization should go last as it depends on the final index order
+                // Reorder indices for overdraw, balancing overdraw and vertex cache efficiency
+                const float kThreshold = 1.01f; // allow up to 1% worse ACMR to get more reordering opportunities for overdraw
+                meshopt_optimizeOverdraw( pSectionIndices, pSectionIndices, section.m_numIndices, (float*) &mesh.m_vertices[0], numVertices, vertexSize, kThreshold );
+            }
+        }
+
+        // Vertex fetch optimization should go last as it depends on the final index order, all LODs share the vertex buffer so this needs to run over all the indices
         meshopt_optimizeVertexFetch( &mesh.m_vertices[0], &mesh.m_indices[0], mesh.m_indices.size(), &mesh.m_vertices[0], numVertices, vertexSize );
     }
 
+    bool MeshCompiler::CompressMeshVertices( Mesh& mesh ) const
+    {
+        EE_ASSERT( !mesh.HasCompressedVertices() );
+
+        bool const isSkeletalMesh = ( mesh.m_vertexBuffer.m_vertexFormat == VertexFormat::SkeletalMesh );
+        int32_t const numVertices = mesh.GetNumVertices();
+        int32_t const uncompressedVertexSize = mesh.m_vertexBuffer.m_byteStride;
+
+        // Skinning data is stored as 8bit indices
+        if ( isSkeletalMesh )
+        {
+            for ( int32_t i = 0; i < numVertices; i++ )
+            {
+                auto pVertex = reinterpret_cast<SkeletalMeshVertex const*>( mesh.m_vertices.data() + i * uncompressedVertexSize );
+                for ( int32_t j = 0; j < 4; j++ )
+                {
+                    if ( pVertex->m_boneIndices[j] > 255 )
+                    {
+                        Warning( "Mesh has more than 256 bones and can't use the compressed vertex format!" );
+                        return false;
+                    }
+                }
+            }
+        }
+
+        // Positions are quantized against the vertex bounds
+        //-------------------------------------------------------------------------
+
+        Vector boundsMin( FLT_MAX );
+        Vector boundsMax( -FLT_MAX );
+        for ( int32_t i = 0; i < numVertices; i++ )
+        {
+            auto pVertex = reinterpret_cast<StaticMeshVertex const*>( mesh.m_vertices.data() + i * uncompressedVertexSize );
+            boundsMin = Vector::Min( boundsMin, Vector( pVertex->m_position ) );
+            boundsMax = Vector::Max( boundsMax, Vector( pVertex->m_position ) );
+        }
+
+        Vector const boundsSize = boundsMax - boundsMin;
+        Vector const quantizationScale = Vector::Select( boundsSize, Vector::One, boundsSize.EqualsZero() ); // Avoid division by zero for flat meshes
+
+        mesh.m_positionDequantizationOffset = boundsMin.GetWithW0();
+        mesh.m_positionDequantizationScale = quantizationScale.GetWithW0();
+
+        // Convert vertices
+        //-------------------------------------------------------------------------
+
+        VertexFormat const compressedVertexFormat = isSkeletalMesh ? VertexFormat::SkeletalMeshCompressed : VertexFormat::StaticMeshCompressed;
+        int32_t const compressedVertexSize = VertexLayoutRegistry::GetDescriptorForFormat( compressedVertexFormat ).m_byteSize;
+        EE_ASSERT( compressedVertexSize == ( isSkeletalMesh ? sizeof( CompressedSkeletalMeshVertex ) : sizeof( CompressedStaticMeshVertex ) ) );
+
+        Blob compressedVertices;
+        compressedVertices.resize( compressedVertexSize * numVertices );
+
+        for ( int32_t i = 0; i < numVertices; i++ )
+        {
+            auto pVertex = reinterpret_cast<StaticMeshVertex const*>( mesh.m_vertices.data() + i * uncompressedVertexSize );
+            auto pCompressedVertex = new( compressedVertices.data() + i * compressedVertexSize ) CompressedStaticMeshVertex();
+
+            Vector const normalizedPosition = ( Vector( pVertex->m_position ) - boundsMin ) / quantizationScale;
+            pCompressedVertex->m_position[0] = VertexCompression::FloatToUNorm16( normalizedPosition.m_x );
+            pCompressedVertex->m_position[1] = VertexCompression::FloatToUNorm16( normalizedPosition.m_y );
+            pCompressedVertex->m_position[2] = VertexCompression::FloatToUNorm16( normalizedPosition.m_z );
+            pCompressedVertex->m_position[3] = 0;
+
+            Float2 const encodedNormal = VertexCompression::EncodeOctahedralNormal( Vector( pVertex->m_normal ).GetWithW0() );
+            pCompressedVertex->m_normal[0] = VertexCompression::FloatToSNorm16( encodedNormal.m_x );
+            pCompressedVertex->m_normal[1] = VertexCompression::FloatToSNorm16( encodedNormal.m_y );
+
+            pCompressedVertex->m_UV0[0] = VertexCompression::FloatToHalf( pVertex->m_UV0.m_x );
+            pCompressedVertex->m_UV0[1] = VertexCompression::FloatToHalf( pVertex->m_UV0.m_y );
+            pCompressedVertex->m_UV1[0] = VertexCompression::FloatToHalf( pVertex->m_UV1.m_x );
+            pCompressedVertex->m_UV1[1] = VertexCompression::FloatToHalf( pVertex->m_UV1.m_y );
+
+            //-------------------------------------------------------------------------
+
+            if ( isSkeletalMesh )
+            {
+                auto pSkeletalVertex = static_cast<SkeletalMeshVertex const*>( pVertex );
+                auto pCompressedSkeletalVertex = static_cast<CompressedSkeletalMeshVertex*>( pCompressedVertex );
+
+                // Quantize the weights and then distribute the rounding error to the largest weight so that the weights always sum to 1
+                int32_t weightSum = 0;
+                int32_t largestWeightIdx = 0;
+                for ( int32_t j = 0; j < 4; j++ )
+                {
+                    bool const isValidInfluence = pSkeletalVertex->m_boneIndices[j] != InvalidIndex;
+                    pCompressedSkeletalVertex->m_boneIndices[j] = isValidInfluence ? (uint8_t) pSkeletalVertex->m_boneIndices[j] : 0;
+                    pCompressedSkeletalVertex->m_boneWeights[j] = isValidInfluence ? (uint8_t) Math::RoundToInt( Math::Clamp( pSkeletalVertex->m_boneWeights[j], 0.0f, 1.0f ) * 255.0f ) : 0;
+                    weightSum += pCompressedSkeletalVertex->m_boneWeights[j];
+
+                    if ( pCompressedSkeletalVertex->m_boneWeights[j] > pCompressedSkeletalVertex->m_boneWeights[largestWeightIdx] )
+                    {
+                        largestWeightIdx = j;
+                    }
+                }
+
+                if ( weightSum > 0 )
+                {
+                    pCompressedSkeletalVertex->m_boneWeights[largestWeightIdx] = (uint8_t) Math::Clamp( pCompressedSkeletalVertex->m_boneWeights[largestWeightIdx] + ( 255 - weightSum ), 0, 255 );
+                }
+            }
+        }
+
+        // Update mesh buffers
+        //-------------------------------------------------------------------------
+
+        mesh.m_vertices.swap( compressedVertices );
+        mesh.m_vertexBuffer.m_vertexFormat = compressedVertexFormat;
+        mesh.m_vertexBuffer.m_byteStride = compressedVertexSize;
+        mesh.m_vertexBuffer.m_byteSize = compressedVertexSize * numVertices;
+
+        return true;
+    }
+
     void MeshCompiler::SetMeshDefaultMaterials( MeshResourceDescriptor const& descriptor, Mesh& mesh ) const
     {
         mesh.m_materials.reserve( mesh.GetNumSections() );
@@ -235,7 +432,7 @@ namespace EE::Render
             return Error( "Invalid mesh data path: %s", resourceDescriptor.m_meshPath.c_str() );
         }
 
-        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); } };
+        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); }, ctx.m_rawAssetCacheDirectoryPath };
         TUniquePtr<RawAssets::RawMesh> pRawMesh = RawAssets::ReadStaticMesh( readerCtx, meshFilePath, resourceDescriptor.m_meshName );
         if ( pRawMesh == nullptr )
         {
@@ -249,7 +446,9 @@ namespace EE::Render
 
         StaticMesh staticMesh;
         TransferMeshGeometry( *pRawMesh, staticMesh, 4 );
+        bool const allLODsGenerated = GenerateMeshLODs( resourceDescriptor, staticMesh );
         OptimizeMeshGeometry( staticMesh );
+        bool const compressionSucceeded = !resourceDescriptor.m_compressVertices || CompressMeshVertices( staticMesh );
         SetMeshDefaultMaterials( resourceDescriptor, staticMesh );
 
         // Serialize
@@ -269,7 +468,7 @@ namespace EE::Render
             in2.ReadFromFile( ctx.m_outputFilePath );
             in2 << hdr2 << mesh2;*/
 
-            if ( pRawMesh->HasWarnings() )
+            if ( pRawMesh->HasWarnings() || !allLODsGenerated || !compressionSucceeded )
             {
                 return CompilationSucceededWithWarnings( ctx );
             }
@@ -311,7 +510,7 @@ namespace EE::Render
             return Error( "Invalid mesh data path: %s", resourceDescriptor.m_meshPath.c_str() );
         }
 
-        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); } };
+        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); }, ctx.m_rawAssetCacheDirectoryPath };
         int32_t const maxBoneInfluences = 4;
         TUniquePtr<RawAssets::RawMesh> pRawMesh = RawAssets::ReadSkeletalMesh( readerCtx, meshFilePath, maxBoneInfluences );
         if ( pRawMesh == nullptr )
@@ -326,7 +525,9 @@ namespace EE::Render
 
         SkeletalMesh skeletalMesh;
         TransferMeshGeometry( *pRawMesh, skeletalMesh, maxBoneInfluences );
+        bool const allLODsGenerated = GenerateMeshLODs( resourceDescriptor, skeletalMesh );
         OptimizeMeshGeometry( skeletalMesh );
+        bool const compressionSucceeded = !resourceDescriptor.m_compressVertices || CompressMeshVertices( skeletalMesh );
         TransferSkeletalMeshData( *pRawMesh, skeletalMesh );
         SetMeshDefaultMaterials( resourceDescriptor, skeletalMesh );
 
@@ -341,7 +542,7 @@ namespace EE::Render
 
         if ( archive.WriteToFile( ctx.m_outputFilePath ) )
         {
-            if ( pRawMesh->HasWarnings() )
+            if ( pRawMesh->HasWarnings() || !allLODsGenerated || !compressionSucceeded )
             {
                 return CompilationSucceededWithWarnings( ctx );
             }
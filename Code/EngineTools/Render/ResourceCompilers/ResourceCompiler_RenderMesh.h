@@ -28,7 +28,9 @@ namespace EE::Render
     protected:
 
         void TransferMeshGeometry( RawAssets::RawMesh const& rawMesh, Mesh& mesh, int32_t maxBoneInfluences ) const;
+        bool GenerateMeshLODs( MeshResourceDescriptor const& descriptor, Mesh& mesh ) const; // Returns false if any of the requested LODs could not be generated
         void OptimizeMeshGeometry( Mesh& mesh ) const;
+        bool CompressMeshVertices( Mesh& mesh ) const; // Needs to run after all other geometry operations, returns false if the mesh couldn't be compressed
         void SetMeshDefaultMaterials( MeshResourceDescriptor const& descriptor, Mesh& mesh ) const;
         void SetMeshInstallDependencies( Mesh const& mesh, Resource::ResourceHeader& hdr ) const;
         virtual bool GetReferencedResources( ResourceID const& resourceID, TVector<ResourceID>& outReferencedResources ) const override;
@@ -39,7 +41,7 @@ namespace EE::Render
     class StaticMeshCompiler : public MeshCompiler
     {
         EE_REGISTER_TYPE( StaticMeshCompiler );
-        static const int32_t s_version = 1;
+        static const int32_t s_version = 3;
 
     public:
 
@@ -52,7 +54,7 @@ namespace EE::Render
     class SkeletalMeshCompiler : public MeshCompiler
     {
         EE_REGISTER_TYPE( SkeletalMeshCompiler );
-        static const int32_t s_version = 4;
+        static const int32_t s_version = 6;
 
     public:
 
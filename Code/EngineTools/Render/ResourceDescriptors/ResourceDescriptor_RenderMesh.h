@@ -19,6 +19,17 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    struct EE_ENGINETOOLS_API MeshLODSettings : public IRegisteredType
+    {
+        EE_REGISTER_TYPE( MeshLODSettings );
+
+        EE_EXPOSE float                                    m_triangleRatio = 0.5f; // The target fraction of the authored mesh's triangles to keep for this LOD
+        EE_EXPOSE float                                    m_maxError = 0.01f; // The max allowed simplification error, relative to the mesh extents. Simplification stops once this is reached even if the triangle target isn't.
+        EE_EXPOSE float                                    m_screenSize = 0.25f; // Switch to this LOD once the mesh covers less than this fraction of the viewport height
+    };
+
+    //-------------------------------------------------------------------------
+
     struct EE_ENGINETOOLS_API MeshResourceDescriptor : public Resource::ResourceDescriptor
     {
         EE_REGISTER_TYPE( MeshResourceDescriptor );
@@ -31,6 +42,12 @@ namespace EE::Render
 
         // Optional value that specifies the specific sub-mesh to compile, if this is not set, all sub-meshes contained in the source will be combined into a single mesh object
         EE_EXPOSE String                               m_meshName;
+
+        // Optional LODs to generate from the authored mesh, ordered from highest to lowest detail
+        EE_EXPOSE TVector<MeshLODSettings>             m_LODs;
+
+        // Use the compressed vertex format (quantized positions, octahedral normals, half UVs and 8bit skinning data) - roughly halves the vertex memory
+        EE_EXPOSE bool                                 m_compressVertices = false;
     };
 
     //-------------------------------------------------------------------------
@@ -107,19 +107,19 @@ namespace EE::Render
 
             if ( m_showVertices || m_showNormals )
             {
-                auto pVertex = reinterpret_cast<StaticMeshVertex const*>( m_pResource->GetVertexData().data() );
                 for ( auto i = 0; i < m_pResource->GetNumVertices(); i++ )
                 {
+                    Vector const vertexPosition = m_pResource->GetVertexPosition( i );
+
                     if ( m_showVertices )
                     {
-                        drawingCtx.DrawPoint( pVertex->m_position, Colors::Cyan );
+                        drawingCtx.DrawPoint( vertexPosition, Colors::Cyan );
                     }
 
                     if ( m_showNormals )
                     {
-                        drawingCtx.DrawLine( pVertex->m_position, pVertex->m_position + ( pVertex->m_normal * 0.15f ), Colors::Yellow );
+                        drawingCtx.DrawLine( vertexPosition, vertexPosition + ( m_pResource->GetVertexNormal( i ) * 0.15f ), Colors::Yellow );
                     }
-                    pVertex++;
                 }
             }
 
@@ -151,20 +151,19 @@ namespace EE::Render
         if ( IsResourceLoaded() && ( m_showVertices || m_showNormals ) )
         {
             auto drawingContext = GetDrawingContext();
-            auto pVertex = reinterpret_cast<StaticMeshVertex const*>( m_pResource->GetVertexData().data() );
             for ( auto i = 0; i < m_pResource->GetNumVertices(); i++ )
             {
+                Vector const vertexPosition = m_pResource->GetVertexPosition( i );
+
                 if ( m_showVertices )
                 {
-                    drawingContext.DrawPoint( pVertex->m_position, Colors::Cyan );
+                    drawingContext.DrawPoint( vertexPosition, Colors::Cyan );
                 }
 
                 if ( m_showNormals )
                 {
-                    drawingContext.DrawLine( pVertex->m_position, pVertex->m_position + ( pVertex->m_normal * 0.15f ), Colors::Yellow );
+                    drawingContext.DrawLine( vertexPosition, vertexPosition + ( m_pResource->GetVertexNormal( i ) * 0.15f ), Colors::Yellow );
                 }
-
-                pVertex++;
             }
         }
     }
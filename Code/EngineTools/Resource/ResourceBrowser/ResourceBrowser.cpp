@@ -2,6 +2,7 @@
 #include "ResourceBrowser_DescriptorCreator.h"
 #include "EngineTools/Resource/RawFileInspector.h"
 #include "EngineTools/Resource/ResourceDescriptor.h"
+#include "EngineTools/Resource/ResourceDatabase.h"
 #include "EngineTools/ThirdParty/pfd/portable-file-dialogs.h"
 #include "EngineTools/Core/ToolsContext.h"
 #include "System/TypeSystem/TypeRegistry.h"
@@ -9,6 +10,7 @@
 #include "System/Profiling.h"
 #include "System/Platform/PlatformHelpers_Win32.h"
 #include <eastl/sort.h>
+#include <eastl/algorithm.h>
 
 //-------------------------------------------------------------------------
 
@@ -45,7 +47,7 @@ namespace EE
         }
 
         virtual StringID GetNameID() const { return m_nameID; }
-        virtual uint64_t GetUniqueID() const override { return m_resourcePath.GetID(); }
+        virtual uint64_t GetUniqueID() const override { return m_resourcePath.GetHash(); }
         virtual bool HasContextMenu() const override { return true; }
         virtual bool IsActivatable() const override { return false; }
 
@@ -103,10 +105,14 @@ namespace EE
         // Refresh visual state
         RebuildBrowserTree();
         UpdateVisibility();
+
+        // Keep the tree in sync with the file system
+        m_toolsContext.m_pResourceDatabase->RegisterChangeListener( this );
     }
 
     ResourceBrowser::~ResourceBrowser()
     {
+        m_toolsContext.m_pResourceDatabase->UnregisterChangeListener( this );
         OnItemDoubleClicked().Unbind( m_onDoubleClickEventID );
 
         EE::Delete( m_pResourceDescriptorCreator );
@@ -122,6 +128,14 @@ namespace EE
         {
             DrawCreationControls( context );
             DrawFilterOptions( context );
+
+            // Items added by file system changes need to have the filters applied
+            if ( m_isVisibilityUpdateRequired )
+            {
+                UpdateVisibility();
+                m_isVisibilityUpdateRequired = false;
+            }
+
             TreeListView::Draw();
         }
         ImGui::End();
@@ -160,22 +174,7 @@ namespace EE
 
         for ( auto const& path : m_foundPaths )
         {
-            auto& parentItem = FindOrCreateParentForItem( path );
-
-            // Check if this is a registered resource
-            ResourceTypeID resourceTypeID;
-            auto const extension = path.GetLowercaseExtensionAsString();
-            if ( extension.length() <= 4 )
-            {
-                resourceTypeID = ResourceTypeID( extension.c_str() );
-                if ( !m_toolsContext.m_pTypeRegistry->IsRegisteredResourceType( resourceTypeID ) )
-                {
-                    resourceTypeID = ResourceTypeID();
-                }
-            }
-
-            // Create file item
-            parentItem.CreateChild<ResourceBrowserTreeItem>( path.GetFilename().c_str(), path, ResourcePath::FromFileSystemPath( m_toolsContext.GetRawResourceDirectory(), path ), resourceTypeID );
+            AddFileItem( path );
         }
 
         UpdateVisibility();
@@ -183,9 +182,67 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
+    void ResourceBrowser::OnFileCreated( FileSystem::Path const& path )
+    {
+        AddFileItem( path );
+    }
+
+    void ResourceBrowser::OnFileDeleted( FileSystem::Path const& path )
+    {
+        RemoveItem( path );
+    }
+
+    void ResourceBrowser::OnFileRenamed( FileSystem::Path const& oldPath, FileSystem::Path const& newPath )
+    {
+        RemoveItem( oldPath );
+        AddFileItem( newPath );
+    }
+
+    void ResourceBrowser::OnDirectoryCreated( FileSystem::Path const& path )
+    {
+        AddDirectoryItems( path );
+    }
+
+    void ResourceBrowser::OnDirectoryDeleted( FileSystem::Path const& path )
+    {
+        RemoveItem( path );
+    }
+
+    void ResourceBrowser::OnDirectoryRenamed( FileSystem::Path const& oldPath, FileSystem::Path const& newPath )
+    {
+        RemoveItem( oldPath );
+        AddDirectoryItems( newPath );
+    }
+
+    //-------------------------------------------------------------------------
+
     void ResourceBrowser::UpdateVisibility()
     {
-        auto VisibilityFunc = [this] ( TreeListViewItem const* pItem )
+        EE_PROFILE_FUNCTION();
+
+        // Query the search index once for the text filter, the per-item visibility check is then just a lookup
+        //-------------------------------------------------------------------------
+
+        bool const hasNameFilter = m_nameFilterBuffer[0] != 0;
+        m_nameFilterMatchingPathHashes.clear();
+
+        if ( hasNameFilter )
+        {
+            TVector<Resource::ResourceSearchIndex::SearchResult> searchResults;
+            m_toolsContext.m_pResourceDatabase->GetSearchIndex().Search( m_nameFilterBuffer, searchResults );
+
+            m_nameFilterMatchingPathHashes.reserve( searchResults.size() );
+            for ( auto const& result : searchResults )
+            {
+                m_nameFilterMatchingPathHashes.emplace_back( result.m_pPath->GetHash() );
+            }
+
+            eastl::sort( m_nameFilterMatchingPathHashes.begin(), m_nameFilterMatchingPathHashes.end() );
+        }
+
+        //-------------------------------------------------------------------------
+
+        auto VisibilityFunc = [this, hasNameFilter] ( TreeListViewItem const* pItem )
         {
             bool isVisible = true;
 
@@ -209,25 +266,9 @@ namespace EE
             // Text filter
             //-------------------------------------------------------------------------
 
-            if ( isVisible && m_nameFilterBuffer[0] != 0 )
+            if ( isVisible && hasNameFilter )
             {
-                String lowercaseLabel = pItem->GetDisplayName();
-                lowercaseLabel.make_lower();
-
-                char tempBuffer[256];
-                strcpy( tempBuffer, m_nameFilterBuffer );
-
-                char* token = strtok( tempBuffer, " " );
-                while ( token )
-                {
-                    if ( lowercaseLabel.find( token ) == String::npos )
-                    {
-                        isVisible = false;
-                        break;
-                    }
-
-                    token = strtok( NULL, " " );
-                }
+                isVisible = eastl::binary_search( m_nameFilterMatchingPathHashes.begin(), m_nameFilterMatchingPathHashes.end(), pDataFileItem->GetResourcePath().GetHash() );
             }
 
             //-------------------------------------------------------------------------
@@ -309,15 +350,23 @@ namespace EE
 
             shouldUpdateVisibility = true;
 
-            auto const SetExpansion = []( TreeListViewItem* pItem )
+            // Only rebuild the visual tree if the expansion actually changed, otherwise the visibility update only splices the changed rows
+            bool expansionChanged = false;
+            auto const SetExpansion = [&expansionChanged] ( TreeListViewItem* pItem )
             {
-                if ( pItem->IsVisible() )
+                if ( pItem->IsVisible() && !pItem->IsExpanded() )
                 {
                     pItem->SetExpanded( true );
+                    expansionChanged = true;
                 }
             };
 
-            ForEachItem( SetExpansion );
+            ForEachItem( SetExpansion, false );
+
+            if ( expansionChanged )
+            {
+                RefreshVisualState();
+            }
         }
 
         ImGui::SameLine();
@@ -419,7 +468,7 @@ namespace EE
             auto pFoundChildItem = pCurrentItem->FindChild( searchPredicate );
             if ( pFoundChildItem == nullptr )
             {
-                auto pItem = pCurrentItem->CreateChild<ResourceBrowserTreeItem>( splitPath[i].c_str(), directoryPath, ResourcePath::FromFileSystemPath( m_toolsContext.GetRawResourceDirectory(), directoryPath ) );
+                auto pItem = CreateItem<ResourceBrowserTreeItem>( pCurrentItem, splitPath[i].c_str(), directoryPath, ResourcePath::FromFileSystemPath( m_toolsContext.GetRawResourceDirectory(), directoryPath ) );
                 pCurrentItem = pItem;
             }
             else
@@ -433,6 +482,64 @@ namespace EE
         return *pCurrentItem;
     }
 
+    void ResourceBrowser::AddFileItem( FileSystem::Path const& path )
+    {
+        auto& parentItem = FindOrCreateParentForItem( path );
+
+        // Check if this is a registered resource
+        ResourceTypeID resourceTypeID;
+        auto const extension = path.GetLowercaseExtensionAsString();
+        if ( extension.length() <= 4 )
+        {
+            resourceTypeID = ResourceTypeID( extension.c_str() );
+            if ( !m_toolsContext.m_pTypeRegistry->IsRegisteredResourceType( resourceTypeID ) )
+            {
+                resourceTypeID = ResourceTypeID();
+            }
+        }
+
+        // Create file item
+        CreateItem<ResourceBrowserTreeItem>( &parentItem, path.GetFilename().c_str(), path, ResourcePath::FromFileSystemPath( m_toolsContext.GetRawResourceDirectory(), path ), resourceTypeID );
+        m_isVisibilityUpdateRequired = true;
+    }
+
+    void ResourceBrowser::AddDirectoryItems( FileSystem::Path const& path )
+    {
+        TVector<FileSystem::Path> foundPaths;
+        if ( !FileSystem::GetDirectoryContents( path, foundPaths, FileSystem::DirectoryReaderOutput::OnlyFiles, FileSystem::DirectoryReaderMode::Expand ) )
+        {
+            EE_HALT();
+        }
+
+        for ( auto const& filePath : foundPaths )
+        {
+            AddFileItem( filePath );
+        }
+    }
+
+    void ResourceBrowser::RemoveItem( FileSystem::Path const& path )
+    {
+        ResourcePath const resourcePath = ResourcePath::FromFileSystemPath( m_toolsContext.GetRawResourceDirectory(), path );
+        TreeListViewItem* pItem = FindItem( resourcePath.GetHash() );
+        if ( pItem == nullptr )
+        {
+            return;
+        }
+
+        TreeListViewItem* pParentItem = pItem->GetParent();
+        DestroyItem( pItem->GetUniqueID() );
+
+        // Directories only exist in the tree for the files they contain, so remove any directories that are now empty
+        while ( pParentItem != &m_rootItem && !pParentItem->HasChildren() )
+        {
+            TreeListViewItem* pNextParentItem = pParentItem->GetParent();
+            DestroyItem( pParentItem->GetUniqueID() );
+            pParentItem = pNextParentItem;
+        }
+
+        m_isVisibilityUpdateRequired = true;
+    }
+
     void ResourceBrowser::DrawItemContextMenu( TVector<TreeListViewItem*> const& selectedItemsWithContextMenus )
     {
         auto pResourceItem = (ResourceBrowserTreeItem*) GetSelection()[0];
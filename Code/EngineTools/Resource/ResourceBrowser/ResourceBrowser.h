@@ -35,7 +35,18 @@ namespace EE
 
         void OnBrowserItemDoubleClicked( TreeListViewItem* pItem );
 
+        // File system changes, the tree is updated incrementally
+        virtual void OnFileCreated( FileSystem::Path const& path ) override final;
+        virtual void OnFileDeleted( FileSystem::Path const& path ) override final;
+        virtual void OnFileRenamed( FileSystem::Path const& oldPath, FileSystem::Path const& newPath ) override final;
+        virtual void OnDirectoryCreated( FileSystem::Path const& path ) override final;
+        virtual void OnDirectoryDeleted( FileSystem::Path const& path ) override final;
+        virtual void OnDirectoryRenamed( FileSystem::Path const& oldPath, FileSystem::Path const& newPath ) override final;
+
         TreeListViewItem& FindOrCreateParentForItem( FileSystem::Path const& path );
+        void AddFileItem( FileSystem::Path const& path );
+        void AddDirectoryItems( FileSystem::Path const& path );
+        void RemoveItem( FileSystem::Path const& path );
 
         void UpdateVisibility();
         void DrawCreateNewDescriptorMenu( FileSystem::Path const& path );
@@ -47,9 +58,11 @@ namespace EE
 
         ToolsContext&                                       m_toolsContext;
         char                                                m_nameFilterBuffer[256];
+        TVector<uint64_t>                                   m_nameFilterMatchingPathHashes;
         TVector<ResourceTypeID>                             m_typeFilter;
         bool                                                m_showRawFiles = false;
         bool                                                m_showDeleteConfirmationDialog = false;
+        bool                                                m_isVisibilityUpdateRequired = false;
 
         int32_t                                             m_dataDirectoryPathDepth;
         TVector<FileSystem::Path>                           m_foundPaths;
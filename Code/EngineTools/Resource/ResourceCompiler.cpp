@@ -5,10 +5,12 @@
 
 namespace EE::Resource
 {
-    CompileContext::CompileContext( FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& compiledResourceDirectoryPath, ResourceID const& resourceToCompile, bool isCompilingForShippingBuild )
+    CompileContext::CompileContext( FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& compiledResourceDirectoryPath, ResourceID const& resourceToCompile, bool isCompilingForShippingBuild, FileSystem::Path const& rawAssetCacheDirectoryPath, TaskSystem* pTaskSystem )
         : m_compiledResourceDirectoryPath( compiledResourceDirectoryPath )
         , m_resourceID( resourceToCompile )
         , m_isCompilingForPackagedBuild( isCompilingForShippingBuild )
+        , m_rawAssetCacheDirectoryPath( rawAssetCacheDirectoryPath )
+        , m_pTaskSystem( pTaskSystem )
     {
         EE_ASSERT( rawResourceDirectoryPath.IsDirectoryPath() && FileSystem::Exists( rawResourceDirectoryPath ) && resourceToCompile.IsValid() );
 
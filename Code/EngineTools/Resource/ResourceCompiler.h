@@ -8,6 +8,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Resource
 {
     enum class CompilationResult
@@ -21,7 +25,7 @@ namespace EE::Resource
 
     struct EE_ENGINETOOLS_API CompileContext
     {
-        CompileContext( FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& compiledResourceDirectoryPath, ResourceID const& resourceToCompile, bool isCompilingForShippingBuild );
+        CompileContext( FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& compiledResourceDirectoryPath, ResourceID const& resourceToCompile, bool isCompilingForShippingBuild, FileSystem::Path const& rawAssetCacheDirectoryPath = FileSystem::Path(), TaskSystem* pTaskSystem = nullptr );
 
         bool IsValid() const;
 
@@ -37,6 +41,12 @@ namespace EE::Resource
         ResourceID const                                m_resourceID;
         FileSystem::Path const                          m_inputFilePath;
         FileSystem::Path const                          m_outputFilePath;
+
+        // Optional cache for parsed raw assets (FBX/glTF), shared by all compiler invocations
+        FileSystem::Path const                          m_rawAssetCacheDirectoryPath;
+
+        // Optional task system for compilers that can go wide
+        TaskSystem*                                     m_pTaskSystem = nullptr;
     };
 
     //-------------------------------------------------------------------------
@@ -56,6 +56,7 @@ namespace EE::Resource
     ResourceDatabase::~ResourceDatabase()
     {
         EE_ASSERT( m_rootDir.IsEmpty() && m_resourcesPerType.empty() );
+        EE_ASSERT( m_changeListeners.empty() );
     }
 
     //-------------------------------------------------------------------------
@@ -121,6 +122,7 @@ namespace EE::Resource
     {
         m_resourcesPerType.clear();
         m_rootDir.Clear();
+        m_searchIndex.Clear();
 
         if ( m_databaseUpdatedEvent.HasBoundUsers() )
         {
@@ -133,6 +135,7 @@ namespace EE::Resource
     {
         m_resourcesPerType.clear();
         m_rootDir.Clear();
+        m_searchIndex.Clear();
 
         //-------------------------------------------------------------------------
 
@@ -283,6 +286,8 @@ namespace EE::Resource
         {
             m_resourcesPerType[typeID].emplace_back( pNewEntry );
         }
+
+        AddToSearchIndex( pNewEntry );
     }
 
     void ResourceDatabase::RemoveFileRecord( FileSystem::Path const& path )
@@ -308,6 +313,9 @@ namespace EE::Resource
                     }
                 }
 
+                // Remove from search index
+                m_searchIndex.RemoveEntry( pDirectory->m_files[i]->m_resourceID.GetResourcePath() );
+
                 // Destroy record
                 EE::Delete( pDirectory->m_files[i] );
                 pDirectory->m_files.erase_unsorted( pDirectory->m_files.begin() + i );
@@ -318,20 +326,85 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    void ResourceDatabase::AddToSearchIndex( ResourceEntry const* pEntry )
+    {
+        EE_ASSERT( pEntry != nullptr );
+
+        ResourceTypeID const typeID = pEntry->m_resourceID.GetResourceTypeID();
+        m_searchIndex.AddEntry( pEntry->m_resourceID.GetResourcePath(), m_pTypeRegistry->IsRegisteredResourceType( typeID ) ? typeID : ResourceTypeID() );
+    }
+
+    void ResourceDatabase::AddDirectoryToSearchIndex( Directory const& directory )
+    {
+        for ( auto const& childDirectory : directory.m_directories )
+        {
+            AddDirectoryToSearchIndex( childDirectory );
+        }
+
+        for ( auto pRecord : directory.m_files )
+        {
+            AddToSearchIndex( pRecord );
+        }
+    }
+
+    void ResourceDatabase::RemoveDirectoryFromSearchIndex( Directory const& directory )
+    {
+        for ( auto const& childDirectory : directory.m_directories )
+        {
+            RemoveDirectoryFromSearchIndex( childDirectory );
+        }
+
+        for ( auto pRecord : directory.m_files )
+        {
+            m_searchIndex.RemoveEntry( pRecord->m_resourceID.GetResourcePath() );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourceDatabase::RegisterChangeListener( FileSystem::IFileSystemChangeListener* pListener ) const
+    {
+        EE_ASSERT( pListener != nullptr && !VectorContains( m_changeListeners, pListener ) );
+        m_changeListeners.emplace_back( pListener );
+    }
+
+    void ResourceDatabase::UnregisterChangeListener( FileSystem::IFileSystemChangeListener* pListener ) const
+    {
+        EE_ASSERT( pListener != nullptr && VectorContains( m_changeListeners, pListener ) );
+        m_changeListeners.erase_first_unsorted( pListener );
+    }
+
+    //-------------------------------------------------------------------------
+
     void ResourceDatabase::OnFileCreated( FileSystem::Path const& path )
     {
         AddFileRecord( path );
+
+        for ( auto pListener : m_changeListeners )
+        {
+            pListener->OnFileCreated( path );
+        }
     }
 
     void ResourceDatabase::OnFileDeleted( FileSystem::Path const& path )
     {
         RemoveFileRecord( path );
+
+        for ( auto pListener : m_changeListeners )
+        {
+            pListener->OnFileDeleted( path );
+        }
     }
 
     void ResourceDatabase::OnFileRenamed( FileSystem::Path const& oldPath, FileSystem::Path const& newPath )
     {
         RemoveFileRecord( oldPath );
         AddFileRecord( newPath );
+
+        for ( auto pListener : m_changeListeners )
+        {
+            pListener->OnFileRenamed( oldPath, newPath );
+        }
     }
 
     void ResourceDatabase::OnDirectoryCreated( FileSystem::Path const& newDirectoryPath )
@@ -346,6 +419,11 @@ namespace EE::Resource
         {
             AddFileRecord( filePath );
         }
+
+        for ( auto pListener : m_changeListeners )
+        {
+            pListener->OnDirectoryCreated( newDirectoryPath );
+        }
     }
 
     void ResourceDatabase::OnDirectoryDeleted( FileSystem::Path const& path )
@@ -359,11 +437,17 @@ namespace EE::Resource
             if ( pParentDirectory->m_directories[i].m_filePath == path )
             {
                 // Delete all children and remove directory
+                RemoveDirectoryFromSearchIndex( pParentDirectory->m_directories[i] );
                 pParentDirectory->m_directories[i].Clear();
                 pParentDirectory->m_directories.erase_unsorted( pParentDirectory->m_directories.begin() + i );
                 break;
             }
         }
+
+        for ( auto pListener : m_changeListeners )
+        {
+            pListener->OnDirectoryDeleted( path );
+        }
     }
 
     void ResourceDatabase::OnDirectoryRenamed( FileSystem::Path const& oldPath, FileSystem::Path const& newPath )
@@ -414,6 +498,14 @@ namespace EE::Resource
 
         //-------------------------------------------------------------------------
 
+        // All file paths below the directory will change so we need to re-index them
+        RemoveDirectoryFromSearchIndex( *pDirectory );
         pDirectory->ChangePath( m_rawResourceDirPath, newPath );
+        AddDirectoryToSearchIndex( *pDirectory );
+
+        for ( auto pListener : m_changeListeners )
+        {
+            pListener->OnDirectoryRenamed( oldPath, newPath );
+        }
     }
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include "ResourceSearchIndex.h"
 #include "EngineTools/Core/FileSystem/FileSystemWatcher.h"
 #include "System/Resource/ResourceID.h"
 #include "System/Types/StringID.h"
@@ -62,9 +63,16 @@ namespace EE::Resource
         // Get a list of all known resource of the specified type
         TVector<ResourceEntry*> const& GetAllResourcesOfType( ResourceTypeID typeID ) const;
 
+        // Get the search index for all known files (resources and raw files), this is kept up to date with the database
+        inline ResourceSearchIndex const& GetSearchIndex() const { return m_searchIndex; }
+
         // Event that fires whenever the database is updated
         TEventHandle<> OnDatabaseUpdated() const { return m_databaseUpdatedEvent; }
 
+        // Listen for the individual file system changes, listeners are notified once the database has processed each change
+        void RegisterChangeListener( FileSystem::IFileSystemChangeListener* pListener ) const;
+        void UnregisterChangeListener( FileSystem::IFileSystemChangeListener* pListener ) const;
+
     private:
 
         void RebuildDatabase();
@@ -78,6 +86,11 @@ namespace EE::Resource
         void AddFileRecord( FileSystem::Path const& path );
         void RemoveFileRecord( FileSystem::Path const& path );
 
+        // Search index
+        void AddToSearchIndex( ResourceEntry const* pEntry );
+        void AddDirectoryToSearchIndex( Directory const& directory );
+        void RemoveDirectoryFromSearchIndex( Directory const& directory );
+
         // File system listener
         virtual void OnFileCreated( FileSystem::Path const& path ) override final;
         virtual void OnFileDeleted( FileSystem::Path const& path ) override final;
@@ -96,6 +109,8 @@ namespace EE::Resource
 
         Directory                                                   m_rootDir;
         THashMap<ResourceTypeID, TVector<ResourceEntry*>>           m_resourcesPerType;
+        ResourceSearchIndex                                         m_searchIndex;
         mutable TEvent<>                                            m_databaseUpdatedEvent;
+        mutable TInlineVector<FileSystem::IFileSystemChangeListener*, 5>  m_changeListeners;
     };
 }
\ No newline at end of file
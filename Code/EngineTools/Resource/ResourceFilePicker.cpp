@@ -61,36 +61,33 @@ namespace EE::Resource
 
         //-------------------------------------------------------------------------
 
+        UpdateFilteredResourceList( resourceTypeID );
+    }
+
+    void ResourceFilePicker::UpdateFilteredResourceList( ResourceTypeID resourceTypeID )
+    {
         if ( m_filterBuffer[0] == 0 )
         {
             m_filteredResourceIDs = m_knownResourceIDs;
+            return;
         }
-        else
-        {
-            m_filteredResourceIDs.clear();
-            for ( auto const& resourceID : m_knownResourceIDs )
-            {
-                String lowercasePath = resourceID.m_resourceID.GetResourcePath().GetString();
-                lowercasePath.make_lower();
 
-                bool passesFilter = true;
-                char* token = strtok( m_filterBuffer, " " );
-                while ( token )
-                {
-                    if ( lowercasePath.find( token ) == String::npos )
-                    {
-                        passesFilter = false;
-                        break;
-                    }
+        //-------------------------------------------------------------------------
 
-                    token = strtok( NULL, " " );
-                }
+        // Raw files have no type set in the index and are never valid picker options
+        auto ResultFilter = [resourceTypeID] ( ResourceTypeID const& entryTypeID )
+        {
+            return resourceTypeID.IsValid() ? ( entryTypeID == resourceTypeID ) : entryTypeID.IsValid();
+        };
 
-                if ( passesFilter )
-                {
-                    m_filteredResourceIDs.emplace_back( resourceID );
-                }
-            }
+        TVector<ResourceSearchIndex::SearchResult> searchResults;
+        m_toolsContext.m_pResourceDatabase->GetSearchIndex().Search( m_filterBuffer, searchResults, ResultFilter );
+
+        m_filteredResourceIDs.clear();
+        m_filteredResourceIDs.reserve( searchResults.size() );
+        for ( auto const& result : searchResults )
+        {
+            m_filteredResourceIDs.emplace_back( ResourceID( *result.m_pPath ) );
         }
     }
 
@@ -336,7 +333,7 @@ namespace EE::Resource
 
             if ( filterUpdated )
             {
-                RefreshResourceList( resourceTypeID );
+                UpdateFilteredResourceList( resourceTypeID );
             }
 
             // Draw results
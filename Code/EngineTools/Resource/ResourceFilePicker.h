@@ -56,8 +56,12 @@ namespace EE::Resource
         // Draw the selection dialog, returns true if the dialog is closed
         bool DrawDialog( ResourceTypeID resourceTypeID, ResourceID const* pResourceID );
 
+        // Rebuild the list of all known resources of the specified type and refilter it
         void RefreshResourceList( ResourceTypeID resourceTypeID );
 
+        // Update the filtered list based on the current filter, results are ranked by the database search index
+        void UpdateFilteredResourceList( ResourceTypeID resourceTypeID );
+
     private:
 
         ToolsContext const&             m_toolsContext;
@@ -0,0 +1,374 @@
+#include "ResourceSearchIndex.h"
+#include "System/Math/Math.h"
+#include "System/Log.h"
+#include <EASTL/sort.h>
+#include <EASTL/algorithm.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    // Collisions in the mask are fine, the mask is only used to quickly reject entries
+    EE_FORCE_INLINE static uint64_t GetCharacterMaskBit( char c )
+    {
+        return 1ull << ( uint8_t( c ) & 63 );
+    }
+
+    EE_FORCE_INLINE static uint32_t GetTrigram( char const* pStr )
+    {
+        return ( uint32_t( uint8_t( pStr[0] ) ) << 16 ) | ( uint32_t( uint8_t( pStr[1] ) ) << 8 ) | uint32_t( uint8_t( pStr[2] ) );
+    }
+
+    EE_FORCE_INLINE static bool IsWordBoundary( String const& str, size_t idx )
+    {
+        if ( idx == 0 )
+        {
+            return true;
+        }
+
+        char const previousChar = str[idx - 1];
+        return previousChar == '/' || previousChar == '_' || previousChar == '-' || previousChar == '.' || previousChar == ' ';
+    }
+
+    static void GetUniqueTrigrams( String const& str, TVector<uint32_t>& outTrigrams )
+    {
+        outTrigrams.clear();
+
+        int32_t const numTrigrams = (int32_t) str.length() - 2;
+        for ( int32_t i = 0; i < numTrigrams; i++ )
+        {
+            outTrigrams.emplace_back( GetTrigram( &str[i] ) );
+        }
+
+        eastl::sort( outTrigrams.begin(), outTrigrams.end() );
+        outTrigrams.erase( eastl::unique( outTrigrams.begin(), outTrigrams.end() ), outTrigrams.end() );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourceSearchIndex::AddEntry( ResourcePath const& path, ResourceTypeID resourceTypeID )
+    {
+        EE_ASSERT( path.IsValid() && path.IsFile() );
+
+        // Entries are keyed on the full 64bit path hash, since the 32bit path IDs can collide for large data sets
+        auto const foundIter = m_pathHashToEntryIdx.find( path.GetHash() );
+        if ( foundIter != m_pathHashToEntryIdx.end() )
+        {
+            if ( m_entries[foundIter->second].m_path.GetString() != path.GetString() )
+            {
+                EE_LOG_WARNING( "Resource", "Search Index", "Path hash collision, '%s' will not be searchable (collides with '%s')", path.c_str(), m_entries[foundIter->second].m_path.c_str() );
+            }
+
+            return;
+        }
+
+        // Create entry
+        //-------------------------------------------------------------------------
+
+        int32_t entryIdx = InvalidIndex;
+        if ( m_freeEntryIndices.empty() )
+        {
+            entryIdx = (int32_t) m_entries.size();
+            m_entries.emplace_back();
+        }
+        else
+        {
+            entryIdx = m_freeEntryIndices.back();
+            m_freeEntryIndices.pop_back();
+        }
+
+        Entry& entry = m_entries[entryIdx];
+        entry.m_path = path;
+        entry.m_resourceTypeID = resourceTypeID;
+
+        // We dont need to search the "data://" prefix since every path has it
+        entry.m_searchString = path.GetString().substr( ResourcePath::s_pathPrefixLength );
+        entry.m_searchString.make_lower();
+
+        size_t const lastDelimiterIdx = entry.m_searchString.find_last_of( ResourcePath::s_pathDelimiter );
+        entry.m_filenameStartIdx = ( lastDelimiterIdx == String::npos ) ? 0 : int32_t( lastDelimiterIdx + 1 );
+
+        entry.m_characterMask = 0;
+        for ( char c : entry.m_searchString )
+        {
+            entry.m_characterMask |= GetCharacterMaskBit( c );
+        }
+
+        m_pathHashToEntryIdx[path.GetHash()] = entryIdx;
+
+        // Update postings
+        //-------------------------------------------------------------------------
+
+        TVector<uint32_t> trigrams;
+        GetUniqueTrigrams( entry.m_searchString, trigrams );
+        for ( uint32_t trigram : trigrams )
+        {
+            m_trigramPostings[trigram].emplace_back( entryIdx );
+        }
+    }
+
+    void ResourceSearchIndex::RemoveEntry( ResourcePath const& path )
+    {
+        auto iter = m_pathHashToEntryIdx.find( path.GetHash() );
+        if ( iter == m_pathHashToEntryIdx.end() || m_entries[iter->second].m_path.GetString() != path.GetString() )
+        {
+            return;
+        }
+
+        int32_t const entryIdx = iter->second;
+        m_pathHashToEntryIdx.erase( iter );
+
+        // Update postings
+        //-------------------------------------------------------------------------
+
+        Entry& entry = m_entries[entryIdx];
+
+        TVector<uint32_t> trigrams;
+        GetUniqueTrigrams( entry.m_searchString, trigrams );
+        for ( uint32_t trigram : trigrams )
+        {
+            auto postingIter = m_trigramPostings.find( trigram );
+            EE_ASSERT( postingIter != m_trigramPostings.end() );
+            postingIter->second.erase_first_unsorted( entryIdx );
+
+            if ( postingIter->second.empty() )
+            {
+                m_trigramPostings.erase( postingIter );
+            }
+        }
+
+        // Release entry
+        //-------------------------------------------------------------------------
+
+        entry.m_path.Clear();
+        entry.m_searchString.clear();
+        entry.m_resourceTypeID.Clear();
+        entry.m_characterMask = 0;
+        m_freeEntryIndices.emplace_back( entryIdx );
+    }
+
+    void ResourceSearchIndex::Clear()
+    {
+        m_entries.clear();
+        m_freeEntryIndices.clear();
+        m_pathHashToEntryIdx.clear();
+        m_trigramPostings.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    int32_t ResourceSearchIndex::ScoreEntry( Entry const& entry, TInlineVector<TInlineString<64>, 8> const& tokens, bool isFuzzyPass ) const
+    {
+        String const& str = entry.m_searchString;
+        int32_t score = 0;
+
+        for ( auto const& token : tokens )
+        {
+            // Verbatim match - prefer matches in the filename
+            //-------------------------------------------------------------------------
+
+            if ( !isFuzzyPass )
+            {
+                size_t matchIdx = str.find( token.c_str(), entry.m_filenameStartIdx );
+                if ( matchIdx != String::npos )
+                {
+                    score += 100;
+                    score += ( matchIdx == (size_t) entry.m_filenameStartIdx ) ? 60 : IsWordBoundary( str, matchIdx ) ? 30 : 0;
+                }
+                else
+                {
+                    matchIdx = str.find( token.c_str() );
+                    if ( matchIdx == String::npos )
+                    {
+                        return -1;
+                    }
+
+                    score += 40;
+                    score += IsWordBoundary( str, matchIdx ) ? 20 : 0;
+                }
+
+                score += (int32_t) token.length() * 2;
+                continue;
+            }
+
+            // Fuzzy match - greedy in-order subsequence, rewards consecutive and word boundary matches
+            //-------------------------------------------------------------------------
+
+            int32_t const strLength = (int32_t) str.length();
+            int32_t strIdx = 0;
+            int32_t previousMatchIdx = -2;
+            for ( char c : token )
+            {
+                while ( strIdx < strLength && str[strIdx] != c )
+                {
+                    strIdx++;
+                }
+
+                if ( strIdx == strLength )
+                {
+                    return -1;
+                }
+
+                score += 4;
+
+                if ( strIdx == previousMatchIdx + 1 )
+                {
+                    score += 8;
+                }
+                else if ( previousMatchIdx >= 0 )
+                {
+                    score -= Math::Min( strIdx - previousMatchIdx - 1, 8 );
+                }
+
+                if ( IsWordBoundary( str, strIdx ) )
+                {
+                    score += 6;
+                }
+
+                if ( strIdx >= entry.m_filenameStartIdx )
+                {
+                    score += 2;
+                }
+
+                previousMatchIdx = strIdx;
+                strIdx++;
+            }
+        }
+
+        // Prefer shorter paths
+        score -= (int32_t) str.length() / 16;
+        return Math::Max( score, 0 );
+    }
+
+    bool ResourceSearchIndex::Search( char const* pQuery, TVector<SearchResult>& outResults, ResultFilter const& resultFilter ) const
+    {
+        EE_ASSERT( pQuery != nullptr );
+        outResults.clear();
+
+        // Tokenize query
+        //-------------------------------------------------------------------------
+
+        TInlineVector<TInlineString<64>, 8> tokens;
+        uint64_t queryMask = 0;
+
+        TInlineString<64> currentToken;
+        for ( char const* pChar = pQuery; ; pChar++ )
+        {
+            if ( *pChar == 0 || *pChar == ' ' )
+            {
+                if ( !currentToken.empty() )
+                {
+                    tokens.emplace_back( currentToken );
+                    currentToken.clear();
+                }
+
+                if ( *pChar == 0 )
+                {
+                    break;
+                }
+            }
+            else
+            {
+                char const c = eastl::CharToLower( *pChar );
+                currentToken.push_back( c );
+                queryMask |= GetCharacterMaskBit( c );
+            }
+        }
+
+        if ( tokens.empty() )
+        {
+            return false;
+        }
+
+        //-------------------------------------------------------------------------
+
+        auto TryAddResult = [&] ( int32_t entryIdx, bool isFuzzyPass )
+        {
+            Entry const& entry = m_entries[entryIdx];
+            if ( !entry.IsValid() || ( entry.m_characterMask & queryMask ) != queryMask )
+            {
+                return;
+            }
+
+            if ( resultFilter != nullptr && !resultFilter( entry.m_resourceTypeID ) )
+            {
+                return;
+            }
+
+            int32_t const score = ScoreEntry( entry, tokens, isFuzzyPass );
+            if ( score >= 0 )
+            {
+                outResults.emplace_back( &entry.m_path, entry.m_resourceTypeID, score );
+            }
+        };
+
+        // Verbatim pass - use the shortest trigram posting list as the candidate list
+        //-------------------------------------------------------------------------
+
+        bool canMatchVerbatim = true;
+        TVector<int32_t> const* pCandidates = nullptr;
+        for ( auto const& token : tokens )
+        {
+            int32_t const numTrigrams = (int32_t) token.length() - 2;
+            for ( int32_t i = 0; i < numTrigrams && canMatchVerbatim; i++ )
+            {
+                auto postingIter = m_trigramPostings.find( GetTrigram( &token[i] ) );
+                if ( postingIter == m_trigramPostings.end() )
+                {
+                    canMatchVerbatim = false;
+                }
+                else if ( pCandidates == nullptr || postingIter->second.size() < pCandidates->size() )
+                {
+                    pCandidates = &postingIter->second;
+                }
+            }
+        }
+
+        if ( canMatchVerbatim )
+        {
+            if ( pCandidates != nullptr )
+            {
+                for ( int32_t entryIdx : *pCandidates )
+                {
+                    TryAddResult( entryIdx, false );
+                }
+            }
+            else // All tokens are too short for trigrams
+            {
+                int32_t const numEntries = (int32_t) m_entries.size();
+                for ( int32_t i = 0; i < numEntries; i++ )
+                {
+                    TryAddResult( i, false );
+                }
+            }
+        }
+
+        // Fuzzy pass - only if we have no verbatim matches
+        //-------------------------------------------------------------------------
+
+        if ( outResults.empty() )
+        {
+            int32_t const numEntries = (int32_t) m_entries.size();
+            for ( int32_t i = 0; i < numEntries; i++ )
+            {
+                TryAddResult( i, true );
+            }
+        }
+
+        // Rank results
+        //-------------------------------------------------------------------------
+
+        auto Comparator = [] ( SearchResult const& a, SearchResult const& b )
+        {
+            if ( a.m_score != b.m_score )
+            {
+                return a.m_score > b.m_score;
+            }
+
+            return a.m_pPath->GetString() < b.m_pPath->GetString();
+        };
+
+        eastl::sort( outResults.begin(), outResults.end(), Comparator );
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+#include "EngineTools/_Module/API.h"
+#include "System/Resource/ResourcePath.h"
+#include "System/Resource/ResourceTypeID.h"
+#include "System/Types/HashMap.h"
+#include "System/Types/Function.h"
+
+//-------------------------------------------------------------------------
+// Resource Search Index
+//-------------------------------------------------------------------------
+// A prebuilt search index over all the resource paths known to the resource database
+// Each path is stored lowercased along with a character mask and is registered in a trigram posting list so that we never have to touch every path per query
+//
+// Queries are space separated tokens, all of which need to match. Matching happens in two passes:
+// 1) Verbatim: each token must be a substring of the path, the candidates come from the shortest posting list of the query trigrams
+// 2) Fuzzy: only run if the verbatim pass found nothing, each token must be an (in-order) subsequence of the path
+// Results are ranked: matches in the filename, at word boundaries and in shorter paths score higher
+
+namespace EE::Resource
+{
+    class EE_ENGINETOOLS_API ResourceSearchIndex
+    {
+        struct Entry
+        {
+            inline bool IsValid() const { return m_path.IsValid(); }
+
+        public:
+
+            ResourcePath                                            m_path;
+            String                                                  m_searchString;
+            ResourceTypeID                                          m_resourceTypeID;
+            uint64_t                                                m_characterMask = 0;
+            int32_t                                                 m_filenameStartIdx = 0;
+        };
+
+    public:
+
+        struct SearchResult
+        {
+            SearchResult( ResourcePath const* pPath, ResourceTypeID resourceTypeID, int32_t score )
+                : m_pPath( pPath )
+                , m_resourceTypeID( resourceTypeID )
+                , m_score( score )
+            {}
+
+            // Only valid until the index is next modified
+            ResourcePath const*                                     m_pPath = nullptr;
+            ResourceTypeID                                          m_resourceTypeID;
+            int32_t                                                 m_score = 0;
+        };
+
+        // Optional filter for the results, takes the resource type of the entry (invalid for raw files)
+        using ResultFilter = TFunction<bool( ResourceTypeID const& resourceTypeID )>;
+
+    public:
+
+        // Add a file to the index, the type ID should only be set for registered resource types
+        void AddEntry( ResourcePath const& path, ResourceTypeID resourceTypeID );
+
+        // Remove a file from the index
+        void RemoveEntry( ResourcePath const& path );
+
+        // Remove all entries
+        void Clear();
+
+        inline int32_t GetNumEntries() const { return (int32_t) m_pathHashToEntryIdx.size(); }
+
+        // Search the index, results are sorted by score (highest first). Returns false if the query contained no tokens.
+        bool Search( char const* pQuery, TVector<SearchResult>& outResults, ResultFilter const& resultFilter = nullptr ) const;
+
+    private:
+
+        // Returns the score for the entry or -1 if the entry doesnt match all tokens
+        int32_t ScoreEntry( Entry const& entry, TInlineVector<TInlineString<64>, 8> const& tokens, bool isFuzzyPass ) const;
+
+    private:
+
+        TVector<Entry>                                              m_entries;
+        TVector<int32_t>                                            m_freeEntryIndices;
+        THashMap<uint64_t, int32_t>                                 m_pathHashToEntryIdx;
+        THashMap<uint32_t, TVector<int32_t>>                        m_trigramPostings;
+    };
+}
\ No newline at end of file
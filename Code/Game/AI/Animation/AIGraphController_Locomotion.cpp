@@ -7,41 +7,35 @@ namespace EE::AI
     LocomotionGraphController::LocomotionGraphController( Animation::GraphInstance* pGraphInstance, Render::SkeletalMeshComponent* pMeshComponent )
         : Animation::SubGraphController( pGraphInstance, pMeshComponent )
     {
-        m_speedParam.TryBind( this );
-        m_headingParam.TryBind( this );
-        m_facingParam.TryBind( this );
+        m_locomotionParams.AddParameter( "Locomotion_Speed", &LocomotionParameters::m_speed );
+        m_locomotionParams.AddParameter( "Locomotion_Heading", &LocomotionParameters::m_heading );
+        m_locomotionParams.AddParameter( "Locomotion_Facing", &LocomotionParameters::m_facing );
+        m_locomotionParams.TryBind( this );
     }
 
     void LocomotionGraphController::SetIdle()
     {
-        m_speedParam.Set( this, 0.0f );
-        m_headingParam.Set( this, Vector::Zero );
-        m_facingParam.Set( this, Vector::WorldForward );
+        m_locomotionParams.Set( this, LocomotionParameters() );
     }
 
     void LocomotionGraphController::SetLocomotionDesires( Seconds const deltaTime, Vector const& headingVelocityWS, Vector const& facingDirectionWS )
     {
         EE_ASSERT( Math::IsNearZero( facingDirectionWS.m_z ) );
 
-        Vector const characterSpaceHeading = ConvertWorldSpaceVectorToCharacterSpace( headingVelocityWS );
-        float const speed = characterSpaceHeading.GetLength3();
-
-        m_headingParam.Set( this, characterSpaceHeading );
-        m_speedParam.Set( this, speed );
+        LocomotionParameters params;
+        params.m_heading = ConvertWorldSpaceVectorToCharacterSpace( headingVelocityWS );
+        params.m_speed = params.m_heading.GetLength3();
 
         //-------------------------------------------------------------------------
 
         EE_ASSERT( !facingDirectionWS.IsNaN3() );
 
-        if ( facingDirectionWS.IsZero3() )
-        {
-            m_facingParam.Set( this, Vector::WorldForward );
-        }
-        else
+        if ( !facingDirectionWS.IsZero3() )
         {
             EE_ASSERT( facingDirectionWS.IsNormalized3() );
-            Vector const facingDirCS = ConvertWorldSpaceVectorToCharacterSpace( facingDirectionWS ).GetNormalized2();
-            m_facingParam.Set( this, facingDirCS );
+            params.m_facing = ConvertWorldSpaceVectorToCharacterSpace( facingDirectionWS ).GetNormalized2();
         }
+
+        m_locomotionParams.Set( this, params );
     }
 }
\ No newline at end of file
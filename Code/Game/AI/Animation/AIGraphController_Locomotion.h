@@ -11,6 +11,16 @@ namespace EE::AI
 
         EE_ANIMATION_SUBGRAPH_CONTROLLER_ID( LocomotionGraphController );
 
+    private:
+
+        // The locomotion parameters are always set together
+        struct LocomotionParameters
+        {
+            float       m_speed = 0.0f;
+            Vector      m_heading = Vector::Zero;
+            Vector      m_facing = Vector::WorldForward;
+        };
+
     public:
 
         LocomotionGraphController( Animation::GraphInstance* pGraphInstance, Render::SkeletalMeshComponent* pMeshComponent );
@@ -23,8 +33,6 @@ namespace EE::AI
 
     private:
 
-        ControlParameter<float>     m_speedParam = ControlParameter<float>( "Locomotion_Speed" );
-        ControlParameter<Vector>    m_headingParam = ControlParameter<Vector>( "Locomotion_Heading" );
-        ControlParameter<Vector>    m_facingParam = ControlParameter<Vector>( "Locomotion_Facing" );
+        ControlParameterBlock<LocomotionParameters>     m_locomotionParams;
     };
 }
\ No newline at end of file
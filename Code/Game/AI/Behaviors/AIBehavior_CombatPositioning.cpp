@@ -1,5 +1,10 @@
 #include "AIBehavior_CombatPositioning.h"
+#include "Game/Cover/Systems/WorldSystem_CoverManager.h"
 #include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
+#include "Engine/Player/Systems/WorldSystem_PlayerManager.h"
+#include "Engine/Camera/Components/Component_Camera.h"
+#include "Engine/AI/Components/Component_AI.h"
+#include "Engine/Physics/Components/Component_PhysicsCharacter.h"
 #include "System/Math/MathRandom.h"
 #include "System/Math/BoundingVolumes.h"
 
@@ -9,9 +14,40 @@ namespace EE::AI
 {
     void CombatPositionBehavior::StartInternal( BehaviorContext const& ctx )
     {
+        m_isWaitingForCoverQuery = false;
         m_waitTimer.Start( Math::GetRandomFloat( 1.0f, 3.0f ) );
     }
 
+    bool CombatPositionBehavior::TryRequestCoverQuery( BehaviorContext const& ctx ) const
+    {
+        auto pCoverManager = ctx.GetWorldSystem<CoverManager>();
+        if ( !pCoverManager->HasCoverDatabase() )
+        {
+            return false;
+        }
+
+        auto pPlayerManager = ctx.GetWorldSystem<PlayerManager>();
+        if ( !pPlayerManager->HasPlayer() || pPlayerManager->GetPlayerCamera() == nullptr )
+        {
+            return false;
+        }
+
+        CoverManager::CoverQuery query;
+        query.m_position = ctx.m_pCharacter->GetPosition();
+        query.m_threatPositions.emplace_back( pPlayerManager->GetPlayerCamera()->GetPosition() );
+        pCoverManager->RequestCoverQuery( ctx.m_pAIComponent->GetID().m_ID, query );
+        return true;
+    }
+
+    void CombatPositionBehavior::StartRandomMove( BehaviorContext const& ctx, AABB const& navmeshBounds )
+    {
+        Vector const boundsMin = navmeshBounds.GetMin();
+        Vector const boundsMax = navmeshBounds.GetMax();
+        Vector const moveGoalPosition( Math::GetRandomFloat( boundsMin.m_x, boundsMax.m_x ), Math::GetRandomFloat( boundsMin.m_y, boundsMax.m_y ), navmeshBounds.GetCenter().m_z );
+
+        m_moveToAction.Start( ctx, moveGoalPosition );
+    }
+
     Behavior::Status CombatPositionBehavior::UpdateInternal( BehaviorContext const& ctx )
     {
         // Remain in idle if there is no valid navmesh
@@ -23,18 +59,35 @@ namespace EE::AI
 
         //-------------------------------------------------------------------------
 
-        if ( m_waitTimer.IsRunning() )
+        if ( m_isWaitingForCoverQuery )
         {
             m_idleAction.Update( ctx );
 
-            // Wait for the timer to elapse and start a move
-            if ( m_waitTimer.Update( ctx.GetDeltaTime() ) )
+            // Queries are resolved in a single batch after the entity updates, so the result is available on the following frame
+            CoverManager::CoverQueryResult result;
+            if ( ctx.GetWorldSystem<CoverManager>()->TryGetCoverQueryResult( ctx.m_pAIComponent->GetID().m_ID, result ) && result.IsValid() )
+            {
+                m_moveToAction.Start( ctx, result.m_coverPoint.m_position );
+            }
+            else
             {
-                Vector const boundsMin = navmeshBounds.GetMin();
-                Vector const boundsMax = navmeshBounds.GetMax();
-                Vector const moveGoalPosition( Math::GetRandomFloat( boundsMin.m_x, boundsMax.m_x ), Math::GetRandomFloat( boundsMin.m_y, boundsMax.m_y ), navmeshBounds.GetCenter().m_z );
+                StartRandomMove( ctx, navmeshBounds );
+            }
+
+            m_isWaitingForCoverQuery = false;
+        }
+        else if ( m_waitTimer.IsRunning() )
+        {
+            m_idleAction.Update( ctx );
 
-                m_moveToAction.Start( ctx, moveGoalPosition );
+            // Wait for the timer to elapse and then look for cover, if there is no cover available just pick a random point
+            if ( m_waitTimer.Update( ctx.GetDeltaTime() ) )
+            {
+                m_isWaitingForCoverQuery = TryRequestCoverQuery( ctx );
+                if ( !m_isWaitingForCoverQuery )
+                {
+                    StartRandomMove( ctx, navmeshBounds );
+                }
             }
         }
         else // We're moving
@@ -60,6 +113,6 @@ namespace EE::AI
 
     void CombatPositionBehavior::StopInternal( BehaviorContext const& ctx, StopReason reason )
     {
-
+        m_isWaitingForCoverQuery = false;
     }
 }
\ No newline at end of file
@@ -5,6 +5,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { struct AABB; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::AI
 {
     class CombatPositionBehavior : public Behavior
@@ -19,10 +23,17 @@ namespace EE::AI
         virtual Status UpdateInternal( BehaviorContext const& ctx ) override;
         virtual void StopInternal( BehaviorContext const& ctx, StopReason reason ) override;
 
+        // Request a cover query against the player, returns false if cover isnt available
+        bool TryRequestCoverQuery( BehaviorContext const& ctx ) const;
+
+        // Move to a random position on the navmesh
+        void StartRandomMove( BehaviorContext const& ctx, AABB const& navmeshBounds );
+
     private:
 
         MoveToAction                m_moveToAction;
         IdleAction                  m_idleAction;
         ManualCountdownTimer        m_waitTimer;
+        bool                        m_isWaitingForCoverQuery = false;
     };
 }
\ No newline at end of file
@@ -13,36 +13,51 @@ namespace EE::AI
     {
         Transform capsuleWorldTransform = m_pCharacterComponent->GetCapsuleWorldTransform();
 
+        #if EE_DEVELOPMENT_TOOLS
+        auto drawingContext = ctx.GetDrawingContext();
+        //drawingContext.DrawCapsuleHeightX( capsuleWorldTransform, m_pCharacterComponent->GetCapsuleRadius(), m_pCharacterComponent->GetCapsuleCylinderPortionHalfHeight(), Colors::Red );
+        #endif
+
+        //-------------------------------------------------------------------------
+
+        pPhysicsScene->AcquireReadLock();
+        Vector const capsuleFinalPosition = ProjectCapsuleOntoEnvironment( pPhysicsScene, m_pCharacterComponent, capsuleWorldTransform.GetTranslation() + deltaTranslation, ctx.GetDeltaTime() );
+        pPhysicsScene->ReleaseReadLock();
+
+        //-------------------------------------------------------------------------
+
+        Transform finalCapsuleWorldTransform = capsuleWorldTransform;
+        finalCapsuleWorldTransform.SetTranslation( capsuleFinalPosition );
+
+        // Apply rotation delta and move character
+        Transform newCharacterTransform = m_pCharacterComponent->CalculateWorldTransformFromCapsuleTransform( finalCapsuleWorldTransform );
+        newCharacterTransform.AddRotation( deltaRotation );
+        m_pCharacterComponent->MoveCharacter( ctx.GetDeltaTime(), newCharacterTransform );
+        return true;
+    }
+
+    Vector CharacterPhysicsController::ProjectCapsuleOntoEnvironment( Physics::Scene* pPhysicsScene, Physics::CharacterComponent const* pCharacterComponent, Vector const& desiredCapsulePosition, Seconds deltaTime )
+    {
         // Create sphere to correct Z-position
         //-------------------------------------------------------------------------
 
         float const sphereRadiusReduction = 0.2f;
-        float const sphereRadius = m_pCharacterComponent->GetCapsuleRadius() - sphereRadiusReduction;
-        Vector const sphereOrigin = capsuleWorldTransform.GetTranslation();
-
-        // Attempt a sweep from current position to the bottom of the capsule including some "gravity"
-        float const verticalDistanceAllowedToTravelThisFrame = ( ctx.GetDeltaTime() * 0.5f );
-        Vector halfHeightVector = Vector( 0, 0, m_pCharacterComponent->GetCapsuleCylinderPortionHalfHeight() + sphereRadiusReduction );
-        Vector sweepStartPos = sphereOrigin + deltaTranslation + halfHeightVector;
-        Vector sweepEndPos = sweepStartPos - Vector( 0, 0, ( ( m_pCharacterComponent->GetCapsuleCylinderPortionHalfHeight() + sphereRadiusReduction ) * 2 ) + verticalDistanceAllowedToTravelThisFrame );
-        Vector capsuleFinalPosition = sphereOrigin;
 
-        #if EE_DEVELOPMENT_TOOLS
-        auto drawingContext = ctx.GetDrawingContext();
-        //drawingContext.DrawSphere( sweepStartPos, Vector( sphereRadius ), Colors::Gray, 5.0f );
-        //drawingContext.DrawCapsuleHeightX( capsuleWorldTransform, m_pCharacterComponent->GetCapsuleRadius(), m_pCharacterComponent->GetCapsuleCylinderPortionHalfHeight(), Colors::Red );
-        #endif
+        // Attempt a sweep from the desired position to the bottom of the capsule including some "gravity"
+        float const verticalDistanceAllowedToTravelThisFrame = ( deltaTime * 0.5f );
+        Vector halfHeightVector = Vector( 0, 0, pCharacterComponent->GetCapsuleCylinderPortionHalfHeight() + sphereRadiusReduction );
+        Vector sweepStartPos = desiredCapsulePosition + halfHeightVector;
+        Vector sweepEndPos = sweepStartPos - Vector( 0, 0, ( ( pCharacterComponent->GetCapsuleCylinderPortionHalfHeight() + sphereRadiusReduction ) * 2 ) + verticalDistanceAllowedToTravelThisFrame );
+        Vector capsuleFinalPosition = pCharacterComponent->GetCapsulePosition();
 
         //-------------------------------------------------------------------------
 
         Physics::QueryFilter filter;
         filter.SetLayerMask( Physics::CreateLayerMask( Physics::Layers::Environment ) );
-        filter.AddIgnoredEntity( m_pCharacterComponent->GetEntityID() );
-
-        pPhysicsScene->AcquireReadLock();
+        filter.AddIgnoredEntity( pCharacterComponent->GetEntityID() );
 
         Physics::SweepResults sweepResults;
-        if ( pPhysicsScene->SphereSweep( m_pCharacterComponent->GetCapsuleRadius(), sweepStartPos, sweepEndPos, filter, sweepResults ) )
+        if ( pPhysicsScene->SphereSweep( pCharacterComponent->GetCapsuleRadius(), sweepStartPos, sweepEndPos, filter, sweepResults ) )
         {
             if ( sweepResults.HadInitialOverlap() )
             {
@@ -50,33 +65,14 @@ namespace EE::AI
             }
             else
             {
-                #if EE_DEVELOPMENT_TOOLS
-                //drawingContext.DrawSphere( sweepResults.GetShapePosition(), Vector( sphereRadius ), Colors::Yellow, 2.0f );
-                #endif
-
                 capsuleFinalPosition = sweepResults.GetShapePosition() + halfHeightVector;
             }
         }
         else
         {
             capsuleFinalPosition = sweepEndPos + halfHeightVector;
-
-            #if EE_DEVELOPMENT_TOOLS
-            //drawingContext.DrawSphere( capsuleFinalPosition, Vector( sphereRadius ), Colors::LimeGreen, 2.0f );
-            #endif
         }
 
-        pPhysicsScene->ReleaseReadLock();
-
-        //-------------------------------------------------------------------------
-
-        Transform finalCapsuleWorldTransform = capsuleWorldTransform;
-        finalCapsuleWorldTransform.SetTranslation( capsuleFinalPosition );
-
-        // Apply rotation delta and move character
-        Transform newCharacterTransform = m_pCharacterComponent->CalculateWorldTransformFromCapsuleTransform( finalCapsuleWorldTransform );
-        newCharacterTransform.AddRotation( deltaRotation );
-        m_pCharacterComponent->MoveCharacter( ctx.GetDeltaTime(), newCharacterTransform );
-        return true;
+        return capsuleFinalPosition;
     }
 }
\ No newline at end of file
@@ -28,6 +28,10 @@ namespace EE::AI
 
         bool TryMoveCapsule( EntityWorldUpdateContext const& ctx, Physics::Scene* pPhysicsScene, Vector const& deltaTranslation, Quaternion const& deltaRotation );
 
+        // Find the final capsule position for a desired (horizontal) capsule position by projecting it onto the environment below it
+        // This is shared with the batched crowd movement and expects the caller to hold the scene read lock
+        static Vector ProjectCapsuleOntoEnvironment( Physics::Scene* pPhysicsScene, Physics::CharacterComponent const* pCharacterComponent, Vector const& desiredCapsulePosition, Seconds deltaTime );
+
     public:
 
         Physics::CharacterComponent*        m_pCharacterComponent = nullptr;
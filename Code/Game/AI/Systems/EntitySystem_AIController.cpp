@@ -1,6 +1,7 @@
 #include "EntitySystem_AIController.h"
 #include "Game/AI/Physics/AIPhysicsController.h"
 #include "Game/AI/Animation/AIAnimationController.h"
+#include "Game/AI/Systems/WorldSystem_AICharacterMovement.h"
 #include "Engine/AI/Components/Component_AI.h"
 #include "Engine/Navmesh/NavPower.h"
 #include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
@@ -135,11 +136,25 @@ namespace EE::AI
             Vector const& deltaTranslation = m_pCharacterMeshComponent->GetWorldTransform().RotateVector( m_pAnimGraphComponent->GetRootMotionDelta().GetTranslation() );
             Quaternion const& deltaRotation = m_pAnimGraphComponent->GetRootMotionDelta().GetRotation();
 
-            // Move character
-            m_behaviorContext.m_pCharacterController->TryMoveCapsule( ctx, m_behaviorContext.m_pPhysicsScene, deltaTranslation, deltaRotation );
-
-            // Run animation pose tasks
-            m_pAnimGraphComponent->ExecutePrePhysicsTasks( ctx.GetDeltaTime(), m_pCharacterMeshComponent->GetWorldTransform() );
+            // Move character - when batched, the movement system will also run the pose tasks once all characters have been moved
+            auto pMovementSystem = ctx.GetWorldSystem<CharacterMovementSystem>();
+            if ( pMovementSystem->IsBatchedMovementEnabled() )
+            {
+                CharacterMovementSystem::MoveRequest moveRequest;
+                moveRequest.m_pCharacterComponent = m_behaviorContext.m_pCharacter;
+                moveRequest.m_deltaTranslation = deltaTranslation;
+                moveRequest.m_deltaRotation = deltaRotation;
+                moveRequest.m_pGraphComponent = m_pAnimGraphComponent;
+                moveRequest.m_pMeshComponent = m_pCharacterMeshComponent;
+                pMovementSystem->RequestMove( moveRequest );
+            }
+            else
+            {
+                m_behaviorContext.m_pCharacterController->TryMoveCapsule( ctx, m_behaviorContext.m_pPhysicsScene, deltaTranslation, deltaRotation );
+
+                // Run animation pose tasks
+                m_pAnimGraphComponent->ExecutePrePhysicsTasks( ctx.GetDeltaTime(), m_pCharacterMeshComponent->GetWorldTransform() );
+            }
         }
         else if ( updateStage == UpdateStage::PostPhysics )
         {
@@ -0,0 +1,421 @@
+#include "WorldSystem_AICharacterMovement.h"
+#include "Game/AI/Physics/AIPhysicsController.h"
+#include "Engine/Animation/Components/Component_AnimationGraph.h"
+#include "Engine/Render/Components/Component_SkeletalMesh.h"
+#include "Engine/Physics/Systems/WorldSystem_Physics.h"
+#include "Engine/Physics/Components/Component_PhysicsCharacter.h"
+#include "Engine/Physics/PhysicsScene.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+#include <EASTL/sort.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::AI
+{
+    // The smallest number of characters we will process per job
+    constexpr static uint32_t const g_minMovesPerJob = 16;
+
+    // The separation sweep is lifted (and shortened) by this amount so that it doesnt hit the floor the character is standing on
+    constexpr static float const g_separationSweepFloorClearance = 0.1f;
+
+    //-------------------------------------------------------------------------
+
+    EE_FORCE_INLINE static uint64_t GetCellKey( int32_t cellX, int32_t cellY )
+    {
+        return ( uint64_t( uint32_t( cellX ) ) << 32 ) | uint64_t( uint32_t( cellY ) );
+    }
+
+    EE_FORCE_INLINE static int32_t GetCellCoordinate( float value, float cellSize )
+    {
+        return (int32_t) Math::Floor( value / cellSize );
+    }
+
+    // Separation only pushes characters horizontally, so sweep the correction against the environment to ensure we never push a character into a wall
+    static Vector ClampSeparationToEnvironment( Physics::Scene* pPhysicsScene, CharacterMovementSystem::PendingMove const& move )
+    {
+        Vector direction;
+        float distance = 0.0f;
+        ( move.m_desiredCapsulePosition - move.m_requestedCapsulePosition ).ToDirectionAndLength3( direction, distance );
+        if ( distance < Math::Epsilon )
+        {
+            return move.m_desiredCapsulePosition;
+        }
+
+        Physics::CharacterComponent const* pCharacterComponent = move.m_request.m_pCharacterComponent;
+
+        Physics::QueryFilter filter;
+        filter.SetLayerMask( Physics::CreateLayerMask( Physics::Layers::Environment ) );
+        filter.AddIgnoredEntity( pCharacterComponent->GetEntityID() );
+
+        float const cylinderPortionHalfHeight = Math::Max( pCharacterComponent->GetCapsuleCylinderPortionHalfHeight() - g_separationSweepFloorClearance, 0.0f );
+        Vector const sweepStartPosition = move.m_requestedCapsulePosition + Vector( 0, 0, g_separationSweepFloorClearance );
+
+        // If we hit something (or started overlapping), only apply the correction up to the hit
+        Physics::SweepResults sweepResults;
+        if ( pPhysicsScene->CapsuleSweep( cylinderPortionHalfHeight, move.m_radius, pCharacterComponent->GetCapsuleOrientation(), sweepStartPosition, direction, distance, filter, sweepResults ) )
+        {
+            return move.m_requestedCapsulePosition + ( sweepResults.GetShapePosition() - sweepStartPosition );
+        }
+
+        return move.m_desiredCapsulePosition;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CharacterMovementSystem::PendingMove::PendingMove( MoveRequest const& request )
+        : m_request( request )
+    {
+        EE_ASSERT( request.m_pCharacterComponent != nullptr );
+        m_requestedCapsulePosition = request.m_pCharacterComponent->GetCapsulePosition() + request.m_deltaTranslation;
+        m_desiredCapsulePosition = m_requestedCapsulePosition;
+        m_finalCapsulePosition = m_desiredCapsulePosition;
+        m_radius = request.m_pCharacterComponent->GetCapsuleRadius();
+        m_halfHeight = request.m_pCharacterComponent->GetCapsuleHalfHeight();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CharacterMovementSystem::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<EE::TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
+    }
+
+    void CharacterMovementSystem::ShutdownSystem()
+    {
+        EE_ASSERT( m_requestedMoves.empty() );
+        m_pTaskSystem = nullptr;
+    }
+
+    void CharacterMovementSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        if ( auto pCharacterComponent = TryCast<Physics::CharacterComponent>( pComponent ) )
+        {
+            m_characterComponents.emplace_back( pCharacterComponent );
+        }
+    }
+
+    void CharacterMovementSystem::UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        // Requests only live for the duration of the pre-physics stage and components are never unregistered during it
+        if ( auto pCharacterComponent = TryCast<Physics::CharacterComponent>( pComponent ) )
+        {
+            EE_ASSERT( !VectorContains( m_requestedMoves, pCharacterComponent, [] ( PendingMove const& move, Physics::CharacterComponent* const& pCharacter ) { return move.m_request.m_pCharacterComponent == pCharacter; } ) );
+            m_characterComponents.erase_first_unsorted( pCharacterComponent );
+        }
+    }
+
+    void CharacterMovementSystem::RequestMove( MoveRequest const& request )
+    {
+        Threading::ScopeLock lock( m_requestMutex );
+        m_requestedMoves.emplace_back( request );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CharacterMovementSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
+        {
+            Threading::ScopeLock lock( m_requestMutex );
+            m_moves.swap( m_requestedMoves );
+            m_requestedMoves.clear();
+        }
+
+        if ( m_moves.empty() )
+        {
+            return;
+        }
+
+        EE_PROFILE_SCOPE_AI( "Batched Character Movement" );
+
+        // Sort the requests so that the results dont depend on the order in which the entity updates ran
+        auto comparator = [] ( PendingMove const& moveA, PendingMove const& moveB )
+        {
+            return moveA.m_request.m_pCharacterComponent->GetID().m_ID < moveB.m_request.m_pCharacterComponent->GetID().m_ID;
+        };
+
+        eastl::sort( m_moves.begin(), m_moves.end(), comparator );
+
+        // Character vs character
+        //-------------------------------------------------------------------------
+
+        ResolveCharacterSeparation();
+
+        // Character vs environment
+        //-------------------------------------------------------------------------
+
+        struct EnvironmentProjectionTask final : public ITaskSet
+        {
+            EnvironmentProjectionTask( TVector<PendingMove>& moves, Physics::Scene* pPhysicsScene, Seconds deltaTime )
+                : m_moves( moves )
+                , m_pPhysicsScene( pPhysicsScene )
+                , m_deltaTime( deltaTime )
+            {
+                m_SetSize = (uint32_t) moves.size();
+                m_MinRange = g_minMovesPerJob;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_AI( "Character Environment Projection Task" );
+
+                // Only lock once per batch
+                m_pPhysicsScene->AcquireReadLock();
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    PendingMove& move = m_moves[i];
+                    move.m_desiredCapsulePosition = ClampSeparationToEnvironment( m_pPhysicsScene, move );
+                    move.m_finalCapsulePosition = CharacterPhysicsController::ProjectCapsuleOntoEnvironment( m_pPhysicsScene, move.m_request.m_pCharacterComponent, move.m_desiredCapsulePosition, m_deltaTime );
+                }
+                m_pPhysicsScene->ReleaseReadLock();
+            }
+
+        private:
+
+            TVector<PendingMove>&                       m_moves;
+            Physics::Scene*                             m_pPhysicsScene = nullptr;
+            Seconds                                     m_deltaTime;
+        };
+
+        auto pPhysicsScene = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>()->GetScene();
+        EnvironmentProjectionTask environmentProjectionTask( m_moves, pPhysicsScene, ctx.GetDeltaTime() );
+        m_pTaskSystem->ScheduleTask( &environmentProjectionTask );
+        m_pTaskSystem->WaitForTask( &environmentProjectionTask );
+
+        // Move characters
+        //-------------------------------------------------------------------------
+        // Moving a character sets its kinematic target, so we hold the write lock once for all of them
+
+        {
+            EE_PROFILE_SCOPE_AI( "Apply Character Moves" );
+
+            pPhysicsScene->AcquireWriteLock();
+            for ( PendingMove const& move : m_moves )
+            {
+                Physics::CharacterComponent* pCharacterComponent = move.m_request.m_pCharacterComponent;
+
+                Transform finalCapsuleWorldTransform = pCharacterComponent->GetCapsuleWorldTransform();
+                finalCapsuleWorldTransform.SetTranslation( move.m_finalCapsulePosition );
+
+                Transform newCharacterTransform = pCharacterComponent->CalculateWorldTransformFromCapsuleTransform( finalCapsuleWorldTransform );
+                newCharacterTransform.AddRotation( move.m_request.m_deltaRotation );
+                pCharacterComponent->MoveCharacter( ctx.GetDeltaTime(), newCharacterTransform );
+            }
+            pPhysicsScene->ReleaseWriteLock();
+        }
+
+        // Pose tasks
+        //-------------------------------------------------------------------------
+
+        struct PoseTaskExecutionTask final : public ITaskSet
+        {
+            PoseTaskExecutionTask( TVector<PendingMove> const& moves, Seconds deltaTime )
+                : m_moves( moves )
+                , m_deltaTime( deltaTime )
+            {
+                m_SetSize = (uint32_t) moves.size();
+                m_MinRange = 1;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_AI( "Character Pose Task Execution Task" );
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    MoveRequest const& request = m_moves[i].m_request;
+                    if ( request.m_pGraphComponent != nullptr )
+                    {
+                        EE_ASSERT( request.m_pMeshComponent != nullptr );
+                        request.m_pGraphComponent->ExecutePrePhysicsTasks( m_deltaTime, request.m_pMeshComponent->GetWorldTransform() );
+                    }
+                }
+            }
+
+        private:
+
+            TVector<PendingMove> const&                 m_moves;
+            Seconds                                     m_deltaTime;
+        };
+
+        PoseTaskExecutionTask poseTaskExecutionTask( m_moves, ctx.GetDeltaTime() );
+        m_pTaskSystem->ScheduleTask( &poseTaskExecutionTask );
+        m_pTaskSystem->WaitForTask( &poseTaskExecutionTask );
+
+        m_moves.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CharacterMovementSystem::BuildSpatialHash()
+    {
+        m_cellEntries.clear();
+
+        int32_t const numMoves = (int32_t) m_moves.size();
+        for ( int32_t i = 0; i < numMoves; i++ )
+        {
+            Vector const& position = m_moves[i].m_desiredCapsulePosition;
+            m_cellEntries.push_back( { GetCellKey( GetCellCoordinate( position.GetX(), m_cellSize ), GetCellCoordinate( position.GetY(), m_cellSize ) ), i } );
+        }
+
+        eastl::sort( m_cellEntries.begin(), m_cellEntries.end() );
+    }
+
+    void CharacterMovementSystem::AddSeparationObstacles()
+    {
+        // The moves are sorted by component ID at this point
+        auto comparator = [] ( PendingMove const& move, Physics::CharacterComponent* const& pCharacterComponent )
+        {
+            return move.m_request.m_pCharacterComponent->GetID().m_ID < pCharacterComponent->GetID().m_ID;
+        };
+
+        int32_t const numMoves = (int32_t) m_moves.size();
+        for ( auto pCharacterComponent : m_characterComponents )
+        {
+            if ( !pCharacterComponent->IsInitialized() )
+            {
+                continue;
+            }
+
+            auto foundIter = eastl::lower_bound( m_moves.begin(), m_moves.begin() + numMoves, pCharacterComponent, comparator );
+            if ( foundIter != m_moves.begin() + numMoves && foundIter->m_request.m_pCharacterComponent == pCharacterComponent )
+            {
+                continue;
+            }
+
+            MoveRequest obstacleRequest;
+            obstacleRequest.m_pCharacterComponent = pCharacterComponent;
+            m_moves.emplace_back( obstacleRequest ).m_isObstacle = true;
+        }
+
+        // Keep the results independent of the registration order
+        eastl::sort( m_moves.begin() + numMoves, m_moves.end(), [] ( PendingMove const& moveA, PendingMove const& moveB ) { return moveA.m_request.m_pCharacterComponent->GetID().m_ID < moveB.m_request.m_pCharacterComponent->GetID().m_ID; } );
+    }
+
+    void CharacterMovementSystem::ResolveCharacterSeparation()
+    {
+        if ( m_numSeparationIterations == 0 || m_characterComponents.size() < 2 )
+        {
+            return;
+        }
+
+        EE_PROFILE_SCOPE_AI( "Character Separation" );
+
+        int32_t const numMoves = (int32_t) m_moves.size();
+        AddSeparationObstacles();
+
+        // A cell needs to be at least as large as the biggest possible overlap so that we only ever need to check the neighboring cells
+        float maxRadius = 0.0f;
+        for ( PendingMove const& move : m_moves )
+        {
+            maxRadius = Math::Max( maxRadius, move.m_radius );
+        }
+
+        m_cellSize = Math::Max( maxRadius * 2.0f, 0.1f );
+
+        //-------------------------------------------------------------------------
+
+        // Calculate the corrections for all characters in parallel from the same set of positions, each character only moves itself by half of each overlap
+        struct SeparationTask final : public ITaskSet
+        {
+            SeparationTask( TVector<PendingMove>& moves, TVector<CellEntry> const& cellEntries, float cellSize )
+                : m_moves( moves )
+                , m_cellEntries( cellEntries )
+                , m_cellSize( cellSize )
+            {
+                m_SetSize = (uint32_t) moves.size();
+                m_MinRange = g_minMovesPerJob;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_AI( "Character Separation Task" );
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    PendingMove& move = m_moves[i];
+                    if ( move.m_isObstacle )
+                    {
+                        continue;
+                    }
+
+                    Vector const& position = move.m_desiredCapsulePosition;
+                    int32_t const cellX = GetCellCoordinate( position.GetX(), m_cellSize );
+                    int32_t const cellY = GetCellCoordinate( position.GetY(), m_cellSize );
+
+                    Vector correction = Vector::Zero;
+                    for ( int32_t offsetX = -1; offsetX <= 1; offsetX++ )
+                    {
+                        for ( int32_t offsetY = -1; offsetY <= 1; offsetY++ )
+                        {
+                            CellEntry const searchEntry = { GetCellKey( cellX + offsetX, cellY + offsetY ), InvalidIndex };
+                            for ( auto iter = eastl::lower_bound( m_cellEntries.begin(), m_cellEntries.end(), searchEntry ); iter != m_cellEntries.end() && iter->m_cellKey == searchEntry.m_cellKey; ++iter )
+                            {
+                                if ( iter->m_moveIdx == (int32_t) i )
+                                {
+                                    continue;
+                                }
+
+                                PendingMove const& otherMove = m_moves[iter->m_moveIdx];
+
+                                // Ignore characters that are above or below us
+                                if ( Math::Abs( position.GetZ() - otherMove.m_desiredCapsulePosition.GetZ() ) >= ( move.m_halfHeight + otherMove.m_halfHeight ) )
+                                {
+                                    continue;
+                                }
+
+                                Vector const offset = ( position - otherMove.m_desiredCapsulePosition ).Get2D();
+                                float const minDistance = move.m_radius + otherMove.m_radius;
+                                float const distanceSq = offset.GetLengthSquared2();
+                                if ( distanceSq >= minDistance * minDistance )
+                                {
+                                    continue;
+                                }
+
+                                // Coincident characters need a consistent push direction, so use the move order
+                                // Obstacles wont move, so we need to resolve the entire overlap ourselves
+                                float const distance = Math::Sqrt( distanceSq );
+                                Vector const direction = ( distance > Math::Epsilon ) ? offset / distance : ( ( (int32_t) i < iter->m_moveIdx ) ? Vector::UnitX : -Vector::UnitX );
+                                correction += direction * ( ( minDistance - distance ) * ( otherMove.m_isObstacle ? 1.0f : 0.5f ) );
+                            }
+                        }
+                    }
+
+                    // Never push a character further than its own radius in a single pass, this keeps dense crowds stable
+                    float const correctionLength = correction.GetLength2();
+                    if ( correctionLength > move.m_radius )
+                    {
+                        correction *= move.m_radius / correctionLength;
+                    }
+
+                    move.m_separationCorrection = correction;
+                }
+            }
+
+        private:
+
+            TVector<PendingMove>&                       m_moves;
+            TVector<CellEntry> const&                   m_cellEntries;
+            float                                       m_cellSize;
+        };
+
+        //-------------------------------------------------------------------------
+
+        for ( int32_t iteration = 0; iteration < m_numSeparationIterations; iteration++ )
+        {
+            BuildSpatialHash();
+
+            SeparationTask separationTask( m_moves, m_cellEntries, m_cellSize );
+            m_pTaskSystem->ScheduleTask( &separationTask );
+            m_pTaskSystem->WaitForTask( &separationTask );
+
+            for ( PendingMove& move : m_moves )
+            {
+                move.m_desiredCapsulePosition += move.m_separationCorrection;
+            }
+        }
+
+        // Remove the obstacles
+        m_moves.erase( m_moves.begin() + numMoves, m_moves.end() );
+    }
+}
\ No newline at end of file
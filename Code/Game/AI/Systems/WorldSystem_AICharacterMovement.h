@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Game/_Module/API.h"
+#include "Engine/Entity/EntityWorldSystem.h"
+#include "System/Math/Quaternion.h"
+#include "System/Math/Math.h"
+#include "System/Threading/Threading.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class TaskSystem; }
+namespace EE::Physics { class CharacterComponent; class Scene; }
+namespace EE::Animation { class AnimationGraphComponent; }
+namespace EE::Render { class CharacterMeshComponent; }
+
+//-------------------------------------------------------------------------
+// AI Character Movement System
+//-------------------------------------------------------------------------
+// Moves all AI characters together instead of inside each entity's update
+// The AI controllers request their moves during the pre-physics entity update and this system then:
+// 1) resolves the character-vs-character overlaps of the desired positions using a spatial hash
+//    characters that are not moving this frame (the player moves itself, idle AI dont request moves) are treated as immovable obstacles
+// 2) clamps the separation corrections against the environment and projects all the characters onto it, as parallel batches that each only take the scene read lock once
+// 3) moves all the characters under a single scene write lock and runs any pre-physics pose tasks that were waiting on the move
+
+namespace EE::AI
+{
+    class EE_GAME_API CharacterMovementSystem final : public IEntityWorldSystem
+    {
+    public:
+
+        struct MoveRequest
+        {
+            Physics::CharacterComponent*                        m_pCharacterComponent = nullptr;
+            Vector                                              m_deltaTranslation = Vector::Zero;
+            Quaternion                                          m_deltaRotation = Quaternion::Identity;
+
+            // Optional: the graph whose pre-physics pose tasks need to be run once the character has been moved
+            Animation::AnimationGraphComponent*                 m_pGraphComponent = nullptr;
+            Render::CharacterMeshComponent*                     m_pMeshComponent = nullptr;
+        };
+
+        struct PendingMove
+        {
+            PendingMove( MoveRequest const& request );
+
+        public:
+
+            MoveRequest                                         m_request;
+            Vector                                              m_requestedCapsulePosition;
+            Vector                                              m_desiredCapsulePosition;
+            Vector                                              m_separationCorrection = Vector::Zero;
+            Vector                                              m_finalCapsulePosition;
+            float                                               m_radius = 0.0f;
+            float                                               m_halfHeight = 0.0f;
+            bool                                                m_isObstacle = false;
+        };
+
+        struct CellEntry
+        {
+            inline bool operator<( CellEntry const& rhs ) const { return m_cellKey < rhs.m_cellKey; }
+
+            uint64_t                                            m_cellKey = 0;
+            int32_t                                             m_moveIdx = InvalidIndex;
+        };
+
+    public:
+
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( CharacterMovementSystem, RequiresUpdate( UpdateStage::PrePhysics ) );
+
+        // When disabled, the AI controllers move their characters themselves as part of their entity update
+        inline bool IsBatchedMovementEnabled() const { return m_isBatchedMovementEnabled; }
+        inline void SetBatchedMovementEnabled( bool isEnabled ) { m_isBatchedMovementEnabled = isEnabled; }
+
+        // The number of separation passes run over the desired positions, zero disables the character-vs-character resolution
+        inline int32_t GetNumSeparationIterations() const { return m_numSeparationIterations; }
+        inline void SetNumSeparationIterations( int32_t numIterations ) { m_numSeparationIterations = Math::Max( numIterations, 0 ); }
+
+        // Request a character move for this frame, this is threadsafe and is expected to be called from the pre-physics entity updates
+        void RequestMove( MoveRequest const& request );
+
+    private:
+
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override;
+        virtual void ShutdownSystem() override;
+        virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override;
+        virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override;
+        virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+
+        // Push apart all characters whose desired positions overlap
+        void ResolveCharacterSeparation();
+
+        // Add all the characters that are not moving this frame as obstacles, these are added to the end of the move list
+        void AddSeparationObstacles();
+
+        // Rebuild the spatial hash from the current desired positions
+        void BuildSpatialHash();
+
+    private:
+
+        TaskSystem*                                             m_pTaskSystem = nullptr;
+        TVector<Physics::CharacterComponent*>                   m_characterComponents;
+
+        Threading::Mutex                                        m_requestMutex;
+        TVector<PendingMove>                                    m_requestedMoves;
+        TVector<PendingMove>                                    m_moves;
+        TVector<CellEntry>                                      m_cellEntries;
+        float                                                   m_cellSize = 1.0f;
+
+        int32_t                                                 m_numSeparationIterations = 2;
+        bool                                                    m_isBatchedMovementEnabled = true;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Game/_Module/API.h"
+#include "Game/Cover/CoverDatabase.h"
+#include "Engine/Entity/EntityComponent.h"
+#include "System/Resource/ResourcePtr.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    struct EE_GAME_API CoverDatabaseBuildSettings : public IRegisteredType
+    {
+        EE_REGISTER_TYPE( CoverDatabaseBuildSettings );
+
+        EE_EXPOSE float                                    m_sampleSpacing = 1.0f; // The distance between the cover points sampled along the front of each cover volume
+        EE_EXPOSE float                                    m_characterRadius = 0.45f; // How far away from the cover geometry the points are placed
+        EE_EXPOSE float                                    m_collisionProbeDistance = 1.5f; // How far in front of the cover volume we look for collision to snap the points against
+        EE_EXPOSE float                                    m_collisionProbeHeight = 0.5f; // The height above the volume floor at which we probe for collision
+        EE_EXPOSE bool                                     m_discardPointsWithoutCollision = false; // Discard any points for which the probe didnt find any collision
+        EE_EXPOSE float                                    m_cellSize = 4.0f; // The cell size of the spatial index
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_GAME_API CoverDatabaseComponent : public EntityComponent
+    {
+        EE_REGISTER_SINGLETON_ENTITY_COMPONENT( CoverDatabaseComponent );
+        friend class CoverManager;
+
+    public:
+
+        using EntityComponent::EntityComponent;
+
+        inline bool HasCoverDatabase() const { return m_pCoverDatabase.IsLoaded() && m_pCoverDatabase->IsValid(); }
+        inline CoverDatabase const* GetCoverDatabase() const { return m_pCoverDatabase.GetPtr(); }
+
+        #if EE_DEVELOPMENT_TOOLS
+        CoverDatabaseBuildSettings const& GetBuildSettings() const { return m_buildSettings; }
+        #endif
+
+    private:
+
+        #if EE_DEVELOPMENT_TOOLS
+        EE_EXPOSE CoverDatabaseBuildSettings                 m_buildSettings;
+        #endif
+
+        // The compiled cover database for the map, generated from the map file with the same name
+        EE_EXPOSE TResourcePtr<CoverDatabase>                m_pCoverDatabase;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "CoverDatabase.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    CoverDatabase::CoverPoint CoverDatabase::GetCoverPoint( int32_t pointIdx ) const
+    {
+        EE_ASSERT( IsValidPointIndex( pointIdx ) );
+
+        PointBatch const& batch = m_pointBatches[pointIdx / 4];
+        uint32_t const laneIdx = uint32_t( pointIdx % 4 );
+
+        CoverPoint point;
+        point.m_position = Vector( batch.m_positionX[laneIdx], batch.m_positionY[laneIdx], batch.m_positionZ[laneIdx] );
+        point.m_protectionDirection = Vector( batch.m_directionX[laneIdx], batch.m_directionY[laneIdx], 0.0f, 0.0f );
+        point.m_coverHeight = batch.m_coverHeight[laneIdx];
+        point.m_coverType = m_coverTypes[pointIdx];
+        return point;
+    }
+
+    bool CoverDatabase::GetCellRange( Vector const& areaMin, Vector const& areaMax, int32_t& outMinX, int32_t& outMinY, int32_t& outMaxX, int32_t& outMaxY ) const
+    {
+        if ( m_numCoverPoints == 0 )
+        {
+            return false;
+        }
+
+        outMinX = (int32_t) Math::Floor( ( areaMin.GetX() - m_gridOrigin.m_x ) / m_cellSize );
+        outMinY = (int32_t) Math::Floor( ( areaMin.GetY() - m_gridOrigin.m_y ) / m_cellSize );
+        outMaxX = (int32_t) Math::Floor( ( areaMax.GetX() - m_gridOrigin.m_x ) / m_cellSize );
+        outMaxY = (int32_t) Math::Floor( ( areaMax.GetY() - m_gridOrigin.m_y ) / m_cellSize );
+
+        if ( outMaxX < 0 || outMaxY < 0 || outMinX >= m_numCellsX || outMinY >= m_numCellsY )
+        {
+            return false;
+        }
+
+        outMinX = Math::Max( outMinX, 0 );
+        outMinY = Math::Max( outMinY, 0 );
+        outMaxX = Math::Min( outMaxX, m_numCellsX - 1 );
+        outMaxY = Math::Min( outMaxY, m_numCellsY - 1 );
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Game/_Module/API.h"
+#include "Game/Cover/Components/Component_CoverVolume.h"
+#include "System/Resource/IResource.h"
+#include "System/Math/Math.h"
+
+//-------------------------------------------------------------------------
+// Cover Database
+//-------------------------------------------------------------------------
+// All the cover points for a map, generated offline from the cover volumes and the static collision
+// Each cover point has a protection direction (the direction the threats need to be in for the point to provide cover) and a cover height
+//
+// The points are stored in SoA batches of 4 so that they can be scored together, each batch only ever contains points from a single cell
+// The cells form a uniform 2D grid over the points, the batches of each cell are contiguous so a cell is simply a batch range
+
+namespace EE
+{
+    class EE_GAME_API CoverDatabase : public Resource::IResource
+    {
+        EE_REGISTER_RESOURCE( 'cov', "Cover Database" );
+        friend class CoverDatabaseGenerator;
+        friend class CoverDatabaseLoader;
+
+        EE_SERIALIZE( m_gridOrigin, m_cellSize, m_numCellsX, m_numCellsY, m_numCoverPoints, m_cellBatchStartIndices, m_pointBatches, m_coverTypes );
+
+    public:
+
+        // 4 cover points in SoA layout, unused lanes have a cover height of zero
+        struct PointBatch
+        {
+            EE_SERIALIZE( m_positionX, m_positionY, m_positionZ, m_directionX, m_directionY, m_coverHeight );
+
+            Float4                                          m_positionX = Float4::Zero;
+            Float4                                          m_positionY = Float4::Zero;
+            Float4                                          m_positionZ = Float4::Zero;
+            Float4                                          m_directionX = Float4::Zero;
+            Float4                                          m_directionY = Float4::Zero;
+            Float4                                          m_coverHeight = Float4::Zero;
+        };
+
+        struct CoverPoint
+        {
+            Vector                                          m_position;
+            Vector                                          m_protectionDirection;
+            float                                           m_coverHeight = 0.0f;
+            CoverType                                       m_coverType = CoverType::HighHidden;
+        };
+
+    public:
+
+        virtual bool IsValid() const override { return m_cellSize > 0.0f; }
+
+        inline int32_t GetNumCoverPoints() const { return m_numCoverPoints; }
+        inline int32_t GetNumPointBatches() const { return (int32_t) m_pointBatches.size(); }
+        inline PointBatch const& GetPointBatch( int32_t batchIdx ) const { return m_pointBatches[batchIdx]; }
+
+        // Points are identified by their batch and lane: pointIdx = batchIdx * 4 + laneIdx
+        inline bool IsValidPointIndex( int32_t pointIdx ) const { return pointIdx >= 0 && pointIdx < (int32_t) m_coverTypes.size() && GetPointBatch( pointIdx / 4 ).m_coverHeight[pointIdx % 4] > 0.0f; }
+        CoverPoint GetCoverPoint( int32_t pointIdx ) const;
+
+        // Spatial index
+        //-------------------------------------------------------------------------
+
+        inline float GetCellSize() const { return m_cellSize; }
+
+        // Get the (clamped) range of cells overlapping the 2D area, returns false if the area doesnt overlap the grid
+        bool GetCellRange( Vector const& areaMin, Vector const& areaMax, int32_t& outMinX, int32_t& outMinY, int32_t& outMaxX, int32_t& outMaxY ) const;
+
+        // Get the range of batches [start, end) for a cell
+        inline void GetCellBatchRange( int32_t cellX, int32_t cellY, int32_t& outStartIdx, int32_t& outEndIdx ) const
+        {
+            EE_ASSERT( cellX >= 0 && cellX < m_numCellsX && cellY >= 0 && cellY < m_numCellsY );
+            int32_t const cellIdx = cellY * m_numCellsX + cellX;
+            outStartIdx = m_cellBatchStartIndices[cellIdx];
+            outEndIdx = m_cellBatchStartIndices[cellIdx + 1];
+        }
+
+    private:
+
+        Float2                                              m_gridOrigin = Float2::Zero;
+        float                                               m_cellSize = 0.0f;
+        int32_t                                             m_numCellsX = 0;
+        int32_t                                             m_numCellsY = 0;
+        int32_t                                             m_numCoverPoints = 0;
+        TVector<int32_t>                                    m_cellBatchStartIndices; // Num cells + 1 entries
+        TVector<PointBatch>                                 m_pointBatches;
+        TVector<CoverType>                                  m_coverTypes; // One per lane
+    };
+}
\ No newline at end of file
@@ -41,12 +41,41 @@ namespace EE
 
     void CoverDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
-       
+        if ( ImGui::MenuItem( "Overview" ) )
+        {
+            m_isOverviewWindowOpen = true;
+        }
+
+        //-------------------------------------------------------------------------
+
+        ImGui::Checkbox( "Draw Cover Points", &m_pCoverManager->m_drawCoverPoints );
+        ImGui::Checkbox( "Draw Query Results", &m_pCoverManager->m_drawQueryResults );
     }
 
     void CoverDebugView::DrawOverviewWindow( EntityWorldUpdateContext const& context )
     {
-       
+        if ( ImGui::Begin( "Cover Overview", &m_isOverviewWindowOpen ) )
+        {
+            ImGui::Text( "Num Cover Volumes: %u", m_pCoverManager->m_coverVolumes.size() );
+
+            CoverDatabase const* pCoverDatabase = m_pCoverManager->GetCoverDatabase();
+            if ( pCoverDatabase != nullptr )
+            {
+                ImGui::Text( "Num Cover Points: %d", pCoverDatabase->GetNumCoverPoints() );
+                ImGui::Text( "Num Point Batches: %d", pCoverDatabase->GetNumPointBatches() );
+                ImGui::Text( "Cell Size: %.2f", pCoverDatabase->GetCellSize() );
+            }
+            else
+            {
+                ImGui::Text( "No Cover Database Loaded" );
+            }
+
+            ImGui::Separator();
+
+            ImGui::Text( "Queries Last Update: %d", m_pCoverManager->m_numQueriesLastUpdate );
+            ImGui::Text( "Line Of Sight Rays Last Update: %d", m_pCoverManager->m_numRaysLastUpdate );
+        }
+        ImGui::End();
     }
 }
 #endif
\ No newline at end of file
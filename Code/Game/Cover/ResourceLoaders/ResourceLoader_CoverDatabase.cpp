@@ -0,0 +1,30 @@
+#include "ResourceLoader_CoverDatabase.h"
+#include "Game/Cover/CoverDatabase.h"
+#include "System/Serialization/BinarySerialization.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    CoverDatabaseLoader::CoverDatabaseLoader()
+    {
+        m_loadableTypes.push_back( CoverDatabase::GetStaticResourceTypeID() );
+    }
+
+    bool CoverDatabaseLoader::LoadInternal( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord, Serialization::BinaryInputArchive& archive ) const
+    {
+        auto pCoverDatabase = EE::New<CoverDatabase>();
+        archive << *pCoverDatabase;
+
+        if ( !pCoverDatabase->IsValid() || pCoverDatabase->m_cellBatchStartIndices.size() != size_t( pCoverDatabase->m_numCellsX * pCoverDatabase->m_numCellsY + 1 ) )
+        {
+            EE_LOG_ERROR( "Cover", "Cover Database Loader", "Failed to load cover database: %s, compiled resource is malformed", resID.ToString().c_str() );
+            EE::Delete( pCoverDatabase );
+            return false;
+        }
+
+        pResourceRecord->SetResourceData( pCoverDatabase );
+        return true;
+    }
+}
\ No newline at end of file
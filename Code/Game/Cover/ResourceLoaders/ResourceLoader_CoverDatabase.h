@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Game/_Module/API.h"
+#include "System/Resource/ResourceLoader.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class CoverDatabaseLoader : public Resource::ResourceLoader
+    {
+    public:
+
+        CoverDatabaseLoader();
+
+    private:
+
+        virtual bool LoadInternal( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord, Serialization::BinaryInputArchive& archive ) const override final;
+    };
+}
\ No newline at end of file
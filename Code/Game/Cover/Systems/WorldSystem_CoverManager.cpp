@@ -1,16 +1,45 @@
 #include "WorldSystem_CoverManager.h"
 #include "Game/Cover/Components/Component_CoverVolume.h"
+#include "Game/Cover/Components/Component_CoverDatabase.h"
+#include "Engine/Physics/Systems/WorldSystem_Physics.h"
+#include "Engine/Physics/PhysicsScene.h"
+#include "Engine/Physics/PhysicsLayers.h"
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityMap.h"
+#include "System/Drawing/DebugDrawing.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+#include <EASTL/sort.h>
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    // The smallest number of queries we will score per job
+    constexpr static uint32_t const g_minQueriesPerJob = 8;
+
+    // The smallest number of line of sight rays we will cast per job
+    constexpr static uint32_t const g_minRaysPerJob = 32;
+
+    // How high up the cover (as a fraction of its height) we check the line of sight to
+    constexpr static float const g_lineOfSightHeightRatio = 0.75f;
+
+    //-------------------------------------------------------------------------
+
+    void CoverManager::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<EE::TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
+    }
+
     void CoverManager::ShutdownSystem()
     {
         EE_ASSERT( m_coverVolumes.empty() );
+        EE_ASSERT( m_pCoverDatabaseComponent == nullptr && m_pCoverDatabase == nullptr );
+        EE_ASSERT( m_requestedQueries.empty() );
+        m_queryResults.clear();
+        m_pTaskSystem = nullptr;
     }
 
     void CoverManager::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -19,6 +48,12 @@ namespace EE
         {
             m_coverVolumes.Add( pCoverComponent );
         }
+        else if ( auto pCoverDatabaseComponent = TryCast<CoverDatabaseComponent>( pComponent ) )
+        {
+            EE_ASSERT( m_pCoverDatabaseComponent == nullptr );
+            m_pCoverDatabaseComponent = pCoverDatabaseComponent;
+            m_pCoverDatabase = pCoverDatabaseComponent->HasCoverDatabase() ? pCoverDatabaseComponent->GetCoverDatabase() : nullptr;
+        }
     }
 
     void CoverManager::UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -27,11 +62,381 @@ namespace EE
         {
             m_coverVolumes.Remove( pCoverComponent );
         }
+        else if ( auto pCoverDatabaseComponent = TryCast<CoverDatabaseComponent>( pComponent ) )
+        {
+            EE_ASSERT( m_pCoverDatabaseComponent == pCoverDatabaseComponent );
+            m_pCoverDatabaseComponent = nullptr;
+            m_pCoverDatabase = nullptr;
+            m_queryResults.clear();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CoverManager::RequestCoverQuery( uint64_t requesterID, CoverQuery const& query )
+    {
+        EE_ASSERT( query.m_searchRadius > 0.0f );
+
+        Threading::ScopeLock lock( m_requestMutex );
+        PendingQuery& pendingQuery = m_requestedQueries.emplace_back();
+        pendingQuery.m_requesterID = requesterID;
+        pendingQuery.m_query = query;
+    }
+
+    bool CoverManager::TryGetCoverQueryResult( uint64_t requesterID, CoverQueryResult& outResult ) const
+    {
+        auto iter = m_queryResults.find( requesterID );
+        if ( iter == m_queryResults.end() )
+        {
+            return false;
+        }
+
+        outResult = iter->second;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CoverManager::ScoreCandidates( PendingQuery& pendingQuery ) const
+    {
+        EE_ASSERT( m_pCoverDatabase != nullptr );
+
+        CoverQuery const& query = pendingQuery.m_query;
+        pendingQuery.m_numCandidates = 0;
+
+        // Keep the best candidates sorted by score, ties keep the first point found
+        auto TryAddCandidate = [&pendingQuery] ( int32_t pointIdx, float score )
+        {
+            int32_t insertIdx = pendingQuery.m_numCandidates;
+            while ( insertIdx > 0 && pendingQuery.m_candidateScores[insertIdx - 1] < score )
+            {
+                insertIdx--;
+            }
+
+            if ( insertIdx >= s_maxLineOfSightCandidates )
+            {
+                return;
+            }
+
+            for ( int32_t i = Math::Min( pendingQuery.m_numCandidates, s_maxLineOfSightCandidates - 1 ); i > insertIdx; i-- )
+            {
+                pendingQuery.m_candidatePointIndices[i] = pendingQuery.m_candidatePointIndices[i - 1];
+                pendingQuery.m_candidateScores[i] = pendingQuery.m_candidateScores[i - 1];
+            }
+
+            pendingQuery.m_candidatePointIndices[insertIdx] = pointIdx;
+            pendingQuery.m_candidateScores[insertIdx] = score;
+            pendingQuery.m_numCandidates = Math::Min( pendingQuery.m_numCandidates + 1, s_maxLineOfSightCandidates );
+        };
+
+        //-------------------------------------------------------------------------
+
+        Vector const searchExtents( query.m_searchRadius, query.m_searchRadius, 0.0f, 0.0f );
+        int32_t minCellX, minCellY, maxCellX, maxCellY;
+        if ( !m_pCoverDatabase->GetCellRange( query.m_position - searchExtents, query.m_position + searchExtents, minCellX, minCellY, maxCellX, maxCellY ) )
+        {
+            return;
+        }
+
+        // Splat all the query parameters once
+        Vector const queryX = query.m_position.GetSplatX();
+        Vector const queryY = query.m_position.GetSplatY();
+        Vector const searchRadiusSq( query.m_searchRadius * query.m_searchRadius );
+        Vector const travelDistanceWeight( query.m_travelDistanceWeight );
+        Vector const minProtectionDot( query.m_minProtectionDot );
+        Vector const minThreatDistanceSq( query.m_minThreatDistance * query.m_minThreatDistance );
+        Vector const invalidScore( -FLT_MAX );
+
+        int32_t const numThreats = Math::Min( (int32_t) query.m_threatPositions.size(), s_maxThreatsPerQuery );
+        Vector threatX[s_maxThreatsPerQuery];
+        Vector threatY[s_maxThreatsPerQuery];
+        for ( int32_t t = 0; t < numThreats; t++ )
+        {
+            threatX[t] = query.m_threatPositions[t].GetSplatX();
+            threatY[t] = query.m_threatPositions[t].GetSplatY();
+        }
+
+        // Score 4 points at a time
+        for ( int32_t cellY = minCellY; cellY <= maxCellY; cellY++ )
+        {
+            for ( int32_t cellX = minCellX; cellX <= maxCellX; cellX++ )
+            {
+                int32_t batchStartIdx, batchEndIdx;
+                m_pCoverDatabase->GetCellBatchRange( cellX, cellY, batchStartIdx, batchEndIdx );
+
+                for ( int32_t batchIdx = batchStartIdx; batchIdx < batchEndIdx; batchIdx++ )
+                {
+                    CoverDatabase::PointBatch const& batch = m_pCoverDatabase->GetPointBatch( batchIdx );
+                    Vector const pointX( batch.m_positionX );
+                    Vector const pointY( batch.m_positionY );
+                    Vector const directionX( batch.m_directionX );
+                    Vector const directionY( batch.m_directionY );
+                    Vector const coverHeight( batch.m_coverHeight );
+
+                    Vector const offsetX = pointX - queryX;
+                    Vector const offsetY = pointY - queryY;
+                    Vector const distanceSq = ( offsetX * offsetX ) + ( offsetY * offsetY );
+
+                    // Unused lanes have no height
+                    Vector isValid = Vector::And( coverHeight.GreaterThan( Vector::Zero ), distanceSq.LessThanEqual( searchRadiusSq ) );
+                    Vector score = -( distanceSq.GetSqrt() * travelDistanceWeight );
+
+                    for ( int32_t t = 0; t < numThreats; t++ )
+                    {
+                        Vector const toThreatX = threatX[t] - pointX;
+                        Vector const toThreatY = threatY[t] - pointY;
+                        Vector const threatDistanceSq = ( toThreatX * toThreatX ) + ( toThreatY * toThreatY );
+
+                        // The cosine between the protection direction and the direction to the threat
+                        Vector const protectionDot = ( ( toThreatX * directionX ) + ( toThreatY * directionY ) ) / Vector::Max( threatDistanceSq.GetSqrt(), Vector::Epsilon );
+
+                        isValid = Vector::And( isValid, protectionDot.GreaterThanEqual( minProtectionDot ) );
+                        isValid = Vector::And( isValid, threatDistanceSq.GreaterThanEqual( minThreatDistanceSq ) );
+                        score += protectionDot;
+                    }
+
+                    Float4 const laneScores = Vector::Select( invalidScore, score, isValid ).ToFloat4();
+                    for ( int32_t laneIdx = 0; laneIdx < 4; laneIdx++ )
+                    {
+                        if ( laneScores[laneIdx] > -FLT_MAX )
+                        {
+                            TryAddCandidate( batchIdx * 4 + laneIdx, laneScores[laneIdx] );
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void CoverManager::ResolveQueries( Physics::Scene* pPhysicsScene )
+    {
+        EE_ASSERT( pPhysicsScene != nullptr );
+
+        // Build the rays for every candidate
+        //-------------------------------------------------------------------------
+
+        m_lineOfSightRays.clear();
+
+        int32_t const numQueries = (int32_t) m_queries.size();
+        for ( int32_t queryIdx = 0; queryIdx < numQueries; queryIdx++ )
+        {
+            PendingQuery& pendingQuery = m_queries[queryIdx];
+            int32_t const numThreats = Math::Min( (int32_t) pendingQuery.m_query.m_threatPositions.size(), s_maxThreatsPerQuery );
+
+            for ( int32_t candidateIdx = 0; candidateIdx < pendingQuery.m_numCandidates; candidateIdx++ )
+            {
+                pendingQuery.m_candidateIsHidden[candidateIdx] = true;
+
+                CoverDatabase::CoverPoint const coverPoint = m_pCoverDatabase->GetCoverPoint( pendingQuery.m_candidatePointIndices[candidateIdx] );
+                Vector const target = coverPoint.m_position + ( Vector::UnitZ * ( coverPoint.m_coverHeight * g_lineOfSightHeightRatio ) );
+
+                for ( int32_t t = 0; t < numThreats; t++ )
+                {
+                    LineOfSightRay& ray = m_lineOfSightRays.emplace_back();
+                    ray.m_start = pendingQuery.m_query.m_threatPositions[t];
+                    ray.m_end = target;
+                    ray.m_queryIdx = queryIdx;
+                    ray.m_candidateIdx = candidateIdx;
+                }
+            }
+        }
+
+        // Cast all the rays as a single batch
+        //-------------------------------------------------------------------------
+
+        struct LineOfSightTask final : public ITaskSet
+        {
+            LineOfSightTask( TVector<LineOfSightRay>& rays, Physics::Scene* pPhysicsScene )
+                : m_rays( rays )
+                , m_pPhysicsScene( pPhysicsScene )
+            {
+                m_SetSize = (uint32_t) rays.size();
+                m_MinRange = g_minRaysPerJob;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_AI( "Cover Line Of Sight Task" );
+
+                // Only the static environment can provide cover
+                Physics::QueryFilter filter( Physics::CreateLayerMask( Physics::Layers::Environment ) );
+                Physics::RayCastResults results;
+
+                // Only lock once per batch
+                m_pPhysicsScene->AcquireReadLock();
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    LineOfSightRay& ray = m_rays[i];
+                    if ( ( ray.m_end - ray.m_start ).IsNearZero3() )
+                    {
+                        ray.m_isBlocked = false;
+                        continue;
+                    }
+
+                    ray.m_isBlocked = m_pPhysicsScene->RayCast( ray.m_start, ray.m_end, filter, results );
+                }
+                m_pPhysicsScene->ReleaseReadLock();
+            }
+
+        private:
+
+            TVector<LineOfSightRay>&                    m_rays;
+            Physics::Scene*                             m_pPhysicsScene = nullptr;
+        };
+
+        if ( !m_lineOfSightRays.empty() )
+        {
+            LineOfSightTask lineOfSightTask( m_lineOfSightRays, pPhysicsScene );
+            m_pTaskSystem->ScheduleTask( &lineOfSightTask );
+            m_pTaskSystem->WaitForTask( &lineOfSightTask );
+
+            for ( LineOfSightRay const& ray : m_lineOfSightRays )
+            {
+                if ( !ray.m_isBlocked )
+                {
+                    m_queries[ray.m_queryIdx].m_candidateIsHidden[ray.m_candidateIdx] = false;
+                }
+            }
+        }
+
+        // Store the results
+        //-------------------------------------------------------------------------
+        // Pick the best candidate that is hidden from all threats, if there are none, fall back to the best scoring one
+
+        for ( PendingQuery const& pendingQuery : m_queries )
+        {
+            CoverQueryResult result;
+
+            if ( pendingQuery.m_numCandidates > 0 )
+            {
+                int32_t selectedCandidateIdx = 0;
+                for ( int32_t candidateIdx = 0; candidateIdx < pendingQuery.m_numCandidates; candidateIdx++ )
+                {
+                    if ( pendingQuery.m_candidateIsHidden[candidateIdx] )
+                    {
+                        selectedCandidateIdx = candidateIdx;
+                        break;
+                    }
+                }
+
+                result.m_pointIdx = pendingQuery.m_candidatePointIndices[selectedCandidateIdx];
+                result.m_coverPoint = m_pCoverDatabase->GetCoverPoint( result.m_pointIdx );
+                result.m_score = pendingQuery.m_candidateScores[selectedCandidateIdx];
+                result.m_isLineOfSightBlocked = pendingQuery.m_candidateIsHidden[selectedCandidateIdx];
+            }
+
+            m_queryResults[pendingQuery.m_requesterID] = result;
+        }
     }
 
     //-------------------------------------------------------------------------
 
     void CoverManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        {
+            Threading::ScopeLock lock( m_requestMutex );
+            m_queries.swap( m_requestedQueries );
+            m_requestedQueries.clear();
+        }
+
+        // The previous results were available for this frame's entity updates, replace them with the new ones
+        m_queryResults.clear();
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_numQueriesLastUpdate = (int32_t) m_queries.size();
+        m_numRaysLastUpdate = 0;
+        #endif
+
+        if ( m_pCoverDatabase != nullptr && !m_queries.empty() )
+        {
+            EE_PROFILE_SCOPE_AI( "Cover Queries" );
+
+            // Sort the requests so that the results dont depend on the order in which the entity updates ran
+            auto comparator = [] ( PendingQuery const& queryA, PendingQuery const& queryB )
+            {
+                return queryA.m_requesterID < queryB.m_requesterID;
+            };
+
+            eastl::sort( m_queries.begin(), m_queries.end(), comparator );
+
+            // Score candidates
+            //-------------------------------------------------------------------------
+
+            struct ScoringTask final : public ITaskSet
+            {
+                ScoringTask( CoverManager const* pCoverManager, TVector<PendingQuery>& queries )
+                    : m_pCoverManager( pCoverManager )
+                    , m_queries( queries )
+                {
+                    m_SetSize = (uint32_t) queries.size();
+                    m_MinRange = g_minQueriesPerJob;
+                }
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    EE_PROFILE_SCOPE_AI( "Cover Scoring Task" );
+                    for ( uint64_t i = range.start; i < range.end; ++i )
+                    {
+                        m_pCoverManager->ScoreCandidates( m_queries[i] );
+                    }
+                }
+
+            private:
+
+                CoverManager const*                     m_pCoverManager = nullptr;
+                TVector<PendingQuery>&                  m_queries;
+            };
+
+            ScoringTask scoringTask( this, m_queries );
+            m_pTaskSystem->ScheduleTask( &scoringTask );
+            m_pTaskSystem->WaitForTask( &scoringTask );
+
+            // Line of sight
+            //-------------------------------------------------------------------------
+
+            ResolveQueries( ctx.GetWorldSystem<Physics::PhysicsWorldSystem>()->GetScene() );
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_numRaysLastUpdate = (int32_t) m_lineOfSightRays.size();
+            #endif
+        }
+
+        m_queries.clear();
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        auto drawingCtx = ctx.GetDrawingContext();
+
+        if ( m_drawCoverPoints && m_pCoverDatabase != nullptr )
+        {
+            int32_t const numBatches = m_pCoverDatabase->GetNumPointBatches();
+            for ( int32_t pointIdx = 0; pointIdx < numBatches * 4; pointIdx++ )
+            {
+                if ( !m_pCoverDatabase->IsValidPointIndex( pointIdx ) )
+                {
+                    continue;
+                }
+
+                CoverDatabase::CoverPoint const coverPoint = m_pCoverDatabase->GetCoverPoint( pointIdx );
+                Vector const top = coverPoint.m_position + ( Vector::UnitZ * coverPoint.m_coverHeight );
+                drawingCtx.DrawLine( coverPoint.m_position, top, Colors::LightGray );
+                drawingCtx.DrawArrow( top, top + ( coverPoint.m_protectionDirection * 0.5f ), Colors::Yellow, 2.0f );
+            }
+        }
+
+        if ( m_drawQueryResults )
+        {
+            for ( auto const& resultPair : m_queryResults )
+            {
+                CoverQueryResult const& result = resultPair.second;
+                if ( result.IsValid() )
+                {
+                    Vector const top = result.m_coverPoint.m_position + ( Vector::UnitZ * result.m_coverPoint.m_coverHeight );
+                    drawingCtx.DrawLine( result.m_coverPoint.m_position, top, result.m_isLineOfSightBlocked ? Colors::LimeGreen : Colors::Orange, 4.0f );
+                }
+            }
+        }
+        #endif
     }
 }
\ No newline at end of file
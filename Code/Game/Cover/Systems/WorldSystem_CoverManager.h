@@ -1,14 +1,28 @@
 #pragma once
 
 #include "Game/_Module/API.h"
+#include "Game/Cover/CoverDatabase.h"
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "System/Types/IDVector.h"
+#include "System/Types/HashMap.h"
+#include "System/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
+// Cover Manager
+//-------------------------------------------------------------------------
+// Provides cover point queries against the cover database of the loaded map
+//
+// Queries are requested during the pre-physics entity updates and all of them are resolved together in this system's update:
+// 1) the candidate points around each query are scored against the query's threats, 4 points at a time
+// 2) the best candidates of every query have their line of sight to the threats checked, all rays are submitted to the physics scene as a single batch
+// 3) the results are stored and are available to the requesters for the whole of the next frame's entity updates
 
 namespace EE
 {
+    namespace Physics { class Scene; }
+    class TaskSystem;
     class CoverVolumeComponent;
+    class CoverDatabaseComponent;
 
     //-------------------------------------------------------------------------
 
@@ -16,19 +30,103 @@ namespace EE
     {
         friend class CoverDebugView;
 
+    public:
+
+        // The max number of threats we will consider per query
+        constexpr static int32_t const s_maxThreatsPerQuery = 4;
+
+        // The number of best scoring candidates per query that get their line of sight checked
+        constexpr static int32_t const s_maxLineOfSightCandidates = 4;
+
+        struct CoverQuery
+        {
+            Vector                                              m_position; // The position of the requester
+            float                                               m_searchRadius = 15.0f;
+            TInlineVector<Vector, s_maxThreatsPerQuery>         m_threatPositions; // The eye positions of the threats
+            float                                               m_minThreatDistance = 4.0f; // Points closer than this to any threat are rejected
+            float                                               m_minProtectionDot = 0.5f; // The min cosine between a point's protection direction and the direction to each threat
+            float                                               m_travelDistanceWeight = 0.1f; // The score penalty per meter from the requester
+        };
+
+        struct CoverQueryResult
+        {
+            inline bool IsValid() const { return m_pointIdx != InvalidIndex; }
+
+        public:
+
+            int32_t                                             m_pointIdx = InvalidIndex;
+            CoverDatabase::CoverPoint                           m_coverPoint;
+            float                                               m_score = 0.0f;
+            bool                                                m_isLineOfSightBlocked = false; // Did the physics scene confirm that the point is hidden from all threats
+        };
+
+    private:
+
+        struct PendingQuery
+        {
+            uint64_t                                            m_requesterID = 0;
+            CoverQuery                                          m_query;
+            int32_t                                             m_candidatePointIndices[s_maxLineOfSightCandidates];
+            float                                               m_candidateScores[s_maxLineOfSightCandidates];
+            bool                                                m_candidateIsHidden[s_maxLineOfSightCandidates];
+            int32_t                                             m_numCandidates = 0;
+        };
+
+        struct LineOfSightRay
+        {
+            Vector                                              m_start;
+            Vector                                              m_end;
+            int32_t                                             m_queryIdx = InvalidIndex;
+            int32_t                                             m_candidateIdx = InvalidIndex;
+            bool                                                m_isBlocked = false;
+        };
+
     public:
 
         EE_REGISTER_ENTITY_WORLD_SYSTEM( CoverManager, RequiresUpdate( UpdateStage::PrePhysics ) );
 
+        inline CoverDatabase const* GetCoverDatabase() const { return m_pCoverDatabase; }
+        inline bool HasCoverDatabase() const { return m_pCoverDatabase != nullptr; }
+
+        // Request a cover query, this is threadsafe and expected to be called from the pre-physics entity updates
+        // The requester ID needs to be unique per requester (e.g. the requesting component's ID)
+        void RequestCoverQuery( uint64_t requesterID, CoverQuery const& query );
+
+        // Get the result of a query requested during the previous frame, returns false if no result is available
+        bool TryGetCoverQueryResult( uint64_t requesterID, CoverQueryResult& outResult ) const;
+
     private:
 
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
+        // Score all the points around the query and keep the best candidates
+        void ScoreCandidates( PendingQuery& pendingQuery ) const;
+
+        // Build the line of sight rays for all the candidates, check them against the physics scene and store the results
+        void ResolveQueries( Physics::Scene* pPhysicsScene );
+
     private:
 
-        TIDVector<ComponentID, CoverVolumeComponent*>      m_coverVolumes;
+        TaskSystem*                                             m_pTaskSystem = nullptr;
+        TIDVector<ComponentID, CoverVolumeComponent*>           m_coverVolumes;
+        CoverDatabaseComponent*                                 m_pCoverDatabaseComponent = nullptr;
+        CoverDatabase const*                                    m_pCoverDatabase = nullptr;
+
+        Threading::Mutex                                        m_requestMutex;
+        TVector<PendingQuery>                                   m_requestedQueries;
+        TVector<PendingQuery>                                   m_queries;
+        TVector<LineOfSightRay>                                 m_lineOfSightRays;
+        THashMap<uint64_t, CoverQueryResult>                    m_queryResults;
+
+        #if EE_DEVELOPMENT_TOOLS
+        int32_t                                                 m_numQueriesLastUpdate = 0;
+        int32_t                                                 m_numRaysLastUpdate = 0;
+        bool                                                    m_drawCoverPoints = false;
+        bool                                                    m_drawQueryResults = false;
+        #endif
     };
 }
\ No newline at end of file
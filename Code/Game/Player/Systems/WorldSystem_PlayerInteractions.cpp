@@ -1,6 +1,7 @@
 #include "WorldSystem_PlayerInteractions.h"
 #include "Game/Player/Components/Component_PlayerInteractible.h"
 #include "Game/Player/Components/Component_MainPlayer.h"
+#include "Engine/Spatial/Systems/WorldSystem_SpatialQueries.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/Entity.h"
 
@@ -15,7 +16,7 @@ namespace EE::Player
 
     void PlayerInteractionSystem::ShutdownSystem()
     {
-        EE_ASSERT( m_interactibles.empty() );
+        EE_ASSERT( m_players.empty() );
     }
 
     //-------------------------------------------------------------------------
@@ -27,11 +28,6 @@ namespace EE::Player
             RegisteredPlayer player = { pEntity, pPlayerComponent };
             m_players.emplace_back( player );
         }
-
-        if ( auto pInteractibleComponent = TryCast<PlayerInteractibleComponent>( pComponent ) )
-        {
-            m_interactibles.emplace_back( pInteractibleComponent );
-        }
     }
 
     void PlayerInteractionSystem::UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -41,12 +37,6 @@ namespace EE::Player
             RegisteredPlayer player = { pEntity, pPlayerComponent };
             m_players.erase_first( player );
         }
-
-        // TODO: handle removing a component that is in use!!!
-        if ( auto pInteractibleComponent = TryCast<PlayerInteractibleComponent>( pComponent ) )
-        {
-            m_interactibles.erase_first( pInteractibleComponent );
-        }
     }
 
     //-------------------------------------------------------------------------
@@ -58,14 +48,21 @@ namespace EE::Player
             return;
         }
 
+        auto pSpatialQuerySystem = ctx.GetWorldSystem<SpatialQuerySystem>();
+
         // HACK!!! just to test the external graphs feature!!
         for ( auto const& player : m_players )
         {
             Vector const playerPosition = player.m_pEntity->GetWorldTransform().GetTranslation();
             player.m_pPlayerComp->m_pAvailableInteraction = nullptr;
 
-            for ( auto pInteractible : m_interactibles )
+            // Only consider the interactibles around the player, the interaction range is 2D so ignore the height
+            AABB const searchBox( playerPosition, Vector( 2.0f, 2.0f, 1000.0f ) );
+            pSpatialQuerySystem->FindInBox( searchBox, m_nearbyInteractibles, PlayerInteractibleComponent::GetStaticTypeID() );
+
+            for ( auto pNearbyComponent : m_nearbyInteractibles )
             {
+                auto pInteractible = static_cast<PlayerInteractibleComponent*>( pNearbyComponent );
                 Vector const interactiblePosition = pInteractible->GetPosition();
 
                 if ( interactiblePosition.GetDistance2( playerPosition ) < 2.0f )
@@ -5,6 +5,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { class SpatialEntityComponent; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Player
 {
     class MainPlayerComponent;
@@ -39,6 +43,6 @@ namespace EE::Player
     private:
 
         TVector<RegisteredPlayer>                   m_players;
-        TVector<PlayerInteractibleComponent*>       m_interactibles;
+        TVector<SpatialEntityComponent*>            m_nearbyInteractibles;
     };
 }
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "GameModule.h"
+#include "Game/Player/Components/Component_PlayerInteractible.h"
+#include "Engine/Spatial/Systems/WorldSystem_SpatialQueries.h"
 
 //-------------------------------------------------------------------------
 
@@ -11,11 +13,17 @@ namespace EE
 
     bool GameModule::InitializeModule( GameModuleContext& context, IniFile const& iniFile )
     {
+        context.m_pResourceSystem->RegisterResourceLoader( &m_coverDatabaseLoader );
+
+        SpatialQuerySystem::RegisterTrackedComponentType( Player::PlayerInteractibleComponent::GetStaticTypeID() );
         return true;
     }
 
     void GameModule::ShutdownModule( GameModuleContext& context )
     {
+        SpatialQuerySystem::UnregisterTrackedComponentType( Player::PlayerInteractibleComponent::GetStaticTypeID() );
+
+        context.m_pResourceSystem->UnregisterResourceLoader( &m_coverDatabaseLoader );
     }
 
     void GameModule::LoadModuleResources( Resource::ResourceSystem& resourceSystem )
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "API.h"
+#include "Game/Cover/ResourceLoaders/ResourceLoader_CoverDatabase.h"
 #include "Engine/Entity/EntityWorldManager.h"
 #include "System/Resource/ResourceID.h"
 #include "System/Input/InputSystem.h"
@@ -46,6 +47,7 @@ namespace EE
 
     private:
 
+        CoverDatabaseLoader                             m_coverDatabaseLoader;
         bool                                            m_moduleInitialized = false;
     };
 }
\ No newline at end of file
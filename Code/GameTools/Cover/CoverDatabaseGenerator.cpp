@@ -0,0 +1,528 @@
+#include "CoverDatabaseGenerator.h"
+#include "Game/Cover/CoverDatabase.h"
+#include "Game/Cover/Components/Component_CoverDatabase.h"
+#include "EngineTools/Physics/ResourceDescriptors/ResourceDescriptor_PhysicsMesh.h"
+#include "EngineTools/RawAssets/RawAssetReader.h"
+#include "EngineTools/RawAssets/RawMesh.h"
+#include "Engine/Physics/Components/Component_PhysicsMesh.h"
+#include "Engine/Entity/EntityAccessor.h"
+#include "Engine/Entity/EntitySerialization.h"
+#include "Engine/Entity/EntityDescriptors.h"
+#include "System/TypeSystem/TypeRegistry.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    template<>
+    struct TEntityAccessor<Physics::PhysicsMeshComponent>
+    {
+        TEntityAccessor( Physics::PhysicsMeshComponent* pType )
+            : m_pType( pType )
+        {}
+
+        inline ResourceID const& GetMeshResourceID() { return m_pType->m_pPhysicsMesh.GetResourceID(); }
+
+    protected:
+
+        Physics::PhysicsMeshComponent* m_pType = nullptr;
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    // Triangles with a steeper normal than this are floors/ceilings and cant provide cover
+    constexpr static float const g_maxCoverTriangleNormalZ = 0.7f;
+
+    //-------------------------------------------------------------------------
+
+    EE_FORCE_INLINE static uint64_t GetCellKey( int32_t cellX, int32_t cellY )
+    {
+        return ( uint64_t( uint32_t( cellX ) ) << 32 ) | uint64_t( uint32_t( cellY ) );
+    }
+
+    EE_FORCE_INLINE static int32_t GetCellCoordinate( float value, float cellSize )
+    {
+        return (int32_t) Math::Floor( value / cellSize );
+    }
+
+    // Get the horizontal part of a direction
+    EE_FORCE_INLINE static Vector GetFlattenedDirection( Vector const& direction )
+    {
+        return Vector( direction.GetX(), direction.GetY(), 0.0f, 0.0f ).GetNormalized2();
+    }
+
+    //-------------------------------------------------------------------------
+
+    CoverDatabaseGenerator::CoverDatabaseGenerator( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, EntityModel::SerializedEntityCollection const& entityCollection, CoverDatabaseBuildSettings const& buildSettings )
+        : m_rawResourceDirectoryPath( rawResourceDirectoryPath )
+        , m_typeRegistry( typeRegistry )
+        , m_entityCollection( entityCollection )
+        , m_buildSettings( buildSettings )
+    {
+        EE_ASSERT( rawResourceDirectoryPath.IsValid() );
+    }
+
+    bool CoverDatabaseGenerator::Generate( CoverDatabase& outDatabase )
+    {
+        if ( m_buildSettings.m_sampleSpacing <= 0.0f || m_buildSettings.m_cellSize <= 0.0f || m_buildSettings.m_characterRadius < 0.0f )
+        {
+            EE_LOG_ERROR( "Cover", "Generation", "Invalid build settings, the sample spacing and cell size need to be positive and the character radius cant be negative" );
+            return false;
+        }
+
+        m_collisionPrimitives.clear();
+        m_collisionTriangles.clear();
+        m_collisionGrid.clear();
+        m_samples.clear();
+        m_numCoverVolumes = 0;
+        m_numSnappedPoints = 0;
+        m_numDiscardedPoints = 0;
+
+        //-------------------------------------------------------------------------
+
+        if ( !CollectSamplesAndCollisionPrimitives() )
+        {
+            return false;
+        }
+
+        if ( !CollectCollisionTriangles() )
+        {
+            return false;
+        }
+
+        SnapSamplesToCollision();
+        BuildDatabase( outDatabase );
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CoverDatabaseGenerator::CollectSamplesAndCollisionPrimitives()
+    {
+        TVector<Entity*> createdEntities = EntityModel::Serializer::CreateEntities( nullptr, m_typeRegistry, m_entityCollection );
+
+        // Update all spatial transforms
+        //-------------------------------------------------------------------------
+        // We need to do this since we dont update world transforms when loading a collection
+
+        for ( auto pEntity : createdEntities )
+        {
+            if ( pEntity->IsSpatialEntity() )
+            {
+                pEntity->SetWorldTransform( pEntity->GetWorldTransform() );
+            }
+        }
+
+        auto GetCreatedComponent = [this, &createdEntities] ( EntityModel::SerializedEntityCollection::SearchResult const& searchResult )
+        {
+            int32_t const entityIdx = m_entityCollection.FindEntityIndex( searchResult.m_pEntity->m_name );
+            EE_ASSERT( entityIdx != InvalidIndex );
+
+            int32_t const componentIdx = m_entityCollection.GetEntityDescriptors()[entityIdx].FindComponentIndex( searchResult.m_pComponent->m_name );
+            EE_ASSERT( componentIdx != InvalidIndex );
+
+            Entity const* pEntity = createdEntities[entityIdx];
+            EE_ASSERT( pEntity != nullptr );
+
+            return pEntity->GetComponents()[componentIdx];
+        };
+
+        // Sample the cover volumes
+        //-------------------------------------------------------------------------
+        // Points are placed along the front edge of the volume, on its floor and one character radius back from the front
+
+        auto foundCoverVolumes = m_entityCollection.GetComponentsOfType( m_typeRegistry, CoverVolumeComponent::GetStaticTypeID() );
+        for ( auto const& searchResult : foundCoverVolumes )
+        {
+            auto pCoverVolume = Cast<CoverVolumeComponent>( GetCreatedComponent( searchResult ) );
+            EE_ASSERT( pCoverVolume != nullptr );
+
+            Transform const& WT = pCoverVolume->GetWorldTransform();
+            Float3 const volumeExtents = pCoverVolume->GetVolumeLocalExtents();
+            Vector const forward = GetFlattenedDirection( WT.GetForwardVector() );
+            Vector const right = GetFlattenedDirection( WT.GetRightVector() );
+
+            if ( forward.IsNearZero2() || right.IsNearZero2() || volumeExtents.m_z <= 0.0f )
+            {
+                EE_LOG_WARNING( "Cover", "Generation", "Cover volume (%s) is degenerate or not upright, ignoring it!", searchResult.m_pEntity->m_name.c_str() );
+                continue;
+            }
+
+            Vector const frontOffset = forward * ( volumeExtents.m_y - Math::Min( m_buildSettings.m_characterRadius, volumeExtents.m_y ) );
+            Vector const floorOffset = Vector( 0.0f, 0.0f, -volumeExtents.m_z, 0.0f );
+            Vector const sampleOrigin = WT.GetTranslation() + frontOffset + floorOffset;
+
+            auto AddSample = [&] ( float horizontalOffset )
+            {
+                SamplePoint& sample = m_samples.emplace_back();
+                sample.m_position = sampleOrigin + ( right * horizontalOffset );
+                sample.m_protectionDirection = forward;
+                sample.m_coverHeight = volumeExtents.m_z * 2;
+                sample.m_coverType = pCoverVolume->GetCoverType();
+            };
+
+            AddSample( 0.0f );
+            for ( float horizontalOffset = m_buildSettings.m_sampleSpacing; horizontalOffset <= volumeExtents.m_x; horizontalOffset += m_buildSettings.m_sampleSpacing )
+            {
+                AddSample( horizontalOffset );
+                AddSample( -horizontalOffset );
+            }
+
+            m_numCoverVolumes++;
+        }
+
+        // Collect all static collision geometry
+        //-------------------------------------------------------------------------
+
+        auto foundPhysicsComponents = m_entityCollection.GetComponentsOfType( m_typeRegistry, Physics::PhysicsMeshComponent::GetStaticTypeID() );
+        for ( auto const& searchResult : foundPhysicsComponents )
+        {
+            auto pPhysicsComponent = Cast<Physics::PhysicsMeshComponent>( GetCreatedComponent( searchResult ) );
+            EE_ASSERT( pPhysicsComponent != nullptr );
+
+            if ( !pPhysicsComponent->IsStatic() )
+            {
+                continue;
+            }
+
+            TEntityAccessor<Physics::PhysicsMeshComponent> accessor( pPhysicsComponent );
+            ResourceID geometryResourceID = accessor.GetMeshResourceID();
+            if ( geometryResourceID.IsValid() )
+            {
+                m_collisionPrimitives[geometryResourceID.GetResourcePath()].emplace_back( pPhysicsComponent->GetWorldTransform() );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( auto& pEntity : createdEntities )
+        {
+            EE::Delete( pEntity );
+        }
+
+        return true;
+    }
+
+    bool CoverDatabaseGenerator::CollectCollisionTriangles()
+    {
+        auto LogError = [] ( char const* pFormat, ... )
+        {
+            va_list args;
+            va_start( args, pFormat );
+            Log::AddEntryVarArgs( Log::Severity::Error, "Cover", "Generation", __FILE__, __LINE__, pFormat, args );
+            va_end( args );
+            return false;
+        };
+
+        //-------------------------------------------------------------------------
+
+        for ( auto const& primitiveDesc : m_collisionPrimitives )
+        {
+            // Load descriptor
+            //-------------------------------------------------------------------------
+
+            if ( !primitiveDesc.first.IsValid() )
+            {
+                return LogError( "Invalid source data path (%s) for physics mesh descriptor", primitiveDesc.first.c_str() );
+            }
+
+            FileSystem::Path const meshDescriptorFilePath = ResourcePath::ToFileSystemPath( m_rawResourceDirectoryPath, primitiveDesc.first );
+
+            Physics::PhysicsMeshResourceDescriptor resourceDescriptor;
+            if ( !Resource::ResourceDescriptor::TryReadFromFile( m_typeRegistry, meshDescriptorFilePath, resourceDescriptor ) )
+            {
+                return LogError( "Failed to read physics mesh resource descriptor from file: %s", meshDescriptorFilePath.c_str() );
+            }
+
+            // Load mesh
+            //-------------------------------------------------------------------------
+
+            if ( !resourceDescriptor.m_meshPath.IsValid() )
+            {
+                return LogError( "Invalid source data path (%s) in physics mesh descriptor: %s", resourceDescriptor.m_meshPath.c_str(), meshDescriptorFilePath.c_str() );
+            }
+
+            FileSystem::Path const meshFilePath = ResourcePath::ToFileSystemPath( m_rawResourceDirectoryPath, resourceDescriptor.m_meshPath );
+
+            RawAssets::ReaderContext readerCtx =
+            {
+                [this] ( char const* pString ) { EE_LOG_WARNING( "Cover", "Generation", pString ); },
+                [this] ( char const* pString ) { EE_LOG_ERROR( "Cover", "Generation", pString ); }
+            };
+
+            TUniquePtr<RawAssets::RawMesh> pRawMesh = RawAssets::ReadStaticMesh( readerCtx, meshFilePath, resourceDescriptor.m_meshName );
+            if ( pRawMesh == nullptr )
+            {
+                return LogError( "Failed to read mesh from source file: %s", meshFilePath.c_str() );
+            }
+
+            EE_ASSERT( pRawMesh->IsValid() );
+
+            // Add triangles
+            //-------------------------------------------------------------------------
+            // We dont care about the winding since the probes accept hits from both sides
+
+            for ( Transform const& transform : primitiveDesc.second )
+            {
+                for ( auto const& geometrySection : pRawMesh->GetGeometrySections() )
+                {
+                    int32_t const numTriangles = geometrySection.GetNumTriangles();
+                    int32_t const numIndices = (int32_t) geometrySection.m_indices.size();
+                    for ( auto t = 0; t < numTriangles; t++ )
+                    {
+                        int32_t const i = t * 3;
+                        EE_ASSERT( i <= numIndices - 3 );
+
+                        CollisionTriangle triangle;
+                        triangle.m_vertices[0] = transform.TransformPoint( geometrySection.m_vertices[geometrySection.m_indices[i]].m_position );
+                        triangle.m_vertices[1] = transform.TransformPoint( geometrySection.m_vertices[geometrySection.m_indices[i + 1]].m_position );
+                        triangle.m_vertices[2] = transform.TransformPoint( geometrySection.m_vertices[geometrySection.m_indices[i + 2]].m_position );
+
+                        Vector const faceNormal = Vector::Cross3( triangle.m_vertices[1] - triangle.m_vertices[0], triangle.m_vertices[2] - triangle.m_vertices[0] );
+                        if ( faceNormal.IsNearZero3() )
+                        {
+                            continue;
+                        }
+
+                        triangle.m_normal = faceNormal.GetNormalized3();
+                        if ( Math::Abs( triangle.m_normal.GetZ() ) > g_maxCoverTriangleNormalZ )
+                        {
+                            continue;
+                        }
+
+                        m_collisionTriangles.emplace_back( triangle );
+                        AddTriangleToGrid( (int32_t) m_collisionTriangles.size() - 1 );
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void CoverDatabaseGenerator::AddTriangleToGrid( int32_t triangleIdx )
+    {
+        CollisionTriangle const& triangle = m_collisionTriangles[triangleIdx];
+        Vector const triangleMin = Vector::Min( triangle.m_vertices[0], Vector::Min( triangle.m_vertices[1], triangle.m_vertices[2] ) );
+        Vector const triangleMax = Vector::Max( triangle.m_vertices[0], Vector::Max( triangle.m_vertices[1], triangle.m_vertices[2] ) );
+
+        float const cellSize = m_buildSettings.m_cellSize;
+        int32_t const minCellX = GetCellCoordinate( triangleMin.GetX(), cellSize );
+        int32_t const minCellY = GetCellCoordinate( triangleMin.GetY(), cellSize );
+        int32_t const maxCellX = GetCellCoordinate( triangleMax.GetX(), cellSize );
+        int32_t const maxCellY = GetCellCoordinate( triangleMax.GetY(), cellSize );
+
+        for ( int32_t cellY = minCellY; cellY <= maxCellY; cellY++ )
+        {
+            for ( int32_t cellX = minCellX; cellX <= maxCellX; cellX++ )
+            {
+                m_collisionGrid[GetCellKey( cellX, cellY )].emplace_back( triangleIdx );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CoverDatabaseGenerator::Probe( Vector const& start, Vector const& unitDirection, float distance, Vector& outHitPosition, Vector& outHitNormal ) const
+    {
+        Vector const end = start + ( unitDirection * distance );
+        Vector const probeMin = Vector::Min( start, end );
+        Vector const probeMax = Vector::Max( start, end );
+
+        float const cellSize = m_buildSettings.m_cellSize;
+        int32_t const minCellX = GetCellCoordinate( probeMin.GetX(), cellSize );
+        int32_t const minCellY = GetCellCoordinate( probeMin.GetY(), cellSize );
+        int32_t const maxCellX = GetCellCoordinate( probeMax.GetX(), cellSize );
+        int32_t const maxCellY = GetCellCoordinate( probeMax.GetY(), cellSize );
+
+        float closestHitDistance = distance;
+        int32_t closestTriangleIdx = InvalidIndex;
+
+        for ( int32_t cellY = minCellY; cellY <= maxCellY; cellY++ )
+        {
+            for ( int32_t cellX = minCellX; cellX <= maxCellX; cellX++ )
+            {
+                auto iter = m_collisionGrid.find( GetCellKey( cellX, cellY ) );
+                if ( iter == m_collisionGrid.end() )
+                {
+                    continue;
+                }
+
+                // Moller-Trumbore ray vs triangle test
+                for ( int32_t triangleIdx : iter->second )
+                {
+                    CollisionTriangle const& triangle = m_collisionTriangles[triangleIdx];
+                    Vector const edge1 = triangle.m_vertices[1] - triangle.m_vertices[0];
+                    Vector const edge2 = triangle.m_vertices[2] - triangle.m_vertices[0];
+
+                    Vector const p = Vector::Cross3( unitDirection, edge2 );
+                    float const determinant = edge1.GetDot3( p );
+                    if ( Math::Abs( determinant ) < Math::Epsilon )
+                    {
+                        continue;
+                    }
+
+                    float const invDeterminant = 1.0f / determinant;
+                    Vector const s = start - triangle.m_vertices[0];
+                    float const u = s.GetDot3( p ) * invDeterminant;
+                    if ( u < 0.0f || u > 1.0f )
+                    {
+                        continue;
+                    }
+
+                    Vector const q = Vector::Cross3( s, edge1 );
+                    float const v = unitDirection.GetDot3( q ) * invDeterminant;
+                    if ( v < 0.0f || ( u + v ) > 1.0f )
+                    {
+                        continue;
+                    }
+
+                    float const hitDistance = edge2.GetDot3( q ) * invDeterminant;
+                    if ( hitDistance >= 0.0f && hitDistance < closestHitDistance )
+                    {
+                        closestHitDistance = hitDistance;
+                        closestTriangleIdx = triangleIdx;
+                    }
+                }
+            }
+        }
+
+        if ( closestTriangleIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        // Make sure the normal faces the probe
+        outHitPosition = start + ( unitDirection * closestHitDistance );
+        outHitNormal = m_collisionTriangles[closestTriangleIdx].m_normal;
+        if ( outHitNormal.GetDot3( unitDirection ) > 0.0f )
+        {
+            outHitNormal = -outHitNormal;
+        }
+
+        return true;
+    }
+
+    void CoverDatabaseGenerator::SnapSamplesToCollision()
+    {
+        Vector const probeOffset( 0.0f, 0.0f, m_buildSettings.m_collisionProbeHeight, 0.0f );
+
+        for ( int32_t i = (int32_t) m_samples.size() - 1; i >= 0; i-- )
+        {
+            SamplePoint& sample = m_samples[i];
+
+            Vector hitPosition, hitNormal;
+            float const probeDistance = m_buildSettings.m_characterRadius + m_buildSettings.m_collisionProbeDistance;
+            if ( Probe( sample.m_position + probeOffset, sample.m_protectionDirection, probeDistance, hitPosition, hitNormal ) )
+            {
+                // Place the point one character radius away from the hit surface and protect against the direction the surface faces away from
+                Vector const hitNormal2D = GetFlattenedDirection( hitNormal );
+                Vector const snappedPosition = hitPosition + ( hitNormal2D * m_buildSettings.m_characterRadius );
+                sample.m_position = Vector( snappedPosition.GetX(), snappedPosition.GetY(), sample.m_position.GetZ() );
+                sample.m_protectionDirection = -hitNormal2D;
+                m_numSnappedPoints++;
+            }
+            else if ( m_buildSettings.m_discardPointsWithoutCollision )
+            {
+                m_samples.erase( m_samples.begin() + i );
+                m_numDiscardedPoints++;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CoverDatabaseGenerator::BuildDatabase( CoverDatabase& outDatabase ) const
+    {
+        float const cellSize = m_buildSettings.m_cellSize;
+        outDatabase.m_cellSize = cellSize;
+        outDatabase.m_numCoverPoints = (int32_t) m_samples.size();
+        outDatabase.m_pointBatches.clear();
+        outDatabase.m_coverTypes.clear();
+        outDatabase.m_cellBatchStartIndices.clear();
+
+        if ( m_samples.empty() )
+        {
+            outDatabase.m_gridOrigin = Float2::Zero;
+            outDatabase.m_numCellsX = outDatabase.m_numCellsY = 0;
+            outDatabase.m_cellBatchStartIndices.emplace_back( 0 );
+            return;
+        }
+
+        // Calculate grid
+        //-------------------------------------------------------------------------
+
+        Vector pointsMin = m_samples[0].m_position;
+        Vector pointsMax = m_samples[0].m_position;
+        for ( SamplePoint const& sample : m_samples )
+        {
+            pointsMin = Vector::Min( pointsMin, sample.m_position );
+            pointsMax = Vector::Max( pointsMax, sample.m_position );
+        }
+
+        outDatabase.m_gridOrigin = Float2( pointsMin.GetX(), pointsMin.GetY() );
+        outDatabase.m_numCellsX = GetCellCoordinate( pointsMax.GetX() - pointsMin.GetX(), cellSize ) + 1;
+        outDatabase.m_numCellsY = GetCellCoordinate( pointsMax.GetY() - pointsMin.GetY(), cellSize ) + 1;
+
+        int32_t const numCells = outDatabase.m_numCellsX * outDatabase.m_numCellsY;
+        int32_t const numSamples = (int32_t) m_samples.size();
+
+        TVector<int32_t> sampleCellIndices;
+        sampleCellIndices.resize( numSamples );
+
+        TVector<int32_t> cellPointCounts;
+        cellPointCounts.resize( numCells, 0 );
+
+        for ( int32_t i = 0; i < numSamples; i++ )
+        {
+            int32_t const cellX = Math::Min( GetCellCoordinate( m_samples[i].m_position.GetX() - pointsMin.GetX(), cellSize ), outDatabase.m_numCellsX - 1 );
+            int32_t const cellY = Math::Min( GetCellCoordinate( m_samples[i].m_position.GetY() - pointsMin.GetY(), cellSize ), outDatabase.m_numCellsY - 1 );
+            sampleCellIndices[i] = cellY * outDatabase.m_numCellsX + cellX;
+            cellPointCounts[sampleCellIndices[i]]++;
+        }
+
+        // Allocate batches
+        //-------------------------------------------------------------------------
+        // Each cell gets enough batches for all its points, the remaining lanes are left empty
+
+        TVector<int32_t> cellNextPointIndices;
+        cellNextPointIndices.resize( numCells );
+
+        outDatabase.m_cellBatchStartIndices.resize( numCells + 1 );
+
+        int32_t numBatches = 0;
+        for ( int32_t cellIdx = 0; cellIdx < numCells; cellIdx++ )
+        {
+            outDatabase.m_cellBatchStartIndices[cellIdx] = numBatches;
+            cellNextPointIndices[cellIdx] = numBatches * 4;
+            numBatches += ( cellPointCounts[cellIdx] + 3 ) / 4;
+        }
+        outDatabase.m_cellBatchStartIndices[numCells] = numBatches;
+
+        outDatabase.m_pointBatches.resize( numBatches );
+        outDatabase.m_coverTypes.resize( numBatches * 4, CoverType::HighHidden );
+
+        // Fill batches
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = 0; i < numSamples; i++ )
+        {
+            SamplePoint const& sample = m_samples[i];
+            int32_t const pointIdx = cellNextPointIndices[sampleCellIndices[i]]++;
+            uint32_t const laneIdx = uint32_t( pointIdx % 4 );
+
+            CoverDatabase::PointBatch& batch = outDatabase.m_pointBatches[pointIdx / 4];
+            batch.m_positionX[laneIdx] = sample.m_position.GetX();
+            batch.m_positionY[laneIdx] = sample.m_position.GetY();
+            batch.m_positionZ[laneIdx] = sample.m_position.GetZ();
+            batch.m_directionX[laneIdx] = sample.m_protectionDirection.GetX();
+            batch.m_directionY[laneIdx] = sample.m_protectionDirection.GetY();
+            batch.m_coverHeight[laneIdx] = sample.m_coverHeight;
+            outDatabase.m_coverTypes[pointIdx] = sample.m_coverType;
+        }
+    }
+}
\ No newline at end of file
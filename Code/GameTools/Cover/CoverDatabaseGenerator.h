@@ -0,0 +1,98 @@
+#pragma once
+
+#include "GameTools/_Module/API.h"
+#include "Game/Cover/Components/Component_CoverVolume.h"
+#include "System/Resource/ResourcePath.h"
+#include "System/FileSystem/FileSystemPath.h"
+#include "System/Math/Transform.h"
+#include "System/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::TypeSystem { class TypeRegistry; }
+namespace EE::EntityModel { class SerializedEntityCollection; }
+
+//-------------------------------------------------------------------------
+// Cover Database Generator
+//-------------------------------------------------------------------------
+// Samples cover points along the front of every cover volume in a map and then snaps them against the static collision in front of the volume
+// The final points are binned into a uniform grid and packed into the SoA batches used for the runtime scoring
+
+namespace EE
+{
+    struct CoverDatabaseBuildSettings;
+    class CoverDatabase;
+
+    //-------------------------------------------------------------------------
+
+    class CoverDatabaseGenerator
+    {
+    public:
+
+        constexpr static uint32_t const s_version = 1;
+
+    private:
+
+        struct SamplePoint
+        {
+            Vector                                          m_position; // On the floor of the cover volume
+            Vector                                          m_protectionDirection;
+            float                                           m_coverHeight = 0.0f;
+            CoverType                                       m_coverType = CoverType::HighHidden;
+        };
+
+        struct CollisionTriangle
+        {
+            Vector                                          m_vertices[3];
+            Vector                                          m_normal;
+        };
+
+    public:
+
+        CoverDatabaseGenerator( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, EntityModel::SerializedEntityCollection const& entityCollection, CoverDatabaseBuildSettings const& buildSettings );
+
+        // Generates the database via a blocking call - returns true if the generation succeeded, false otherwise
+        bool Generate( CoverDatabase& outDatabase );
+
+        inline int32_t GetNumCoverVolumes() const { return m_numCoverVolumes; }
+        inline int32_t GetNumCollisionTriangles() const { return (int32_t) m_collisionTriangles.size(); }
+        inline int32_t GetNumSnappedPoints() const { return m_numSnappedPoints; }
+        inline int32_t GetNumDiscardedPoints() const { return m_numDiscardedPoints; }
+
+    private:
+
+        // Sample the cover volumes and collect the static collision primitives
+        bool CollectSamplesAndCollisionPrimitives();
+
+        // Read all the static collision meshes and bin the triangles that can provide cover
+        bool CollectCollisionTriangles();
+
+        // Snap all the sampled points against the collision in front of them
+        void SnapSamplesToCollision();
+
+        // Bin the points into the grid and pack them into batches
+        void BuildDatabase( CoverDatabase& outDatabase ) const;
+
+        // Find the closest collision triangle along a horizontal probe, returns false if nothing was hit
+        bool Probe( Vector const& start, Vector const& unitDirection, float distance, Vector& outHitPosition, Vector& outHitNormal ) const;
+
+        void AddTriangleToGrid( int32_t triangleIdx );
+
+    private:
+
+        // Build data
+        FileSystem::Path const                              m_rawResourceDirectoryPath;
+        TypeSystem::TypeRegistry const&                     m_typeRegistry;
+        EntityModel::SerializedEntityCollection const&      m_entityCollection;
+        CoverDatabaseBuildSettings const&                   m_buildSettings;
+
+        // Build transient data
+        THashMap<ResourcePath, TVector<Transform>>          m_collisionPrimitives;
+        TVector<CollisionTriangle>                          m_collisionTriangles;
+        THashMap<uint64_t, TVector<int32_t>>                m_collisionGrid;
+        TVector<SamplePoint>                                m_samples;
+        int32_t                                             m_numCoverVolumes = 0;
+        int32_t                                             m_numSnappedPoints = 0;
+        int32_t                                             m_numDiscardedPoints = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "ResourceCompiler_CoverDatabase.h"
+#include "GameTools/Cover/CoverDatabaseGenerator.h"
+#include "EngineTools/Entity/EntitySerializationTools.h"
+#include "Game/Cover/CoverDatabase.h"
+#include "Game/Cover/Components/Component_CoverDatabase.h"
+#include "Engine/Entity/EntityDescriptors.h"
+#include "System/Serialization/BinarySerialization.h"
+#include "System/Time/Timers.h"
+#include "System/TypeSystem/TypeRegistry.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    CoverDatabaseCompiler::CoverDatabaseCompiler()
+        : Resource::Compiler( "CoverDatabaseCompiler", CoverDatabaseGenerator::s_version )
+    {
+        m_outputTypes.push_back( CoverDatabase::GetStaticResourceTypeID() );
+    }
+
+    Resource::CompilationResult CoverDatabaseCompiler::Compile( Resource::CompileContext const& ctx ) const
+    {
+        // Get map data
+        //-------------------------------------------------------------------------
+
+        FileSystem::Path mapPath = ctx.m_inputFilePath;
+        mapPath.ReplaceExtension( "map" );
+
+        if ( !mapPath.Exists() )
+        {
+            return Error( "Entity map file (%s) doesnt exist!", mapPath.c_str() );
+        }
+
+        EntityModel::SerializedEntityMap serializedMap;
+
+        Milliseconds elapsedTime = 0.0f;
+        {
+            ScopedTimer<PlatformClock> timer( elapsedTime );
+
+            if ( !EntityModel::ReadSerializedEntityMapFromFile( *m_pTypeRegistry, mapPath, serializedMap, ctx.m_pTaskSystem ) )
+            {
+                return Error( "Entity map file (%s) is malformed!", mapPath.c_str() );
+            }
+        }
+
+        Message( "Entity map read in: %.2fms", elapsedTime.ToFloat() );
+
+        // Get build settings
+        //-------------------------------------------------------------------------
+
+        bool hasWarning = false;
+        CoverDatabaseBuildSettings buildSettings;
+
+        auto const coverDatabaseComponents = serializedMap.GetComponentsOfType<CoverDatabaseComponent>( *m_pTypeRegistry, false );
+        if ( coverDatabaseComponents.empty() )
+        {
+            Warning( "No cover database component found in this map, using the default build settings!" );
+            hasWarning = true;
+        }
+        else
+        {
+            if ( coverDatabaseComponents.size() > 1 )
+            {
+                Warning( "More than one cover database component found in this map, this is not supported... Ignoring all components apart from the first found!" );
+                hasWarning = true;
+            }
+
+            auto pCoverDatabaseComponent = coverDatabaseComponents[0].m_pComponent->CreateTypeInstance<CoverDatabaseComponent>( *m_pTypeRegistry );
+            EE_ASSERT( pCoverDatabaseComponent != nullptr );
+            buildSettings = pCoverDatabaseComponent->GetBuildSettings();
+            EE::Delete( pCoverDatabaseComponent );
+        }
+
+        // Generate cover database
+        //-------------------------------------------------------------------------
+
+        CoverDatabase coverDatabase;
+        CoverDatabaseGenerator generator( *m_pTypeRegistry, m_rawResourceDirectoryPath, serializedMap, buildSettings );
+
+        {
+            ScopedTimer<PlatformClock> timer( elapsedTime );
+            if ( !generator.Generate( coverDatabase ) )
+            {
+                return Error( "Failed to generate the cover database for map: %s", mapPath.c_str() );
+            }
+        }
+
+        Message( "Cover database built in: %.2fms - %d cover volumes, %d collision triangles, %d cover points (%d snapped to collision, %d discarded)", elapsedTime.ToFloat(), generator.GetNumCoverVolumes(), generator.GetNumCollisionTriangles(), coverDatabase.GetNumCoverPoints(), generator.GetNumSnappedPoints(), generator.GetNumDiscardedPoints() );
+
+        // Serialize
+        //-------------------------------------------------------------------------
+
+        Serialization::BinaryOutputArchive archive;
+        archive << Resource::ResourceHeader( CoverDatabaseGenerator::s_version, CoverDatabase::GetStaticResourceTypeID() ) << coverDatabase;
+
+        if ( archive.WriteToFile( ctx.m_outputFilePath ) )
+        {
+            return hasWarning ? CompilationSucceededWithWarnings( ctx ) : CompilationSucceeded( ctx );
+        }
+        else
+        {
+            return CompilationFailed( ctx );
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma  once
+
+#include "GameTools/_Module/API.h"
+#include "EngineTools/Resource/ResourceCompiler.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class CoverDatabaseCompiler : public Resource::Compiler
+    {
+        EE_REGISTER_TYPE( CoverDatabaseCompiler );
+
+    public:
+
+        CoverDatabaseCompiler();
+        virtual Resource::CompilationResult Compile( Resource::CompileContext const& ctx ) const override;
+        virtual bool IsInputFileRequired() const override { return false; }
+    };
+}
\ No newline at end of file
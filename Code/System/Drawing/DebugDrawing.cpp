@@ -11,7 +11,6 @@ namespace EE::Drawing
         constexpr static uint32_t const g_numCircleVertices = 16;
         static_assert( ( g_numCircleVertices % 4 ) == 0 );
 
-        static bool g_circleVerticesInitialized = false;
         static Float4 g_circleVerticesXUp[g_numCircleVertices];
         static Float4 g_circleVerticesYUp[g_numCircleVertices];
         static Float4 g_circleVerticesZUp[g_numCircleVertices];
@@ -35,6 +34,9 @@ namespace EE::Drawing
             return true;
         }
 
+        // Shapes are drawn from worker threads, so the circle vertices are created once at static init time rather than lazily
+        static bool const g_circleVerticesInitialized = InitializeCircleVertices();
+
         //-------------------------------------------------------------------------
 
         // Actual length is 2 since we specify dimensions in a half-size and then scale
@@ -72,6 +74,225 @@ namespace EE::Drawing
             4, 5, 5, 6, 6, 7, 7, 4,
             0, 4, 1, 5, 2, 6, 3, 7,
         };
+
+        //-------------------------------------------------------------------------
+        // Shape Geometry
+        //-------------------------------------------------------------------------
+        // Shared by the drawing context and the primitive unit shapes, the emit function is called with the start and end point of each line
+
+        template<typename EmitLineFunction>
+        static void GenerateCircleLines( Transform const& transform, Float4 const* pCircleVerts, EmitLineFunction&& emitLine )
+        {
+            Vector verts[g_numCircleVertices];
+            for ( auto i = 0; i < g_numCircleVertices; i++ )
+            {
+                verts[i] = transform.TransformPoint( pCircleVerts[i] );
+            }
+
+            for ( auto i = 1; i < g_numCircleVertices; i++ )
+            {
+                emitLine( verts[i - 1], verts[i] );
+            }
+
+            emitLine( verts[g_numCircleVertices - 1], verts[0] );
+        }
+
+        template<typename EmitLineFunction>
+        static void GenerateSphereLines( Transform const& transform, EmitLineFunction&& emitLine )
+        {
+            GenerateCircleLines( transform, g_circleVerticesXUp, emitLine );
+            GenerateCircleLines( transform, g_circleVerticesYUp, emitLine );
+            GenerateCircleLines( transform, g_circleVerticesZUp, emitLine );
+        }
+
+        template<typename EmitLineFunction>
+        static void GenerateHalfSphereLines( Transform const& transform, EmitLineFunction&& emitLine )
+        {
+            GenerateCircleLines( transform, g_circleVerticesZUp, emitLine );
+
+            Vector vertsX[g_numCircleVertices];
+            Vector vertsY[g_numCircleVertices];
+            for ( auto i = 0; i < g_numCircleVertices; i++ )
+            {
+                vertsX[i] = transform.TransformPoint( g_circleVerticesXUp[i] );
+                vertsY[i] = transform.TransformPoint( g_circleVerticesYUp[i] );
+            }
+
+            for ( auto i = 1; i < ( g_numCircleVertices / 2 ); i++ )
+            {
+                emitLine( vertsX[i - 1], vertsX[i] );
+            }
+
+            emitLine( vertsX[g_numCircleVertices - 1], vertsX[0] );
+
+            for ( auto i = g_numCircleVertices / 2; i < g_numCircleVertices; i++ )
+            {
+                emitLine( vertsY[i - 1], vertsY[i] );
+            }
+        }
+
+        template<typename EmitLineFunction>
+        static void GenerateWireBoxLines( Transform const& transform, EmitLineFunction&& emitLine )
+        {
+            Vector verts[g_unitCubeNumVertices];
+            for ( auto i = 0; i < g_unitCubeNumVertices; i++ )
+            {
+                verts[i] = transform.TransformPoint( g_unitCubeVertices[i] );
+            }
+
+            for ( auto i = 0; i < g_unitCubeWireNumIndices; i += 2 )
+            {
+                emitLine( verts[g_unitCubeWireIndices[i]], verts[g_unitCubeWireIndices[i + 1]] );
+            }
+        }
+
+        template<typename EmitLineFunction>
+        static void GenerateCapsuleLines( Transform const& worldTransform, float radius, float halfHeight, EmitLineFunction&& emitLine )
+        {
+            Vector const axisX = worldTransform.GetAxisX();
+            Vector const axisY = worldTransform.GetAxisY();
+            Vector const axisZ = worldTransform.GetAxisZ();
+
+            Vector const origin = worldTransform.GetTranslation();
+            Vector const halfHeightOffset = ( axisZ * halfHeight );
+
+            Transform const cylinderTop( worldTransform.GetRotation(), origin + halfHeightOffset );
+
+            // Rotate the transform 180 degrees
+            Quaternion const rotation( Quaternion( EulerAngles( 0, 180, 0 ) ) * worldTransform.GetRotation() );
+            Transform const cylinderBottom( rotation, origin - halfHeightOffset );
+
+            // Caps
+            //-------------------------------------------------------------------------
+
+            Transform const sphereScale = Transform::FromScale( Vector( radius ) );
+            GenerateHalfSphereLines( sphereScale * cylinderTop, emitLine );
+            GenerateHalfSphereLines( sphereScale * cylinderBottom, emitLine );
+
+            // 4 lines
+            //-------------------------------------------------------------------------
+
+            Vector const xOffset = ( axisX * radius );
+            emitLine( cylinderTop.GetTranslation() + xOffset, cylinderBottom.GetTranslation() + xOffset );
+            emitLine( cylinderTop.GetTranslation() - xOffset, cylinderBottom.GetTranslation() - xOffset );
+
+            Vector const yOffset = ( axisY * radius );
+            emitLine( cylinderTop.GetTranslation() + yOffset, cylinderBottom.GetTranslation() + yOffset );
+            emitLine( cylinderTop.GetTranslation() - yOffset, cylinderBottom.GetTranslation() - yOffset );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Primitive Commands
+    //-------------------------------------------------------------------------
+
+    void PrimitiveCommand::GetUnitShapeVertices( Type type, TVector<Float4>& outVertices )
+    {
+        switch ( type )
+        {
+            case Type::Sphere:
+            {
+                GenerateSphereLines( Transform::Identity, [&outVertices] ( Vector const& startPosition, Vector const& endPosition )
+                {
+                    outVertices.emplace_back( startPosition.GetWithW0().ToFloat4() );
+                    outVertices.emplace_back( endPosition.GetWithW0().ToFloat4() );
+                } );
+            }
+            break;
+
+            case Type::WireBox:
+            {
+                GenerateWireBoxLines( Transform::Identity, [&outVertices] ( Vector const& startPosition, Vector const& endPosition )
+                {
+                    outVertices.emplace_back( startPosition.GetWithW0().ToFloat4() );
+                    outVertices.emplace_back( endPosition.GetWithW0().ToFloat4() );
+                } );
+            }
+            break;
+
+            case Type::Capsule:
+            {
+                // With a radius and half-height of 1, the top half of the capsule is offset by +1 and the bottom half by -1 along Z
+                // That offset is moved into the weight so that the half-height can be supplied separately from the radius
+                auto EmitCapsuleVertex = [&outVertices] ( Vector const& position )
+                {
+                    Float4 vertex = position.ToFloat4();
+                    vertex.m_w = ( vertex.m_z > 0.0f ) ? 1.0f : -1.0f;
+                    vertex.m_z -= vertex.m_w;
+                    outVertices.emplace_back( vertex );
+                };
+
+                GenerateCapsuleLines( Transform::Identity, 1.0f, 1.0f, [&EmitCapsuleVertex] ( Vector const& startPosition, Vector const& endPosition )
+                {
+                    EmitCapsuleVertex( startPosition );
+                    EmitCapsuleVertex( endPosition );
+                } );
+            }
+            break;
+
+            case Type::Cone:
+            {
+                // The apex is the origin and the cap circle is offset along the forward axis, that offset is moved into the weight so that the length can be supplied separately from the cap radius
+                Float4 const apex( 0.0f, 0.0f, 0.0f, 0.0f );
+                auto GetCapVertex = [] ( uint32_t i ) { return Float4( g_circleVerticesYUp[i].m_x, g_circleVerticesYUp[i].m_y, g_circleVerticesYUp[i].m_z, 1.0f ); };
+
+                for ( auto i = 1; i < g_numCircleVertices; i++ )
+                {
+                    outVertices.emplace_back( apex );
+                    outVertices.emplace_back( GetCapVertex( i ) );
+                    outVertices.emplace_back( GetCapVertex( i - 1 ) );
+                    outVertices.emplace_back( GetCapVertex( i ) );
+                }
+
+                outVertices.emplace_back( apex );
+                outVertices.emplace_back( GetCapVertex( 0 ) );
+                outVertices.emplace_back( GetCapVertex( 0 ) );
+                outVertices.emplace_back( GetCapVertex( g_numCircleVertices - 1 ) );
+            }
+            break;
+
+            default:
+            EE_UNREACHABLE_CODE();
+            break;
+        }
+    }
+
+    void PrimitiveCommand::GetShapeTransform( Matrix& outTransform, Float4& outShapeParameters ) const
+    {
+        switch ( m_type )
+        {
+            case Type::Sphere:
+            case Type::WireBox:
+            {
+                outTransform = m_transform.ToMatrix();
+                outShapeParameters = Float4( 1.0f, 0.0f, 0.0f, 0.0f );
+            }
+            break;
+
+            // The capsule and cone dimensions are fully specified by their parameters, so any transform scale is ignored
+
+            case Type::Capsule:
+            {
+                outTransform = Matrix( m_transform.GetRotation(), m_transform.GetTranslation() );
+                outShapeParameters = Float4( m_parameters.m_x, 0.0f, 0.0f, m_parameters.m_y );
+            }
+            break;
+
+            case Type::Cone:
+            {
+                float const length = m_parameters.m_y;
+                float const coneCapRadius = Math::Tan( m_parameters.m_x ) * length;
+                Vector const capOffset = Vector::WorldForward * length;
+
+                outTransform = Matrix( m_transform.GetRotation(), m_transform.GetTranslation() );
+                outShapeParameters = Float4( coneCapRadius, capOffset.GetX(), capOffset.GetY(), capOffset.GetZ() );
+            }
+            break;
+
+            default:
+            EE_UNREACHABLE_CODE();
+            break;
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -144,25 +365,7 @@ namespace EE::Drawing
 
     void DrawContext::DrawWireBox( Transform const& transform, Float4 const& color, float lineThickness, DepthTestState depthTestState, Seconds TTL )
     {
-        // Calculate vertices
-        Vector verts[8] =
-        {
-            transform.TransformPoint( g_unitCubeVertices[0] ),
-            transform.TransformPoint( g_unitCubeVertices[1] ),
-            transform.TransformPoint( g_unitCubeVertices[2] ),
-            transform.TransformPoint( g_unitCubeVertices[3] ),
-            transform.TransformPoint( g_unitCubeVertices[4] ),
-            transform.TransformPoint( g_unitCubeVertices[5] ),
-            transform.TransformPoint( g_unitCubeVertices[6] ),
-            transform.TransformPoint( g_unitCubeVertices[7] )
-        };
-
-        // Register draw commands
-
-        for ( auto i = 0; i < 24; i += 2 )
-        {
-            InternalDrawLine( m_commandBuffer, verts[g_unitCubeWireIndices[i]], verts[g_unitCubeWireIndices[i + 1]], color, lineThickness, depthTestState, TTL );
-        }
+        m_commandBuffer.AddCommand( PrimitiveCommand( PrimitiveCommand::Type::WireBox, transform, Float2::Zero, color, lineThickness, TTL ), depthTestState );
     }
 
     //-------------------------------------------------------------------------
@@ -171,11 +374,6 @@ namespace EE::Drawing
 
     void DrawContext::DrawCircle( Transform const& transform, Axis upAxis, Float4 const& color, float lineThickness, DepthTestState depthTestState, Seconds TTL )
     {
-        if ( !g_circleVerticesInitialized )
-        {
-            InitializeCircleVertices();
-        }
-
         Float4* pCircleVerts = nullptr;
 
         switch ( upAxis )
@@ -198,54 +396,27 @@ namespace EE::Drawing
 
         EE_ASSERT( pCircleVerts != nullptr );
 
-        // Create and transform vertices
-        auto verts = EE_STACK_ARRAY_ALLOC( Vector, g_numCircleVertices );
-        for ( auto i = 0; i < g_numCircleVertices; i++ )
+        auto EmitLine = [&] ( Vector const& startPosition, Vector const& endPosition )
         {
-            verts[i] = transform.TransformPoint( pCircleVerts[i] );
-        }
-
-        // Register line commands
-        for ( auto i = 1; i < g_numCircleVertices; i++ )
-        {
-            InternalDrawLine( m_commandBuffer, verts[i - 1], verts[i], color, lineThickness, depthTestState, TTL );
-        }
+            InternalDrawLine( m_commandBuffer, startPosition, endPosition, color, lineThickness, depthTestState, TTL );
+        };
 
-        InternalDrawLine( m_commandBuffer, verts[g_numCircleVertices - 1], verts[0], color, lineThickness, depthTestState, TTL );
+        GenerateCircleLines( transform, pCircleVerts, EmitLine );
     }
 
     void DrawContext::DrawSphere( Transform const& transform, Float4 const& color, float lineThickness, DepthTestState depthTestState, Seconds TTL )
     {
-        DrawCircle( transform, Axis::X, color, lineThickness, depthTestState, TTL );
-        DrawCircle( transform, Axis::Y, color, lineThickness, depthTestState, TTL );
-        DrawCircle( transform, Axis::Z, color, lineThickness, depthTestState, TTL );
+        m_commandBuffer.AddCommand( PrimitiveCommand( PrimitiveCommand::Type::Sphere, transform, Float2::Zero, color, lineThickness, TTL ), depthTestState );
     }
 
     void DrawContext::DrawHalfSphere( Transform const& transform, Float4 const& color, float lineThickness, DepthTestState depthTestState, Seconds TTL )
     {
-        DrawCircle( transform, Axis::Z, color, lineThickness, depthTestState, TTL );
-
-        Float4* pCircleVerts = g_circleVerticesXUp;
-        auto vertsX = EE_STACK_ARRAY_ALLOC( Vector, g_numCircleVertices );
-        auto vertsY = EE_STACK_ARRAY_ALLOC( Vector, g_numCircleVertices );
-
-        for ( auto i = 0; i < g_numCircleVertices; i++ )
-        {
-            vertsX[i] = transform.TransformPoint( g_circleVerticesXUp[i] );
-            vertsY[i] = transform.TransformPoint( g_circleVerticesYUp[i] );
-        }
-
-        for ( auto i = 1; i < ( g_numCircleVertices / 2 ); i++ )
+        auto EmitLine = [&] ( Vector const& startPosition, Vector const& endPosition )
         {
-            InternalDrawLine( m_commandBuffer, vertsX[i - 1], vertsX[i], color, lineThickness, depthTestState, TTL );
-        }
-
-        InternalDrawLine( m_commandBuffer, vertsX[g_numCircleVertices - 1], vertsX[0], color, lineThickness, depthTestState, TTL );
+            InternalDrawLine( m_commandBuffer, startPosition, endPosition, color, lineThickness, depthTestState, TTL );
+        };
 
-        for ( auto i = g_numCircleVertices / 2; i < g_numCircleVertices; i++ )
-        {
-            InternalDrawLine( m_commandBuffer, vertsY[i - 1], vertsY[i], color, lineThickness, depthTestState, TTL );
-        }
+        GenerateHalfSphereLines( transform, EmitLine );
     }
 
     void DrawContext::DrawHalfSphereYZ( Transform const& transform, Float4 const& color, float lineThickness, DepthTestState depthTestState, Seconds TTL )
@@ -291,11 +462,6 @@ namespace EE::Drawing
 
     void DrawContext::DrawDisc( Float3 const& worldPoint, float radius, Float4 const& color, DepthTestState depthTestState, Seconds TTL )
     {
-        if ( !g_circleVerticesInitialized )
-        {
-            InitializeCircleVertices();
-        }
-
         int32_t const numVerts = g_numCircleVertices;
 
         // Create and transform vertices
@@ -377,46 +543,7 @@ namespace EE::Drawing
 
     void DrawContext::DrawCapsule( Transform const& worldTransform, float radius, float halfHeight, Float4 const& color, float thickness, DepthTestState depthTestState, Seconds TTL )
     {
-        Vector const axisX = worldTransform.GetAxisX();
-        Vector const axisY = worldTransform.GetAxisY();
-        Vector const axisZ = worldTransform.GetAxisZ();
-
-        Vector const origin = worldTransform.GetTranslation();
-        Vector const halfHeightOffset = ( axisZ * halfHeight );
-
-        Transform const cylinderTop( worldTransform.GetRotation(), origin + halfHeightOffset );
-
-        // Rotate the transform 180 degrees
-        Quaternion const rotation( Quaternion( EulerAngles( 0, 180, 0 ) ) * worldTransform.GetRotation() );
-        Transform const cylinderBottom( rotation, origin - halfHeightOffset );
-
-        // Caps
-        //-------------------------------------------------------------------------
-
-        Float3 const sphereRadius( radius );
-        DrawHalfSphere( cylinderTop, sphereRadius, color, thickness, depthTestState, TTL );
-        DrawHalfSphere( cylinderBottom, sphereRadius, color, thickness, depthTestState, TTL );
-
-        // 8 lines
-        //-------------------------------------------------------------------------
-
-        Vector xOffset = ( axisX * radius );
-        Vector lt0 = cylinderTop.GetTranslation() + xOffset;
-        Vector lt1 = cylinderTop.GetTranslation() - xOffset;
-        Vector lb0 = cylinderBottom.GetTranslation() + xOffset;
-        Vector lb1 = cylinderBottom.GetTranslation() - xOffset;
-
-        DrawLine( lt0, lb0, color, thickness, depthTestState, TTL );
-        DrawLine( lt1, lb1, color, thickness, depthTestState, TTL );
-
-        Vector yOffset = ( axisY * radius );
-        Vector lt2 = cylinderTop.GetTranslation() + yOffset;
-        Vector lt3 = cylinderTop.GetTranslation() - yOffset;
-        Vector lb2 = cylinderBottom.GetTranslation() + yOffset;
-        Vector lb3 = cylinderBottom.GetTranslation() - yOffset;
-
-        DrawLine( lt2, lb2, color, thickness, depthTestState, TTL );
-        DrawLine( lt3, lb3, color, thickness, depthTestState, TTL );
+        m_commandBuffer.AddCommand( PrimitiveCommand( PrimitiveCommand::Type::Capsule, worldTransform, Float2( radius, halfHeight ), color, thickness, TTL ), depthTestState );
     }
 
     void DrawContext::DrawCapsuleHeightX( Transform const& worldTransform, float radius, float halfHeight, Float4 const& color, float thickness, DepthTestState depthTestState, Seconds TTL )
@@ -491,31 +618,7 @@ namespace EE::Drawing
 
     void DrawContext::DrawCone( Transform const& transform, Radians coneAngle, float length, Float4 const& color, float thickness, DepthTestState depthTestState, Seconds TTL )
     {
-        Vector const capOffset = ( transform.GetForwardVector() * length );
-        float const coneCapRadius = Math::Tan( coneAngle.ToFloat() ) * length;
-
-        Transform capTransform = transform;
-        capTransform.SetScale( coneCapRadius );
-        capTransform.AddTranslation( capOffset );
-
-        // Draw cone cap
-        //-------------------------------------------------------------------------
-
-        auto verts = EE_STACK_ARRAY_ALLOC( Vector, g_numCircleVertices );
-        for ( auto i = 0; i < g_numCircleVertices; i++ )
-        {
-            verts[i] = capTransform.TransformPoint( g_circleVerticesYUp[i] );
-        }
-
-        // Register line commands
-        for ( auto i = 1; i < g_numCircleVertices; i++ )
-        {
-            InternalDrawLine( m_commandBuffer, transform.GetTranslation(), verts[i], color, thickness, depthTestState, TTL );
-            InternalDrawLine( m_commandBuffer, verts[i - 1], verts[i], color, thickness, depthTestState, TTL );
-        }
-
-        InternalDrawLine( m_commandBuffer, transform.GetTranslation(), verts[0], color, thickness, depthTestState, TTL );
-        InternalDrawLine( m_commandBuffer, verts[0], verts[g_numCircleVertices-1], color, thickness, depthTestState, TTL );
+        m_commandBuffer.AddCommand( PrimitiveCommand( PrimitiveCommand::Type::Cone, transform, Float2( coneAngle.ToFloat(), length ), color, thickness, TTL ), depthTestState );
     }
 }
 #endif
\ No newline at end of file
@@ -44,8 +44,64 @@ namespace EE::Drawing
                 m_textCommands.erase_unsorted( m_textCommands.begin() + i );
             }
         }
+
+        for ( int32_t i = (int32_t) m_primitiveCommands.size() - 1; i >= 0; i-- )
+        {
+            m_primitiveCommands[i].m_TTL -= deltaTime;
+            if ( m_primitiveCommands[i].m_TTL <= 0.0f )
+            {
+                m_primitiveCommands.erase_unsorted( m_primitiveCommands.begin() + i );
+            }
+        }
     }
 
+    void CommandBuffer::AppendCommandList( CommandBuffer const& buffer, CommandList list )
+    {
+        switch ( list )
+        {
+            case PointList:
+            {
+                m_pointCommands.reserve( m_pointCommands.size() + buffer.m_pointCommands.size() );
+                m_pointCommands.insert( m_pointCommands.end(), buffer.m_pointCommands.begin(), buffer.m_pointCommands.end() );
+            }
+            break;
+
+            case LineList:
+            {
+                m_lineCommands.reserve( m_lineCommands.size() + buffer.m_lineCommands.size() );
+                m_lineCommands.insert( m_lineCommands.end(), buffer.m_lineCommands.begin(), buffer.m_lineCommands.end() );
+            }
+            break;
+
+            case TriangleList:
+            {
+                m_triangleCommands.reserve( m_triangleCommands.size() + buffer.m_triangleCommands.size() );
+                m_triangleCommands.insert( m_triangleCommands.end(), buffer.m_triangleCommands.begin(), buffer.m_triangleCommands.end() );
+            }
+            break;
+
+            case TextList:
+            {
+                m_textCommands.reserve( m_textCommands.size() + buffer.m_textCommands.size() );
+                m_textCommands.insert( m_textCommands.end(), buffer.m_textCommands.begin(), buffer.m_textCommands.end() );
+            }
+            break;
+
+            case PrimitiveList:
+            {
+                m_primitiveCommands.reserve( m_primitiveCommands.size() + buffer.m_primitiveCommands.size() );
+                m_primitiveCommands.insert( m_primitiveCommands.end(), buffer.m_primitiveCommands.begin(), buffer.m_primitiveCommands.end() );
+            }
+            break;
+
+            default:
+            EE_UNREACHABLE_CODE();
+            break;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void FrameCommandBuffer::AddThreadCommands( ThreadCommandBuffer const& threadCommands )
     {
         // TODO:
@@ -58,5 +114,19 @@ namespace EE::Drawing
         m_transparentDepthOn.Append( threadCommands.GetTransparentDepthTestEnabledBuffer() );
         m_transparentDepthOff.Append( threadCommands.GetTransparentDepthTestDisabledBuffer() );
     }
+
+    void FrameCommandBuffer::ReflectCommandList( int32_t commandListIdx, ThreadCommandBuffer* const* ppThreadBuffers, int32_t numThreadBuffers )
+    {
+        EE_ASSERT( commandListIdx >= 0 && commandListIdx < s_numCommandLists );
+
+        int32_t const bufferIdx = commandListIdx / CommandBuffer::NumCommandLists;
+        auto const commandList = (CommandBuffer::CommandList) ( commandListIdx % CommandBuffer::NumCommandLists );
+
+        CommandBuffer& frameBuffer = GetBuffer( bufferIdx );
+        for ( int32_t i = 0; i < numThreadBuffers; i++ )
+        {
+            frameBuffer.AppendCommandList( ppThreadBuffers[i]->GetBuffer( bufferIdx ), commandList );
+        }
+    }
 }
 #endif
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "../_Module/API.h"
 #include "System/Math/Math.h"
 #include "System/Math/NumericRange.h"
+#include "System/Math/Transform.h"
 #include "System/Types/Arrays.h"
 #include "System/Types/String.h"
 #include "System/Types/BitFlags.h"
@@ -190,23 +191,82 @@ namespace EE::Drawing
         Seconds                     m_TTL;
     };
 
+    //-------------------------------------------------------------------------
+    // Primitive Command
+    //-------------------------------------------------------------------------
+    // A single compact command for a whole wireframe shape instead of the tens of line commands that make up the shape
+    // These are never expanded on the CPU, the renderer draws each shape type as a single instanced draw of a shared unit shape
+
+    struct EE_SYSTEM_API PrimitiveCommand
+    {
+        enum class Type : uint8_t
+        {
+            Sphere,     // A unit sphere scaled by the transform
+            WireBox,    // A box with a half-size of 1 scaled by the transform
+            Capsule,    // A capsule along the transform Z axis, parameters: ( radius, half-height )
+            Cone,       // A cone along the transform forward axis, parameters: ( cone angle in radians, length )
+
+            NumTypes
+        };
+
+        // Get the line list vertices for a unit shape, each vertex's xyz is scaled by the x shape parameter and its w is the weight of the yzw shape parameter offset
+        static void GetUnitShapeVertices( Type type, TVector<Float4>& outVertices );
+
+        PrimitiveCommand( Type type, Transform const& transform, Float2 const& parameters, Float4 const& color, float lineThickness, Seconds TTL )
+            : m_transform( transform )
+            , m_color( color )
+            , m_parameters( parameters )
+            , m_thickness( lineThickness )
+            , m_type( type )
+            , m_TTL( TTL )
+        {}
+
+        EE_FORCE_INLINE bool IsTransparent() const { return m_color[3] != 1.0f; }
+
+        // Get the transform and shape parameters to place the unit shape vertices in the world
+        void GetShapeTransform( Matrix& outTransform, Float4& outShapeParameters ) const;
+
+        Transform   m_transform;
+        Float4      m_color;
+        Float2      m_parameters;
+        float       m_thickness;
+        Type        m_type;
+        Seconds     m_TTL;
+    };
+
     //-------------------------------------------------------------------------
 
     struct CommandBuffer
     {
-        inline void Append( CommandBuffer const& buffer )
+        // The individual command lists in a buffer, each list can be appended independently
+        enum CommandList : uint8_t
         {
-            m_pointCommands.reserve( m_pointCommands.size() + buffer.m_pointCommands.size() );
-            m_pointCommands.insert( m_pointCommands.end(), buffer.m_pointCommands.begin(), buffer.m_pointCommands.end() );
+            PointList = 0,
+            LineList,
+            TriangleList,
+            TextList,
+            PrimitiveList,
+
+            NumCommandLists
+        };
 
-            m_lineCommands.reserve( m_lineCommands.size() + buffer.m_lineCommands.size() );
-            m_lineCommands.insert( m_lineCommands.end(), buffer.m_lineCommands.begin(), buffer.m_lineCommands.end() );
+    public:
+
+        inline void Append( CommandBuffer const& buffer )
+        {
+            for ( int32_t i = 0; i < NumCommandLists; i++ )
+            {
+                AppendCommandList( buffer, (CommandList) i );
+            }
+        }
 
-            m_triangleCommands.reserve( m_triangleCommands.size() + buffer.m_triangleCommands.size() );
-            m_triangleCommands.insert( m_triangleCommands.end(), buffer.m_triangleCommands.begin(), buffer.m_triangleCommands.end() );
+        // Append a single command list from the supplied buffer
+        void AppendCommandList( CommandBuffer const& buffer, CommandList list );
 
-            m_textCommands.reserve( m_textCommands.size() + buffer.m_textCommands.size() );
-            m_textCommands.insert( m_textCommands.end(), buffer.m_textCommands.begin(), buffer.m_textCommands.end() );
+        // Get the number of recorded commands, each primitive counts as a single command
+        inline size_t GetNumCommands() const
+        {
+            return m_pointCommands.size() + m_lineCommands.size() + m_triangleCommands.size() + m_textCommands.size() + m_primitiveCommands.size();
         }
 
         inline void Clear()
@@ -215,6 +275,7 @@ namespace EE::Drawing
             m_lineCommands.clear();
             m_triangleCommands.clear();
             m_textCommands.clear();
+            m_primitiveCommands.clear();
         }
 
         void Reset( Seconds deltaTime );
@@ -225,6 +286,7 @@ namespace EE::Drawing
         TVector<LineCommand>        m_lineCommands;
         TVector<TriangleCommand>    m_triangleCommands;
         TVector<TextCommand>        m_textCommands;
+        TVector<PrimitiveCommand>   m_primitiveCommands;
     };
 
     //-------------------------------------------------------------------------
@@ -235,6 +297,11 @@ namespace EE::Drawing
     class ThreadCommandBuffer
     {
 
+    public:
+
+        // The number of depth test/transparency buffers
+        constexpr static int32_t const s_numBuffers = 4;
+
     public:
 
         ThreadCommandBuffer( Threading::ThreadID threadID )
@@ -267,6 +334,12 @@ namespace EE::Drawing
             pBuffer->m_textCommands.emplace_back( eastl::move( cmd ) );
         }
 
+        EE_FORCE_INLINE void AddCommand( PrimitiveCommand&& cmd, DepthTestState depthTestState )
+        {
+            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            pBuffer->m_primitiveCommands.emplace_back( eastl::move( cmd ) );
+        }
+
         inline void Clear()
         {
             m_opaqueDepthOn.Clear();
@@ -280,6 +353,19 @@ namespace EE::Drawing
         CommandBuffer const& GetTransparentDepthTestEnabledBuffer() const { return m_transparentDepthOn; }
         CommandBuffer const& GetTransparentDepthTestDisabledBuffer() const { return m_transparentDepthOff; }
 
+        // Get a buffer by index, the buffer order matches the frame command buffer
+        inline CommandBuffer const& GetBuffer( int32_t bufferIdx ) const
+        {
+            EE_ASSERT( bufferIdx >= 0 && bufferIdx < s_numBuffers );
+            CommandBuffer const* const buffers[s_numBuffers] = { &m_opaqueDepthOn, &m_opaqueDepthOff, &m_transparentDepthOn, &m_transparentDepthOff };
+            return *buffers[bufferIdx];
+        }
+
+        inline size_t GetNumCommands() const
+        {
+            return m_opaqueDepthOn.GetNumCommands() + m_opaqueDepthOff.GetNumCommands() + m_transparentDepthOn.GetNumCommands() + m_transparentDepthOff.GetNumCommands();
+        }
+
     private:
 
         inline CommandBuffer* GetCommandBuffer( DepthTestState depthTestState, bool isTransparent )
@@ -315,10 +401,18 @@ namespace EE::Drawing
 
     class EE_SYSTEM_API FrameCommandBuffer
     {
+    public:
+
+        // Each buffer's command lists are independent, so they can all be reflected concurrently
+        constexpr static int32_t const s_numCommandLists = ThreadCommandBuffer::s_numBuffers * CommandBuffer::NumCommandLists;
+
     public:
 
         void AddThreadCommands( ThreadCommandBuffer const& threadCommands );
 
+        // Append a single command list from all the supplied thread buffers, only this command list is written to
+        void ReflectCommandList( int32_t commandListIdx, ThreadCommandBuffer* const* ppThreadBuffers, int32_t numThreadBuffers );
+
         // Empties the command buffer ignoring any TTL state
         inline void Clear()
         {
@@ -337,6 +431,14 @@ namespace EE::Drawing
             m_transparentDepthOff.Reset( deltaTime );
         }
 
+        // Get a buffer by index, the buffer order matches the thread command buffer
+        inline CommandBuffer& GetBuffer( int32_t bufferIdx )
+        {
+            EE_ASSERT( bufferIdx >= 0 && bufferIdx < ThreadCommandBuffer::s_numBuffers );
+            CommandBuffer* const buffers[ThreadCommandBuffer::s_numBuffers] = { &m_opaqueDepthOn, &m_opaqueDepthOff, &m_transparentDepthOn, &m_transparentDepthOff };
+            return *buffers[bufferIdx];
+        }
+
     public:
 
         CommandBuffer               m_opaqueDepthOn;
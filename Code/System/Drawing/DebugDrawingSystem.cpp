@@ -1,56 +1,221 @@
 #include "DebugDrawingSystem.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Drawing
 {
-    ThreadCommandBuffer& DrawingSystem::GetThreadCommandBuffer()
+    namespace
     {
-        Threading::ScopeLock Lock( m_commandBufferMutex );
+        // Below this number of recorded commands, it's cheaper to reflect all the thread buffers on the calling thread
+        constexpr static size_t const g_minCommandsForParallelReflection = 2048;
 
-        auto const threadID = Threading::GetCurrentThreadID();
+        // The number of drawing systems each thread caches its buffers for (i.e. the number of worlds a thread can draw into without hitting the slow path)
+        constexpr static int32_t const g_threadBufferCacheSize = 4;
 
-        // Check for an already created buffer for this thread
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+        struct ThreadCommandBufferCache
         {
-            if ( pThreadBuffer->GetThreadID() == threadID )
+            uint64_t                        m_systemIDs[g_threadBufferCacheSize] = {};
+            ThreadCommandBuffer*            m_pBuffers[g_threadBufferCacheSize] = {};
+            int32_t                         m_nextEntryIdx = 0;
+        };
+
+        // System IDs are never reused, so a cached entry for a destroyed system can never be matched by a new system allocated at the same address
+        static std::atomic<uint64_t> g_nextDrawingSystemID = 1;
+        static thread_local ThreadCommandBufferCache g_threadBufferCache;
+    }
+
+    //-------------------------------------------------------------------------
+
+    DrawingSystem::DrawingSystem()
+        : m_systemID( g_nextDrawingSystemID.fetch_add( 1, std::memory_order_relaxed ) )
+    {
+        for ( auto& threadBuffer : m_threadCommandBuffers )
+        {
+            threadBuffer.store( nullptr, std::memory_order_relaxed );
+        }
+    }
+
+    DrawingSystem::~DrawingSystem()
+    {
+        int32_t const numBuffers = Math::Min( m_numThreadCommandBuffers.load(), s_maxThreadCommandBuffers );
+        for ( int32_t i = 0; i < numBuffers; i++ )
+        {
+            ThreadCommandBuffer* pBuffer = m_threadCommandBuffers[i].exchange( nullptr );
+            EE::Delete( pBuffer );
+        }
+
+        for ( auto& pBuffer : m_overflowThreadCommandBuffers )
+        {
+            EE::Delete( pBuffer );
+        }
+        m_overflowThreadCommandBuffers.clear();
+    }
+
+    ThreadCommandBuffer& DrawingSystem::GetThreadCommandBuffer()
+    {
+        // Check whether this thread has already drawn into this system
+        ThreadCommandBufferCache& cache = g_threadBufferCache;
+        for ( int32_t i = 0; i < g_threadBufferCacheSize; i++ )
+        {
+            if ( cache.m_systemIDs[i] == m_systemID )
             {
-                return *pThreadBuffer;
+                return *cache.m_pBuffers[i];
             }
         }
 
-        // Create a new buffer
-        auto& pThreadBuffer = m_threadCommandBuffers.emplace_back( EE::New<ThreadCommandBuffer>( threadID ) );
+        // Find or register the buffer and cache it, replacing the oldest entry
+        ThreadCommandBuffer* pThreadBuffer = FindOrRegisterThreadCommandBuffer();
+        cache.m_systemIDs[cache.m_nextEntryIdx] = m_systemID;
+        cache.m_pBuffers[cache.m_nextEntryIdx] = pThreadBuffer;
+        cache.m_nextEntryIdx = ( cache.m_nextEntryIdx + 1 ) % g_threadBufferCacheSize;
         return *pThreadBuffer;
     }
 
-    DrawingSystem::~DrawingSystem()
+    ThreadCommandBuffer* DrawingSystem::FindOrRegisterThreadCommandBuffer()
     {
-        for ( auto& pBuffer : m_threadCommandBuffers )
+        auto const threadID = Threading::GetCurrentThreadID();
+
+        // Check for an already created buffer for this thread (i.e. the cache entry was evicted)
+        // Only this thread can register its own buffer, so any slot that is still being published by another thread can safely be skipped
+        int32_t const numBuffers = Math::Min( m_numThreadCommandBuffers.load( std::memory_order_acquire ), s_maxThreadCommandBuffers );
+        for ( int32_t i = 0; i < numBuffers; i++ )
         {
-            EE::Delete( pBuffer );
+            ThreadCommandBuffer* pThreadBuffer = m_threadCommandBuffers[i].load( std::memory_order_acquire );
+            if ( pThreadBuffer != nullptr && pThreadBuffer->GetThreadID() == threadID )
+            {
+                return pThreadBuffer;
+            }
         }
+
+        // Claim a slot and publish a new buffer
+        if ( numBuffers < s_maxThreadCommandBuffers )
+        {
+            int32_t const slotIdx = m_numThreadCommandBuffers.fetch_add( 1, std::memory_order_acq_rel );
+            if ( slotIdx < s_maxThreadCommandBuffers )
+            {
+                ThreadCommandBuffer* pThreadBuffer = EE::New<ThreadCommandBuffer>( threadID );
+                m_threadCommandBuffers[slotIdx].store( pThreadBuffer, std::memory_order_release );
+                return pThreadBuffer;
+            }
+        }
+
+        // All lock-free slots are taken, so fall back to the overflow list
+        Threading::ScopeLock lock( m_overflowMutex );
+        for ( auto pThreadBuffer : m_overflowThreadCommandBuffers )
+        {
+            if ( pThreadBuffer->GetThreadID() == threadID )
+            {
+                return pThreadBuffer;
+            }
+        }
+
+        ThreadCommandBuffer* pThreadBuffer = EE::New<ThreadCommandBuffer>( threadID );
+        m_overflowThreadCommandBuffers.emplace_back( pThreadBuffer );
+        return pThreadBuffer;
     }
 
     void DrawingSystem::ReflectFrameCommandBuffer( Seconds const deltaTime, FrameCommandBuffer& reflectedFrameCommands )
     {
+        EE_PROFILE_FUNCTION_RENDER();
+
         // Reset the frame buffer for a new frame, flush old commands and only keep ones with a valid TTL
         reflectedFrameCommands.Reset( deltaTime );
 
+        // Gather all the thread buffers
+        //-------------------------------------------------------------------------
+
+        TInlineVector<ThreadCommandBuffer*, s_maxThreadCommandBuffers> threadBuffers;
+        size_t numCommands = 0;
+
+        int32_t const numBuffers = Math::Min( m_numThreadCommandBuffers.load( std::memory_order_acquire ), s_maxThreadCommandBuffers );
+        for ( int32_t i = 0; i < numBuffers; i++ )
+        {
+            ThreadCommandBuffer* pThreadBuffer = m_threadCommandBuffers[i].load( std::memory_order_acquire );
+            if ( pThreadBuffer != nullptr )
+            {
+                threadBuffers.emplace_back( pThreadBuffer );
+                numCommands += pThreadBuffer->GetNumCommands();
+            }
+        }
+
+        {
+            Threading::ScopeLock lock( m_overflowMutex );
+            for ( auto pThreadBuffer : m_overflowThreadCommandBuffers )
+            {
+                threadBuffers.emplace_back( pThreadBuffer );
+                numCommands += pThreadBuffer->GetNumCommands();
+            }
+        }
+
         // Reflect all the new commands into the frame buffer
-        Threading::ScopeLock Lock( m_commandBufferMutex );
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+        //-------------------------------------------------------------------------
+        // Each job writes to a different command list in the frame buffer, so the jobs need no synchronization
+
+        if ( m_pTaskSystem != nullptr && numCommands >= g_minCommandsForParallelReflection )
+        {
+            struct ReflectionTask : public ITaskSet
+            {
+                ReflectionTask( FrameCommandBuffer& frameCommands, TInlineVector<ThreadCommandBuffer*, s_maxThreadCommandBuffers> const& threadBuffers )
+                    : m_frameCommands( frameCommands )
+                    , m_threadBuffers( threadBuffers )
+                {
+                    m_SetSize = FrameCommandBuffer::s_numCommandLists;
+                    m_MinRange = 1;
+                }
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    EE_PROFILE_SCOPE_RENDER( "Reflect Debug Drawing Commands" );
+
+                    for ( uint32_t i = range.start; i < range.end; i++ )
+                    {
+                        m_frameCommands.ReflectCommandList( (int32_t) i, m_threadBuffers.data(), (int32_t) m_threadBuffers.size() );
+                    }
+                }
+
+            private:
+
+                FrameCommandBuffer&                                                         m_frameCommands;
+                TInlineVector<ThreadCommandBuffer*, s_maxThreadCommandBuffers> const&       m_threadBuffers;
+            };
+
+            ReflectionTask reflectionTask( reflectedFrameCommands, threadBuffers );
+            m_pTaskSystem->ScheduleTask( &reflectionTask );
+            m_pTaskSystem->WaitForTask( &reflectionTask );
+        }
+        else
+        {
+            for ( int32_t i = 0; i < FrameCommandBuffer::s_numCommandLists; i++ )
+            {
+                reflectedFrameCommands.ReflectCommandList( i, threadBuffers.data(), (int32_t) threadBuffers.size() );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( auto pThreadBuffer : threadBuffers )
         {
-            reflectedFrameCommands.AddThreadCommands( *pThreadBuffer );
             pThreadBuffer->Clear();
         }
     }
 
     void DrawingSystem::Reset()
     {
-        Threading::ScopeLock Lock( m_commandBufferMutex );
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+        int32_t const numBuffers = Math::Min( m_numThreadCommandBuffers.load( std::memory_order_acquire ), s_maxThreadCommandBuffers );
+        for ( int32_t i = 0; i < numBuffers; i++ )
+        {
+            ThreadCommandBuffer* pThreadBuffer = m_threadCommandBuffers[i].load( std::memory_order_acquire );
+            if ( pThreadBuffer != nullptr )
+            {
+                pThreadBuffer->Clear();
+            }
+        }
+
+        Threading::ScopeLock lock( m_overflowMutex );
+        for ( auto pThreadBuffer : m_overflowThreadCommandBuffers )
         {
             pThreadBuffer->Clear();
         }
@@ -3,20 +3,34 @@
 #include "System/_Module/API.h"
 #include "System/Drawing/DebugDrawing.h"
 #include "System/Threading/Threading.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Drawing
 {
+    // Each thread that draws gets its own command buffer, registered lock-free the first time the thread draws and cached in thread local storage after that
+    // Once all the lock-free slots are taken, any further thread buffers are registered in a mutex protected overflow list
+    // The thread buffers are only ever written to by their owning thread and only ever read when reflecting the frame buffer, at which point no thread should be drawing
+
     class EE_SYSTEM_API DrawingSystem
     {
+        // The max number of threads that can register lock-free with a single drawing system
+        constexpr static int32_t const s_maxThreadCommandBuffers = 64;
 
     public:
 
-        DrawingSystem() = default;
+        DrawingSystem();
         ~DrawingSystem();
 
+        // Set the task system to use when reflecting the thread buffers, without one all buffers are reflected on the calling thread
+        inline void SetTaskSystem( TaskSystem* pTaskSystem ) { m_pTaskSystem = pTaskSystem; }
+
         // Empty all per thread buffers
         void Reset();
 
@@ -30,10 +44,17 @@ namespace EE::Drawing
 
         ThreadCommandBuffer& GetThreadCommandBuffer();
 
+        // Search the registered buffers for the calling thread's buffer, registering a new one if none exists
+        ThreadCommandBuffer* FindOrRegisterThreadCommandBuffer();
+
     private:
 
-        TVector<ThreadCommandBuffer*>       m_threadCommandBuffers;
-        Threading::Mutex                    m_commandBufferMutex;
+        uint64_t const                                      m_systemID; // Unique per drawing system, used to validate the thread local buffer caches
+        std::atomic<ThreadCommandBuffer*>                   m_threadCommandBuffers[s_maxThreadCommandBuffers];
+        std::atomic<int32_t>                                m_numThreadCommandBuffers = 0;
+        Threading::Mutex                                    m_overflowMutex;
+        TVector<ThreadCommandBuffer*>                       m_overflowThreadCommandBuffers;
+        TaskSystem*                                         m_pTaskSystem = nullptr;
     };
 }
 #endif
\ No newline at end of file
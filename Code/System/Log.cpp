@@ -3,6 +3,8 @@
 #include "System/FileSystem/FileSystem.h"
 #include "System/FileSystem/FileStreams.h"
 #include "System/FileSystem/FileSystemPath.h"
+#include <atomic>
+#include <thread>
 #include <ctime>
 
 //-------------------------------------------------------------------------
@@ -13,17 +15,214 @@ namespace EE::Log
     {
         static char const* const g_severityLabels[] = { "Message", "Warning", "Error", "Fatal Error" };
 
+        // The maximum number of entries kept in the in-memory history
+        constexpr static int32_t const g_maxHistorySize = 8192;
+
+        // The maximum number of unhandled warnings and errors kept until they are retrieved
+        constexpr static int32_t const g_maxUnhandledWarningsAndErrors = 1024;
+
+        // The maximum number of entries waiting to be processed, once reached the adding thread helps drain the queue
+        constexpr static uint64_t const g_maxQueuedEntries = 4096;
+
+        // The maximum number of entries processed per drain iteration
+        constexpr static int32_t const g_maxDrainBatchSize = 32;
+
+        // How long the drain thread sleeps when there is nothing to process
+        static Milliseconds const g_drainThreadSleepTime( 5.0f );
+
+        //-------------------------------------------------------------------------
+
+        // An entry waiting to be processed - only the message is formatted by the thread adding the entry, everything else is deferred
+        struct QueuedLogEntry
+        {
+            InlineString                    m_message;
+            InlineString                    m_sourceInfo;
+            InlineString                    m_filename;
+            TInlineString<32>               m_category;
+            time_t                          m_time = 0;
+            uint32_t                        m_lineNumber = 0;
+            Severity                        m_severity = Severity::Message;
+        };
+
         struct LogData
         {
-            TVector<LogEntry>               m_logEntries;
+            // Bounded ring of processed entries
+            TVector<LogEntry>               m_history;
+            int32_t                         m_historyStartIdx = 0;
+
+            // Bounded ring of warnings and errors that havent been retrieved yet
             TVector<LogEntry>               m_unhandledWarningsAndErrors;
+            int32_t                         m_unhandledWarningsAndErrorsStartIdx = 0;
+
+            LogEntry                        m_fatalError;
             Threading::Mutex                m_mutex;
-            int32_t                         m_fatalErrorIndex = InvalidIndex;
+            bool                            m_hasFatalErrorOccurred = false;
             int32_t                         m_numWarnings = 0;
             int32_t                         m_numErrors = 0;
+
+            // Async mode
+            Threading::LockFreeQueue<QueuedLogEntry>    m_queue;
+            Threading::Mutex                m_drainMutex;
+            std::thread                     m_drainThread;
+            FileSystem::OutputFileStream*   m_pLogFile = nullptr;
+            std::atomic<uint64_t>           m_numQueuedEntries = 0;
+            std::atomic<uint64_t>           m_numProcessedEntries = 0;
+            std::atomic<int32_t>            m_numActiveProducers = 0;
+            std::atomic<bool>               m_isAsyncModeEnabled = false;
         };
 
         static LogData*                     g_pLog = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        static void CreateQueuedEntry( QueuedLogEntry& queuedEntry, Severity severity, char const* pCategory, char const* pSourceInfo, char const* pFilename, int pLineNumber, char const* pMessageFormat, va_list args )
+        {
+            queuedEntry.m_category = pCategory;
+            queuedEntry.m_sourceInfo = ( pSourceInfo != nullptr ) ? pSourceInfo : "";
+            queuedEntry.m_filename = pFilename;
+            queuedEntry.m_lineNumber = pLineNumber;
+            queuedEntry.m_severity = severity;
+            queuedEntry.m_time = std::time( nullptr );
+            queuedEntry.m_message.sprintf_va_list( pMessageFormat, args );
+        }
+
+        // Creates the verbose line used for log files
+        static void CreateLogFileLine( LogEntry const& entry, InlineString& outLine )
+        {
+            if ( entry.m_sourceInfo.empty() )
+            {
+                outLine.sprintf( "[%s] %s >>> %s: %s, File: %s, %d\r\n", entry.m_timestamp.c_str(), entry.m_category.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_message.c_str(), entry.m_filename.c_str(), entry.m_lineNumber );
+            }
+            else
+            {
+                outLine.sprintf( "[%s] %s >>> %s: %s, Source: %s, File: %s, %d\r\n", entry.m_timestamp.c_str(), entry.m_category.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_message.c_str(), entry.m_sourceInfo.c_str(), entry.m_filename.c_str(), entry.m_lineNumber );
+            }
+        }
+
+        // Creates the final entry, outputs it and adds it to the history - expects the log mutex to be held
+        static void ProcessEntry( QueuedLogEntry const& queuedEntry )
+        {
+            LogEntry entry;
+            entry.m_category = queuedEntry.m_category.c_str();
+            entry.m_sourceInfo = queuedEntry.m_sourceInfo.c_str();
+            entry.m_message = queuedEntry.m_message.c_str();
+            entry.m_filename = queuedEntry.m_filename.c_str();
+            entry.m_lineNumber = queuedEntry.m_lineNumber;
+            entry.m_severity = queuedEntry.m_severity;
+
+            // Timestamp
+            entry.m_timestamp.resize( 9 );
+            strftime( entry.m_timestamp.data(), 9, "%H:%M:%S", std::localtime( &queuedEntry.m_time ) );
+
+            // Immediate display of log
+            //-------------------------------------------------------------------------
+            // This uses a less verbose format, if you want more info look at the saved log
+
+            InlineString traceMessage;
+            if ( entry.m_sourceInfo.empty() )
+            {
+                traceMessage.sprintf( "[%s][%s][%s] %s", entry.m_timestamp.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_category.c_str(), entry.m_message.c_str() );
+            }
+            else
+            {
+                traceMessage.sprintf( "[%s][%s][%s][%s] %s", entry.m_timestamp.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_category.c_str(), entry.m_sourceInfo.c_str(), entry.m_message.c_str() );
+            }
+
+            // Print to debug trace
+            EE_TRACE_MSG( traceMessage.c_str() );
+
+            // Print to std out
+            printf( "%s\n", traceMessage.c_str() );
+
+            // Write to the log file
+            if ( g_pLog->m_pLogFile != nullptr )
+            {
+                InlineString logLine;
+                CreateLogFileLine( entry, logLine );
+                g_pLog->m_pLogFile->Write( (void*) logLine.data(), logLine.size() );
+            }
+
+            // Track unhandled warnings and errors
+            //-------------------------------------------------------------------------
+
+            if ( entry.m_severity == Severity::FatalError )
+            {
+                g_pLog->m_fatalError = entry;
+                g_pLog->m_hasFatalErrorOccurred = true;
+            }
+
+            if ( entry.m_severity > Severity::Message )
+            {
+                g_pLog->m_numWarnings += ( entry.m_severity == Severity::Warning ) ? 1 : 0;
+                g_pLog->m_numErrors += ( entry.m_severity == Severity::Error ) ? 1 : 0;
+
+                if ( (int32_t) g_pLog->m_unhandledWarningsAndErrors.size() < g_maxUnhandledWarningsAndErrors )
+                {
+                    g_pLog->m_unhandledWarningsAndErrors.emplace_back( entry );
+                }
+                else // Overwrite the oldest entry
+                {
+                    g_pLog->m_unhandledWarningsAndErrors[g_pLog->m_unhandledWarningsAndErrorsStartIdx] = entry;
+                    g_pLog->m_unhandledWarningsAndErrorsStartIdx = ( g_pLog->m_unhandledWarningsAndErrorsStartIdx + 1 ) % g_maxUnhandledWarningsAndErrors;
+                }
+            }
+
+            // Add to history
+            //-------------------------------------------------------------------------
+
+            if ( (int32_t) g_pLog->m_history.size() < g_maxHistorySize )
+            {
+                g_pLog->m_history.emplace_back( eastl::move( entry ) );
+            }
+            else // Overwrite the oldest entry
+            {
+                g_pLog->m_history[g_pLog->m_historyStartIdx] = eastl::move( entry );
+                g_pLog->m_historyStartIdx = ( g_pLog->m_historyStartIdx + 1 ) % g_maxHistorySize;
+            }
+        }
+
+        // Process all queued entries, returns true if any entries were processed
+        // This can be called from any thread, the drain mutex ensures that batches are processed in the order they were dequeued
+        static bool DrainQueue()
+        {
+            QueuedLogEntry queuedEntries[g_maxDrainBatchSize];
+
+            Threading::ScopeLock drainLock( g_pLog->m_drainMutex );
+
+            bool entriesProcessed = false;
+            size_t numDequeued = 0;
+            while ( ( numDequeued = g_pLog->m_queue.try_dequeue_bulk( queuedEntries, g_maxDrainBatchSize ) ) > 0 )
+            {
+                {
+                    Threading::ScopeLock lock( g_pLog->m_mutex );
+                    for ( size_t i = 0; i < numDequeued; i++ )
+                    {
+                        ProcessEntry( queuedEntries[i] );
+                    }
+                }
+
+                g_pLog->m_numProcessedEntries += numDequeued;
+                entriesProcessed = true;
+            }
+
+            return entriesProcessed;
+        }
+
+        static void DrainThreadMain()
+        {
+            Threading::SetCurrentThreadName( "Log Thread" );
+
+            while ( g_pLog->m_isAsyncModeEnabled )
+            {
+                if ( !DrainQueue() )
+                {
+                    Threading::Sleep( g_drainThreadSleepTime );
+                }
+            }
+
+            // Process any remaining entries
+            DrainQueue();
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -32,11 +231,18 @@ namespace EE::Log
     {
         EE_ASSERT( g_pLog == nullptr );
         g_pLog = EE::New<LogData>();
+        g_pLog->m_history.reserve( 1024 );
     }
 
     void Shutdown()
     {
         EE_ASSERT( g_pLog != nullptr );
+
+        if ( IsAsyncModeEnabled() )
+        {
+            DisableAsyncMode();
+        }
+
         EE::Delete( g_pLog );
     }
 
@@ -47,12 +253,96 @@ namespace EE::Log
 
     //-------------------------------------------------------------------------
 
-    TVector<EE::Log::LogEntry> const& GetLogEntries()
+    void EnableAsyncMode()
+    {
+        EE_ASSERT( IsInitialized() && !IsAsyncModeEnabled() );
+        g_pLog->m_isAsyncModeEnabled = true;
+        g_pLog->m_drainThread = std::thread( &DrainThreadMain );
+    }
+
+    void EnableAsyncMode( FileSystem::Path const& logFilePath )
+    {
+        EE_ASSERT( IsInitialized() && !IsAsyncModeEnabled() );
+        EE_ASSERT( logFilePath.IsValid() && logFilePath.IsFilePath() );
+
+        logFilePath.EnsureDirectoryExists();
+        g_pLog->m_pLogFile = EE::New<FileSystem::OutputFileStream>( logFilePath );
+        if ( !g_pLog->m_pLogFile->IsValid() )
+        {
+            EE::Delete( g_pLog->m_pLogFile );
+        }
+        else // Write out all the entries logged before async mode was enabled
+        {
+            String logData;
+            InlineString logLine;
+
+            Threading::ScopeLock lock( g_pLog->m_mutex );
+            int32_t const historySize = (int32_t) g_pLog->m_history.size();
+            for ( int32_t i = 0; i < historySize; i++ )
+            {
+                CreateLogFileLine( g_pLog->m_history[( g_pLog->m_historyStartIdx + i ) % historySize], logLine );
+                logData.append( logLine.c_str() );
+            }
+
+            g_pLog->m_pLogFile->Write( (void*) logData.data(), logData.size() );
+        }
+
+        EnableAsyncMode();
+    }
+
+    void DisableAsyncMode()
+    {
+        EE_ASSERT( IsInitialized() && IsAsyncModeEnabled() );
+
+        // The drain thread will process all remaining entries before exiting
+        g_pLog->m_isAsyncModeEnabled = false;
+        g_pLog->m_drainThread.join();
+
+        // Wait for any producers that saw async mode enabled and have not finished enqueuing yet, then catch their entries
+        while ( g_pLog->m_numActiveProducers > 0 )
+        {
+            std::this_thread::yield();
+        }
+
+        DrainQueue();
+
+        if ( g_pLog->m_pLogFile != nullptr )
+        {
+            g_pLog->m_pLogFile->Close();
+            EE::Delete( g_pLog->m_pLogFile );
+        }
+    }
+
+    bool IsAsyncModeEnabled()
     {
         EE_ASSERT( IsInitialized() );
-        return g_pLog->m_logEntries;
+        return g_pLog->m_isAsyncModeEnabled;
     }
 
+    void Flush()
+    {
+        EE_ASSERT( IsInitialized() );
+
+        if ( !IsAsyncModeEnabled() )
+        {
+            return;
+        }
+
+        uint64_t const numQueuedEntries = g_pLog->m_numQueuedEntries;
+        while ( g_pLog->m_numProcessedEntries < numQueuedEntries )
+        {
+            std::this_thread::yield();
+        }
+
+        Threading::ScopeLock lock( g_pLog->m_mutex );
+        if ( g_pLog->m_pLogFile != nullptr )
+        {
+            g_pLog->m_pLogFile->GetStream().flush();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void AddEntry( Severity severity, char const* pCategory, char const* pSourceInfo, char const* pFilename, int pLineNumber, char const* pMessageFormat, ... )
     {
         EE_ASSERT( IsInitialized() );
@@ -67,63 +357,66 @@ namespace EE::Log
         EE_ASSERT( IsInitialized() );
         EE_ASSERT( pCategory != nullptr && pFilename != nullptr && pMessageFormat != nullptr );
 
+        QueuedLogEntry queuedEntry;
+        CreateQueuedEntry( queuedEntry, severity, pCategory, pSourceInfo, pFilename, pLineNumber, pMessageFormat, args );
+
+        // Async mode - push to the calling thread's sub-queue, fatal errors need to be processed immediately since we are about to halt
+        //-------------------------------------------------------------------------
+
+        // The active producer count is raised before checking the mode so that disabling async mode can wait for this entry to be enqueued
+        // If too many entries are pending, we drain the queue on this thread rather than letting it grow unbounded
+
+        if ( severity != Severity::FatalError )
         {
-            std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
+            g_pLog->m_numActiveProducers++;
 
-            if ( severity == Severity::FatalError )
+            if ( IsAsyncModeEnabled() )
             {
-                g_pLog->m_fatalErrorIndex = (int32_t) g_pLog->m_logEntries.size();
+                if ( ( g_pLog->m_numQueuedEntries - g_pLog->m_numProcessedEntries ) >= g_maxQueuedEntries )
+                {
+                    DrainQueue();
+                }
+
+                g_pLog->m_numQueuedEntries++;
+                g_pLog->m_queue.enqueue( eastl::move( queuedEntry ) );
+                g_pLog->m_numActiveProducers--;
+                return;
             }
 
-            auto& entry = g_pLog->m_logEntries.emplace_back( LogEntry() );
-
-            //-------------------------------------------------------------------------
-
-            entry.m_category = pCategory;
-            entry.m_sourceInfo = ( pSourceInfo  != nullptr ) ? pSourceInfo : String();
-            entry.m_filename = pFilename;
-            entry.m_lineNumber = pLineNumber;
-            entry.m_severity = severity;
-            entry.m_timestamp.resize( 9 );
+            g_pLog->m_numActiveProducers--;
+        }
 
-            // Message
-            entry.m_message.sprintf_va_list( pMessageFormat, args );
-            va_end( args );
+        // Synchronous processing
+        //-------------------------------------------------------------------------
 
-            // Timestamp
-            entry.m_timestamp.resize( 9 );
-            time_t const t = std::time( nullptr );
-            strftime( entry.m_timestamp.data(), 9, "%H:%M:%S", std::localtime( &t ) );
+        Flush();
 
-            // Immediate display of log
-            //-------------------------------------------------------------------------
-            // This uses a less verbose format, if you want more info look at the saved log
+        Threading::ScopeLock lock( g_pLog->m_mutex );
+        ProcessEntry( queuedEntry );
+    }
 
-            InlineString traceMessage;
-            if ( entry.m_sourceInfo.empty() )
-            {
-                traceMessage.sprintf( "[%s][%s][%s] %s", entry.m_timestamp.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_category.c_str(), entry.m_message.c_str() );
-            }
-            else
-            {
-                traceMessage.sprintf( "[%s][%s][%s][%s] %s", entry.m_timestamp.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_category.c_str(), entry.m_sourceInfo.c_str(), entry.m_message.c_str() );
-            }
+    //-------------------------------------------------------------------------
 
-            // Print to debug trace
-            EE_TRACE_MSG( traceMessage.c_str() );
+    int32_t GetNumLogEntries()
+    {
+        EE_ASSERT( IsInitialized() );
+        Threading::ScopeLock lock( g_pLog->m_mutex );
+        return (int32_t) g_pLog->m_history.size();
+    }
 
-            // Print to std out
-            printf( "%s\n", traceMessage.c_str() );
+    void GetLogEntries( int32_t startIdx, int32_t numEntries, TVector<LogEntry>& outEntries )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_ASSERT( startIdx >= 0 && numEntries >= 0 );
 
-            // Track unhandled warnings and errors
-            //-------------------------------------------------------------------------
+        outEntries.clear();
 
-            if ( entry.m_severity > Severity::Message )
-            {
-                g_pLog->m_numWarnings += ( entry.m_severity == Severity::Warning ) ? 1 : 0;
-                g_pLog->m_numErrors += ( entry.m_severity == Severity::Error ) ? 1 : 0;
-                g_pLog->m_unhandledWarningsAndErrors.emplace_back( entry );
-            }
+        Threading::ScopeLock lock( g_pLog->m_mutex );
+        int32_t const historySize = (int32_t) g_pLog->m_history.size();
+        int32_t const endIdx = Math::Min( startIdx + numEntries, historySize );
+        for ( int32_t i = startIdx; i < endIdx; i++ )
+        {
+            outEntries.emplace_back( g_pLog->m_history[( g_pLog->m_historyStartIdx + i ) % historySize] );
         }
     }
 
@@ -133,23 +426,18 @@ namespace EE::Log
     {
         EE_ASSERT( IsInitialized() && logFilePath.IsValid() && logFilePath.IsFilePath() );
 
+        Flush();
+
         logFilePath.EnsureDirectoryExists();
 
         String logData;
         InlineString logLine;
 
-        std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
-        for ( auto const& entry : g_pLog->m_logEntries )
+        Threading::ScopeLock lock( g_pLog->m_mutex );
+        int32_t const historySize = (int32_t) g_pLog->m_history.size();
+        for ( int32_t i = 0; i < historySize; i++ )
         {
-            if ( entry.m_sourceInfo.empty() )
-            {
-                logLine.sprintf( "[%s] %s >>> %s: %s, File: %s, %d\r\n", entry.m_timestamp.c_str(), entry.m_category.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_message.c_str(), entry.m_filename.c_str(), entry.m_lineNumber );
-            }
-            else
-            {
-                logLine.sprintf( "[%s] %s >>> %s: %s, Source: %s, File: %s, %d\r\n", entry.m_timestamp.c_str(), entry.m_category.c_str(), g_severityLabels[(int32_t) entry.m_severity], entry.m_message.c_str(), entry.m_sourceInfo.c_str(), entry.m_filename.c_str(), entry.m_lineNumber );
-            }
-
+            CreateLogFileLine( g_pLog->m_history[( g_pLog->m_historyStartIdx + i ) % historySize], logLine );
             logData.append( logLine.c_str() );
         }
 
@@ -162,13 +450,13 @@ namespace EE::Log
     bool HasFatalErrorOccurred()
     {
         EE_ASSERT( IsInitialized() );
-        return g_pLog->m_fatalErrorIndex != InvalidIndex;
+        return g_pLog->m_hasFatalErrorOccurred;
     }
 
     LogEntry const& GetFatalError()
     {
-        EE_ASSERT( IsInitialized() && g_pLog->m_fatalErrorIndex != InvalidIndex );
-        return g_pLog->m_logEntries[g_pLog->m_fatalErrorIndex];
+        EE_ASSERT( IsInitialized() && g_pLog->m_hasFatalErrorOccurred );
+        return g_pLog->m_fatalError;
     }
 
     //-------------------------------------------------------------------------
@@ -176,10 +464,14 @@ namespace EE::Log
     TVector<Log::LogEntry> GetUnhandledWarningsAndErrors()
     {
         EE_ASSERT( IsInitialized() );
-        std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
+        Threading::ScopeLock lock( g_pLog->m_mutex );
 
+        // Return the entries oldest first
         TVector<Log::LogEntry> outEntries = g_pLog->m_unhandledWarningsAndErrors;
+        eastl::rotate( outEntries.begin(), outEntries.begin() + g_pLog->m_unhandledWarningsAndErrorsStartIdx, outEntries.end() );
+
         g_pLog->m_unhandledWarningsAndErrors.clear();
+        g_pLog->m_unhandledWarningsAndErrorsStartIdx = 0;
         return outEntries;
     }
 
@@ -194,4 +486,4 @@ namespace EE::Log
         EE_ASSERT( IsInitialized() );
         return g_pLog->m_numErrors;
     }
-}
\ No newline at end of file
+}
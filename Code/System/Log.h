@@ -38,18 +38,43 @@ namespace EE::Log
     EE_SYSTEM_API void Shutdown();
     EE_SYSTEM_API bool IsInitialized();
 
+    // Async Mode
+    //-------------------------------------------------------------------------
+    // In async mode, adding an entry only formats the message and pushes it onto a lock-free queue (each thread gets its own producer sub-queue).
+    // A background thread drains the queue: it formats the output, prints it, writes it to the optional log file and adds it to the history.
+    // The number of pending entries is bounded, once the limit is reached the adding thread drains the queue itself before pushing its entry.
+    // Fatal errors are always flushed and processed immediately on the calling thread.
+    // When enabled with a log file, the existing history is written to the file first.
+
+    EE_SYSTEM_API void EnableAsyncMode();
+    EE_SYSTEM_API void EnableAsyncMode( FileSystem::Path const& logFilePath );
+    EE_SYSTEM_API void DisableAsyncMode();
+    EE_SYSTEM_API bool IsAsyncModeEnabled();
+
+    // Blocks until all queued entries have been processed (no-op in synchronous mode)
+    EE_SYSTEM_API void Flush();
+
     // Logging
     //-------------------------------------------------------------------------
 
     EE_SYSTEM_API void AddEntry( Severity severity, char const* pCategory, char const* pSourceInfo, char const* pFilename, int pLineNumber, char const* pMessageFormat, ... );
     EE_SYSTEM_API void AddEntryVarArgs( Severity severity, char const* pCategory, char const* pSourceInfo, char const* pFilename, int pLineNumber, char const* pMessageFormat, va_list args );
-    EE_SYSTEM_API TVector<LogEntry> const& GetLogEntries();
     EE_SYSTEM_API int32_t GetNumWarnings();
     EE_SYSTEM_API int32_t GetNumErrors();
 
+    // History
+    //-------------------------------------------------------------------------
+    // The in-memory history is a bounded ring, once full the oldest entries are overwritten
+
+    EE_SYSTEM_API int32_t GetNumLogEntries();
+
+    // Copy a range of the history, index 0 is the oldest entry still in the history
+    EE_SYSTEM_API void GetLogEntries( int32_t startIdx, int32_t numEntries, TVector<LogEntry>& outEntries );
+
     // Output
     //-------------------------------------------------------------------------
 
+    // Save the contents of the history to a file
     EE_SYSTEM_API void SaveToFile( FileSystem::Path const& logFilePath );
 
     // Warnings and errors
@@ -59,7 +84,7 @@ namespace EE::Log
     EE_SYSTEM_API LogEntry const& GetFatalError();
 
     // Transfers a list of unhandled warnings and errors - useful for displaying all errors for a given frame.
-    // Calling this function will clear the list of warnings and errors.
+    // Calling this function will clear the list of warnings and errors. The list is bounded, if it isnt retrieved the oldest entries are overwritten.
     EE_SYSTEM_API TVector<LogEntry> GetUnhandledWarningsAndErrors();
 }
 
@@ -6,6 +6,10 @@
 #include "System/Esoterica.h"
 #include <math.h>
 
+#if _MSC_VER
+#include <intrin.h>
+#endif
+
 //-------------------------------------------------------------------------
 
 namespace EE
@@ -217,6 +221,19 @@ namespace EE
             return i >> 1;
         }
 
+        // Get the index of the lowest set bit, the value must be non-zero
+        EE_FORCE_INLINE uint32_t GetLowestSetBitIdx( uint32_t x )
+        {
+            EE_ASSERT( x != 0 );
+            #if _MSC_VER
+            unsigned long bitIdx;
+            _BitScanForward( &bitIdx, x );
+            return (uint32_t) bitIdx;
+            #else
+            return (uint32_t) __builtin_ctz( x );
+            #endif
+        }
+
         EE_FORCE_INLINE uint32_t RoundUpToNearestMultiple32( uint32_t value, uint32_t multiple ) { return ( ( value + multiple - 1 ) / multiple ) * multiple; }
         EE_FORCE_INLINE uint64_t RoundUpToNearestMultiple64( uint64_t value, uint64_t multiple ) { return ( ( value + multiple - 1 ) / multiple ) * multiple; }
         EE_FORCE_INLINE uint32_t RoundDownToNearestMultiple32( uint32_t value, uint32_t multiple ) { return value - value % multiple; }
@@ -81,6 +81,7 @@ namespace EE
         EE_FORCE_INLINE static Vector MultiplyAdd( Vector const& vec, Vector const& multiplier, Vector const& add );
         EE_FORCE_INLINE static Vector NegativeMultiplySubtract( Vector const& vec, Vector const& multiplier, Vector const& subtrahend );
         EE_FORCE_INLINE static Vector Xor( Vector const& vec0, Vector const& vec1 );
+        EE_FORCE_INLINE static Vector And( Vector const& vec0, Vector const& vec1 ); // Bitwise and, useful to combine comparison masks
         EE_FORCE_INLINE static Vector LinearCombination( Vector const& v0, Vector const& v1, float scale0, float scale1 ) { return ( v0 * scale0 ) + ( v1 * scale1 ); }
 
         EE_FORCE_INLINE static Vector Sin( Vector const& vec );
@@ -228,6 +229,8 @@ namespace EE
         EE_FORCE_INLINE Vector& InvertEst() { m_data = _mm_rcp_ps( m_data ); return *this; }
         EE_FORCE_INLINE Vector GetInverseEst() const { return _mm_rcp_ps( m_data ); }
 
+        EE_FORCE_INLINE Vector GetSqrt() const { return _mm_sqrt_ps( m_data ); }
+
         EE_FORCE_INLINE Vector& Negate() { m_data = _mm_sub_ps( Vector::Zero, m_data ); return *this; }
         EE_FORCE_INLINE Vector GetNegated() const { return _mm_sub_ps( Vector::Zero, m_data ); }
 
@@ -1006,6 +1009,11 @@ namespace EE
         return result;
     }
 
+    EE_FORCE_INLINE Vector Vector::And( Vector const& v0, Vector const& v1 )
+    {
+        return _mm_and_ps( v0, v1 );
+    }
+
     EE_FORCE_INLINE Vector Vector::Select( Vector const& v0, Vector const& v1, Vector const& control )
     {
         auto const ctrl = _mm_cmpneq_ps( control, Vector::Zero );
@@ -492,6 +492,12 @@ namespace EE::Render
         m_pDeviceContext->DrawIndexed( vertexCount, indexStartIndex, vertexStartIndex );
     }
 
+    void RenderContext::DrawInstanced( uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t vertexStartIndex, uint32_t instanceStartIndex ) const
+    {
+        EE_ASSERT( IsValid() );
+        m_pDeviceContext->DrawInstanced( vertexCountPerInstance, instanceCount, vertexStartIndex, instanceStartIndex );
+    }
+
     void RenderContext::Dispatch( uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ ) const
     {
         EE_ASSERT( IsValid() );
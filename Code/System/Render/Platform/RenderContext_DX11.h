@@ -69,6 +69,7 @@ namespace EE
             void SetPrimitiveTopology( Topology topology ) const;
             void Draw( uint32_t vertexCount, uint32_t vertexStartIndex = 0 ) const;
             void DrawIndexed( uint32_t vertexCount, uint32_t indexStartIndex = 0, uint32_t vertexStartIndex = 0 ) const;
+            void DrawInstanced( uint32_t vertexCountPerInstance, uint32_t instanceCount, uint32_t vertexStartIndex = 0, uint32_t instanceStartIndex = 0 ) const;
 
             void Dispatch( uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ ) const;
 
@@ -622,7 +622,10 @@ namespace EE::Render
             DXGI_FORMAT_R32G32B32_FLOAT,
             DXGI_FORMAT_R32G32B32A32_FLOAT,
 
-            DXGI_FORMAT_R32_TYPELESS
+            DXGI_FORMAT_R32_TYPELESS,
+
+            DXGI_FORMAT_R16G16B16A16_UNORM,
+            DXGI_FORMAT_R16G16_SNORM,
         };
 
         EE_FORCE_INLINE static DXGI_FORMAT GetDXGIFormat( DataFormat format  )
@@ -681,8 +684,8 @@ namespace EE::Render
                     elementDesc.Format = DX11::GetDXGIFormat( shaderVertexElementDesc.m_format );
                     elementDesc.InputSlot = 0;
                     elementDesc.AlignedByteOffset = vertexElement.m_offset;
-                    elementDesc.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA;
-                    elementDesc.InstanceDataStepRate = 0;
+                    elementDesc.InputSlotClass = vertexElement.m_isPerInstance ? D3D11_INPUT_PER_INSTANCE_DATA : D3D11_INPUT_PER_VERTEX_DATA;
+                    elementDesc.InstanceDataStepRate = vertexElement.m_isPerInstance ? 1 : 0;
                     inputLayout.push_back( elementDesc );
 
                     inputBound = true;
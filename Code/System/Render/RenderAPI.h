@@ -53,6 +53,10 @@ namespace EE::Render
         // Special case format that changes based on texture usage
         Float_X32,
 
+        // Compressed vertex formats
+        UNorm_R16G16B16A16,
+        SNorm_R16G16,
+
         Count,
     };
 
@@ -35,7 +35,10 @@ namespace EE::Render
         12,
         16,
 
-        4
+        4,
+
+        8,
+        4,
     };
 
     static_assert( sizeof( g_dataTypeSizes ) / sizeof( uint32_t ) == (uint32_t) DataFormat::Count, "Mismatched data type and size arrays" );
@@ -50,6 +53,129 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    namespace VertexCompression
+    {
+        Float2 EncodeOctahedralNormal( Vector const& normal )
+        {
+            // Project onto the octahedron and then fold the lower hemisphere over the diagonals
+            float const L1Norm = Math::Abs( normal.m_x ) + Math::Abs( normal.m_y ) + Math::Abs( normal.m_z );
+            if ( L1Norm <= Math::Epsilon )
+            {
+                return Float2( 0.0f, 0.0f );
+            }
+
+            Float2 encoded( normal.m_x / L1Norm, normal.m_y / L1Norm );
+            if ( normal.m_z < 0.0f )
+            {
+                float const x = encoded.m_x;
+                encoded.m_x = ( 1.0f - Math::Abs( encoded.m_y ) ) * ( ( x >= 0.0f ) ? 1.0f : -1.0f );
+                encoded.m_y = ( 1.0f - Math::Abs( x ) ) * ( ( encoded.m_y >= 0.0f ) ? 1.0f : -1.0f );
+            }
+
+            return encoded;
+        }
+
+        Vector DecodeOctahedralNormal( Float2 const& encodedNormal )
+        {
+            Vector normal( encodedNormal.m_x, encodedNormal.m_y, 1.0f - Math::Abs( encodedNormal.m_x ) - Math::Abs( encodedNormal.m_y ) );
+            float const t = Math::Max( -normal.m_z, 0.0f );
+            normal.m_x += ( normal.m_x >= 0.0f ) ? -t : t;
+            normal.m_y += ( normal.m_y >= 0.0f ) ? -t : t;
+            return normal.GetNormalized3();
+        }
+
+        //-------------------------------------------------------------------------
+
+        uint16_t FloatToHalf( float value )
+        {
+            uint32_t bits;
+            memcpy( &bits, &value, sizeof( float ) );
+
+            uint32_t const sign = ( bits >> 16 ) & 0x8000;
+            int32_t const exponent = int32_t( ( bits >> 23 ) & 0xFF ) - 127 + 15;
+            uint32_t mantissa = bits & 0x007FFFFF;
+
+            // NaN/Inf
+            if ( ( ( bits >> 23 ) & 0xFF ) == 0xFF )
+            {
+                return uint16_t( sign | 0x7C00 | ( mantissa ? 0x200 : 0 ) );
+            }
+
+            // Overflow - clamp to infinity
+            if ( exponent >= 31 )
+            {
+                return uint16_t( sign | 0x7C00 );
+            }
+
+            // Underflow - denormals or zero
+            if ( exponent <= 0 )
+            {
+                if ( exponent < -10 )
+                {
+                    return uint16_t( sign );
+                }
+
+                mantissa |= 0x00800000;
+                uint32_t const shift = uint32_t( 14 - exponent );
+                uint32_t halfMantissa = mantissa >> shift;
+                uint32_t const roundBit = 1u << ( shift - 1 );
+                if ( ( mantissa & roundBit ) && ( mantissa & ( 3 * roundBit - 1 ) ) ) // Round to nearest even
+                {
+                    halfMantissa++;
+                }
+                return uint16_t( sign | halfMantissa );
+            }
+
+            // Normalized - round to nearest even, a mantissa overflow correctly carries into the exponent
+            uint32_t half = sign | ( uint32_t( exponent ) << 10 ) | ( mantissa >> 13 );
+            if ( ( mantissa & 0x00001000 ) && ( mantissa & 0x00002FFF ) )
+            {
+                half++;
+            }
+            return uint16_t( half );
+        }
+
+        float HalfToFloat( uint16_t value )
+        {
+            uint32_t const sign = uint32_t( value & 0x8000 ) << 16;
+            uint32_t exponent = ( value >> 10 ) & 0x1F;
+            uint32_t mantissa = value & 0x03FF;
+
+            uint32_t bits;
+            if ( exponent == 0x1F ) // NaN/Inf
+            {
+                bits = sign | 0x7F800000 | ( mantissa << 13 );
+            }
+            else if ( exponent == 0 )
+            {
+                if ( mantissa == 0 ) // Zero
+                {
+                    bits = sign;
+                }
+                else // Denormal - renormalize
+                {
+                    exponent = 127 - 15 + 1;
+                    while ( ( mantissa & 0x0400 ) == 0 )
+                    {
+                        mantissa <<= 1;
+                        exponent--;
+                    }
+                    bits = sign | ( exponent << 23 ) | ( ( mantissa & 0x03FF ) << 13 );
+                }
+            }
+            else
+            {
+                bits = sign | ( ( exponent - 15 + 127 ) << 23 ) | ( mantissa << 13 );
+            }
+
+            float result;
+            memcpy( &result, &bits, sizeof( float ) );
+            return result;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void VertexLayoutDescriptor::CalculateByteSize()
     {
         m_byteSize = 0;
@@ -87,6 +213,23 @@ namespace EE::Render
                 layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendIndex, DataFormat::SInt_R32G32B32A32, 0, 48 ) );
                 layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendWeight, DataFormat::Float_R32G32B32A32, 0, 64 ) );
             }
+            else if ( format == VertexFormat::StaticMeshCompressed )
+            {
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Position, DataFormat::UNorm_R16G16B16A16, 0, 0 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Normal, DataFormat::SNorm_R16G16, 0, 8 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 0, 12 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 1, 16 ) );
+            }
+            else if ( format == VertexFormat::SkeletalMeshCompressed )
+            {
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Position, DataFormat::UNorm_R16G16B16A16, 0, 0 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Normal, DataFormat::SNorm_R16G16, 0, 8 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 0, 12 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 1, 16 ) );
+
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendIndex, DataFormat::UInt_R8G8B8A8, 0, 20 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendWeight, DataFormat::UNorm_R8G8B8A8, 0, 24 ) );
+            }
 
             //-------------------------------------------------------------------------
 
@@ -5,6 +5,7 @@
 #include "System/Serialization/BinarySerialization.h"
 #include "System/Types/Arrays.h"
 #include "System/Math/Math.h"
+#include "System/Math/Vector.h"
 
 //-------------------------------------------------------------------------
 
@@ -20,6 +21,8 @@ namespace EE::Render
         None,
         StaticMesh,
         SkeletalMesh,
+        StaticMeshCompressed,
+        SkeletalMeshCompressed,
     };
 
     // CPU format for the static mesh vertex - this is what the mesh compiler fills the vertex data array with
@@ -38,6 +41,45 @@ namespace EE::Render
         Float4  m_boneWeights;
     };
 
+    // CPU format for the compressed static mesh vertex
+    // Positions are quantized against the mesh bounds, normals are octahedral encoded and UVs are stored as half floats
+    struct CompressedStaticMeshVertex
+    {
+        uint16_t    m_position[4];      // UNorm16 - dequantized with the mesh's position dequantization offset and scale, W is unused
+        int16_t     m_normal[2];        // SNorm16 - octahedral encoded
+        uint16_t    m_UV0[2];           // Half
+        uint16_t    m_UV1[2];           // Half
+    };
+
+    // CPU format for the compressed skeletal mesh vertex - only supports meshes with up to 256 bones
+    struct CompressedSkeletalMeshVertex : public CompressedStaticMeshVertex
+    {
+        uint8_t     m_boneIndices[4];   // Unused influences have an index of 0 and a weight of 0
+        uint8_t     m_boneWeights[4];   // UNorm8 - always sum to 255
+    };
+
+    static_assert( sizeof( CompressedStaticMeshVertex ) == 20, "Unexpected compressed vertex size" );
+    static_assert( sizeof( CompressedSkeletalMeshVertex ) == 28, "Unexpected compressed vertex size" );
+
+    //-------------------------------------------------------------------------
+
+    namespace VertexCompression
+    {
+        // Octahedral normal encoding, the encoded normal is in the [-1, 1] range
+        EE_SYSTEM_API Float2 EncodeOctahedralNormal( Vector const& normal );
+        EE_SYSTEM_API Vector DecodeOctahedralNormal( Float2 const& encodedNormal );
+
+        // IEEE half-precision float conversion
+        EE_SYSTEM_API uint16_t FloatToHalf( float value );
+        EE_SYSTEM_API float HalfToFloat( uint16_t value );
+
+        // Normalized integer conversion
+        EE_FORCE_INLINE uint16_t FloatToUNorm16( float value ) { return (uint16_t) Math::RoundToInt( Math::Clamp( value, 0.0f, 1.0f ) * 65535.0f ); }
+        EE_FORCE_INLINE float UNorm16ToFloat( uint16_t value ) { return value / 65535.0f; }
+        EE_FORCE_INLINE int16_t FloatToSNorm16( float value ) { return (int16_t) Math::RoundToInt( Math::Clamp( value, -1.0f, 1.0f ) * 32767.0f ); }
+        EE_FORCE_INLINE float SNorm16ToFloat( int16_t value ) { return Math::Max( value / 32767.0f, -1.0f ); }
+    }
+
     //-------------------------------------------------------------------------
 
     struct EE_SYSTEM_API VertexLayoutDescriptor
@@ -50,16 +92,18 @@ namespace EE::Render
 
             ElementDescriptor() = default;
 
-            ElementDescriptor( DataSemantic semantic, DataFormat format, uint16_t semanticIndex, uint16_t offset ) : m_semantic( semantic )
+            ElementDescriptor( DataSemantic semantic, DataFormat format, uint16_t semanticIndex, uint16_t offset, bool isPerInstance = false ) : m_semantic( semantic )
                 , m_format( format )
                 , m_semanticIndex( semanticIndex )
                 , m_offset( offset )
+                , m_isPerInstance( isPerInstance )
             {}
 
             DataSemantic        m_semantic = DataSemantic::None;
             DataFormat      m_format = DataFormat::Unknown;
             uint16_t              m_semanticIndex = 0;
             uint16_t              m_offset = 0;
+            bool                m_isPerInstance = false; // Runtime only, advanced once per instance rather than once per vertex
         };
 
     public:
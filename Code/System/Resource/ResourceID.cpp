@@ -41,18 +41,32 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
-    void ResourceID::OnPathChanged()
+    ResourcePath const& ResourceID::GetResourcePath() const
     {
-        // Try to set the typeID
-        if ( m_path.IsValid() )
+        static ResourcePath const s_invalidPath;
+        return ( m_pathIdx != ResourcePathTable::s_invalidIndex ) ? ResourcePathTable::GetPath( m_pathIdx ) : s_invalidPath;
+    }
+
+    void ResourceID::SetPath( ResourcePath const& path )
+    {
+        // A path that couldnt be added to the path table can't be resolved, so it is treated as an invalid path
+        m_pathIdx = path.IsValid() ? ResourcePathTable::Intern( path ) : ResourcePathTable::s_invalidIndex;
+        if ( m_pathIdx != ResourcePathTable::s_invalidIndex )
         {
-            auto const pExtension = m_path.GetExtension();
-            if (pExtension != nullptr)
+            m_pathHash = path.GetHash();
+
+            // Try to set the typeID
+            auto const pExtension = path.GetExtension();
+            if ( pExtension != nullptr )
             {
                 m_type = ResourceTypeID( pExtension );
                 return;
             }
         }
+        else
+        {
+            m_pathHash = 0;
+        }
 
         // Invalidate this resource ID
         m_type = ResourceTypeID();
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "ResourceTypeID.h"
-#include "ResourcePath.h"
+#include "ResourcePathTable.h"
 #include "System/Types/UUID.h"
 
 //-------------------------------------------------------------------------
@@ -11,6 +11,9 @@
 // Resource Type ID are generated from the lowercase extension of the resource path
 //
 // e.g. data://directory/someResource.mesh ->  ResourceTypeID = 'mesh'
+//
+// Resource IDs are compact handles: the 64-bit hash of the path and the index of the path in the global resource path table
+// Comparing and hashing IDs never touches the path string, the string is only resolved for tools, logging and file access
 //-------------------------------------------------------------------------
 
 namespace EE
@@ -19,14 +22,15 @@ namespace EE
     {
         EE_CUSTOM_SERIALIZE_WRITE_FUNCTION( archive )
         {
-            archive << m_path;
+            archive << GetResourcePath();
             return archive;
         }
 
         EE_CUSTOM_SERIALIZE_READ_FUNCTION( archive )
         {
-            archive << m_path;
-            OnPathChanged();
+            ResourcePath path;
+            archive << path;
+            SetPath( path );
             return archive;
         }
 
@@ -39,41 +43,42 @@ namespace EE
     public:
 
         ResourceID() = default;
-        ResourceID( ResourcePath const& path ) : m_path( path ) { EE_ASSERT( m_path.IsValid() ); OnPathChanged(); }
-        ResourceID( ResourcePath&& path ) : m_path( std::move( path ) ) { EE_ASSERT( m_path.IsValid() ); OnPathChanged(); }
-        inline ResourceID( String&& path ) : m_path( path ) { OnPathChanged(); }
-        inline ResourceID( String const& path ) : m_path( path ) { OnPathChanged(); }
-        inline ResourceID( char const* pPath ) : m_path( pPath ) { OnPathChanged(); }
+        ResourceID( ResourcePath const& path ) { EE_ASSERT( path.IsValid() ); SetPath( path ); }
+        inline ResourceID( String const& path ) { SetPath( ResourcePath( path ) ); }
+        inline ResourceID( char const* pPath ) { SetPath( ResourcePath( pPath ) ); }
 
         inline bool IsValid() const { return m_type.IsValid(); }
-        inline uint32_t GetPathID() const { return m_path.GetID(); }
+        inline uint32_t GetPathID() const { return (uint32_t) m_pathHash; }
+        inline uint64_t GetPathHash() const { return m_pathHash; }
 
-        inline ResourcePath const& GetResourcePath() const { return m_path; }
+        // Resolve the path from the path table, only needed for tools, logging and file access
+        ResourcePath const& GetResourcePath() const;
         inline ResourceTypeID GetResourceTypeID() const { return m_type; }
-        inline String GetFileNameWithoutExtension() const { EE_ASSERT( m_path.IsValid() ); return m_path.GetFileNameWithoutExtension(); }
+        inline String GetFileNameWithoutExtension() const { EE_ASSERT( m_pathIdx != ResourcePathTable::s_invalidIndex ); return GetResourcePath().GetFileNameWithoutExtension(); }
 
-        inline void Clear() { m_path.Clear(); m_type.Clear(); }
+        inline void Clear() { m_pathHash = 0; m_pathIdx = ResourcePathTable::s_invalidIndex; m_type.Clear(); }
 
         //-------------------------------------------------------------------------
 
-        inline String const& ToString() const { return m_path.GetString(); }
-        inline char const* c_str() const { return m_path.c_str(); }
+        inline String const& ToString() const { return GetResourcePath().GetString(); }
+        inline char const* c_str() const { return GetResourcePath().c_str(); }
 
         //-------------------------------------------------------------------------
 
-        inline bool operator==( ResourceID const& rhs ) const { return m_path == rhs.m_path; }
-        inline bool operator!=( ResourceID const& rhs ) const { return m_path != rhs.m_path; }
+        inline bool operator==( ResourceID const& rhs ) const { return m_pathHash == rhs.m_pathHash; }
+        inline bool operator!=( ResourceID const& rhs ) const { return m_pathHash != rhs.m_pathHash; }
 
-        inline bool operator==( uint32_t const& ID ) const { return m_path.GetID() == ID; }
-        inline bool operator!=( uint32_t const& ID ) const { return m_path.GetID() != ID; }
+        inline bool operator==( uint32_t const& ID ) const { return GetPathID() == ID; }
+        inline bool operator!=( uint32_t const& ID ) const { return GetPathID() != ID; }
 
     private:
 
-        void OnPathChanged();
+        void SetPath( ResourcePath const& path );
 
     private:
 
-        ResourcePath            m_path;
+        uint64_t                m_pathHash = 0;
+        uint32_t                m_pathIdx = ResourcePathTable::s_invalidIndex;
         ResourceTypeID          m_type;
     };
 }
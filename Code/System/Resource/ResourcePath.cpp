@@ -106,11 +106,11 @@ namespace EE
 
     ResourcePath::ResourcePath( ResourcePath const& path )
         : m_path( path.m_path )
-        , m_ID( path.m_ID )
+        , m_hash( path.m_hash )
     {}
 
     ResourcePath::ResourcePath( ResourcePath&& path )
-        : m_ID( path.m_ID )
+        : m_hash( path.m_hash )
     {
         m_path.swap( path.m_path );
     }
@@ -118,14 +118,14 @@ namespace EE
     ResourcePath& ResourcePath::operator=( ResourcePath const& path )
     {
         m_path = path.m_path;
-        m_ID = path.m_ID;
+        m_hash = path.m_hash;
         return *this;
     }
 
     ResourcePath& ResourcePath::operator=( ResourcePath&& path )
     {
         m_path.swap( path.m_path );
-        m_ID = path.m_ID;
+        m_hash = path.m_hash;
         return *this;
     }
 
@@ -136,12 +136,12 @@ namespace EE
         if ( IsValidPath( m_path ) )
         {
             m_path.make_lower();
-            m_ID = Hash::GetHash32( m_path.c_str() );
+            m_hash = Hash::GetHash64( m_path.c_str() );
         }
         else
         {
             m_path.clear();
-            m_ID = 0;
+            m_hash = 0;
         }
     }
 
@@ -53,8 +53,9 @@ namespace EE
         //-------------------------------------------------------------------------
 
         inline bool IsValid() const { return !m_path.empty() && IsValidPath( m_path ); }
-        inline void Clear() { m_path.clear(); m_ID = 0; }
-        inline uint32_t GetID() const { return m_ID; }
+        inline void Clear() { m_path.clear(); m_hash = 0; }
+        inline uint32_t GetID() const { return (uint32_t) m_hash; }
+        inline uint64_t GetHash() const { return m_hash; }
 
         // Path info
         //-------------------------------------------------------------------------
@@ -118,8 +119,8 @@ namespace EE
         // Operators
         //-------------------------------------------------------------------------
 
-        inline bool operator==( ResourcePath const& rhs ) const { return m_ID == rhs.m_ID; }
-        inline bool operator!=( ResourcePath const& rhs ) const { return m_ID != rhs.m_ID; }
+        inline bool operator==( ResourcePath const& rhs ) const { return m_hash == rhs.m_hash; }
+        inline bool operator!=( ResourcePath const& rhs ) const { return m_hash != rhs.m_hash; }
 
         ResourcePath& operator=( ResourcePath&& path );
         ResourcePath& operator=( ResourcePath const& path );
@@ -131,7 +132,7 @@ namespace EE
     private:
 
         String                  m_path;
-        uint32_t                m_ID = 0;
+        uint64_t                m_hash = 0;
     };
 }
 
@@ -0,0 +1,145 @@
+#include "ResourcePathTable.h"
+#include "System/Types/FlatHashMap.h"
+#include "System/Threading/Threading.h"
+#include "System/Memory/Memory.h"
+#include "System/Log.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    namespace
+    {
+        // Paths are stored in fixed size chunks that are never moved or freed, so they can be read without locking
+        constexpr static uint32_t const g_numPathsPerChunk = 1024;
+        constexpr static uint32_t const g_maxNumChunks = 4096;
+
+        struct PathTable
+        {
+            ResourcePath*                                   m_chunks[g_maxNumChunks] = {};
+            std::atomic<uint32_t>                           m_numPaths = 0;
+            TFlatHashMap<uint64_t, uint32_t>                m_pathHashToIndexMap;
+            Threading::ReadWriteMutex                       m_mutex;
+        };
+
+        static PathTable* g_pPathTable = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        static uint32_t FindPathIndex( uint64_t pathHash )
+        {
+            auto const foundIter = g_pPathTable->m_pathHashToIndexMap.find( pathHash );
+            return ( foundIter != g_pPathTable->m_pathHashToIndexMap.end() ) ? foundIter->second : ResourcePathTable::s_invalidIndex;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourcePathTable::Initialize()
+    {
+        EE_ASSERT( g_pPathTable == nullptr );
+        g_pPathTable = EE::New<PathTable>();
+        g_pPathTable->m_pathHashToIndexMap.reserve( g_numPathsPerChunk );
+    }
+
+    void ResourcePathTable::Shutdown()
+    {
+        EE_ASSERT( g_pPathTable != nullptr );
+
+        uint32_t const numPaths = g_pPathTable->m_numPaths.load();
+        for ( uint32_t i = 0; i < numPaths; i++ )
+        {
+            g_pPathTable->m_chunks[i / g_numPathsPerChunk][i % g_numPathsPerChunk].~ResourcePath();
+        }
+
+        for ( auto& pChunk : g_pPathTable->m_chunks )
+        {
+            EE::Free( pChunk );
+        }
+
+        EE::Delete( g_pPathTable );
+    }
+
+    bool ResourcePathTable::IsInitialized()
+    {
+        return g_pPathTable != nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+
+    uint32_t ResourcePathTable::Intern( ResourcePath const& path )
+    {
+        EE_ASSERT( g_pPathTable != nullptr );
+        EE_ASSERT( path.IsValid() );
+
+        uint64_t const pathHash = path.GetHash();
+
+        // Almost all paths will already be in the table, so only take the write lock when we need to add one
+        g_pPathTable->m_mutex.LockForRead();
+        uint32_t pathIdx = FindPathIndex( pathHash );
+        g_pPathTable->m_mutex.UnlockForRead();
+
+        bool isTableFull = false;
+        if ( pathIdx == s_invalidIndex )
+        {
+            g_pPathTable->m_mutex.LockForWrite();
+
+            // Another thread could have added the path while we were waiting for the lock
+            pathIdx = FindPathIndex( pathHash );
+            if ( pathIdx == s_invalidIndex )
+            {
+                uint32_t const newPathIdx = g_pPathTable->m_numPaths.load( std::memory_order_relaxed );
+                if ( newPathIdx < ( g_numPathsPerChunk * g_maxNumChunks ) )
+                {
+                    uint32_t const chunkIdx = newPathIdx / g_numPathsPerChunk;
+                    if ( g_pPathTable->m_chunks[chunkIdx] == nullptr )
+                    {
+                        g_pPathTable->m_chunks[chunkIdx] = (ResourcePath*) EE::Alloc( sizeof( ResourcePath ) * g_numPathsPerChunk, alignof( ResourcePath ) );
+                    }
+
+                    new ( &g_pPathTable->m_chunks[chunkIdx][newPathIdx % g_numPathsPerChunk] ) ResourcePath( path );
+                    g_pPathTable->m_pathHashToIndexMap[pathHash] = newPathIdx;
+
+                    // Publish the path only once it is fully constructed
+                    g_pPathTable->m_numPaths.store( newPathIdx + 1, std::memory_order_release );
+                    pathIdx = newPathIdx;
+                }
+                else
+                {
+                    isTableFull = true;
+                }
+            }
+
+            g_pPathTable->m_mutex.UnlockForWrite();
+        }
+
+        // The table has a fixed capacity, so once it is full new paths can't be referenced by index
+        if ( isTableFull )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Path Table", "Path table is full (%u paths), failed to add path: %s", g_numPathsPerChunk * g_maxNumChunks, path.c_str() );
+            return s_invalidIndex;
+        }
+
+        // Catch any hash collisions, the existing entry is kept since other IDs may already reference it
+        ResourcePath const& storedPath = GetPath( pathIdx );
+        if ( storedPath.GetString() != path.GetString() )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Path Table", "Path hash collision between '%s' and '%s', the second path will resolve to the first", storedPath.c_str(), path.c_str() );
+        }
+
+        return pathIdx;
+    }
+
+    ResourcePath const& ResourcePathTable::GetPath( uint32_t pathIdx )
+    {
+        EE_ASSERT( g_pPathTable != nullptr );
+        EE_ASSERT( pathIdx < g_pPathTable->m_numPaths.load( std::memory_order_acquire ) );
+        return g_pPathTable->m_chunks[pathIdx / g_numPathsPerChunk][pathIdx % g_numPathsPerChunk];
+    }
+
+    uint32_t ResourcePathTable::GetNumPaths()
+    {
+        return ( g_pPathTable != nullptr ) ? g_pPathTable->m_numPaths.load( std::memory_order_acquire ) : 0;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "ResourcePath.h"
+
+//-------------------------------------------------------------------------
+// Resource Path Table
+//-------------------------------------------------------------------------
+// Global append-only table of all the resource paths referenced by resource IDs
+// Resource IDs only store the path hash and the index of the path in this table, the path strings are only needed for tools, logging and file access
+// Paths are never removed so any references to them remain valid until the table is shutdown
+// This means the table grows with every unique path created during a session (tools included), up to a fixed capacity of ~4M paths
+// Once full, new paths are rejected with an error and their IDs are invalid
+
+namespace EE
+{
+    class EE_SYSTEM_API ResourcePathTable
+    {
+    public:
+
+        constexpr static uint32_t const s_invalidIndex = 0xFFFFFFFF;
+
+    public:
+
+        static void Initialize();
+        static void Shutdown();
+        static bool IsInitialized();
+
+        // Get the table index for a path, adding the path to the table if needed - this is threadsafe
+        // Returns the invalid index if the path isnt in the table and the table is full
+        static uint32_t Intern( ResourcePath const& path );
+
+        // Get the path stored at the specified index, this doesnt require any locking
+        static ResourcePath const& GetPath( uint32_t pathIdx );
+
+        static uint32_t GetNumPaths();
+    };
+}
\ No newline at end of file
@@ -19,7 +19,7 @@ namespace EE::Resource
 
         // Install dependency reference
         ResourceRequesterID( ResourceID const& resourceID )
-            : m_ID( resourceID.GetResourcePath().GetID() )
+            : m_ID( resourceID.GetPathID() )
             , m_isInstallDependency( true )
         {}
 
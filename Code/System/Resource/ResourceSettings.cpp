@@ -57,6 +57,19 @@ namespace EE::Resource
                 return false;
             }
 
+            if ( ini.TryGetString( "Paths:RawAssetCacheDirectoryName", tmp ) && !tmp.empty() )
+            {
+                m_rawAssetCachePath = m_workingDirectoryPath + tmp;
+                if ( !m_rawAssetCachePath.IsValid() )
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Settings", "Invalid raw asset cache path: %s", tmp.c_str() );
+                    return false;
+                }
+
+                m_rawAssetCachePath.MakeIntoDirectoryPath();
+                m_rawAssetCacheMaxSizeMB = ini.GetUIntOrDefault( "Resource:RawAssetCacheMaxSizeMB", m_rawAssetCacheMaxSizeMB );
+            }
+
             if ( ini.TryGetString( "Paths:PackagedBuildRelativePath", tmp ) )
             {
                 if ( tmp.empty() )
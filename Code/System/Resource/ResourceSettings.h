@@ -28,6 +28,8 @@ namespace EE::Resource
         String                  m_resourceServerNetworkAddress;
         uint16_t                m_resourceServerPort;
         FileSystem::Path        m_rawResourcePath;
+        FileSystem::Path        m_rawAssetCachePath; // Optional, raw asset caching is disabled if not set
+        uint32_t                m_rawAssetCacheMaxSizeMB = 4096;
         FileSystem::Path        m_compiledResourceDatabasePath;
         FileSystem::Path        m_resourceServerExecutablePath;
         FileSystem::Path        m_resourceCompilerExecutablePath;
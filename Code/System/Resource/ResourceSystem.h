@@ -8,6 +8,7 @@
 #include "System/Types/Event.h"
 #include "System/Time/TimeStamp.h"
 #include "System/Types/HashMap.h"
+#include "System/Types/FlatHashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -142,7 +143,7 @@ namespace EE::Resource
         TaskSystem&                                             m_taskSystem;
         ResourceProvider*                                       m_pResourceProvider = nullptr;
         THashMap<ResourceTypeID, ResourceLoader*>               m_resourceLoaders;
-        THashMap<ResourceID, ResourceRecord*>                   m_resourceRecords;
+        TFlatHashMap<ResourceID, ResourceRecord*>               m_resourceRecords;
         mutable Threading::RecursiveMutex                       m_accessLock;
 
         // Requests
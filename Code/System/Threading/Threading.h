@@ -47,9 +47,11 @@ namespace EE
 
             inline void LockForWrite() { m_mutex.lock(); }
             inline bool TryLockForWrite() { return m_mutex.try_lock(); }
+            inline void UnlockForWrite() { m_mutex.unlock(); }
 
             inline void LockForRead() { m_mutex.lock_shared(); }
             inline bool TryLockForRead() { return m_mutex.try_lock_shared(); }
+            inline void UnlockForRead() { m_mutex.unlock_shared(); }
 
         private:
 
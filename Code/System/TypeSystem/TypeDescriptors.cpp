@@ -170,6 +170,12 @@ namespace EE::TypeSystem
         TypeDescriber::DescribeType( typeRegistry, *this, m_typeID, pTypeInstance, path, shouldSetPropertyStringValues );
     }
 
+    void TypeDescriptor::ApplyPropertyValues( TypeRegistry const& typeRegistry, IRegisteredType* pTypeInstance ) const
+    {
+        EE_ASSERT( pTypeInstance != nullptr && pTypeInstance->GetTypeID() == m_typeID );
+        SetPropertyValues( typeRegistry, pTypeInstance->GetTypeInfo(), pTypeInstance );
+    }
+
     PropertyDescriptor* TypeDescriptor::GetProperty( PropertyPath const& path )
     {
         for ( auto& prop : m_properties )
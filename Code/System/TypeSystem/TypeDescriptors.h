@@ -175,6 +175,9 @@ namespace EE::TypeSystem
             T* pCreatedType = CreateTypeInstanceInPlace<T>( typeRegistry, pTypeInfo, pTypeInstance );
         }
 
+        // Set the described property values on an existing type instance, all properties that are not described are left untouched
+        void ApplyPropertyValues( TypeRegistry const& typeRegistry, IRegisteredType* pTypeInstance ) const;
+
         // Properties
         //-------------------------------------------------------------------------
 
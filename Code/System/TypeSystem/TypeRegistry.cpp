@@ -4,6 +4,7 @@
 #include "EnumInfo.h"
 #include "TypeInfo.h"
 #include "System/Log.h"
+#include "System/Algorithm/Hash.h"
 #include "DefaultTypeInfos.h"
 #include "EASTL/sort.h"
 
@@ -238,6 +239,54 @@ namespace EE::TypeSystem
         return false;
     }
 
+    uint64_t TypeRegistry::CalculateTypeLayoutHash() const
+    {
+        // Individual hashes are summed so that the hash map iteration order doesnt matter
+        uint64_t layoutHash = 0;
+
+        for ( auto const& typeInfoPair : m_registeredTypes )
+        {
+            TypeInfo const* pTypeInfo = typeInfoPair.second;
+
+            TVector<uint64_t> typeData;
+            typeData.emplace_back( pTypeInfo->m_ID.GetID() );
+            typeData.emplace_back( (uint64_t) pTypeInfo->m_size );
+
+            for ( auto pParentTypeInfo : pTypeInfo->m_parentTypes )
+            {
+                typeData.emplace_back( pParentTypeInfo->m_ID.GetID() );
+            }
+
+            for ( auto const& propertyInfo : pTypeInfo->m_properties )
+            {
+                typeData.emplace_back( propertyInfo.m_ID.GetID() );
+                typeData.emplace_back( propertyInfo.m_typeID.GetID() );
+                typeData.emplace_back( propertyInfo.m_templateArgumentTypeID.GetID() );
+                typeData.emplace_back( ( uint64_t( (uint32_t) propertyInfo.m_offset ) << 32 ) | (uint32_t) propertyInfo.m_size );
+                typeData.emplace_back( ( uint64_t( (uint32_t) propertyInfo.m_arraySize ) << 32 ) | propertyInfo.m_flags.Get() );
+            }
+
+            layoutHash += Hash::XXHash::GetHash64( typeData.data(), typeData.size() * sizeof( uint64_t ) );
+        }
+
+        for ( auto const& enumInfoPair : m_registeredEnums )
+        {
+            EnumInfo const* pEnumInfo = enumInfoPair.second;
+
+            uint64_t constantsHash = 0;
+            for ( auto const& constantPair : pEnumInfo->m_constants )
+            {
+                uint64_t const constantData[2] = { constantPair.first.GetID(), (uint64_t) constantPair.second.m_value };
+                constantsHash += Hash::XXHash::GetHash64( constantData, sizeof( constantData ) );
+            }
+
+            uint64_t const enumData[3] = { pEnumInfo->m_ID.GetID(), (uint64_t) pEnumInfo->m_underlyingType, constantsHash };
+            layoutHash += Hash::XXHash::GetHash64( enumData, sizeof( enumData ) );
+        }
+
+        return layoutHash;
+    }
+
     //-------------------------------------------------------------------------
 
     EnumInfo const* TypeRegistry::RegisterEnum( EnumInfo const& type )
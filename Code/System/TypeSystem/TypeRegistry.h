@@ -4,6 +4,7 @@
 #include "TypeInfo.h"
 #include "CoreTypeIDs.h"
 #include "System/Systems.h"
+#include "System/Types/FlatHashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -67,6 +68,10 @@ namespace EE::TypeSystem
         // Are these two types in the same derivation chain (i.e. does either derive from the other )
         bool AreTypesInTheSameHierarchy( TypeInfo const* pTypeInfoA, TypeInfo const* pTypeInfoB ) const;
 
+        // Calculate a hash of the layouts of all registered types and enums, used to invalidate data that is derived from the reflected type info
+        // The result is independent of the registration order
+        uint64_t CalculateTypeLayoutHash() const;
+
         //-------------------------------------------------------------------------
         // Enums
         //-------------------------------------------------------------------------
@@ -88,7 +93,7 @@ namespace EE::TypeSystem
 
     private:
 
-        THashMap<TypeID, TypeInfo const*>       m_registeredTypes;
+        TFlatHashMap<TypeID, TypeInfo const*>   m_registeredTypes;
         THashMap<TypeID, EnumInfo*>             m_registeredEnums;
         THashMap<TypeID, ResourceInfo>          m_registeredResourceTypes;
     };
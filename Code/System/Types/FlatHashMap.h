@@ -0,0 +1,495 @@
+#pragma once
+
+#include "System/Memory/Memory.h"
+#include "System/Math/Math.h"
+#include <EASTL/functional.h>
+#include <EASTL/utility.h>
+#include <EASTL/iterator.h>
+#include <type_traits>
+#include <immintrin.h>
+
+//-------------------------------------------------------------------------
+// Flat Hash Map
+//-------------------------------------------------------------------------
+// An open-addressing hash map that stores all its entries in a single allocation, so inserting never allocates a node and lookups never chase pointers
+//
+// The control bytes are stored separately from the entries: each slot has one control byte that is either empty, deleted or 7 bits of the key's hash
+// Lookups compare a whole group of 16 control bytes against the hash with SSE2 and only compare the keys of the matching slots
+// Groups are probed along a triangular sequence which visits every group exactly once, the max load factor is 7/8
+//
+// The API matches the subset of THashMap we use so switching a table over is just a type change, with one difference:
+// Inserting can rehash and move the entries, so it invalidates all iterators and references into the map (erasing only invalidates the erased entry)
+//
+// Note: Most of our keys (StringID, ResourceID, TypeID) hash to themselves, so the hash is always mixed before use
+
+namespace EE
+{
+    template<typename K, typename V, typename Hash = eastl::hash<K>, typename Predicate = eastl::equal_to<K>>
+    class TFlatHashMap
+    {
+        constexpr static size_t const s_groupSize = 16;
+        constexpr static size_t const s_invalidSlotIdx = size_t( -1 );
+
+        // Full slots store the top 7 bits of the mixed hash, so only the empty and deleted control bytes have the high bit set
+        constexpr static int8_t const s_emptyControlByte = -128;
+        constexpr static int8_t const s_deletedControlByte = -2;
+
+    public:
+
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = eastl::pair<K const, V>;
+        using size_type = size_t;
+        using hasher = Hash;
+        using key_equal = Predicate;
+
+        //-------------------------------------------------------------------------
+
+        template<bool IsConst>
+        class TIterator
+        {
+            friend class TFlatHashMap;
+            template<bool> friend class TIterator;
+
+            using SlotPointer = std::conditional_t<IsConst, eastl::pair<K const, V> const*, eastl::pair<K const, V>*>;
+
+        public:
+
+            using iterator_category = eastl::forward_iterator_tag;
+            using value_type = eastl::pair<K const, V>;
+            using difference_type = ptrdiff_t;
+            using pointer = SlotPointer;
+            using reference = std::conditional_t<IsConst, value_type const&, value_type&>;
+
+        public:
+
+            TIterator() = default;
+
+            // Allow implicit conversion from mutable to const iterators
+            template<bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+            TIterator( TIterator<WasConst> const& rhs )
+                : m_pControlByte( rhs.m_pControlByte )
+                , m_pControlBytesEnd( rhs.m_pControlBytesEnd )
+                , m_pSlot( rhs.m_pSlot )
+            {}
+
+            inline reference operator*() const { return *m_pSlot; }
+            inline pointer operator->() const { return m_pSlot; }
+
+            inline TIterator& operator++() { ++m_pControlByte; ++m_pSlot; SkipFreeSlots(); return *this; }
+            inline TIterator operator++( int ) { TIterator iter( *this ); ++( *this ); return iter; }
+
+            template<bool C> inline bool operator==( TIterator<C> const& rhs ) const { return m_pSlot == rhs.m_pSlot; }
+            template<bool C> inline bool operator!=( TIterator<C> const& rhs ) const { return m_pSlot != rhs.m_pSlot; }
+
+        private:
+
+            TIterator( int8_t const* pControlByte, int8_t const* pControlBytesEnd, SlotPointer pSlot )
+                : m_pControlByte( pControlByte )
+                , m_pControlBytesEnd( pControlBytesEnd )
+                , m_pSlot( pSlot )
+            {}
+
+            // Move forward to the first full slot (or the end)
+            inline void SkipFreeSlots()
+            {
+                while ( m_pControlByte != m_pControlBytesEnd && *m_pControlByte < 0 )
+                {
+                    ++m_pControlByte;
+                    ++m_pSlot;
+                }
+            }
+
+        private:
+
+            int8_t const*                   m_pControlByte = nullptr;
+            int8_t const*                   m_pControlBytesEnd = nullptr;
+            SlotPointer                     m_pSlot = nullptr;
+        };
+
+        using iterator = TIterator<false>;
+        using const_iterator = TIterator<true>;
+
+    public:
+
+        TFlatHashMap() = default;
+
+        TFlatHashMap( TFlatHashMap const& rhs )
+        {
+            reserve( rhs.m_size );
+            for ( auto const& entry : rhs )
+            {
+                insert( entry );
+            }
+        }
+
+        TFlatHashMap( TFlatHashMap&& rhs )
+        {
+            swap( rhs );
+        }
+
+        ~TFlatHashMap()
+        {
+            DestroyEntries();
+            EE::Free( m_pSlots );
+        }
+
+        TFlatHashMap& operator=( TFlatHashMap const& rhs )
+        {
+            if ( this != &rhs )
+            {
+                TFlatHashMap copy( rhs );
+                swap( copy );
+            }
+            return *this;
+        }
+
+        TFlatHashMap& operator=( TFlatHashMap&& rhs )
+        {
+            swap( rhs );
+            return *this;
+        }
+
+        inline void swap( TFlatHashMap& rhs )
+        {
+            eastl::swap( m_pSlots, rhs.m_pSlots );
+            eastl::swap( m_pControlBytes, rhs.m_pControlBytes );
+            eastl::swap( m_capacity, rhs.m_capacity );
+            eastl::swap( m_size, rhs.m_size );
+            eastl::swap( m_growthLeft, rhs.m_growthLeft );
+        }
+
+        // Iteration
+        //-------------------------------------------------------------------------
+
+        inline iterator begin() { iterator iter = MakeIterator( 0 ); iter.SkipFreeSlots(); return iter; }
+        inline iterator end() { return MakeIterator( m_capacity ); }
+        inline const_iterator begin() const { const_iterator iter = MakeIterator( 0 ); iter.SkipFreeSlots(); return iter; }
+        inline const_iterator end() const { return MakeIterator( m_capacity ); }
+        inline const_iterator cbegin() const { return begin(); }
+        inline const_iterator cend() const { return end(); }
+
+        // Size
+        //-------------------------------------------------------------------------
+
+        inline bool empty() const { return m_size == 0; }
+        inline size_t size() const { return m_size; }
+        inline size_t capacity() const { return m_capacity; }
+
+        // Make sure we can hold the specified number of entries without rehashing
+        void reserve( size_t numEntries )
+        {
+            size_t newCapacity = s_groupSize;
+            while ( GetMaxLoad( newCapacity ) < numEntries )
+            {
+                newCapacity *= 2;
+            }
+
+            if ( newCapacity > m_capacity )
+            {
+                Rehash( newCapacity );
+            }
+        }
+
+        // Remove all entries, the allocated memory is kept
+        void clear()
+        {
+            if ( m_capacity == 0 )
+            {
+                return;
+            }
+
+            DestroyEntries();
+            memset( m_pControlBytes, s_emptyControlByte, m_capacity );
+            m_size = 0;
+            m_growthLeft = GetMaxLoad( m_capacity );
+        }
+
+        // Search
+        //-------------------------------------------------------------------------
+
+        inline iterator find( K const& key ) { return MakeIterator( FindSlot<K, Hash, Predicate>( key ) ); }
+        inline const_iterator find( K const& key ) const { return MakeIterator( FindSlot<K, Hash, Predicate>( key ) ); }
+
+        // Search using a different type than the key, the hash of the search value needs to match the hash of the equivalent key
+        template<typename U> inline iterator find_as( U const& value ) { return MakeIterator( FindSlot<U, eastl::hash<U>, eastl::equal_to_2<K, U>>( value ) ); }
+        template<typename U> inline const_iterator find_as( U const& value ) const { return MakeIterator( FindSlot<U, eastl::hash<U>, eastl::equal_to_2<K, U>>( value ) ); }
+
+        inline size_t count( K const& key ) const { return FindSlot<K, Hash, Predicate>( key ) != s_invalidSlotIdx ? 1 : 0; }
+
+        // Insertion
+        //-------------------------------------------------------------------------
+
+        // Insert an entry if no entry with the same key exists, accepts any pair type that is convertible to the value type (e.g. TPair<K, V>)
+        template<typename P>
+        eastl::pair<iterator, bool> insert( P&& entry )
+        {
+            auto const result = FindOrPrepareInsert( entry.first );
+            if ( result.second )
+            {
+                new ( &m_pSlots[result.first] ) value_type( eastl::forward<P>( entry ) );
+            }
+
+            return eastl::pair<iterator, bool>( MakeIterator( result.first ), result.second );
+        }
+
+        V& operator[]( K const& key )
+        {
+            auto const result = FindOrPrepareInsert( key );
+            if ( result.second )
+            {
+                new ( &m_pSlots[result.first] ) value_type( key, V() );
+            }
+
+            return m_pSlots[result.first].second;
+        }
+
+        V& operator[]( K&& key )
+        {
+            auto const result = FindOrPrepareInsert( key );
+            if ( result.second )
+            {
+                new ( &m_pSlots[result.first] ) value_type( eastl::move( key ), V() );
+            }
+
+            return m_pSlots[result.first].second;
+        }
+
+        // Erasure
+        //-------------------------------------------------------------------------
+
+        // Erase the entry and return an iterator to the next entry
+        iterator erase( const_iterator iter )
+        {
+            EE_ASSERT( iter != end() );
+            size_t const slotIdx = size_t( iter.m_pSlot - m_pSlots );
+            EraseSlot( slotIdx );
+
+            iterator nextIter = MakeIterator( slotIdx );
+            nextIter.SkipFreeSlots();
+            return nextIter;
+        }
+
+        size_t erase( K const& key )
+        {
+            size_t const slotIdx = FindSlot<K, Hash, Predicate>( key );
+            if ( slotIdx == s_invalidSlotIdx )
+            {
+                return 0;
+            }
+
+            EraseSlot( slotIdx );
+            return 1;
+        }
+
+    private:
+
+        EE_FORCE_INLINE static size_t GetMaxLoad( size_t capacity ) { return capacity - ( capacity / 8 ); }
+
+        EE_FORCE_INLINE static uint64_t MixHash( size_t hash ) { return uint64_t( hash ) * 0x9E3779B97F4A7C15ull; }
+        EE_FORCE_INLINE static int8_t GetControlByte( uint64_t mixedHash ) { return int8_t( mixedHash >> 57 ); }
+        EE_FORCE_INLINE size_t GetFirstGroupIdx( uint64_t mixedHash ) const { return size_t( mixedHash ^ ( mixedHash >> 32 ) ) & ( ( m_capacity / s_groupSize ) - 1 ); }
+
+        EE_FORCE_INLINE static uint32_t MatchGroup( int8_t const* pGroup, int8_t controlByte )
+        {
+            __m128i const group = _mm_load_si128( reinterpret_cast<__m128i const*>( pGroup ) );
+            return (uint32_t) _mm_movemask_epi8( _mm_cmpeq_epi8( group, _mm_set1_epi8( controlByte ) ) );
+        }
+
+        EE_FORCE_INLINE static uint32_t MatchFreeSlots( int8_t const* pGroup )
+        {
+            __m128i const group = _mm_load_si128( reinterpret_cast<__m128i const*>( pGroup ) );
+            return (uint32_t) _mm_movemask_epi8( group );
+        }
+
+        inline iterator MakeIterator( size_t slotIdx )
+        {
+            slotIdx = ( slotIdx == s_invalidSlotIdx ) ? m_capacity : slotIdx;
+            return iterator( m_pControlBytes + slotIdx, m_pControlBytes + m_capacity, m_pSlots + slotIdx );
+        }
+
+        inline const_iterator MakeIterator( size_t slotIdx ) const
+        {
+            slotIdx = ( slotIdx == s_invalidSlotIdx ) ? m_capacity : slotIdx;
+            return const_iterator( m_pControlBytes + slotIdx, m_pControlBytes + m_capacity, m_pSlots + slotIdx );
+        }
+
+        //-------------------------------------------------------------------------
+
+        template<typename U, typename UHash, typename UPredicate>
+        size_t FindSlot( U const& key ) const
+        {
+            if ( m_size == 0 )
+            {
+                return s_invalidSlotIdx;
+            }
+
+            uint64_t const mixedHash = MixHash( UHash()( key ) );
+            int8_t const controlByte = GetControlByte( mixedHash );
+            size_t const groupMask = ( m_capacity / s_groupSize ) - 1;
+            size_t groupIdx = GetFirstGroupIdx( mixedHash );
+
+            for ( size_t probeStep = 1; ; probeStep++ )
+            {
+                int8_t const* pGroup = m_pControlBytes + ( groupIdx * s_groupSize );
+
+                uint32_t matches = MatchGroup( pGroup, controlByte );
+                while ( matches != 0 )
+                {
+                    size_t const slotIdx = ( groupIdx * s_groupSize ) + Math::GetLowestSetBitIdx( matches );
+                    if ( UPredicate()( m_pSlots[slotIdx].first, key ) )
+                    {
+                        return slotIdx;
+                    }
+
+                    matches &= matches - 1;
+                }
+
+                // An empty slot in the group means the key was never inserted past this group
+                if ( MatchGroup( pGroup, s_emptyControlByte ) != 0 )
+                {
+                    return s_invalidSlotIdx;
+                }
+
+                EE_ASSERT( probeStep <= groupMask );
+                groupIdx = ( groupIdx + probeStep ) & groupMask;
+            }
+        }
+
+        // Find the first empty or deleted slot along the probe sequence for the hash, there is always at least one empty slot
+        size_t FindFreeSlot( uint64_t mixedHash ) const
+        {
+            size_t const groupMask = ( m_capacity / s_groupSize ) - 1;
+            size_t groupIdx = GetFirstGroupIdx( mixedHash );
+
+            for ( size_t probeStep = 1; ; probeStep++ )
+            {
+                int8_t const* pGroup = m_pControlBytes + ( groupIdx * s_groupSize );
+                uint32_t const freeSlots = MatchFreeSlots( pGroup );
+                if ( freeSlots != 0 )
+                {
+                    return ( groupIdx * s_groupSize ) + Math::GetLowestSetBitIdx( freeSlots );
+                }
+
+                EE_ASSERT( probeStep <= groupMask );
+                groupIdx = ( groupIdx + probeStep ) & groupMask;
+            }
+        }
+
+        // Find the slot for the key, if the key doesnt exist, reserve a slot for it and return true. The reserved slot still needs to be constructed!
+        eastl::pair<size_t, bool> FindOrPrepareInsert( K const& key )
+        {
+            size_t const existingSlotIdx = FindSlot<K, Hash, Predicate>( key );
+            if ( existingSlotIdx != s_invalidSlotIdx )
+            {
+                return eastl::pair<size_t, bool>( existingSlotIdx, false );
+            }
+
+            //-------------------------------------------------------------------------
+
+            if ( m_capacity == 0 )
+            {
+                Rehash( s_groupSize );
+            }
+
+            uint64_t const mixedHash = MixHash( Hash()( key ) );
+            size_t slotIdx = FindFreeSlot( mixedHash );
+
+            // Deleted slots can always be reused, empty slots can only be used while we are under the max load
+            if ( m_growthLeft == 0 && m_pControlBytes[slotIdx] == s_emptyControlByte )
+            {
+                // If most of the used slots are deleted entries, rehashing in place is enough
+                bool const shouldGrow = m_size >= ( GetMaxLoad( m_capacity ) / 2 );
+                Rehash( shouldGrow ? m_capacity * 2 : m_capacity );
+                slotIdx = FindFreeSlot( mixedHash );
+            }
+
+            if ( m_pControlBytes[slotIdx] == s_emptyControlByte )
+            {
+                m_growthLeft--;
+            }
+
+            m_pControlBytes[slotIdx] = GetControlByte( mixedHash );
+            m_size++;
+            return eastl::pair<size_t, bool>( slotIdx, true );
+        }
+
+        void EraseSlot( size_t slotIdx )
+        {
+            EE_ASSERT( slotIdx < m_capacity && m_pControlBytes[slotIdx] >= 0 );
+            m_pSlots[slotIdx].~value_type();
+            m_size--;
+
+            // If the group has an empty slot, it has never been full since the last rehash so no probe sequence continues past it and we can mark the slot as empty
+            int8_t const* pGroup = m_pControlBytes + ( slotIdx & ~( s_groupSize - 1 ) );
+            if ( MatchGroup( pGroup, s_emptyControlByte ) != 0 )
+            {
+                m_pControlBytes[slotIdx] = s_emptyControlByte;
+                m_growthLeft++;
+            }
+            else
+            {
+                m_pControlBytes[slotIdx] = s_deletedControlByte;
+            }
+        }
+
+        void DestroyEntries()
+        {
+            if constexpr ( !std::is_trivially_destructible_v<value_type> )
+            {
+                for ( size_t i = 0; i < m_capacity; i++ )
+                {
+                    if ( m_pControlBytes[i] >= 0 )
+                    {
+                        m_pSlots[i].~value_type();
+                    }
+                }
+            }
+        }
+
+        // Move all entries to a new allocation of the specified capacity, this also clears all deleted slots
+        void Rehash( size_t newCapacity )
+        {
+            EE_ASSERT( newCapacity >= s_groupSize && ( newCapacity & ( newCapacity - 1 ) ) == 0 );
+            EE_ASSERT( GetMaxLoad( newCapacity ) >= m_size );
+
+            value_type* pOldSlots = m_pSlots;
+            int8_t* pOldControlBytes = m_pControlBytes;
+            size_t const oldCapacity = m_capacity;
+
+            // The slots and control bytes share an allocation, the slot array size is a multiple of the group size so the control bytes stay 16 byte aligned
+            size_t const slotArraySize = sizeof( value_type ) * newCapacity;
+            m_pSlots = (value_type*) EE::Alloc( slotArraySize + newCapacity, eastl::max( alignof( value_type ), s_groupSize ) );
+            m_pControlBytes = reinterpret_cast<int8_t*>( m_pSlots ) + slotArraySize;
+            m_capacity = newCapacity;
+            memset( m_pControlBytes, s_emptyControlByte, newCapacity );
+
+            // Move the entries
+            for ( size_t i = 0; i < oldCapacity; i++ )
+            {
+                if ( pOldControlBytes[i] < 0 )
+                {
+                    continue;
+                }
+
+                value_type& oldEntry = pOldSlots[i];
+                uint64_t const mixedHash = MixHash( Hash()( oldEntry.first ) );
+                size_t const slotIdx = FindFreeSlot( mixedHash );
+                m_pControlBytes[slotIdx] = GetControlByte( mixedHash );
+                new ( &m_pSlots[slotIdx] ) value_type( eastl::move( const_cast<K&>( oldEntry.first ) ), eastl::move( oldEntry.second ) );
+                oldEntry.~value_type();
+            }
+
+            m_growthLeft = GetMaxLoad( newCapacity ) - m_size;
+            EE::Free( pOldSlots );
+        }
+
+    private:
+
+        value_type*                         m_pSlots = nullptr;
+        int8_t*                             m_pControlBytes = nullptr;
+        size_t                              m_capacity = 0; // Either zero or a power of 2 multiple of the group size
+        size_t                              m_size = 0;
+        size_t                              m_growthLeft = 0; // How many more empty slots can be filled before we hit the max load, reused deleted slots dont count
+    };
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "Arrays.h"
 #include "HashMap.h"
+#include "FlatHashMap.h"
 
 //-------------------------------------------------------------------------
 // ID Vector
@@ -166,6 +167,6 @@ namespace EE
     private:
 
         TVector<ItemType>                   m_vector;
-        THashMap<IDType, int32_t>           m_indexMap; // A mapping between the ID type and the item index in the flat array
+        TFlatHashMap<IDType, int32_t>       m_indexMap; // A mapping between the ID type and the item index in the flat array
     };
 }
\ No newline at end of file